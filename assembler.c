@@ -0,0 +1,1516 @@
+// In-process x86-64 assembler.
+//
+// Turns the AT&T assembly the generator writes into machine code, so that
+// ./main -c can write an object file (elf.c) without running `as`. It only
+// knows the instructions and directives generator.c emits: mov, push, pop,
+// the two-operand ALU instructions, imul, idiv, shifts, setcc, jcc, jmp,
+// call, ret and syscall, with register, immediate, base+index*scale+disp and
+// sym+offset(%rip) operands, plus cpuid, xgetbv and the SSE2 and AVX2
+// integer instructions of vectorized loops (vectorize.c), .comm for .bss,
+// .p2align, and the movslq, jmp *%reg and .long label-label of switch jump
+// tables (switch.c).
+//
+// Instructions are encoded as they are parsed into one byte buffer. Jumps
+// are kept aside, since their size depends on how far they go: they all start
+// out in their 2-byte short form and are widened to rel32 until every
+// displacement fits, then spliced back into the buffer. .p2align padding is
+// kept aside with them, as its size depends on where it lands. Calls, and
+// jumps to symbols outside the file, always use rel32 with a relocation. So
+// do sym(%rip) operands, but those, calls to functions here that aren't
+// .globl and .long differences between labels here are filled in by the
+// assembler once the layout is known.
+#define _GNU_SOURCE
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+#define ASM_MAX_OPERANDS 3
+#define ASM_NO_REGISTER -1
+// Base register of sym(%rip) operands
+#define ASM_RIP_REGISTER 16
+
+enum {
+    ASM_OPERAND_REGISTER,
+    ASM_OPERAND_IMMEDIATE,
+    ASM_OPERAND_MEMORY,
+    ASM_OPERAND_SYMBOL
+};
+
+struct asm_operand {
+    int kind;
+    // Register number 0-15 and size in bytes, for ASM_OPERAND_REGISTER;
+    // xmm registers are 16 bytes and ymm registers 32
+    int reg;
+    int size;
+    long long value;
+    // ASM_OPERAND_MEMORY: disp(base, index, scale)
+    int base;
+    int index;
+    int scale;
+    long long disp;
+    // ASM_OPERAND_SYMBOL, and ASM_OPERAND_MEMORY sym(%rip) or -1: index
+    // into the symbol table
+    int symbol;
+    // Written with a * in front, the target of an indirect jmp
+    bool indirect;
+};
+
+// A jump, waiting for its final size
+struct asm_branch {
+    // Offset in the buffer of fixed-size code it goes in front of
+    size_t position;
+    int symbol;
+    // -1 for jmp, otherwise the condition code of a jcc
+    int condition;
+    bool near;
+    // Not a branch but .p2align padding to a multiple of align bytes,
+    // whose size also depends on where it ends up
+    int align;
+};
+
+struct asm_label_position {
+    size_t position;
+    // Number of branches in front of it
+    int branches;
+};
+
+// A .long plus - minus, waiting for the final offsets of both
+struct asm_difference {
+    size_t position;
+    int branches;
+    int plus;
+    int minus;
+};
+
+struct assembler {
+    unsigned char* code;
+    size_t code_size;
+    size_t code_capacity;
+    struct asm_branch* branches;
+    int branch_count;
+    int branch_capacity;
+    struct asm_label_position* labels;
+    struct asm_difference* differences;
+    int difference_count;
+    int difference_capacity;
+    // Number of branches in front of each relocation
+    int* relocation_branches;
+    struct asm_object* object;
+    // Symbol name -> index + 1, open addressing
+    int* symbol_slots;
+    int symbol_slot_count;
+    // The sym(%rip) relocation of the instruction being assembled, whose
+    // addend depends on how many bytes follow it, or -1
+    int rip_relocation;
+    int line;
+    char* error;
+    size_t error_size;
+    bool failed;
+};
+
+static const char* register_names_64[16] = {
+    "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+};
+
+static const char* register_names_8[16] = {
+    "al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+    "r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b"
+};
+
+static const char* condition_names[] = {
+    "o", "no", "b", "ae", "e", "ne", "be", "a",
+    "s", "ns", "p", "np", "l", "ge", "le", "g"
+};
+
+static const struct {
+    const char* name;
+    int condition;
+} condition_aliases[] = {
+    { "z", 4 }, { "nz", 5 }, { "c", 2 }, { "nc", 3 }, { "nae", 2 }, { "nb", 3 },
+    { "na", 6 }, { "nbe", 7 }, { "nge", 12 }, { "nl", 13 }, { "ng", 14 }, { "nle", 15 },
+    { "pe", 10 }, { "po", 11 }
+};
+
+// Two-operand ALU instructions: the /digit of their immediate form, and
+// their register-to-memory opcode (the memory-to-register opcode is +2)
+static const struct {
+    const char* name;
+    int digit;
+    unsigned char opcode;
+} alu_instructions[] = {
+    { "addq", 0, 0x01 }, { "orq", 1, 0x09 }, { "andq", 4, 0x21 },
+    { "subq", 5, 0x29 }, { "xorq", 6, 0x31 }, { "cmpq", 7, 0x39 }
+};
+
+// One-operand instructions on r/m64: opcode and /digit
+static const struct {
+    const char* name;
+    unsigned char opcode;
+    int digit;
+} unary_instructions[] = {
+    { "incq", 0xFF, 0 }, { "decq", 0xFF, 1 }, { "notq", 0xF7, 2 }, { "negq", 0xF7, 3 },
+    { "mulq", 0xF7, 4 }, { "imulq", 0xF7, 5 }, { "divq", 0xF7, 6 }, { "idivq", 0xF7, 7 }
+};
+
+static const struct {
+    const char* name;
+    int digit;
+} shift_instructions[] = {
+    { "rolq", 0 }, { "rorq", 1 }, { "salq", 4 }, { "shlq", 4 }, { "shrq", 5 }, { "sarq", 7 }
+};
+
+// Packed integer instructions, 66 0F opcode on xmm registers (SSE2), and
+// the same opcode with a v in front and three operands on VEX (AVX2)
+static const struct {
+    const char* name;
+    unsigned char opcode;
+} packed_instructions[] = {
+    { "paddq", 0xD4 }, { "psubq", 0xFB }, { "pand", 0xDB }, { "por", 0xEB }, { "pxor", 0xEF },
+    { "punpcklqdq", 0x6C }
+};
+
+static bool assembler_fail(struct assembler* as, const char* message, ...)
+{
+    if (as->failed) {
+        return false;
+    }
+    as->failed = true;
+    int written = snprintf(as->error, as->error_size, "line %d of the generated assembly: ", as->line);
+    if (written < 0 || (size_t) written >= as->error_size) {
+        return false;
+    }
+    va_list args;
+    va_start(args, message);
+    vsnprintf(as->error + written, as->error_size - written, message, args);
+    va_end(args);
+    return false;
+}
+
+static unsigned long long symbol_name_hash(const char* name, size_t length)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static void symbol_slots_grow(struct assembler* as)
+{
+    int count = as->symbol_slot_count ? as->symbol_slot_count * 2 : 1024;
+    int* slots = calloc(count, sizeof(int));
+    for (int i = 0; i < as->object->symbol_count; i++) {
+        const char* name = as->object->symbols[i].name;
+        size_t slot = symbol_name_hash(name, strlen(name)) & (count - 1);
+        while (slots[slot]) {
+            slot = (slot + 1) & (count - 1);
+        }
+        slots[slot] = i + 1;
+    }
+    free(as->symbol_slots);
+    as->symbol_slots = slots;
+    as->symbol_slot_count = count;
+}
+
+// Index of the symbol called name[0..length), added undefined if it's new
+static int assembler_symbol(struct assembler* as, const char* name, size_t length)
+{
+    struct asm_object* object = as->object;
+    if (object->symbol_count * 2 >= as->symbol_slot_count) {
+        symbol_slots_grow(as);
+    }
+    size_t slot = symbol_name_hash(name, length) & (as->symbol_slot_count - 1);
+    while (as->symbol_slots[slot]) {
+        int index = as->symbol_slots[slot] - 1;
+        const char* existing = object->symbols[index].name;
+        if (strncmp(existing, name, length) == 0 && existing[length] == 0) {
+            return index;
+        }
+        slot = (slot + 1) & (as->symbol_slot_count - 1);
+    }
+
+    if (object->symbol_count == object->symbol_capacity) {
+        object->symbol_capacity = object->symbol_capacity ? object->symbol_capacity * 2 : 64;
+        object->symbols = realloc(object->symbols, object->symbol_capacity * sizeof(struct asm_symbol));
+        as->labels = realloc(as->labels, object->symbol_capacity * sizeof(struct asm_label_position));
+    }
+    int index = object->symbol_count++;
+    struct asm_symbol* symbol = &object->symbols[index];
+    memset(symbol, 0, sizeof(*symbol));
+    symbol->name = strndup(name, length);
+    // .L labels are assembler-local and never make it to the symbol table
+    symbol->local_label = length >= 2 && name[0] == '.' && name[1] == 'L';
+    as->symbol_slots[slot] = index + 1;
+    return index;
+}
+
+static void emit_byte(struct assembler* as, unsigned char byte)
+{
+    if (as->code_size == as->code_capacity) {
+        as->code_capacity = as->code_capacity ? as->code_capacity * 2 : 65536;
+        as->code = realloc(as->code, as->code_capacity);
+    }
+    as->code[as->code_size++] = byte;
+}
+
+static void emit_value(struct assembler* as, long long value, int size)
+{
+    for (int i = 0; i < size; i++) {
+        emit_byte(as, (unsigned char) (value >> (8 * i)));
+    }
+}
+
+static bool fits_int8(long long value)
+{
+    return value >= -128 && value <= 127;
+}
+
+static bool fits_int32(long long value)
+{
+    return value >= -2147483648LL && value <= 2147483647LL;
+}
+
+// Byte registers 4-7 mean spl/bpl/sil/dil only with a REX prefix, and
+// ah/ch/dh/bh without one
+static bool needs_rex_for_byte(struct asm_operand* operand)
+{
+    return operand && operand->kind == ASM_OPERAND_REGISTER && operand->size == 1 &&
+           operand->reg >= 4 && operand->reg <= 7;
+}
+
+static void emit_relocation(struct assembler* as, int symbol, int type, long long addend);
+
+// Emits ModRM [SIB] [disp] for ModRM.reg reg and the r/m operand rm
+static void emit_modrm(struct assembler* as, int reg, struct asm_operand* rm)
+{
+    if (rm->kind == ASM_OPERAND_REGISTER) {
+        emit_byte(as, 0xC0 | ((reg & 7) << 3) | (rm->reg & 7));
+        return;
+    }
+
+    if (rm->base == ASM_RIP_REGISTER) {
+        emit_byte(as, 0x05 | ((reg & 7) << 3));
+        if (rm->symbol >= 0) {
+            // The addend is fixed up once the instruction is complete
+            as->rip_relocation = as->object->relocation_count;
+            emit_relocation(as, rm->symbol, ASM_RELOCATION_PC32, rm->disp);
+            emit_value(as, 0, 4);
+        } else {
+            emit_value(as, rm->disp, 4);
+        }
+        return;
+    }
+
+    if (rm->base == ASM_NO_REGISTER) {
+        // Absolute disp32, which needs a SIB byte in 64-bit mode
+        int index = rm->index == ASM_NO_REGISTER ? 4 : rm->index & 7;
+        int scale = rm->index == ASM_NO_REGISTER ? 0 : __builtin_ctz(rm->scale);
+        emit_byte(as, 0x04 | ((reg & 7) << 3));
+        emit_byte(as, (scale << 6) | (index << 3) | 5);
+        emit_value(as, rm->disp, 4);
+        return;
+    }
+
+    // rbp and r13 as a base always need a displacement
+    int mod;
+    if (rm->disp == 0 && (rm->base & 7) != 5) {
+        mod = 0;
+    } else if (fits_int8(rm->disp)) {
+        mod = 1;
+    } else {
+        mod = 2;
+    }
+    // rsp and r12 as a base always need a SIB byte
+    if (rm->index != ASM_NO_REGISTER || (rm->base & 7) == 4) {
+        int index = rm->index == ASM_NO_REGISTER ? 4 : rm->index & 7;
+        int scale = rm->index == ASM_NO_REGISTER ? 0 : __builtin_ctz(rm->scale);
+        emit_byte(as, (mod << 6) | ((reg & 7) << 3) | 4);
+        emit_byte(as, (scale << 6) | (index << 3) | (rm->base & 7));
+    } else {
+        emit_byte(as, (mod << 6) | ((reg & 7) << 3) | (rm->base & 7));
+    }
+    if (mod == 1) {
+        emit_value(as, rm->disp, 1);
+    } else if (mod == 2) {
+        emit_value(as, rm->disp, 4);
+    }
+}
+
+// The REX.X and REX.B bits rm needs
+static int rm_extension(struct asm_operand* rm)
+{
+    if (rm->kind == ASM_OPERAND_REGISTER) {
+        return rm->reg & 8 ? 0x01 : 0;
+    }
+    int bits = 0;
+    if (rm->index != ASM_NO_REGISTER && (rm->index & 8)) {
+        bits |= 0x02;
+    }
+    if (rm->base != ASM_NO_REGISTER && rm->base != ASM_RIP_REGISTER && (rm->base & 8)) {
+        bits |= 0x01;
+    }
+    return bits;
+}
+
+// Emits [REX] opcode ModRM [SIB] [disp] for an instruction whose ModRM.reg is
+// reg (a register number or a /digit) and whose r/m operand is rm.
+// reg_operand is the register behind reg, if any, to get its REX bits right
+static void emit_modrm_instruction(struct assembler* as, bool wide, const unsigned char* opcode, int opcode_size,
+                                   int reg, struct asm_operand* reg_operand, struct asm_operand* rm)
+{
+    int rex = (wide ? 0x48 : 0x40) | rm_extension(rm);
+    if (reg & 8) {
+        rex |= 0x04;
+    }
+    if (rex != 0x40 || needs_rex_for_byte(reg_operand) || needs_rex_for_byte(rm)) {
+        emit_byte(as, rex);
+    }
+    for (int i = 0; i < opcode_size; i++) {
+        emit_byte(as, opcode[i]);
+    }
+    emit_modrm(as, reg, rm);
+}
+
+// SSE instructions: a mandatory 66 or F3 prefix, which goes before REX, then
+// 0F opcode
+static void emit_sse_instruction(struct assembler* as, unsigned char prefix, bool wide, unsigned char opcode,
+                                 int reg, struct asm_operand* rm)
+{
+    unsigned char bytes[2] = { 0x0F, opcode };
+    emit_byte(as, prefix);
+    emit_modrm_instruction(as, wide, bytes, 2, reg, NULL, rm);
+}
+
+// VEX-encoded instructions. prefix is the implied 66/F3 (pp = 1/2), map the
+// opcode map (1 = 0F, 2 = 0F38) and source the register in VEX.vvvv, or 0
+// when there's none. The 2-byte form covers map 0F without W, X or B
+static void emit_vex_instruction(struct assembler* as, int prefix, int map, bool wide, bool wide_vector,
+                                 unsigned char opcode, int reg, int source, struct asm_operand* rm)
+{
+    int extension = rm_extension(rm);
+    int tail = (wide ? 0x80 : 0) | ((~source & 15) << 3) | (wide_vector ? 0x04 : 0) | prefix;
+    if (map == 1 && !wide && !extension) {
+        emit_byte(as, 0xC5);
+        emit_byte(as, (reg & 8 ? 0 : 0x80) | (tail & 0x7F));
+    } else {
+        emit_byte(as, 0xC4);
+        emit_byte(as, (reg & 8 ? 0 : 0x80) | (extension & 2 ? 0 : 0x40) | (extension & 1 ? 0 : 0x20) | map);
+        emit_byte(as, tail);
+    }
+    emit_byte(as, opcode);
+    emit_modrm(as, reg, rm);
+}
+
+static void emit_opcode_instruction(struct assembler* as, bool wide, unsigned char opcode,
+                                    int reg, struct asm_operand* reg_operand, struct asm_operand* rm)
+{
+    emit_modrm_instruction(as, wide, &opcode, 1, reg, reg_operand, rm);
+}
+
+// A relocation at position in the fixed code, with branches branches in
+// front of it; assembler_layout moves it to its final offset
+static void add_relocation(struct assembler* as, size_t position, int branches, int symbol, int type, long long addend)
+{
+    struct asm_object* object = as->object;
+    if (object->relocation_count == object->relocation_capacity) {
+        object->relocation_capacity = object->relocation_capacity ? object->relocation_capacity * 2 : 64;
+        object->relocations = realloc(object->relocations, object->relocation_capacity * sizeof(struct asm_relocation));
+        as->relocation_branches = realloc(as->relocation_branches, object->relocation_capacity * sizeof(int));
+    }
+    struct asm_relocation* relocation = &object->relocations[object->relocation_count];
+    relocation->offset = position;
+    relocation->symbol = symbol;
+    relocation->type = type;
+    relocation->addend = addend;
+    as->relocation_branches[object->relocation_count] = branches;
+    object->relocation_count++;
+}
+
+static void emit_relocation(struct assembler* as, int symbol, int type, long long addend)
+{
+    add_relocation(as, as->code_size, as->branch_count, symbol, type, addend);
+}
+
+static void add_branch(struct assembler* as, int symbol, int condition)
+{
+    if (as->branch_count == as->branch_capacity) {
+        as->branch_capacity = as->branch_capacity ? as->branch_capacity * 2 : 1024;
+        as->branches = realloc(as->branches, as->branch_capacity * sizeof(struct asm_branch));
+    }
+    struct asm_branch* branch = &as->branches[as->branch_count++];
+    branch->position = as->code_size;
+    branch->symbol = symbol;
+    branch->condition = condition;
+    branch->near = false;
+    branch->align = 0;
+}
+
+static void add_padding(struct assembler* as, int align)
+{
+    add_branch(as, -1, -1);
+    as->branches[as->branch_count - 1].align = align;
+}
+
+static int find_register(const char* name, size_t length, int* size)
+{
+    if (length == 3 && strncmp(name, "rip", 3) == 0) {
+        *size = 8;
+        return ASM_RIP_REGISTER;
+    }
+    // xmm0-15 and ymm0-15
+    if ((length == 4 || length == 5) && (name[0] == 'x' || name[0] == 'y') && strncmp(name + 1, "mm", 2) == 0 &&
+        isdigit((unsigned char) name[3]) && (length == 4 || isdigit((unsigned char) name[4]))) {
+        int reg = length == 4 ? name[3] - '0' : (name[3] - '0') * 10 + name[4] - '0';
+        if (reg < 16 && (length == 4 || name[3] != '0')) {
+            *size = name[0] == 'x' ? 16 : 32;
+            return reg;
+        }
+        return ASM_NO_REGISTER;
+    }
+    for (int i = 0; i < 16; i++) {
+        if (strlen(register_names_64[i]) == length && strncmp(register_names_64[i], name, length) == 0) {
+            *size = 8;
+            return i;
+        }
+        if (strlen(register_names_8[i]) == length && strncmp(register_names_8[i], name, length) == 0) {
+            *size = 1;
+            return i;
+        }
+    }
+    return ASM_NO_REGISTER;
+}
+
+static const char* skip_blanks(const char* text, const char* end)
+{
+    while (text < end && (*text == ' ' || *text == '\t')) {
+        text++;
+    }
+    return text;
+}
+
+static bool parse_number(const char* text, const char* end, long long* value)
+{
+    char buffer[64];
+    size_t length = end - text;
+    if (length == 0 || length >= sizeof(buffer)) {
+        return false;
+    }
+    memcpy(buffer, text, length);
+    buffer[length] = 0;
+    char* stop;
+    // Unsigned, so 64-bit constants up to 2^64-1 wrap like they do in `as`
+    if (buffer[0] == '-') {
+        *value = -(long long) strtoull(buffer + 1, &stop, 0);
+    } else {
+        *value = (long long) strtoull(buffer, &stop, 0);
+    }
+    return *stop == 0;
+}
+
+static bool parse_register(struct assembler* as, const char* text, const char* end, int* reg, int* size)
+{
+    text = skip_blanks(text, end);
+    while (end > text && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+    if (text >= end || *text != '%') {
+        return assembler_fail(as, "expected a register\n");
+    }
+    *reg = find_register(text + 1, end - text - 1, size);
+    if (*reg == ASM_NO_REGISTER) {
+        return assembler_fail(as, "unknown register %.*s\n", (int) (end - text), text);
+    }
+    return true;
+}
+
+static bool parse_operand(struct assembler* as, const char* text, const char* end, struct asm_operand* operand)
+{
+    text = skip_blanks(text, end);
+    while (end > text && (end[-1] == ' ' || end[-1] == '\t')) {
+        end--;
+    }
+    memset(operand, 0, sizeof(*operand));
+    operand->base = ASM_NO_REGISTER;
+    operand->index = ASM_NO_REGISTER;
+    if (text < end && *text == '*') {
+        operand->indirect = true;
+        text = skip_blanks(text + 1, end);
+    }
+    if (text >= end) {
+        return assembler_fail(as, "missing operand\n");
+    }
+
+    if (*text == '%') {
+        operand->kind = ASM_OPERAND_REGISTER;
+        if (!parse_register(as, text, end, &operand->reg, &operand->size)) {
+            return false;
+        }
+        if (operand->reg == ASM_RIP_REGISTER) {
+            return assembler_fail(as, "%%rip can only be a base\n");
+        }
+        return true;
+    }
+    if (*text == '$') {
+        operand->kind = ASM_OPERAND_IMMEDIATE;
+        if (!parse_number(text + 1, end, &operand->value)) {
+            return assembler_fail(as, "unsupported immediate %.*s\n", (int) (end - text), text);
+        }
+        return true;
+    }
+
+    const char* open = memchr(text, '(', end - text);
+    if (!open) {
+        if (isdigit((unsigned char) *text) || *text == '-') {
+            return assembler_fail(as, "unsupported operand %.*s\n", (int) (end - text), text);
+        }
+        operand->kind = ASM_OPERAND_SYMBOL;
+        operand->symbol = assembler_symbol(as, text, end - text);
+        return true;
+    }
+
+    // disp(base, index, scale), or sym(%rip)
+    operand->kind = ASM_OPERAND_MEMORY;
+    operand->scale = 1;
+    operand->symbol = -1;
+    if (end[-1] != ')') {
+        return assembler_fail(as, "missing )\n");
+    }
+    const char* parts[3];
+    const char* part_ends[3];
+    int part_count = 0;
+    const char* part = open + 1;
+    for (const char* c = part; c <= end - 1 && part_count < 3; c++) {
+        if (c == end - 1 || *c == ',') {
+            parts[part_count] = part;
+            part_ends[part_count] = c;
+            part_count++;
+            part = c + 1;
+        }
+    }
+    int size;
+    if (skip_blanks(parts[0], part_ends[0]) < part_ends[0]) {
+        if (!parse_register(as, parts[0], part_ends[0], &operand->base, &size)) {
+            return false;
+        }
+        if (size != 8) {
+            return assembler_fail(as, "addresses take 64-bit registers\n");
+        }
+    }
+    if (part_count > 1) {
+        if (!parse_register(as, parts[1], part_ends[1], &operand->index, &size)) {
+            return false;
+        }
+        if (size != 8) {
+            return assembler_fail(as, "addresses take 64-bit registers\n");
+        }
+        if (operand->index == 4) {
+            return assembler_fail(as, "%%rsp can't be an index\n");
+        }
+    }
+    if (part_count > 2) {
+        long long scale;
+        const char* scale_text = skip_blanks(parts[2], part_ends[2]);
+        if (!parse_number(scale_text, part_ends[2], &scale) || (scale != 1 && scale != 2 && scale != 4 && scale != 8)) {
+            return assembler_fail(as, "bad scale\n");
+        }
+        operand->scale = scale;
+    }
+    if (operand->base == ASM_RIP_REGISTER && part_count == 1 && open > text && !isdigit((unsigned char) *text) && *text != '-') {
+        // sym+offset(%rip)
+        const char* plus = memchr(text, '+', open - text);
+        if (plus && (!parse_number(plus + 1, open, &operand->disp) || !fits_int32(operand->disp))) {
+            return assembler_fail(as, "unsupported displacement %.*s\n", (int) (open - plus - 1), plus + 1);
+        }
+        operand->symbol = assembler_symbol(as, text, (plus ? plus : open) - text);
+        return true;
+    }
+    if (operand->index == ASM_RIP_REGISTER || (operand->base == ASM_RIP_REGISTER && part_count > 1)) {
+        return assembler_fail(as, "%%rip can't be indexed\n");
+    }
+    if (open > text && !parse_number(text, open, &operand->disp)) {
+        return assembler_fail(as, "unsupported displacement %.*s\n", (int) (open - text), text);
+    }
+    if (!fits_int32(operand->disp)) {
+        return assembler_fail(as, "displacement %lld out of range\n", operand->disp);
+    }
+    return true;
+}
+
+// Splits the operands at the commas that aren't inside parentheses
+static int parse_operands(struct assembler* as, const char* text, const char* end, struct asm_operand* operands)
+{
+    text = skip_blanks(text, end);
+    if (text >= end) {
+        return 0;
+    }
+    int count = 0;
+    int depth = 0;
+    const char* start = text;
+    for (const char* c = text; c <= end; c++) {
+        if (c < end && *c == '(') {
+            depth++;
+        } else if (c < end && *c == ')') {
+            depth--;
+        } else if (c == end || (*c == ',' && depth == 0)) {
+            if (count == ASM_MAX_OPERANDS) {
+                assembler_fail(as, "too many operands\n");
+                return -1;
+            }
+            if (!parse_operand(as, start, c, &operands[count])) {
+                return -1;
+            }
+            count++;
+            start = c + 1;
+        }
+    }
+    return count;
+}
+
+static int find_condition(const char* suffix)
+{
+    for (int i = 0; i < 16; i++) {
+        if (strcmp(suffix, condition_names[i]) == 0) {
+            return i;
+        }
+    }
+    for (size_t i = 0; i < sizeof(condition_aliases) / sizeof(condition_aliases[0]); i++) {
+        if (strcmp(suffix, condition_aliases[i].name) == 0) {
+            return condition_aliases[i].condition;
+        }
+    }
+    return -1;
+}
+
+static bool is_register(struct asm_operand* operand, int size)
+{
+    return operand->kind == ASM_OPERAND_REGISTER && operand->size == size;
+}
+
+static bool is_rm(struct asm_operand* operand, int size)
+{
+    return is_register(operand, size) || operand->kind == ASM_OPERAND_MEMORY;
+}
+
+static bool assemble_mov(struct assembler* as, struct asm_operand* source, struct asm_operand* destination)
+{
+    if (source->kind == ASM_OPERAND_IMMEDIATE && is_register(destination, 8) && !fits_int32(source->value)) {
+        // movabs
+        emit_byte(as, 0x48 | (destination->reg >> 3));
+        emit_byte(as, 0xB8 | (destination->reg & 7));
+        emit_value(as, source->value, 8);
+        return true;
+    }
+    if (source->kind == ASM_OPERAND_IMMEDIATE && is_rm(destination, 8)) {
+        if (!fits_int32(source->value)) {
+            return assembler_fail(as, "immediate %lld doesn't fit in 32 bits\n", source->value);
+        }
+        emit_opcode_instruction(as, true, 0xC7, 0, NULL, destination);
+        emit_value(as, source->value, 4);
+        return true;
+    }
+    if (is_register(source, 8) && is_rm(destination, 8)) {
+        emit_opcode_instruction(as, true, 0x89, source->reg, source, destination);
+        return true;
+    }
+    if (source->kind == ASM_OPERAND_MEMORY && is_register(destination, 8)) {
+        emit_opcode_instruction(as, true, 0x8B, destination->reg, destination, source);
+        return true;
+    }
+    // To and from the low half of an xmm register
+    if (is_rm(source, 8) && is_register(destination, 16)) {
+        emit_sse_instruction(as, 0x66, true, 0x6E, destination->reg, source);
+        return true;
+    }
+    if (is_register(source, 16) && is_rm(destination, 8)) {
+        emit_sse_instruction(as, 0x66, true, 0x7E, source->reg, destination);
+        return true;
+    }
+    return assembler_fail(as, "unsupported operands for movq\n");
+}
+
+static bool assemble_movb(struct assembler* as, struct asm_operand* source, struct asm_operand* destination)
+{
+    if (source->kind == ASM_OPERAND_IMMEDIATE && is_rm(destination, 1)) {
+        emit_opcode_instruction(as, false, 0xC6, 0, NULL, destination);
+        emit_value(as, source->value, 1);
+        return true;
+    }
+    if (is_register(source, 1) && is_rm(destination, 1)) {
+        emit_opcode_instruction(as, false, 0x88, source->reg, source, destination);
+        return true;
+    }
+    if (source->kind == ASM_OPERAND_MEMORY && is_register(destination, 1)) {
+        emit_opcode_instruction(as, false, 0x8A, destination->reg, destination, source);
+        return true;
+    }
+    return assembler_fail(as, "unsupported operands for movb\n");
+}
+
+static bool assemble_alu(struct assembler* as, int digit, unsigned char opcode, struct asm_operand* source, struct asm_operand* destination)
+{
+    if (source->kind == ASM_OPERAND_IMMEDIATE && is_rm(destination, 8)) {
+        if (fits_int8(source->value)) {
+            emit_opcode_instruction(as, true, 0x83, digit, NULL, destination);
+            emit_value(as, source->value, 1);
+        } else if (fits_int32(source->value)) {
+            emit_opcode_instruction(as, true, 0x81, digit, NULL, destination);
+            emit_value(as, source->value, 4);
+        } else {
+            return assembler_fail(as, "immediate %lld doesn't fit in 32 bits\n", source->value);
+        }
+        return true;
+    }
+    if (is_register(source, 8) && is_rm(destination, 8)) {
+        emit_opcode_instruction(as, true, opcode, source->reg, source, destination);
+        return true;
+    }
+    if (source->kind == ASM_OPERAND_MEMORY && is_register(destination, 8)) {
+        emit_opcode_instruction(as, true, opcode + 2, destination->reg, destination, source);
+        return true;
+    }
+    return assembler_fail(as, "unsupported operands\n");
+}
+
+// Vector moves: register-or-memory to register, and register to memory
+static bool assemble_vector_move(struct assembler* as, const char* mnemonic, int prefix, bool vex,
+                                 struct asm_operand* source, struct asm_operand* destination)
+{
+    int size = vex ? (is_register(source, 32) || is_register(destination, 32) ? 32 : 16) : 16;
+    bool load = is_rm(source, size) && is_register(destination, size);
+    if (!load && !(is_register(source, size) && is_rm(destination, size))) {
+        return assembler_fail(as, "unsupported operands for %s\n", mnemonic);
+    }
+    struct asm_operand* reg = load ? destination : source;
+    struct asm_operand* rm = load ? source : destination;
+    unsigned char opcode = load ? 0x6F : 0x7F;
+    if (vex) {
+        emit_vex_instruction(as, prefix == 0x66 ? 1 : 2, 1, false, size == 32, opcode, reg->reg, 0, rm);
+    } else {
+        emit_sse_instruction(as, prefix, false, opcode, reg->reg, rm);
+    }
+    return true;
+}
+
+static bool assemble_instruction(struct assembler* as, const char* mnemonic, struct asm_operand* operands, int count)
+{
+    struct asm_operand* a = &operands[0];
+    struct asm_operand* b = &operands[1];
+
+    for (int i = 0; i < count; i++) {
+        if (operands[i].indirect && strcmp(mnemonic, "jmp") != 0) {
+            return assembler_fail(as, "only jmp takes a * operand\n");
+        }
+    }
+    if (strcmp(mnemonic, "ret") == 0 && count == 0) {
+        emit_byte(as, 0xC3);
+        return true;
+    }
+    if (strcmp(mnemonic, "syscall") == 0 && count == 0) {
+        emit_byte(as, 0x0F);
+        emit_byte(as, 0x05);
+        return true;
+    }
+    if (strcmp(mnemonic, "cqo") == 0 && count == 0) {
+        emit_byte(as, 0x48);
+        emit_byte(as, 0x99);
+        return true;
+    }
+    if (strcmp(mnemonic, "leave") == 0 && count == 0) {
+        emit_byte(as, 0xC9);
+        return true;
+    }
+    if (strcmp(mnemonic, "nop") == 0 && count == 0) {
+        emit_byte(as, 0x90);
+        return true;
+    }
+    if (strcmp(mnemonic, "cpuid") == 0 && count == 0) {
+        emit_byte(as, 0x0F);
+        emit_byte(as, 0xA2);
+        return true;
+    }
+    if (strcmp(mnemonic, "xgetbv") == 0 && count == 0) {
+        emit_byte(as, 0x0F);
+        emit_byte(as, 0x01);
+        emit_byte(as, 0xD0);
+        return true;
+    }
+    if (strcmp(mnemonic, "vzeroupper") == 0 && count == 0) {
+        emit_byte(as, 0xC5);
+        emit_byte(as, 0xF8);
+        emit_byte(as, 0x77);
+        return true;
+    }
+
+    if ((strcmp(mnemonic, "pushq") == 0 || strcmp(mnemonic, "popq") == 0) && count == 1) {
+        bool push = mnemonic[1] == 'u';
+        if (is_register(a, 8)) {
+            if (a->reg & 8) {
+                emit_byte(as, 0x41);
+            }
+            emit_byte(as, (push ? 0x50 : 0x58) | (a->reg & 7));
+            return true;
+        }
+        if (push && a->kind == ASM_OPERAND_IMMEDIATE && fits_int32(a->value)) {
+            emit_byte(as, fits_int8(a->value) ? 0x6A : 0x68);
+            emit_value(as, a->value, fits_int8(a->value) ? 1 : 4);
+            return true;
+        }
+        if (a->kind == ASM_OPERAND_MEMORY) {
+            emit_opcode_instruction(as, false, push ? 0xFF : 0x8F, push ? 6 : 0, NULL, a);
+            return true;
+        }
+        return assembler_fail(as, "unsupported operand for %s\n", mnemonic);
+    }
+
+    if (strcmp(mnemonic, "call") == 0 && count == 1) {
+        if (a->kind != ASM_OPERAND_SYMBOL) {
+            return assembler_fail(as, "only direct calls are supported\n");
+        }
+        emit_byte(as, 0xE8);
+        emit_relocation(as, a->symbol, ASM_RELOCATION_PLT32, -4);
+        emit_value(as, 0, 4);
+        return true;
+    }
+
+    if (mnemonic[0] == 'j' && count == 1) {
+        int condition = strcmp(mnemonic, "jmp") == 0 ? -1 : find_condition(mnemonic + 1);
+        if (strcmp(mnemonic, "jmp") != 0 && condition < 0) {
+            return assembler_fail(as, "unknown instruction %s\n", mnemonic);
+        }
+        if (a->indirect && condition < 0 && is_rm(a, 8)) {
+            emit_opcode_instruction(as, false, 0xFF, 4, NULL, a);
+            return true;
+        }
+        if (a->kind != ASM_OPERAND_SYMBOL || a->indirect) {
+            return assembler_fail(as, "only direct jumps and jmp *r/m64 are supported\n");
+        }
+        add_branch(as, a->symbol, condition);
+        return true;
+    }
+
+    if (strncmp(mnemonic, "set", 3) == 0 && count == 1) {
+        int condition = find_condition(mnemonic + 3);
+        if (condition < 0 || !is_rm(a, 1)) {
+            return assembler_fail(as, "unsupported %s\n", mnemonic);
+        }
+        unsigned char opcode[2] = { 0x0F, 0x90 | condition };
+        emit_modrm_instruction(as, false, opcode, 2, 0, NULL, a);
+        return true;
+    }
+
+    if (strncmp(mnemonic, "cmov", 4) == 0 && count == 2) {
+        size_t length = strlen(mnemonic);
+        char suffix[8];
+        if (length < 6 || length - 5 >= sizeof(suffix) || mnemonic[length - 1] != 'q') {
+            return assembler_fail(as, "unsupported %s\n", mnemonic);
+        }
+        memcpy(suffix, mnemonic + 4, length - 5);
+        suffix[length - 5] = 0;
+        int condition = find_condition(suffix);
+        if (condition < 0 || !is_rm(a, 8) || !is_register(b, 8)) {
+            return assembler_fail(as, "unsupported %s\n", mnemonic);
+        }
+        unsigned char opcode[2] = { 0x0F, 0x40 | condition };
+        emit_modrm_instruction(as, true, opcode, 2, b->reg, b, a);
+        return true;
+    }
+
+    if (strcmp(mnemonic, "movq") == 0 && count == 2) {
+        return assemble_mov(as, a, b);
+    }
+    if (strcmp(mnemonic, "movb") == 0 && count == 2) {
+        return assemble_movb(as, a, b);
+    }
+    if (strcmp(mnemonic, "movzbq") == 0 && count == 2 && is_rm(a, 1) && is_register(b, 8)) {
+        unsigned char opcode[2] = { 0x0F, 0xB6 };
+        emit_modrm_instruction(as, true, opcode, 2, b->reg, b, a);
+        return true;
+    }
+    if (strcmp(mnemonic, "movslq") == 0 && count == 2 && a->kind == ASM_OPERAND_MEMORY && is_register(b, 8)) {
+        emit_opcode_instruction(as, true, 0x63, b->reg, b, a);
+        return true;
+    }
+    if (strcmp(mnemonic, "leaq") == 0 && count == 2 && a->kind == ASM_OPERAND_MEMORY && is_register(b, 8)) {
+        emit_opcode_instruction(as, true, 0x8D, b->reg, b, a);
+        return true;
+    }
+    if (strcmp(mnemonic, "xchgq") == 0 && count == 2 && is_register(a, 8) && is_rm(b, 8)) {
+        emit_opcode_instruction(as, true, 0x87, a->reg, a, b);
+        return true;
+    }
+    if (strcmp(mnemonic, "testq") == 0 && count == 2) {
+        if (a->kind == ASM_OPERAND_IMMEDIATE && is_rm(b, 8) && fits_int32(a->value)) {
+            emit_opcode_instruction(as, true, 0xF7, 0, NULL, b);
+            emit_value(as, a->value, 4);
+            return true;
+        }
+        if (is_register(a, 8) && is_rm(b, 8)) {
+            emit_opcode_instruction(as, true, 0x85, a->reg, a, b);
+            return true;
+        }
+        return assembler_fail(as, "unsupported operands for testq\n");
+    }
+    if (strcmp(mnemonic, "imulq") == 0 && count == 2 && is_rm(a, 8) && is_register(b, 8)) {
+        unsigned char opcode[2] = { 0x0F, 0xAF };
+        emit_modrm_instruction(as, true, opcode, 2, b->reg, b, a);
+        return true;
+    }
+    if (strcmp(mnemonic, "imulq") == 0 && count == 3 && a->kind == ASM_OPERAND_IMMEDIATE &&
+        is_rm(b, 8) && is_register(&operands[2], 8) && fits_int32(a->value)) {
+        bool short_immediate = fits_int8(a->value);
+        emit_opcode_instruction(as, true, short_immediate ? 0x6B : 0x69, operands[2].reg, &operands[2], b);
+        emit_value(as, a->value, short_immediate ? 1 : 4);
+        return true;
+    }
+
+    if (strcmp(mnemonic, "movdqu") == 0 && count == 2) {
+        return assemble_vector_move(as, mnemonic, 0xF3, false, a, b);
+    }
+    if (strcmp(mnemonic, "movdqa") == 0 && count == 2) {
+        return assemble_vector_move(as, mnemonic, 0x66, false, a, b);
+    }
+    if (strcmp(mnemonic, "vmovdqu") == 0 && count == 2) {
+        return assemble_vector_move(as, mnemonic, 0xF3, true, a, b);
+    }
+    if (strcmp(mnemonic, "vmovq") == 0 && count == 2 && is_rm(a, 8) && is_register(b, 16)) {
+        emit_vex_instruction(as, 1, 1, true, false, 0x6E, b->reg, 0, a);
+        return true;
+    }
+    if (strcmp(mnemonic, "vpbroadcastq") == 0 && count == 2 && (is_register(a, 16) || a->kind == ASM_OPERAND_MEMORY) &&
+        (is_register(b, 16) || is_register(b, 32))) {
+        emit_vex_instruction(as, 1, 2, false, b->size == 32, 0x59, b->reg, 0, a);
+        return true;
+    }
+    for (size_t i = 0; i < sizeof(packed_instructions) / sizeof(packed_instructions[0]); i++) {
+        const char* name = packed_instructions[i].name;
+        unsigned char opcode = packed_instructions[i].opcode;
+        if (strcmp(mnemonic, name) == 0 && count == 2) {
+            if (!is_rm(a, 16) || !is_register(b, 16)) {
+                return assembler_fail(as, "unsupported operands for %s\n", mnemonic);
+            }
+            emit_sse_instruction(as, 0x66, false, opcode, b->reg, a);
+            return true;
+        }
+        if (mnemonic[0] == 'v' && strcmp(mnemonic + 1, name) == 0 && count == 3) {
+            struct asm_operand* c = &operands[2];
+            int size = c->size;
+            if (c->kind != ASM_OPERAND_REGISTER || (size != 16 && size != 32) || !is_rm(a, size) || !is_register(b, size)) {
+                return assembler_fail(as, "unsupported operands for %s\n", mnemonic);
+            }
+            emit_vex_instruction(as, 1, 1, false, size == 32, opcode, c->reg, b->reg, a);
+            return true;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(alu_instructions) / sizeof(alu_instructions[0]); i++) {
+        if (strcmp(mnemonic, alu_instructions[i].name) == 0 && count == 2) {
+            return assemble_alu(as, alu_instructions[i].digit, alu_instructions[i].opcode, a, b);
+        }
+    }
+    for (size_t i = 0; i < sizeof(unary_instructions) / sizeof(unary_instructions[0]); i++) {
+        if (strcmp(mnemonic, unary_instructions[i].name) == 0 && count == 1 && is_rm(a, 8)) {
+            emit_opcode_instruction(as, true, unary_instructions[i].opcode, unary_instructions[i].digit, NULL, a);
+            return true;
+        }
+    }
+    for (size_t i = 0; i < sizeof(shift_instructions) / sizeof(shift_instructions[0]); i++) {
+        if (strcmp(mnemonic, shift_instructions[i].name) != 0 || count != 2 || !is_rm(b, 8)) {
+            continue;
+        }
+        if (is_register(a, 1) && a->reg == 1) {
+            emit_opcode_instruction(as, true, 0xD3, shift_instructions[i].digit, NULL, b);
+            return true;
+        }
+        if (a->kind == ASM_OPERAND_IMMEDIATE && a->value == 1) {
+            // By one has its own opcode
+            emit_opcode_instruction(as, true, 0xD1, shift_instructions[i].digit, NULL, b);
+            return true;
+        }
+        if (a->kind == ASM_OPERAND_IMMEDIATE) {
+            emit_opcode_instruction(as, true, 0xC1, shift_instructions[i].digit, NULL, b);
+            emit_value(as, a->value, 1);
+            return true;
+        }
+        return assembler_fail(as, "%s shifts by %%cl or an immediate\n", mnemonic);
+    }
+
+    return assembler_fail(as, "unsupported instruction %s\n", mnemonic);
+}
+
+static void define_label(struct assembler* as, const char* name, size_t length)
+{
+    int index = assembler_symbol(as, name, length);
+    struct asm_symbol* symbol = &as->object->symbols[index];
+    if (symbol->defined) {
+        assembler_fail(as, "%s is already defined\n", symbol->name);
+        return;
+    }
+    symbol->defined = true;
+    as->labels[index].position = as->code_size;
+    as->labels[index].branches = as->branch_count;
+}
+
+// Directive arguments are a single symbol name
+static int directive_symbol(struct assembler* as, const char* text, const char* end)
+{
+    text = skip_blanks(text, end);
+    const char* stop = text;
+    while (stop < end && *stop != ',' && *stop != ' ' && *stop != '\t') {
+        stop++;
+    }
+    if (stop == text) {
+        assembler_fail(as, "missing symbol name\n");
+        return -1;
+    }
+    return assembler_symbol(as, text, stop - text);
+}
+
+// .comm name,size[,alignment] puts a zeroed block in .bss. Doing it again
+// for the same name is fine, it's one block
+static void assemble_comm(struct assembler* as, const char* text, const char* end)
+{
+    int index = directive_symbol(as, text, end);
+    if (index < 0) {
+        return;
+    }
+    long long values[2] = { 0, 1 };
+    const char* comma = memchr(text, ',', end - text);
+    for (int i = 0; i < 2 && comma; i++) {
+        const char* start = skip_blanks(comma + 1, end);
+        comma = memchr(start, ',', end - start);
+        const char* stop = comma ? comma : end;
+        while (stop > start && (stop[-1] == ' ' || stop[-1] == '\t')) {
+            stop--;
+        }
+        if (!parse_number(start, stop, &values[i])) {
+            assembler_fail(as, "bad .comm size or alignment\n");
+            return;
+        }
+    }
+    long long size = values[0];
+    long long alignment = values[1];
+    if (size <= 0 || alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+        assembler_fail(as, "bad .comm size or alignment\n");
+        return;
+    }
+    struct asm_symbol* symbol = &as->object->symbols[index];
+    if (symbol->defined) {
+        if (!symbol->bss) {
+            assembler_fail(as, "%s is already defined\n", symbol->name);
+        }
+        return;
+    }
+    struct asm_object* object = as->object;
+    object->bss_size = (object->bss_size + alignment - 1) & ~(size_t) (alignment - 1);
+    symbol->defined = true;
+    symbol->bss = true;
+    symbol->offset = object->bss_size;
+    object->bss_size += size;
+}
+
+// .long takes a number, or the difference of two labels defined here,
+// which is only known after the layout
+static void assemble_long(struct assembler* as, const char* text, const char* end)
+{
+    text = skip_blanks(text, end);
+    long long value;
+    if (parse_number(text, end, &value)) {
+        if (value < -2147483648LL || value > 4294967295LL) {
+            assembler_fail(as, ".long value %lld out of range\n", value);
+            return;
+        }
+        emit_value(as, value, 4);
+        return;
+    }
+    const char* minus = memchr(text, '-', end - text);
+    const char* plus_end = minus;
+    while (plus_end > text && (plus_end[-1] == ' ' || plus_end[-1] == '\t')) {
+        plus_end--;
+    }
+    const char* minus_start = minus ? skip_blanks(minus + 1, end) : end;
+    if (!minus || plus_end == text || minus_start == end) {
+        assembler_fail(as, "unsupported .long value %.*s\n", (int) (end - text), text);
+        return;
+    }
+    if (as->difference_count == as->difference_capacity) {
+        as->difference_capacity = as->difference_capacity ? as->difference_capacity * 2 : 64;
+        as->differences = realloc(as->differences, as->difference_capacity * sizeof(struct asm_difference));
+    }
+    struct asm_difference* difference = &as->differences[as->difference_count++];
+    difference->position = as->code_size;
+    difference->branches = as->branch_count;
+    difference->plus = assembler_symbol(as, text, plus_end - text);
+    difference->minus = assembler_symbol(as, minus_start, end - minus_start);
+    emit_value(as, 0, 4);
+}
+
+static void assemble_directive(struct assembler* as, const char* text, const char* end)
+{
+    const char* stop = text;
+    while (stop < end && *stop != ' ' && *stop != '\t') {
+        stop++;
+    }
+    size_t length = stop - text;
+    if (length == 5 && strncmp(text, ".text", 5) == 0) {
+        return;
+    }
+    if (length == 6 && strncmp(text, ".globl", 6) == 0) {
+        int index = directive_symbol(as, stop, end);
+        if (index >= 0) {
+            as->object->symbols[index].global = true;
+        }
+        return;
+    }
+    if (length == 6 && strncmp(text, ".local", 6) == 0) {
+        // Symbols are local unless .globl says otherwise
+        directive_symbol(as, stop, end);
+        return;
+    }
+    if (length == 5 && strncmp(text, ".comm", 5) == 0) {
+        assemble_comm(as, stop, end);
+        return;
+    }
+    if (length == 5 && strncmp(text, ".long", 5) == 0) {
+        assemble_long(as, stop, end);
+        return;
+    }
+    if (length == 8 && strncmp(text, ".p2align", 8) == 0) {
+        long long power;
+        const char* start = skip_blanks(stop, end);
+        if (!parse_number(start, end, &power) || power < 0 || power > 12) {
+            assembler_fail(as, "unsupported .p2align %.*s\n", (int) (end - start), start);
+            return;
+        }
+        if (power) {
+            add_padding(as, 1 << power);
+            if (as->object->text_align < (size_t) 1 << power) {
+                as->object->text_align = (size_t) 1 << power;
+            }
+        }
+        return;
+    }
+    if (length == 5 && strncmp(text, ".type", 5) == 0) {
+        int index = directive_symbol(as, stop, end);
+        if (index >= 0) {
+            as->object->symbols[index].function = memmem(stop, end - stop, "@function", 9) != NULL;
+        }
+        return;
+    }
+    if (length == 5 && strncmp(text, ".file", 5) == 0) {
+        const char* open = memchr(stop, '"', end - stop);
+        const char* close = open ? memchr(open + 1, '"', end - open - 1) : NULL;
+        if (open && close) {
+            free(as->object->file_name);
+            as->object->file_name = strndup(open + 1, close - open - 1);
+        }
+        return;
+    }
+    if (length == 8 && strncmp(text, ".section", 8) == 0) {
+        // The only section besides .text is the marker for a non-executable
+        // stack, which elf_write_object always writes
+        if (memmem(stop, end - stop, ".note.GNU-stack", 15)) {
+            return;
+        }
+    }
+    assembler_fail(as, "unsupported directive %.*s\n", (int) (end - text), text);
+}
+
+static void assemble_line(struct assembler* as, const char* text, const char* end)
+{
+    // Comments run to the end of the line; the generator never puts a # in
+    // a string
+    const char* comment = memchr(text, '#', end - text);
+    if (comment) {
+        end = comment;
+    }
+    text = skip_blanks(text, end);
+    while (end > text && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) {
+        end--;
+    }
+    if (text == end) {
+        return;
+    }
+    if (end[-1] == ':') {
+        define_label(as, text, end - 1 - text);
+        return;
+    }
+    if (*text == '.') {
+        assemble_directive(as, text, end);
+        return;
+    }
+
+    const char* stop = text;
+    while (stop < end && *stop != ' ' && *stop != '\t') {
+        stop++;
+    }
+    char mnemonic[16];
+    if ((size_t) (stop - text) >= sizeof(mnemonic)) {
+        assembler_fail(as, "unsupported instruction %.*s\n", (int) (stop - text), text);
+        return;
+    }
+    memcpy(mnemonic, text, stop - text);
+    mnemonic[stop - text] = 0;
+
+    struct asm_operand operands[ASM_MAX_OPERANDS];
+    int count = parse_operands(as, stop, end, operands);
+    if (count >= 0) {
+        as->rip_relocation = -1;
+        assemble_instruction(as, mnemonic, operands, count);
+        // The CPU adds the displacement to the address of the next
+        // instruction, which can be more than 4 bytes past the field
+        if (as->rip_relocation >= 0) {
+            struct asm_relocation* relocation = &as->object->relocations[as->rip_relocation];
+            relocation->addend -= (long long) (as->code_size - relocation->offset);
+        }
+    }
+}
+
+// Bytes of branch when it starts at offset
+static int branch_size(struct asm_branch* branch, size_t offset)
+{
+    if (branch->align) {
+        return (int) ((branch->align - offset % branch->align) % branch->align);
+    }
+    if (!branch->near) {
+        return 2;
+    }
+    return branch->condition < 0 ? 5 : 6;
+}
+
+// Jumps to code defined here, labels and the functions tail calls go to,
+// are resolved by the assembler, as `as` does; everything else needs the
+// linker
+static bool branch_is_local(struct assembler* as, struct asm_branch* branch)
+{
+    struct asm_symbol* symbol = &as->object->symbols[branch->symbol];
+    return symbol->defined && !symbol->bss;
+}
+
+// The multi-byte nops as pads with, by length; longer padding is several
+static const unsigned char nops[][11] = {
+    { 0 },
+    { 0x90 },
+    { 0x66, 0x90 },
+    { 0x0F, 0x1F, 0x00 },
+    { 0x0F, 0x1F, 0x40, 0x00 },
+    { 0x0F, 0x1F, 0x44, 0x00, 0x00 },
+    { 0x66, 0x0F, 0x1F, 0x44, 0x00, 0x00 },
+    { 0x0F, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00 },
+    { 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x66, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x66, 0x66, 0x2E, 0x0F, 0x1F, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00 },
+};
+
+static void write_nops(unsigned char* text, int size)
+{
+    while (size > 0) {
+        int length = size < 11 ? size : 11;
+        memcpy(text, nops[length], length);
+        text += length;
+        size -= length;
+    }
+}
+
+// Final offset of something at position in the fixed code with branches
+// branches in front of it, given the sizes of the branches so far
+static size_t final_offset(size_t position, int branches, size_t* branch_growth)
+{
+    return position + branch_growth[branches];
+}
+
+// Widens short jumps whose target is out of reach until none are, then
+// puts the final code together. Jumps only ever widen, so this ends, and
+// the padding is worked out again on every round
+static void assembler_layout(struct assembler* as)
+{
+    struct asm_object* object = as->object;
+    // branch_growth[i] = bytes the first i branches add to the fixed code
+    size_t* branch_growth = calloc(as->branch_count + 1, sizeof(size_t));
+    for (int i = 0; i < as->branch_count; i++) {
+        if (!as->branches[i].align && !branch_is_local(as, &as->branches[i])) {
+            as->branches[i].near = true;
+        }
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int i = 0; i < as->branch_count; i++) {
+            size_t start = final_offset(as->branches[i].position, i, branch_growth);
+            branch_growth[i + 1] = branch_growth[i] + branch_size(&as->branches[i], start);
+        }
+        for (int i = 0; i < as->branch_count; i++) {
+            struct asm_branch* branch = &as->branches[i];
+            if (branch->near || branch->align) {
+                continue;
+            }
+            struct asm_label_position* target = &as->labels[branch->symbol];
+            long long from = final_offset(branch->position, i + 1, branch_growth);
+            long long to = final_offset(target->position, target->branches, branch_growth);
+            if (!fits_int8(to - from)) {
+                branch->near = true;
+                changed = true;
+            }
+        }
+    }
+
+    size_t size = as->code_size + branch_growth[as->branch_count];
+    unsigned char* text = malloc(size ? size : 1);
+    size_t written = 0;
+    size_t copied = 0;
+    for (int i = 0; i < as->branch_count; i++) {
+        struct asm_branch* branch = &as->branches[i];
+        memcpy(text + written, as->code + copied, branch->position - copied);
+        written += branch->position - copied;
+        copied = branch->position;
+
+        int size = branch_size(branch, written);
+        if (branch->align) {
+            write_nops(text + written, size);
+            written += size;
+            continue;
+        }
+        if (!branch->near) {
+            text[written] = branch->condition < 0 ? 0xEB : 0x70 | branch->condition;
+        } else if (branch->condition < 0) {
+            text[written] = 0xE9;
+        } else {
+            text[written] = 0x0F;
+            text[written + 1] = 0x80 | branch->condition;
+        }
+        long long displacement = 0;
+        if (branch_is_local(as, branch)) {
+            struct asm_label_position* target = &as->labels[branch->symbol];
+            displacement = (long long) final_offset(target->position, target->branches, branch_growth) -
+                           (long long) (written + size);
+        } else {
+            // Already at its final offset, which no branches move any more
+            add_relocation(as, written + size - 4, 0, branch->symbol, ASM_RELOCATION_PLT32, -4);
+        }
+        int displacement_size = branch->near ? 4 : 1;
+        for (int b = 0; b < displacement_size; b++) {
+            text[written + size - displacement_size + b] = (unsigned char) (displacement >> (8 * b));
+        }
+        written += size;
+    }
+    memcpy(text + written, as->code + copied, as->code_size - copied);
+
+    // Everything recorded against the fixed code moves by the branches in
+    // front of it
+    for (int i = 0; i < object->relocation_count; i++) {
+        struct asm_relocation* relocation = &object->relocations[i];
+        relocation->offset = final_offset(relocation->offset, as->relocation_branches[i], branch_growth);
+    }
+    for (int i = 0; i < object->symbol_count; i++) {
+        if (object->symbols[i].defined && !object->symbols[i].bss) {
+            object->symbols[i].offset = final_offset(as->labels[i].position, as->labels[i].branches, branch_growth);
+        }
+    }
+    for (int i = 0; i < as->difference_count; i++) {
+        struct asm_difference* difference = &as->differences[i];
+        long long value = (long long) object->symbols[difference->plus].offset - (long long) object->symbols[difference->minus].offset;
+        size_t offset = final_offset(difference->position, difference->branches, branch_growth);
+        for (int b = 0; b < 4; b++) {
+            text[offset + b] = (unsigned char) (value >> (8 * b));
+        }
+    }
+    // sym(%rip) operands that refer to code here don't need the linker, nor
+    // do calls to functions that aren't .globl
+    int kept = 0;
+    for (int i = 0; i < object->relocation_count; i++) {
+        struct asm_relocation* relocation = &object->relocations[i];
+        struct asm_symbol* symbol = &object->symbols[relocation->symbol];
+        bool here = symbol->defined && !symbol->bss;
+        if ((relocation->type == ASM_RELOCATION_PC32 && here) ||
+            (relocation->type == ASM_RELOCATION_PLT32 && here && !symbol->global)) {
+            long long value = (long long) symbol->offset + relocation->addend - (long long) relocation->offset;
+            for (int b = 0; b < 4; b++) {
+                text[relocation->offset + b] = (unsigned char) (value >> (8 * b));
+            }
+            continue;
+        }
+        object->relocations[kept++] = *relocation;
+    }
+    object->relocation_count = kept;
+    free(branch_growth);
+    object->text = text;
+    object->text_size = size;
+}
+
+static int relocation_compare(const void* a, const void* b)
+{
+    const struct asm_relocation* left = a;
+    const struct asm_relocation* right = b;
+    return left->offset < right->offset ? -1 : left->offset > right->offset;
+}
+
+bool assemble(const char* source, size_t size, struct asm_object* object, char* error, size_t error_size)
+{
+    memset(object, 0, sizeof(*object));
+    struct assembler as = { 0 };
+    as.object = object;
+    as.error = error;
+    as.error_size = error_size;
+
+    const char* end = source + size;
+    const char* line = source;
+    while (line < end && !as.failed) {
+        const char* newline = memchr(line, '\n', end - line);
+        const char* line_end = newline ? newline : end;
+        as.line++;
+        assemble_line(&as, line, line_end);
+        line = line_end + 1;
+    }
+
+    for (int i = 0; i < as.branch_count && !as.failed; i++) {
+        if (as.branches[i].align) {
+            continue;
+        }
+        struct asm_symbol* symbol = &object->symbols[as.branches[i].symbol];
+        if (symbol->local_label && !symbol->defined) {
+            as.line = 0;
+            assembler_fail(&as, "%s is never defined\n", symbol->name);
+        }
+    }
+    for (int i = 0; i < as.difference_count * 2 && !as.failed; i++) {
+        struct asm_difference* difference = &as.differences[i / 2];
+        struct asm_symbol* symbol = &object->symbols[i % 2 ? difference->minus : difference->plus];
+        if (!symbol->defined || symbol->bss) {
+            as.line = 0;
+            assembler_fail(&as, "%s is not a label in .text\n", symbol->name);
+        }
+    }
+    if (!as.failed) {
+        assembler_layout(&as);
+        qsort(object->relocations, object->relocation_count, sizeof(struct asm_relocation), relocation_compare);
+    }
+
+    free(as.code);
+    free(as.branches);
+    free(as.labels);
+    free(as.differences);
+    free(as.relocation_branches);
+    free(as.symbol_slots);
+    if (as.failed) {
+        asm_object_free(object);
+        return false;
+    }
+    return true;
+}
+
+void asm_object_free(struct asm_object* object)
+{
+    for (int i = 0; i < object->symbol_count; i++) {
+        free(object->symbols[i].name);
+    }
+    free(object->symbols);
+    free(object->relocations);
+    free(object->text);
+    free(object->file_name);
+    memset(object, 0, sizeof(*object));
+}
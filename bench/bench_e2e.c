@@ -0,0 +1,404 @@
+// End-to-end compile benchmark with a checked-in baseline.
+//
+//   bench_e2e [--update] [--baseline <file>] [--runs <n>] [--max-rss-ratio <n>] [--no-run] <corpus files...>
+//
+// For every corpus file it runs the whole compile_file pipeline in a child
+// process and records:
+//   compile_time_us  best wall time over <n> compiles
+//   peak_rss_kb      peak resident memory of the compiling process
+//   output_bytes     size of the generated assembly
+//   instructions     user-space instructions executed by the compiled
+//                    program, linked against bench/e2e_start.s instead of
+//                    libc so only generated code is counted
+// Instructions come from the hardware counter when perf_event_open allows
+// it, otherwise from single-stepping the program under ptrace.
+//
+// Without --update the results are compared against the baseline and the
+// exit status is 1 if any metric regressed past its threshold. With
+// --update the baseline file is rewritten from this run.
+//
+// With --max-rss-ratio, a compile whose peak memory is more than <n> times
+// the size of its input also fails, baseline or not. make bench-memory runs
+// it on a large generated input, where memory kept per token shows up.
+// --no-run leaves out linking and counting instructions, which single-
+// stepping makes slow for a large program.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <libgen.h>
+#include <sys/stat.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "compiler.h"
+
+#define E2E_OUTPUT_DIR "./build/bench/e2e"
+#define E2E_START_FILE "./bench/e2e_start.s"
+#define E2E_MAX_SINGLE_STEPS 20000000L
+
+enum {
+    METRIC_COMPILE_TIME,
+    METRIC_PEAK_RSS,
+    METRIC_OUTPUT_BYTES,
+    METRIC_INSTRUCTIONS,
+    METRIC_COUNT
+};
+
+struct metric_info {
+    const char* name;
+    // A metric regresses when it grows by more than threshold_percent and
+    // by more than slack in absolute terms, to ride out timer noise
+    double threshold_percent;
+    long long slack;
+};
+
+static struct metric_info metrics[METRIC_COUNT] = {
+    [METRIC_COMPILE_TIME] = { "compile_time_us", 30.0, 2000 },
+    [METRIC_PEAK_RSS]     = { "peak_rss_kb",     10.0, 1024 },
+    [METRIC_OUTPUT_BYTES] = { "output_bytes",     2.0, 0 },
+    [METRIC_INSTRUCTIONS] = { "instructions",     2.0, 0 },
+};
+
+struct baseline_entry {
+    char file[256];
+    int metric;
+    long long value;
+};
+
+static struct baseline_entry* baseline = NULL;
+static int baseline_count = 0;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int metric_from_name(const char* name)
+{
+    for (int i = 0; i < METRIC_COUNT; i++) {
+        if (strcmp(metrics[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void load_baseline(const char* path)
+{
+    FILE* fp = fopen(path, "r");
+    if (!fp) {
+        return;
+    }
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        char file[256], name[64];
+        long long value;
+        if (line[0] == '#' || sscanf(line, "%255s %63s %lld", file, name, &value) != 3) {
+            continue;
+        }
+        int metric = metric_from_name(name);
+        if (metric < 0) {
+            continue;
+        }
+        baseline = realloc(baseline, (baseline_count + 1) * sizeof(struct baseline_entry));
+        strcpy(baseline[baseline_count].file, file);
+        baseline[baseline_count].metric = metric;
+        baseline[baseline_count].value = value;
+        baseline_count++;
+    }
+    fclose(fp);
+}
+
+static struct baseline_entry* find_baseline(const char* file, int metric)
+{
+    for (int i = 0; i < baseline_count; i++) {
+        if (baseline[i].metric == metric && strcmp(baseline[i].file, file) == 0) {
+            return &baseline[i];
+        }
+    }
+    return NULL;
+}
+
+// Compiles in a forked child so every run starts from a fresh heap and the
+// compiler's global state (and its exit() on errors) can't leak between runs
+static int compile_in_child(const char* input, const char* output, double* seconds, long* peak_rss_kb)
+{
+    fflush(stdout);
+    double start = now_seconds();
+    pid_t pid = fork();
+    if (pid == 0) {
+        _exit(compile_file(input, output, 0));
+    }
+    int status;
+    struct rusage usage;
+    wait4(pid, &status, 0, &usage);
+    *seconds = now_seconds() - start;
+    *peak_rss_kb = usage.ru_maxrss;
+    return WIFEXITED(status) ? WEXITSTATUS(status) : COMPILER_FAILED_WITH_ERRORS;
+}
+
+static int run_quiet(const char* cmd)
+{
+    int status = system(cmd);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+static void exec_program(const char* binary)
+{
+    freopen("/dev/null", "w", stdout);
+    execl(binary, binary, (char*) NULL);
+    _exit(127);
+}
+
+static long long count_with_perf(const char* binary)
+{
+    int go[2];
+    if (pipe(go) != 0) {
+        return -1;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        char c;
+        close(go[1]);
+        // Wait until the parent has attached the counter
+        read(go[0], &c, 1);
+        exec_program(binary);
+    }
+    close(go[0]);
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.enable_on_exec = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    int fd = syscall(SYS_perf_event_open, &attr, pid, -1, -1, 0);
+    write(go[1], "x", 1);
+    close(go[1]);
+
+    int status;
+    waitpid(pid, &status, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    long long count = -1;
+    if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+        count = -1;
+    }
+    close(fd);
+    return WIFSIGNALED(status) ? -1 : count;
+}
+
+static long long count_with_single_step(const char* binary)
+{
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+        exec_program(binary);
+    }
+    int status;
+    // Stopped at the exec
+    waitpid(pid, &status, 0);
+    long long steps = 0;
+    while (WIFSTOPPED(status) && steps < E2E_MAX_SINGLE_STEPS) {
+        if (ptrace(PTRACE_SINGLESTEP, pid, NULL, NULL) != 0) {
+            break;
+        }
+        waitpid(pid, &status, 0);
+        steps++;
+    }
+    if (!WIFEXITED(status)) {
+        kill(pid, SIGKILL);
+        waitpid(pid, &status, 0);
+        return -1;
+    }
+    // The last step is the exit syscall completing, not an instruction
+    return steps - 1;
+}
+
+static long long count_instructions(const char* binary, const char** method)
+{
+    long long count = count_with_perf(binary);
+    *method = "perf";
+    if (count < 0) {
+        count = count_with_single_step(binary);
+        *method = "ptrace";
+    }
+    return count;
+}
+
+// Fails a compile that used more than ratio times its input's size
+static bool within_rss_ratio(const char* input, const char* name, long long peak_rss_kb, double ratio)
+{
+    struct stat st;
+    if (stat(input, &st) != 0) {
+        return true;
+    }
+    double limit_kb = ratio * st.st_size / 1024;
+    if (peak_rss_kb <= limit_kb) {
+        return true;
+    }
+    printf("%-16s %-16s %14.0f %14lld %+8.1f%%  OVER %gx THE INPUT\n", name, metrics[METRIC_PEAK_RSS].name,
+           limit_kb, peak_rss_kb, 100.0 * (peak_rss_kb - limit_kb) / limit_kb, ratio);
+    return false;
+}
+
+static int measure(const char* input, int runs, bool run, long long* values)
+{
+    char name[256], output[512], binary[512], cmd[2048];
+    char* path = strdup(input);
+    snprintf(name, sizeof(name), "%s", basename(path));
+    free(path);
+    snprintf(output, sizeof(output), "%s/%s.s", E2E_OUTPUT_DIR, name);
+    snprintf(binary, sizeof(binary), "%s/%s.bin", E2E_OUTPUT_DIR, name);
+
+    double best = 0;
+    long peak_rss = 0;
+    for (int i = 0; i < runs; i++) {
+        double seconds;
+        long rss;
+        if (compile_in_child(input, output, &seconds, &rss) != COMPILER_FILE_COMPILED_OK) {
+            fprintf(stderr, "%s: compile_file failed\n", input);
+            return -1;
+        }
+        if (i == 0 || seconds < best) {
+            best = seconds;
+        }
+        if (rss > peak_rss) {
+            peak_rss = rss;
+        }
+    }
+    values[METRIC_COMPILE_TIME] = (long long) (best * 1e6);
+    values[METRIC_PEAK_RSS] = peak_rss;
+
+    struct stat st;
+    values[METRIC_OUTPUT_BYTES] = stat(output, &st) == 0 ? st.st_size : -1;
+
+    values[METRIC_INSTRUCTIONS] = -1;
+    if (!run) {
+        return 0;
+    }
+    snprintf(cmd, sizeof(cmd), "gcc -static -nostdlib %s %s -o %s", output, E2E_START_FILE, binary);
+    if (run_quiet(cmd) != 0) {
+        fprintf(stderr, "%s: generated assembly didn't assemble/link\n", input);
+        return -1;
+    }
+    const char* method;
+    values[METRIC_INSTRUCTIONS] = count_instructions(binary, &method);
+    if (values[METRIC_INSTRUCTIONS] < 0) {
+        fprintf(stderr, "%s: couldn't count instructions (program crashed or ran too long)\n", input);
+    } else {
+        fprintf(stderr, "%s: instructions counted with %s\n", input, method);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* baseline_path = "./bench/baseline.txt";
+    bool update = false;
+    int runs = 5;
+    double max_rss_ratio = 0;
+    bool run = true;
+    int first_input = 1;
+    for (; first_input < argc && argv[first_input][0] == '-'; first_input++) {
+        if (strcmp(argv[first_input], "--update") == 0) {
+            update = true;
+        } else if (strcmp(argv[first_input], "--baseline") == 0 && first_input + 1 < argc) {
+            baseline_path = argv[++first_input];
+        } else if (strcmp(argv[first_input], "--runs") == 0 && first_input + 1 < argc) {
+            runs = atoi(argv[++first_input]);
+        } else if (strcmp(argv[first_input], "--max-rss-ratio") == 0 && first_input + 1 < argc) {
+            max_rss_ratio = atof(argv[++first_input]);
+        } else if (strcmp(argv[first_input], "--no-run") == 0) {
+            run = false;
+        } else {
+            fprintf(stderr, "unknown option %s\n", argv[first_input]);
+            return 2;
+        }
+    }
+    if (first_input == argc) {
+        fprintf(stderr, "usage: %s [--update] [--baseline <file>] [--runs <n>] [--max-rss-ratio <n>] [--no-run] <corpus files...>\n", argv[0]);
+        return 2;
+    }
+    if (runs < 1) {
+        runs = 1;
+    }
+    mkdir("./build", 0755);
+    mkdir("./build/bench", 0755);
+    mkdir(E2E_OUTPUT_DIR, 0755);
+
+    load_baseline(baseline_path);
+    FILE* out = NULL;
+    if (update) {
+        out = fopen(baseline_path, "w");
+        if (!out) {
+            fprintf(stderr, "couldn't write %s\n", baseline_path);
+            return 2;
+        }
+        fprintf(out, "# bench_e2e baseline, regenerate with `make bench-baseline`\n");
+        fprintf(out, "# <corpus file> <metric> <value>\n");
+    }
+
+    int regressions = 0;
+    int failures = 0;
+    printf("%-16s %-16s %14s %14s %9s\n", "file", "metric", "baseline", "current", "change");
+    for (int i = first_input; i < argc; i++) {
+        long long values[METRIC_COUNT];
+        char* path = strdup(argv[i]);
+        const char* name = basename(path);
+        if (measure(argv[i], runs, run, values) != 0) {
+            failures++;
+            free(path);
+            continue;
+        }
+        for (int m = 0; m < METRIC_COUNT; m++) {
+            if (values[m] < 0) {
+                continue;
+            }
+            if (out) {
+                fprintf(out, "%s %s %lld\n", name, metrics[m].name, values[m]);
+            }
+            struct baseline_entry* entry = find_baseline(name, m);
+            if (!entry) {
+                printf("%-16s %-16s %14s %14lld %9s\n", name, metrics[m].name, "-", values[m], "new");
+                continue;
+            }
+            double change = entry->value ? 100.0 * (values[m] - entry->value) / entry->value : 0;
+            bool regressed = change > metrics[m].threshold_percent &&
+                             values[m] - entry->value > metrics[m].slack;
+            printf("%-16s %-16s %14lld %14lld %+8.1f%%%s\n", name, metrics[m].name,
+                   entry->value, values[m], change, regressed ? "  REGRESSION" : "");
+            if (regressed) {
+                regressions++;
+            }
+        }
+        if (max_rss_ratio > 0 && !within_rss_ratio(argv[i], name, values[METRIC_PEAK_RSS], max_rss_ratio)) {
+            regressions++;
+        }
+        free(path);
+    }
+
+    if (out) {
+        fclose(out);
+        printf("baseline written to %s\n", baseline_path);
+        return failures ? 1 : 0;
+    }
+    if (failures || regressions) {
+        printf("%d regression(s), %d failure(s)\n", regressions, failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,180 @@
+// Per-phase micro-benchmark.
+//
+//   bench_phases <input.c> [iterations]
+//
+// Runs lex, parse and generate_code on the same input in isolation, each
+// phase <iterations> times, and reports throughput in MB/s and tokens/s as
+// mean +- standard deviation over the runs. Parse and codegen reuse the
+// tokens/AST from a single untimed run of the earlier phases.
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <sys/stat.h>
+#include "compiler.h"
+#include "helpers/vector.h"
+
+extern struct lex_process_functions compiler_lex_functions;
+extern struct parse_process_functions parse_process_functions;
+
+struct phase_result {
+    double mb_per_sec_mean;
+    double mb_per_sec_stddev;
+    double tokens_per_sec_mean;
+    double tokens_per_sec_stddev;
+    double best_seconds;
+};
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Lexes the file once and hands back the compile process holding the tokens
+static struct compile_process* run_lex(const char* filename)
+{
+    struct compile_process* process = compile_process_create(filename, NULL, 0);
+    if (!process) {
+        fprintf(stderr, "couldn't open %s\n", filename);
+        exit(1);
+    }
+    struct lex_process* lex_process = lex_process_create(process, &compiler_lex_functions, NULL);
+    if (lex(lex_process) != LEXICAL_ANALYSIS_ALL_OK) {
+        fprintf(stderr, "lexing %s failed\n", filename);
+        exit(1);
+    }
+    process->token_vec = lex_process->token_vec;
+    fclose(process->cfile.fp);
+    free(lex_process);
+    return process;
+}
+
+static struct ast_node* run_parse(struct compile_process* process)
+{
+    struct parse_process* parser = create_parse_process(process, &parse_process_functions, NULL);
+    if (parse(parser) != PARSER_ANALYSIS_ALL_OK) {
+        fprintf(stderr, "parsing failed\n");
+        exit(1);
+    }
+    struct ast_node* root = parser->root;
+    free(parser);
+    return root;
+}
+
+static void summarize(struct phase_result* result, double* seconds, int runs, long long bytes, int tokens)
+{
+    double mb_sum = 0, mb_sq = 0, tok_sum = 0, tok_sq = 0;
+    result->best_seconds = seconds[0];
+    for (int i = 0; i < runs; i++) {
+        double mb = bytes / (1024.0 * 1024.0) / seconds[i];
+        double tok = tokens / seconds[i];
+        mb_sum += mb;
+        mb_sq += mb * mb;
+        tok_sum += tok;
+        tok_sq += tok * tok;
+        if (seconds[i] < result->best_seconds) {
+            result->best_seconds = seconds[i];
+        }
+    }
+    result->mb_per_sec_mean = mb_sum / runs;
+    result->tokens_per_sec_mean = tok_sum / runs;
+    result->mb_per_sec_stddev = sqrt(fmax(0, mb_sq / runs - result->mb_per_sec_mean * result->mb_per_sec_mean));
+    result->tokens_per_sec_stddev = sqrt(fmax(0, tok_sq / runs - result->tokens_per_sec_mean * result->tokens_per_sec_mean));
+}
+
+static void report(const char* phase, const char* filename, struct phase_result* result, int runs)
+{
+    printf("%-8s %-28s %10.2f MB/s +- %-8.2f %12.0f tok/s +- %-10.0f best %.4fs (%d runs)\n",
+           phase, filename,
+           result->mb_per_sec_mean, result->mb_per_sec_stddev,
+           result->tokens_per_sec_mean, result->tokens_per_sec_stddev,
+           result->best_seconds, runs);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <input.c> [iterations]\n", argv[0]);
+        return 1;
+    }
+    const char* filename = argv[1];
+    int runs = argc > 2 ? atoi(argv[2]) : 5;
+    if (runs < 1) {
+        runs = 1;
+    }
+    struct stat st;
+    if (stat(filename, &st) != 0) {
+        fprintf(stderr, "couldn't stat %s\n", filename);
+        return 1;
+    }
+    long long bytes = st.st_size;
+    double* seconds = calloc(runs, sizeof(double));
+    struct phase_result result;
+
+    // Lexing, including reading the file
+    int tokens = 0;
+    for (int i = 0; i < runs; i++) {
+        double start = now_seconds();
+        struct compile_process* process = run_lex(filename);
+        seconds[i] = now_seconds() - start;
+        tokens = vector_total(process->token_vec);
+        lex_tokens_free(process->token_vec);
+        vector_free(process->token_vec);
+        free(process);
+    }
+    summarize(&result, seconds, runs, bytes, tokens);
+    report("lex", filename, &result, runs);
+
+    struct compile_process* process = run_lex(filename);
+
+    // Parsing the same token vector over and over
+    struct ast_node* root = NULL;
+    for (int i = 0; i < runs; i++) {
+        ast_arena_free(&process->ast_arena);
+        double start = now_seconds();
+        root = run_parse(process);
+        seconds[i] = now_seconds() - start;
+    }
+    summarize(&result, seconds, runs, bytes, tokens);
+    report("parse", filename, &result, runs);
+
+    // Converting to the flat form and back
+    struct flat_ast flat = { 0 };
+    for (int i = 0; i < runs; i++) {
+        flat_ast_free(&flat);
+        double start = now_seconds();
+        ast_flatten(root, &flat);
+        seconds[i] = now_seconds() - start;
+    }
+    summarize(&result, seconds, runs, bytes, tokens);
+    report("flatten", filename, &result, runs);
+
+    struct ast_arena arena = { 0 };
+    for (int i = 0; i < runs; i++) {
+        ast_arena_free(&arena);
+        double start = now_seconds();
+        ast_unflatten(&flat, &arena);
+        seconds[i] = now_seconds() - start;
+    }
+    summarize(&result, seconds, runs, bytes, tokens);
+    report("unflatten", filename, &result, runs);
+    ast_arena_free(&arena);
+    flat_ast_free(&flat);
+
+    // Code generation of the last AST into /dev/null
+    FILE* sink = fopen("/dev/null", "w");
+    for (int i = 0; i < runs; i++) {
+        double start = now_seconds();
+        generate_code(sink, root);
+        fflush(sink);
+        seconds[i] = now_seconds() - start;
+    }
+    summarize(&result, seconds, runs, bytes, tokens);
+    report("codegen", filename, &result, runs);
+
+    fclose(sink);
+    free(seconds);
+    return 0;
+}
@@ -0,0 +1,13 @@
+int main() {
+    int a = 7;
+    int b = 3;
+    int c = a * b + 4;
+    int d = c / b - a;
+    int e = 1000 - c * d + a;
+    print(a);
+    print(b);
+    print(c);
+    print(d);
+    print(e);
+    return 0;
+}
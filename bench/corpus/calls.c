@@ -0,0 +1,34 @@
+int fib(int n) {
+    if (n < 2) {
+        return n;
+    }
+    return fib(n - 1) + fib(n - 2);
+}
+
+int gcd(int a, int b) {
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+int sum_to(int n) {
+    int i = 0;
+    int sum = 0;
+    while (i <= n) {
+        sum += i * i;
+        i++;
+    }
+    return sum;
+}
+
+int main() {
+    print(fib(18));
+    print(gcd(1071, 462));
+    print(sum_to(1000));
+    int x = 3;
+    print((x + 4) * (x - 1) / 2 - -x);
+    return 0;
+}
@@ -0,0 +1,225 @@
+int expr_0(int x) {
+    int v0 = x + 78;
+    int v1 = 87;
+    int v2 = 25;
+    int v3 = 35;
+    int v4 = 45;
+    int v5 = 38;
+    int v6 = 78;
+    int v7 = 12;
+    int r0 = v0 * 481 + 70 / 3 * v3 + v3 + v7 - (v0 + (v0 * (v0 / 1 * (v0 * 207) / 6)) * 603 - 905) * v6 + (v0 * 245 + 83) / 2 + 921 * v1 + 587 - (v0 - v4 * v1 / 8 + 805) + 652 * v5 / 9 + v5 + v3 + (v0 + (v0 / 2)) - (v0 * (v0 * 95) - v7 / 6) - 587 / 3 - 340 + 393 * v1 + v3 * v7 + (v0 + v4 * (v0 * v7 + v5 + v0 * v0) - 196 - (v0 * v0 * 379)) - v0;
+    int r1 = v0 + 33 * (v0 * (v0 / 6 * 765) - (v0 / 5) * v3) / 7 + (v0 + 966) / 7 + (v0 + v1 - v3 / 1) / 4 * (v0 / 7 + 463 * (v0 - (v0 + (v0 + v1) + v3 / 8 * 264) * v3 * 770) + 487) * v0 / 7 / 2 - v0 / 1 - (v0 + v3 + v5 + 422) / 1 / 6 / 5 + v6 - v6 / 8 * 699 / 8 * 341 * v5 / 7 + 629 * 966 - 377 * 229 - v3 - v5 - 995 / 8 - 617 / 6 - v3 - 871 / 8 / 8 - 219 * v0;
+    int r2 = v0 + v0 * v7 / 1 + (v0 + 547 - 476 * 215) * (v0 / 6) / 1 * v4 + v6 * (v0 + v5 / 5 - v4) * v7 / 4 + v4 + v7 * (v0 / 4 / 9 / 2 + (v0 / 8 / 2)) / 4 - (v0 - 368 - 274 * v3 / 9) * v1 + 833 / 8 * v0 / 3 - 641 / 2 * v3 / 3 + 254 - (v0 - v3 + 296 + 205) * v4 + v6 * 498 + v7 - 422 + (v0 / 1 + v3 / 6) + v5 / 8 + 282;
+    int r3 = v0 / 2 - 661 / 8 - (v0 - v2 + 756) * 922 * v2 * 471 - 852 * (v0 * v6 / 4 + 660 + (v0 / 9)) - (v0 - v7 * (v0 - 663) - (v0 + v6 / 4 / 1)) + (v0 * v0 + v6 - 332) - (v0 / 9 - v5 / 8 + (v0 / 5 - (v0 + v0 * 862) * 470)) - (v0 / 4 + 37 / 4) / 3 + (v0 - 494) + v5 + 632 * 343 * 157 + 384 / 5 * 226 - 782 * 819 + 487 - 144 - v4 + v0 + (v0 - v4 * 934) / 8 / 9 * 548 + v6 * 841 - 39 - (v0 / 6 - 126 - (v0 + (v0 + 283) - v4 - v5) * 326) - v3 + 50 - 436 - (v0 + v1 * 596 * 920) + v2 * (v0 + 294 - (v0 + 668) - v2) / 9 / 3 / 2 - v7 - v0 * 501 + 913 / 3 / 7 + 983;
+    int r4 = v0 - v6 + (v0 + v2 - 936) * 835 - (v0 - (v0 / 9) * v2) / 2 - (v0 / 5) / 1 - (v0 * v6) / 6 - v2 / 7 + 964 - 319 * 876 * v6 * (v0 * v1 - 309 / 5) * 554 * v4 + (v0 - 359 + v7) - 78 + v3 + v0 + v0 * (v0 / 7 + v6 + (v0 / 3 - (v0 * 400 / 7 - 242 * (v0 / 7 * v1))) / 9) / 1 / 4 * 121 - 921 + v2;
+    int r5 = v0 / 8 + 235 + 720 * (v0 * (v0 / 9 * v2 - (v0 / 7 - v5 * 673 - v4)) * 468 / 8) / 7 * 592 + 128 * v4 / 1 - 0 + (v0 * v3 * v7 + 323) + (v0 + v6 + v2 - (v0 / 3 - v0 - (v0 / 9 / 8 - v6) + 137) + 833) / 3 / 3 * 997 - (v0 / 2 + (v0 / 9 / 6)) / 5 + (v0 / 1 / 2 / 6 * (v0 * 339 - v7 / 8)) + 780 - (v0 * 941 / 2) / 6 + (v0 / 2) / 3 / 8 / 2 / 7 - v4 * (v0 / 8 + v1 + v5 + (v0 + (v0 / 6) * v6)) - v0 / 6 - v5 / 9 * v4 + v0 * (v0 / 7) + 797 * 356;
+    int r6 = v0 / 8 - 918 * (v0 - 418 - (v0 * v6 + v2 / 8) / 8 - (v0 * 250 + 189)) + v1 / 4 - 598 + 707 + 704 + 693 / 9 / 5 / 7 * 763 / 3 - (v0 / 6 / 6 * v7 * v6) + 130 + v1 - v5 / 7 / 4 * (v0 + 987) + 169 * v2 * v7 - (v0 + (v0 - v2 - 582 - (v0 / 8 - 697 / 3) * (v0 + 326))) - (v0 - v5 * (v0 * v3 * 556 - (v0 - (v0 / 6 / 2)) / 2) - v7 / 4);
+    int r7 = v0 - v2 / 2 - 907 + (v0 * (v0 / 7 + v1) - v3 * (v0 - 327 / 5 / 5 - 817) + (v0 + v6 + (v0 * 62 / 6 / 6 / 8) * (v0 / 6) + (v0 + v6 - 319))) + (v0 - 855 - v6) - (v0 - (v0 - 991 - 900 - (v0 + 580 * 263 * v4 - v7) * (v0 + (v0 + (v0 - 981 * (v0 - v5 + 771 * v0))) / 8)) + v5 * (v0 - v7 + 241 - (v0 - v4) * 571)) - (v0 + (v0 - v6 - (v0 * v2 * v0) * v2) + 586 * 969) + 699 - (v0 + 552 / 8 * 851) * v6 - v7 * 848 / 4 * 518 / 1 - 189 + v1 + 339 + 844 + 12 * v7 + (v0 / 3 + (v0 * 351 / 7 * 249 - 33) / 5 / 5) / 4 / 1 + (v0 / 8 - 406 / 1 - (v0 - 619)) + v4 * 407 + v4;
+    print(r0);
+    return r7;
+}
+
+int expr_1(int x) {
+    int v0 = x + 39;
+    int v1 = 49;
+    int v2 = 74;
+    int v3 = 17;
+    int v4 = 63;
+    int v5 = 15;
+    int v6 = 26;
+    int v7 = 80;
+    int r0 = v0 / 3 + 71 * 680 / 2 / 6 * (v0 + v7 - v3 * (v0 - (v0 / 9 - 235 + (v0 + (v0 - v7 - 235 / 8 - (v0 / 5 + 285)))) + v1)) + v6 * (v0 + v4 * v6) * (v0 / 4) + 549 / 4 / 1 + v7 * 627 / 6 * v7 * 834 + v6;
+    int r1 = v0 - v0 - v5 - (v0 / 9 - 256 + (v0 * v2 * (v0 * 451))) + 618 * 297 * v6 / 3 * v5 / 9 * (v0 * 385) - 577 + 182 + v6 / 1 + (v0 * (v0 / 8 - 586) + 701 + 513) + (v0 / 9 / 1 - (v0 * 94) / 6) / 4 / 3 / 8 / 4 / 7 * (v0 / 2 / 7 * 107) + 657 - 105 * 697 + 203 * 319 + v6 - v2 * 780 - 430 - 281 * 103;
+    int r2 = v0 - (v0 / 2 - 130) / 2 - (v0 + 311 + 245 + v3 / 5) - (v0 - v7 - 600) - (v0 + v6) / 4 / 5 / 7 + (v0 / 4 + (v0 - 905 + v4 - (v0 - 464 * (v0 / 1 * v4 * v0) - 821)) - v7 + (v0 + 845)) - v3 + v2 * (v0 + 449 - (v0 + (v0 / 8 / 9) / 3 + (v0 - (v0 / 8)) / 6) / 9 - 752) * v6 + (v0 - v3 - 903 + (v0 - v0 + 30)) - 233 - 516 + (v0 + (v0 / 5) + (v0 + (v0 - 35 + 447) * v7 + (v0 * 787 + v5 - 95 * v0))) / 6 - v0 + 853 / 7 - (v0 - v2 / 1) * 891 * 286 + v3 - 902 / 6 - v7 - (v0 - v6 * 810 * (v0 / 4 / 8 - 804)) + 833 + (v0 / 1 * v2 + v2) - 108 * 10 - (v0 + 180) * 588 + v2 / 4 + (v0 - 313) + v3 / 2 + (v0 / 7 + (v0 + 131 / 6) + 803) * v5 * (v0 + 762 / 3 * (v0 / 7) / 8) + 811 + (v0 + 205 + 637 * 17 * v6) / 8 / 7 + v4;
+    int r3 = v0 + 814 + v6 * 434 - 917 + 8 + v6 * v3 * v7 + v3 * v6 - v1 / 7 - 123 / 2 - v3 / 3 - v4 + (v0 - (v0 / 8 + 667 + 114)) * 294 * 892 - 643 + (v0 / 1 - 851) + (v0 + v2 * v7) * (v0 + v7 - 529 / 9 + 112) * 367 - v2 + 486 / 1 * 785 / 1;
+    int r4 = v0 - (v0 / 7 / 7) * v3 - 612 + 54 / 3 - 542 / 5 - v4 / 5 / 2 * v5 / 7 * v5 + 337 - (v0 + v5) - 57 + (v0 * 476 + 505);
+    int r5 = v0 + (v0 * v5 / 4 - 11 * 58) / 9 + v1 + v6 * v4 + (v0 + (v0 + 129 / 1)) - (v0 + v1) / 9 + v0 * v1 / 3 + v5 - v7 - 139 + (v0 - 545 + v4 * 600 / 6) + 251 / 6 - v2 * (v0 - (v0 * 978 - 35 + (v0 * (v0 + 274) / 7 + 699))) / 5 + (v0 * v2 - 25) * 102 + 216 - v3 * v7 - (v0 - (v0 - (v0 * (v0 - v1 / 1) / 3 * 412 + (v0 - v7)) + (v0 / 3 * v2 / 8 / 8) - 670) - 64) - v3 * (v0 + (v0 / 6 + v1 - 366)) - 482 - 283 - 746 + v5 - v3 + (v0 - (v0 / 2)) - 310 / 8 * 464 + v3 + 491 - v5 / 4 / 7 - 262 / 9 * 987;
+    int r6 = v0 + 328 * (v0 / 7 * v0 - (v0 + v5 + v0 * v7) / 2) - 273 - 511 + (v0 + 669) * (v0 + v1 / 3 / 2 * (v0 * (v0 - (v0 * (v0 - (v0 - 973 + v6 / 8) - 685) - v0 + (v0 - 470 / 5 * (v0 - v6)) / 6) * v2) + 133)) / 9 - v4 / 3 - 941 + v4 / 4 - v0 * (v0 + v7 + v0 * 179 * v6) / 8 - 956 + 699 + 382 - v6 / 4 + 683 / 7 * (v0 * (v0 - 71 * v1) + 822 / 9 / 5) - (v0 + v6 * (v0 + 733 - 691 + (v0 / 3 + 384 / 1)) / 5 + v4) - 196 + (v0 * (v0 * 637)) / 7 / 1 / 1 - (v0 - 13 / 8) * v5 + 74 + v0 / 1 * v3 / 1 * v0 - 412 + v3 * 535 - (v0 - (v0 * (v0 - 78 + v3 * 60 - (v0 + v3))) + v4 + 508) - v3 / 5 - v6;
+    int r7 = v0 / 2 / 4 * 207 / 4 - v3 - 53 - 327 - v3 * 324 + 672 - (v0 / 1) - 11 * 75 + 670 / 6 / 3 * v2 + v6 / 4 * 558 + 354 - 996 * (v0 * 48 + (v0 - (v0 - 949) / 4)) - v5 / 2 + v2 + (v0 - 200 - 466) / 2 / 6 / 9 * v1 * 582 + v7 / 2 / 7 - v4 - v7 / 9 / 7 / 3 * (v0 * (v0 + 454 - (v0 - 168 / 2 - v3 / 8) - v7) + v4);
+    print(r0);
+    return r7;
+}
+
+int expr_2(int x) {
+    int v0 = x + 56;
+    int v1 = 41;
+    int v2 = 75;
+    int v3 = 68;
+    int v4 = 26;
+    int v5 = 47;
+    int v6 = 21;
+    int v7 = 41;
+    int r0 = v0 + (v0 / 5 * v0 + v6 + v6) - (v0 / 2 * v3 / 9) * v2 * 90 * (v0 / 2 - 578 / 3 - 872) + (v0 / 4) * 827 / 4 / 5 / 8 - v3 - 420 / 3 - 94 * v3 * 600 + v0 / 4 - 489 * 573 - v5 - 640 - v0 / 4 + v1 / 7 * 463 / 8 + (v0 - v2 - v3) * (v0 * 415) * 288 + v4 + 424 / 1 - 516 * v6 / 6 / 9 * 930 * (v0 * (v0 * (v0 + 121 - (v0 + v6 * (v0 - 778 - (v0 + v4 / 2) / 8 - 593) / 8 / 4) / 2) - 281) * v2 * 733 - v7) + 299 * (v0 - v4 - v2 + 537) - (v0 - (v0 - (v0 / 9 - 265) - (v0 / 4 + (v0 + v0 * (v0 * v2 - v7))) * 664) / 3 * v3 * v1) - (v0 + v7 - (v0 + 431 * (v0 / 6 - v5 - v3)) - v4 * v5) + v6 + 39 / 9 / 9 * 383 - v6 + (v0 + v0 + v7 / 9 + (v0 / 8 - (v0 / 6 - (v0 * v1)) * (v0 - 468 * v1))) / 2 + (v0 / 5) - v4 / 8 - 445;
+    int r1 = v0 / 3 * (v0 + v3 + 870) + 532 * v7 * (v0 * v5 - 524) - v4 + 542 * v7 - 111 / 2 * 711 - 352 + 580 * v7 - 130 / 2 * 564 - v4 / 8;
+    int r2 = v0 + 680 + (v0 * (v0 - (v0 / 1 - v6) + v3) / 3 + 8) * (v0 / 7 - 808 * (v0 + (v0 * v3 / 4 + 233) - 735 * v6 - 452)) * 646 + (v0 * 427 + (v0 * v0 / 7 / 8) / 8) + 677 * 884 * v0 / 9 * v7 + v2 - 396 / 7 * 137 + (v0 + v0 * 770) + v6 * 69 * 496 * (v0 + v6 / 2) - v3 / 4 + v3 + v6 + (v0 - v2) * 355 - v3 - v2 - 42 / 6 + (v0 + v6 + (v0 * (v0 / 3) * v2)) - 997 + 420 + v3 - 434 + 262 * v6 - 638 / 6 / 3 * (v0 - (v0 - v2 * (v0 - 114 - v2 * 901 - (v0 / 1 - 739 * v7)))) + (v0 + v1 * v4 - v6 * v7) / 8 / 5 / 5 - (v0 + v1) + v4 + (v0 + 422 + v2 + 716) / 6;
+    int r3 = v0 * 133 / 1 + 349 / 7 + 204 / 5 + 108 / 9 * v5 - 155 - v0 / 4 - v5 / 6 + 91 - (v0 * v0 / 9 + (v0 + v6 - 529 - 280) * v0) * v3 / 2 / 4 * v1 / 9 - 423 + 545 * v4 + 662 + v7 / 1 - 158 * (v0 * v4) + 853 / 1;
+    int r4 = v0 + 50 + 701 + v0 + 850 - (v0 / 5) / 5 * v7 * v6 - v3 + 90 - v2 / 5 / 2 + v5 / 6 * v0 * 57 * 553 / 6 * 718 - 456 + v4 / 7 * 827 * (v0 + (v0 - v0 / 4)) * v2 / 5 * (v0 + (v0 - 841) / 2) + v6 / 1 + (v0 + 313 - 666 + v0) - (v0 * (v0 - v5 - 570 + v2 / 4)) + 43 - (v0 - v2 + (v0 / 7) + (v0 / 6 - v7 + v3 / 8)) + (v0 - (v0 - v5 * (v0 + v2 + 295) / 2) / 2 * 658) + 985 / 4 - v0 * v0 - 778 - (v0 / 6 / 7) + v0 - v2;
+    int r5 = v0 + (v0 * v4 + (v0 + v6 * v6 + 202)) * 720 - (v0 - 287) + 624 / 8 - v5 + v1 - v1 / 3 + v7 - v5 - 561 + v5 + 918 * (v0 - 863 * v3 + v6) + (v0 / 9 + 444) / 7 + (v0 / 7 * v1 - v5) / 8 * v2 / 9 + (v0 - 400 / 3 * 278) - v4 / 7 + 185 * 129 + 269 / 3 - (v0 / 4) * v3 * 509 - v1 / 1 + v0 + (v0 * v1 / 7) * (v0 * v1 - 308 - 378 / 8) * 235 + 989;
+    int r6 = v0 / 6 - v1 - 682 / 9 - 362 + 142 - 521 - v1 - v7 * 648 + 698 / 7 / 4 - 300 - 17 - v4 * 731 + 875 - (v0 - 403 + v5) / 7 * v2 - v4 / 1 + 174 - v0 + v2 / 3 - 644 / 3 + (v0 - 882 + 562) - v5;
+    int r7 = v0 - (v0 - 672) / 4 * 490 * v7 - v7 * 895 + (v0 * 101) + v5 / 8 - v2 * (v0 * (v0 - 275 + v3)) / 4 - (v0 * 492 - v5 - 276) + v5 * v2 - (v0 - 28 * v6) - 382 / 4 - v7 - v1 + (v0 * (v0 * (v0 * v4) * 616 / 2) - 840 - 454 * (v0 * 670 + (v0 - 796 - 981 / 2 + (v0 / 1)) - v1 + v2)) - 244 * (v0 + (v0 * 245 / 8) + (v0 / 8)) + (v0 * v5 - 792 + (v0 * 318 * (v0 + 630 / 3) * 226)) / 7 - (v0 * (v0 / 6 - v3 + 960 * v0)) + v2 * (v0 * (v0 - v1 + v2) - (v0 + (v0 - (v0 * 972 + (v0 - 572 / 2) * 353) * 625) * 258 - (v0 - (v0 + 839 / 7) - 199 + 534))) - (v0 + (v0 / 6 / 3 - (v0 / 2)) - 901) / 6 * 618 / 9 + (v0 + 917 * (v0 - 865)) - 281 / 9 / 3 * 164 * 56 / 8 - (v0 * (v0 / 4 / 6) / 7 + v6) - (v0 - 605 + v5) * (v0 / 1 * 748) - (v0 / 2 * 585) / 9 - v5 + 432 * 744 + v7 / 5 - v2 - 291 + 459 / 9 + (v0 - (v0 - v6 * 22 / 2) - 33 - v6) * (v0 - v5 / 4 - (v0 / 1) * (v0 / 2 + (v0 + 624 + 727 * (v0 + 310) + v4)));
+    print(r0);
+    return r7;
+}
+
+int expr_3(int x) {
+    int v0 = x + 66;
+    int v1 = 95;
+    int v2 = 14;
+    int v3 = 62;
+    int v4 = 36;
+    int v5 = 16;
+    int v6 = 85;
+    int v7 = 60;
+    int r0 = v0 / 1 / 5 + 6 / 1 + v0 - (v0 - v7) + (v0 + 745 - v4 - 79) + v3 - 597 * v5 / 8 * v2 + v2 - (v0 * 430 / 7 * 104) / 9 / 1 * 178 - v4 + v3 / 4 / 4 + v3 - v3 - (v0 + 246 - v0 - v2) + v6 + 441 * (v0 + 475) + (v0 - v5 / 9 * (v0 / 4 - 504 - v0 / 3)) / 3 / 5 * (v0 / 8 * v0 + 424 + v1) * 893 + 98 / 6 + v6 / 7 - 959 / 6 / 2 / 5 / 1 / 5 * (v0 * v7) * v3 - (v0 * 849) * v6 + 801 * (v0 * v7 * 54 * v2 - v1) - v2 / 3 * v3 * (v0 + v5 + v2 / 2) / 6 - v3;
+    int r1 = v0 - 894 + v7 - 77 / 5 + 85 * 456 + 871 - 886 * v3 + v2 - (v0 / 8 + v0 - v2 - (v0 / 4 * v0 + (v0 / 3) - v6)) - (v0 - 862 + 71 + 959) - 119 + v5 - (v0 * 780 + v0 + v4) / 4 / 6 + 686 / 4 / 5 + v0 * v5 * v4 * v7 / 5 - 928 + v1 + 769 - (v0 / 8 * v0 * v1) / 2 * (v0 * v1 * (v0 * v7 * v7 + v2)) / 4 + v1 - (v0 + (v0 + 728 - v1) + 51) / 2 + 310 + v1 * 301 / 1 * (v0 - 548) - 889 + 610 / 9 - 741 - 482 * (v0 - 388 / 7 / 4 * 409) + 916 - 416 / 9 / 4 / 9 + 265 - (v0 + 559 * 683 / 3) - v7 / 3 - v0 + (v0 * 454) * (v0 - 583) + (v0 / 5 + v5) + v1 / 5;
+    int r2 = v0 / 9 / 7 * 223 * 390 - (v0 + (v0 - 39)) - v2 - 462 - v1 * (v0 * 672) - 562 / 3 + (v0 / 1) - 952 + (v0 * 170 / 2 + v7 - v1) / 5 / 8 + (v0 + v2 - 262) - v7 - 207 / 5 * v7 * 102 * 889 / 5 / 7 + 871 + (v0 + 877 + 800) - v7 / 9 - 467 + v5 / 1 / 2 - v5 + 181 * (v0 / 4 - (v0 - (v0 / 3 + (v0 * v3)) * 530) / 2 - v7) * 662 * 96 + v3 + 748 / 1 + v4 / 2 / 4 / 9 + v3 - 761 + 874 / 5 + v3 / 9 + 946 + (v0 + v0 - v2 + (v0 - v3 + v0 - v5 + (v0 - 922 + v3 / 7 * 315))) - 789 + 952 * 546 * 164 + 146 + 477 - 563;
+    int r3 = v0 / 6 / 4 / 8 + v3 / 1 + (v0 + 550 * v2) - 523 * (v0 + 569) / 6 / 6 * v6 + v7 + v5 / 1 - (v0 + v0 + v5 - 136 / 9) + 456 * (v0 / 7 * (v0 * v5 / 1) / 8) / 5 + (v0 / 3 / 1 / 1 * 711) / 9 / 5 - (v0 * (v0 * v5 + (v0 - (v0 * 582 / 3 / 4 + 337) - 825 + 40 / 3) * v3) + (v0 * (v0 * v1 + 994 / 4))) * 595 / 4 - 269 * (v0 * 862 / 5 + 237 + (v0 - v2)) - 187 - (v0 - v2 * (v0 / 9 / 9 + v1) * v6 + v5) + (v0 - v4 + (v0 + 216) + (v0 + (v0 / 5 / 4) - 990 - (v0 + v5 - (v0 * 937 / 8) * 264) - 907) * (v0 * v1)) * v3 + 739 - 531 - 46 + (v0 / 2 + v6 + (v0 + v7 / 8)) * v2 - (v0 * v4 + v2 / 3 + 949) / 9 - 385 - 62 - 359 - 934 / 2 - 618 - v0 + (v0 / 5 * (v0 - (v0 + 894)) + 491) * 399 - v5 + v0 + v7 - v6 / 8 - (v0 / 6 / 7 / 5 * 578) / 4 / 2 + v4 / 9 * 429 - (v0 * v7) - 682 * (v0 - 708 * v2);
+    int r4 = v0 + v7 * v4 * 281 - v3 / 6 * 775 - v5 - v3 / 6 / 2 + 415 / 4 * v6 / 5 / 4 / 1 + v3;
+    int r5 = v0 / 7 - (v0 + 477 - v4 / 8) + v1 / 3 + 630 - 594 - (v0 / 6 * v4) * 105 - 439 * v1 - v1 + 964 / 6 + (v0 / 9 / 6 - v4) - v4 + (v0 + 543 - 563 * 954) - v3 + (v0 - 99 / 6 + v3) * v7 - 708 - (v0 * (v0 - 457 * (v0 / 1 / 5 / 7) - 561 / 1) * 230 / 1 + (v0 / 4 * 687)) * v1 / 7 * 154 - 323 / 8 - v3 / 8 - (v0 / 1 * 487) * (v0 * (v0 / 6 / 1 + 531 - v6) * (v0 * 999 + v7 + v2 + v7) + v6) * 100 + v6 * (v0 + (v0 - 236 / 8) / 3) - 983 / 1 * (v0 - v5 - v2) + 571 * 103 - (v0 / 6 - (v0 + v4 / 4 - 711 - 35) + (v0 + (v0 + 952 + 606 - v0) * 463) * 232) + v5 * 573 / 7 - v1 / 8 * (v0 + 719 * 972 * v1) - 542 + v4 / 8 / 8 + (v0 + v6 - v3) - (v0 * 150) + v4 * (v0 * 106);
+    int r6 = v0 * v1 / 6 * v0 - 469 + 652 * 172 - 693 + (v0 - v6) + (v0 * 556 * (v0 / 6 * v6) * v3) * v1 - (v0 * 774) * v7 * v5 - v3 * v3 + 310 * (v0 - 213 / 2) / 8 - (v0 - v0 / 4 * v3) - 930 - 422 + 728 - 547 / 7 / 3 * v1 * v1;
+    int r7 = v0 - 944 + v5 / 2 * v7 / 6 * (v0 * v4) + (v0 - v3 + 310) - 9 + v0 - (v0 * v7 / 5 / 5 - 707) + (v0 * (v0 + 756) * 153 / 7) + v0 + 862 * 120 - 18 + 81 / 1 + v6 - v4 * (v0 + v7 + 227 * (v0 / 1)) / 2 / 3 / 4 + v0 / 1 - 381 + (v0 - v3 * 940 * 592) - (v0 * v3) - 350 + 62 + 697 / 5 / 7;
+    print(r0);
+    return r7;
+}
+
+int expr_4(int x) {
+    int v0 = x + 21;
+    int v1 = 17;
+    int v2 = 62;
+    int v3 = 59;
+    int v4 = 73;
+    int v5 = 16;
+    int v6 = 43;
+    int v7 = 23;
+    int r0 = v0 / 3 + v1 + v6 / 8 + 113 * 888 * v0 + 568 / 3 / 9 / 4 - v4 + (v0 / 8) * v0 / 1 - (v0 * v0) + (v0 * 286 * (v0 / 7) / 6 + v2) + 816 - 81 * 53 * (v0 - (v0 * 995 + 698 * (v0 * (v0 * 404 + v1 / 9 / 4) / 4 + 411)) * v3) * 83 - v6 + v1 - (v0 + v1 + v7 - (v0 * v7 / 5) - (v0 * 882 * v4)) - (v0 / 3 - v2 - v6 * (v0 - v7)) * 678 - 745 / 5 - v5 * (v0 * v4 / 3) / 3 * v7 / 8 - v4 / 8 / 4 - 664 / 5 + (v0 * 279 / 2) + 750 * 16 * 322 * 216 * (v0 / 6 / 3 - v3) / 6 + (v0 - 322 / 5 + (v0 * (v0 - 760 / 3 / 2) / 8) / 7) * v5 + v6 + (v0 / 7 * (v0 - (v0 * 517 / 4 - v7) + 569 * 439) / 1) + 342 - 319 + 399 * v2 / 8 / 3 - v6 / 6 - v7 * 487;
+    int r1 = v0 - v7 + v1 + 82 / 1 / 8 / 4 / 3 - 437 / 1 * 347 + 838 * 913 / 3 / 7 / 1 - v4 / 7 / 5;
+    int r2 = v0 + v0 * v4 + 565 - (v0 * 645 - v6 - 830 * 965) / 8 - v4 - (v0 * 832 * (v0 + v7)) - v0 - 967 - v2 + (v0 + 408 + (v0 / 6 / 5 + (v0 * (v0 - 722 * 149 + (v0 * 417 / 9 / 9 * v5)) / 8 * v4) / 6)) - (v0 * (v0 - v5 + 123 + (v0 - v5 + v7 + v0 / 7) + 634)) / 2 * (v0 / 2) + 106 + 566 * (v0 * 553 / 1 - v0 - 49) - v3 * 337 - (v0 * 464 + v6) + 8 / 3 - (v0 / 7 + v2 + v6) * 465 / 1 - (v0 + (v0 + 774 + 966 / 1 - 11) * 771 + (v0 + (v0 + 812 * 545 * v0)) - 922) * v0 + 459 * v3;
+    int r3 = v0 - 745 * (v0 - 799) / 3 * 386 - v2 * v7 + v6 + v1 - (v0 - 782 * 89 - v2) - (v0 + 419) - (v0 - v3) * (v0 - v4) * (v0 * (v0 * (v0 + v6 * (v0 * (v0 * v5) / 6 + 0))) + v3) - v2 + v7 + (v0 / 4 + v3 + v1);
+    int r4 = v0 - 931 + v0 / 1 + 681 * (v0 - 301) / 2 + v3 - 215 / 1 + 617 - 400 - (v0 + (v0 * (v0 - 896 + (v0 / 1) * (v0 / 5) / 2)) / 9) + 371 + 719 * 897 * 701 - (v0 + v6 + (v0 * v5 * v0 / 4 + 493)) * (v0 * v1 + (v0 / 5 / 1) * (v0 / 8)) + v7 + 63 * 11 + v1 - (v0 / 2 - 984) + 830 - (v0 + 876 * (v0 + (v0 / 1 * (v0 + (v0 - v1 + (v0 + 735 + v1 - 213 + 412) * (v0 - 310)) - v0 / 3 - 216) - (v0 / 9 + 68 + 680))) - v2 / 8) / 1 + 805;
+    int r5 = v0 - (v0 * (v0 + v0 / 4) - v5 * v5) * 209 * (v0 - v6) / 6 / 9 - 282 + 837 * 719 * (v0 - 975 / 3 + 307) + 374 / 8 + 261 + (v0 * v4 - 145 / 2 / 6) - v1 / 5 / 3 * v0 + (v0 / 3) - 615 / 9 / 6 + (v0 / 6 - (v0 + (v0 / 9))) + v7 + v1 / 9 * 724 - v2 * (v0 * v3 - 157 + 50);
+    int r6 = v0 * v5 + v7 + v2 - v5 - v1 / 9 + 807 * v3 * v6 + v3 - (v0 - v0 - 442) - v7 * v3 - v1 + (v0 + v3 + 587 - v0 - v7) * v7 / 9 / 7 / 8 / 1 / 4 + (v0 * (v0 * v1 * 365)) - (v0 / 4 - (v0 / 1 / 4 - v1 - 188)) / 2 - v7 * v7 + (v0 / 4 * 466 * v0 + v4) - v5 + v4 - 789 + v6 - (v0 / 4 + (v0 / 1 * (v0 * v6 * (v0 - 188)) + 699) - v0 / 4) / 7 + 2 + (v0 * v2) * (v0 / 2 / 5 / 6 - v1);
+    int r7 = v0 + (v0 + 143) / 2 * v2 + 469 + 871 + v2 - 211 / 1 + 282 * 870 + v1 + 914 / 9 + v1 / 7 * (v0 * (v0 / 8 * v4 / 9) * 277 / 7 - 744) - 627 - 973 + 231 * 915 * v7 + v6 - (v0 * 906 - 384) / 3 * (v0 / 8 / 1 * v7) - v2 - 154 * (v0 + 786) + v7 + (v0 / 1) * v5 * 261 / 3 * v6 * 820 * v1 / 9 + 168;
+    print(r0);
+    return r7;
+}
+
+int expr_5(int x) {
+    int v0 = x + 3;
+    int v1 = 96;
+    int v2 = 38;
+    int v3 = 73;
+    int v4 = 4;
+    int v5 = 38;
+    int v6 = 31;
+    int v7 = 29;
+    int r0 = v0 * v1 + v7 - 249 * 388 - v7 / 7 * v1 * (v0 - (v0 * v3)) - v4 / 4 + 755 / 4 + v1 / 9 * v3 / 8 / 4 * v2 + v6 + v0 - (v0 / 2 + v4 * (v0 * v6) + 656) - v1 + 907 * (v0 + (v0 - v5) / 4 - 787) / 8 - (v0 * 760 + 508 * v7 - v2) * (v0 + (v0 / 5 + v7 / 5) * v6) / 1 * 792 / 2 / 3 - v4 * 253 - (v0 / 6) / 8 * v7 + 342 / 1;
+    int r1 = v0 - v3 * 136 + v1 + 147 / 2 + (v0 * 856 / 8 * (v0 + v3 * (v0 - v7) + 874)) * v5 / 4 / 1 - 361 / 4 * (v0 * 269) / 8 + 285 / 4 / 4 * 867 / 4 + v1 - v1 + 462 - v3 - 964 * v4 / 3;
+    int r2 = v0 * 762 * (v0 / 6 / 4 / 2) * (v0 + v2) - 357 + 965 * v3 - (v0 - v5 + v2) / 2 - v7 * 13 - 293 - (v0 + v6 / 5 / 6) * 594 + 576 + v3 * (v0 * v5 * 206) / 5 / 6 - 104 - 317 - v6 - 458 - 623 + 107 - 33 / 4 * v1 + (v0 * (v0 / 2 + v2)) + v4 - v3 * 462 + v7 / 8 - 987 + (v0 * v5 / 3) / 2 / 6 - v1 * 563 + 423 * v6 - v4 / 6 * (v0 + v1 + 152 - (v0 / 9 * v3 - 403 - 728) + v4) / 8 - v4 * v6 / 5 - v4 + v7 / 1 + 35;
+    int r3 = v0 - v5 - 482 / 3 + v3 - 562 / 2 - v6 - v1 - 806 * 762 - (v0 * v5) * (v0 * 970) + (v0 - v3 + (v0 + v4 + v1) / 1) - (v0 - v3 - (v0 / 3 - v6) * v1 - v1) * v4 - (v0 / 2) * v7 - (v0 * (v0 / 2) / 7) + 134;
+    int r4 = v0 + 759 / 3 - 557 * (v0 * v0 / 3 / 1 - 897) * 885 / 3 * v3 / 4 + v1 / 3 - v4 / 6 / 5 * v0 - v0 / 7 / 7 / 1 / 2 - 417 + v4 + (v0 + v3) / 8 + (v0 - 255 * 467 / 9) + 525 - v1 * (v0 / 5 / 4 - 958) - v2 / 5 * 954 + (v0 * v7) - 85 - (v0 + v0 / 8 + v7 + (v0 * v6)) + 778;
+    int r5 = v0 * 105 + v3 / 7 + 9 + 64 - (v0 * v3) + 312 - (v0 - v7 + (v0 * (v0 / 8 + v0) / 8)) + (v0 / 9) - v0 - (v0 + v4 + (v0 * v5 / 1) / 4) / 4 - v4 - 332 / 5 * 666 - v4 / 2 / 5 * v7 - v3 + (v0 * 127 * 47 - v2) - 158;
+    int r6 = v0 + v3 + 350 / 6 * 882 / 1 / 3 - (v0 - v6 - v7) - v0 - v6 - v7 + 972 - (v0 - v4) * v1 * v4 - 360 - 115 + (v0 + v6) + 389 - v4 * v7 / 5 + v6 / 7 * v0 * (v0 + 412 * 517) + v6 - (v0 * v7 - v3 + v7) + v7 / 6 * v2 - v4 - (v0 + v6 / 9 / 4) - (v0 * v7 - 646) - 394 - v7 - v4 - v3 / 9 + v0 / 8 * 617 / 9;
+    int r7 = v0 + v7 + v3 + (v0 - v6 - v0) - v3 - 916 - 529 + 520 * v3 * (v0 / 8 + v2 + 250 / 7) * (v0 - 384 / 9 / 3) * v3 * (v0 + v0) / 2 - v6 / 6 * (v0 * v4 * v1) + v5 / 6;
+    print(r0);
+    return r7;
+}
+
+int expr_6(int x) {
+    int v0 = x + 80;
+    int v1 = 84;
+    int v2 = 35;
+    int v3 = 100;
+    int v4 = 90;
+    int v5 = 63;
+    int v6 = 49;
+    int v7 = 66;
+    int r0 = v0 * 941 + 768 - v3 + v7 + v2 + 182 * v5 + v2 * 181 + 57 + v1 * 659 / 2 + (v0 * v0 + v5 * 399 + 542) - v0 * 17 - 994 + 799 + 259 + 917 + (v0 - (v0 - v1) * (v0 * v2 - 638 + (v0 / 4)) / 2 * (v0 + v4 - (v0 - 748 * (v0 / 6 / 8 - v4) - (v0 / 7 + v4 / 3) + v0) * (v0 + 56 * 406 + v6 + v1))) - 433 * v7 * (v0 * v7 - 77 - v3) - v7 / 8 * 528 / 3 / 7 + (v0 * (v0 - (v0 - 619 + 826 * (v0 / 8)) / 3 * v4) + v7) + v7 * v7 - 833 - 872 / 4 + 530 * 464 * (v0 - v3 + v4 - 725) * 625 + 139 * v5 / 7 - (v0 / 4 * v2 + (v0 - 566)) * (v0 / 3 * v5 - v2 - (v0 - 702));
+    int r1 = v0 / 6 * 545 * (v0 - v4 - 339) - v1 - v0 / 9 * v3 - (v0 - 812) - (v0 * v4 + v3 * v6 * v1) - 899 / 6 - 327 * 820 / 7 + v2 / 9 - (v0 / 1 / 4) / 8 + v2 + v4 - v0 * 684 + v5 - v6 + v5 * 724 - (v0 - 748 * 358 / 3) - 3 / 8 / 4 + v1 / 6 / 8 - 382 / 8 / 9;
+    int r2 = v0 + 993 - v3 / 9 * 526 * (v0 - v0 / 4) / 2 - v5 * (v0 - 167 + 51 - 723 * v2) / 5 - (v0 / 7 / 1 * (v0 * 923 + (v0 - 216 - (v0 * 3 * (v0 / 9) * (v0 / 5 + 270 + v2 - v4) - v3) - (v0 / 1 + 40 + 746) / 5))) / 4 - v0 + 396 + v1 * (v0 / 1 + 804 / 6) + v7 + 209 / 8 + (v0 + v2 / 9) - 601 + v4 / 2 - (v0 / 3 * (v0 + (v0 / 7 * (v0 + (v0 * (v0 + 766 / 3) / 5)) - 29 / 2)) + 756) + (v0 + v7 / 6 + v1) * 413 + 919 - 775 / 7 + v7 * (v0 * (v0 * v5)) / 1 - v6 + 89 - v6 + (v0 + (v0 + v5 - (v0 + 799) - (v0 - (v0 / 2)) - v4) * 297 * (v0 / 9 / 8)) + 186 / 8 - v7 + v6 / 2 / 2 * v6 + (v0 / 2 / 8 * 613) + 909 + v0 + 692 * v4 / 1 + 619 / 9 - 937;
+    int r3 = v0 / 2 - v5 / 7 / 1 * v3 * 247 - 629 / 3 * v2 + (v0 - v2 + (v0 - (v0 + (v0 - (v0 - v0 / 3 * v3 + 610)) + v5) - v5 + (v0 + (v0 * 933 + 574) * 725 * (v0 * 971) + (v0 * 486 * (v0 / 9))) * v4)) * v4 + 709 * 293 * (v0 / 5 - 229) * v5 - 838 - 927 * v3 - (v0 * v7) * 21 * (v0 + v1 - 116) / 9 / 2 + 496 / 4 / 1 + 146 + (v0 / 3 / 8) - v4 / 7 * 811 + v5 * (v0 * 670 * (v0 - 971)) / 7 + (v0 + (v0 / 8 - 732 + (v0 / 1 - v2 + v2 * v2) * v4) * (v0 / 7 * (v0 / 1 + (v0 - 461 + 726)) / 3) + 918 * 334) + 179 - (v0 + (v0 * v1) * 131 + v1 + 972);
+    int r4 = v0 - 247 * 863 + v0 * (v0 / 8 * 337 - v1 * (v0 / 4)) * v7 / 3 + (v0 + (v0 + v6 - 287 + (v0 - 195 - v3 / 1) + 560)) + (v0 * v3 / 5 * 627) - 503 - (v0 / 3 - v0) * v4 * 607 - 289 - (v0 + 86 - (v0 - 963 * v2 - v7) - (v0 + 574 + 501 * v4)) - v6 - (v0 / 4 * v5 - (v0 - v3 + 433 * (v0 - 362 + 701 + v7) / 8)) - v0 / 9 * v1 * v6 - v1 - v2 * 294 - 196 * (v0 + 248 - v5 - 28 - v1) + 384 * 133 * v6 + 771 / 9 * (v0 / 8 + 855) * 73 * v4 - 884 / 1 - (v0 + 831 * v1 / 3) - (v0 * 637) / 2 / 1 / 1 / 8 - (v0 * (v0 / 5)) - v3 - (v0 * 376) / 4 * v0 + 26 / 1 - (v0 / 2 - (v0 * v7 + v1) - v6) / 3 * 654 * 729 + v1 * 564 / 3 / 3 / 7 + 235 * 330 / 6 - (v0 - 661 * v1 - v3) + 255;
+    int r5 = v0 * v2 / 9 / 3 - v0 / 4 - v0 + 23 * 605 * v7 * (v0 * (v0 / 1) - v0 / 7) / 4 / 6 * 361 / 2 - 283 - 828 * v6 / 5 + 373 + v1 / 2 + 35 - v1 - (v0 + 888 / 8 * (v0 + 745)) - (v0 / 1 - (v0 - 109 - v1 - v0 * v0) + v0) / 9 * 259 - 309 - v2 / 7;
+    int r6 = v0 / 6 - v7 * v6 * v6 + 569 * 907 + 879 + 338 / 4 / 9 - v0 * v5 - (v0 / 3 * v5) * v4 - 633 + (v0 * (v0 * 688) + (v0 - (v0 - 975) * 970 + 115) * (v0 / 6 + v5)) + (v0 * 667 * 529) + v7 / 8 / 4 / 3 + v5 - v6 + (v0 - 622 + (v0 + v4 * 769 - v0 - (v0 / 8)) * 763 - 866) / 9 + v3 - v7 + (v0 - 185) - (v0 * (v0 * v2) + 377 / 9 - (v0 * v5 / 6 / 4)) - v0 - 809 / 5 - v7 + (v0 * 216 * v3 / 4 + 181) * (v0 - 998 * (v0 / 9)) - 248 * v1 + 887 + (v0 - (v0 / 9 + v0 * (v0 + 900 * (v0 - 160)))) * 358 / 2 + 523 - v6 - (v0 + v7) + (v0 + 636 - v5 + 46) - 192 + (v0 - 487 * (v0 / 7 * (v0 - v2 - 815 / 6 + 688) + (v0 * (v0 - (v0 - v2 / 3) + v4 * 693) / 9)) + v6) + 195 / 9 + v3 + 372 / 3 + 838 - (v0 / 3) * v0;
+    int r7 = v0 + 970 + v4 / 5 - 845 / 1 + v3 - 284 - 807 / 7 - 528 * (v0 * 521 * v1) / 1 + 290 / 8 + (v0 + 700 + 496 * 774 / 8) / 4 / 7 / 6 / 8 + (v0 * (v0 / 8 / 5 - (v0 + v4 + 591 - (v0 - v1) + 119)) - v1 * v6) / 8 * (v0 * 400 * (v0 * 272)) * v3 * v0 - (v0 - v5 - v1) - 787 / 3 / 3 * 856 * v7 * v3 / 1 * (v0 / 2 * v6) / 1 - v5 / 2 * (v0 * 762 - 881 * (v0 / 6)) - v5 + 342 + 512 / 5 + 726 - 609 * v5 / 5 * 669 + v3 - v2 - 711 - v4 * 168 * (v0 * (v0 * v4 - v6)) * 907 * v2 / 9 + 74 + v7 * (v0 / 7) + v3;
+    print(r0);
+    return r7;
+}
+
+int expr_7(int x) {
+    int v0 = x + 15;
+    int v1 = 14;
+    int v2 = 84;
+    int v3 = 56;
+    int v4 = 39;
+    int v5 = 100;
+    int v6 = 8;
+    int v7 = 78;
+    int r0 = v0 / 3 * v1 + v1 * v6 * v2 / 1 / 2 * v5 - v1 / 2 / 1 + 246 + v1 + 28 - 502 * (v0 * v4 / 3 - 763 / 4) + v2 / 3 * v7 - (v0 / 1 / 9) * v0 - 701 + v3 + v7 * v0 * v5 * v0 / 1;
+    int r1 = v0 + 758 + v1 - 15 / 8 + (v0 / 1) - 825 + v2 + 544 + 365 - v4 / 2 + v2 * 496 + 469 * (v0 / 2 * (v0 * v6 * 569 + (v0 / 6 / 6 + 797)) + (v0 * v3 + (v0 * (v0 / 9 - (v0 + v6)) / 6 + (v0 * (v0 + v4 * (v0 - 386 / 1 - 639) * v6) * 803) - v6) / 5 / 4)) - 952 / 5 * (v0 * (v0 - (v0 * 658 + (v0 - (v0 * (v0 - 489 + v4 + v0) * v3 - (v0 / 7 - v5 - 889) - (v0 * v6 + 529 - 771 * v1)) * 391 / 1 * v7) / 3 + (v0 + 412)) / 6 - (v0 + (v0 + v0)) - (v0 / 8 / 2 / 3 / 6))) * 442 - v1 - v0 + v0 * v5 / 4 * 898 + 743 - v2 - 827 * (v0 * v1 - 48 / 7) / 8 - v7 + (v0 * 966 / 7) - v1 - 61 + 399 + 504 / 6 - 645 - 129 + v5;
+    int r2 = v0 * 567 + (v0 - v1 * 890 - v5) + (v0 / 3 * v2 * 757) - 188 + v5 * 488 - v2 * 974 / 8 - v5 + v1 / 7 + 469 / 5 - 523 + v5 * v6 * v3 + v1 / 5 * v2;
+    int r3 = v0 * 85 - 223 * (v0 - v1 / 9) + 838 + v1 * (v0 / 1 + 996 * 305 - (v0 - v6 / 1 + 729 / 8)) + v7 * (v0 * 751) / 9 - 297 - (v0 + v6 + 134) + (v0 - v6) * v3 * 322 / 4 + v0 * (v0 - v7 - 15 / 6) / 8 + v3 / 7 + v3 - 446 * v4 + (v0 + (v0 + v5 + (v0 - (v0 + v1 + v3 / 4 * 382) * (v0 / 6 + 799 - v3))) / 6) * 45 * v1 + 627 + v7 / 7 / 5 * (v0 + 584 - 236 + v4 - 171) + v2 * (v0 + (v0 * (v0 - (v0 * (v0 / 4 * (v0 - 627 * 630 / 4 / 1) * (v0 - 479 * 542 + 588) * (v0 + 762)) / 5 * (v0 / 5 * v6 / 5) - v4) - v4))) * v6 * 100 / 7 / 9 + 102 - (v0 + v6) + (v0 * 951 / 3 + 307 + 835) - 248 - 628 - 614 + v1 * 908 * v1 + 554 - v3 - v2 + v7 / 1 / 1 + v0 + (v0 + (v0 / 2 - 341) / 4 * v6) + v1 + 668 - v3 + 161;
+    int r4 = v0 - 916 - v6 * v7 - v6 / 2 / 5 * 446 * 285 - (v0 * 743 * (v0 / 5)) / 1 + v3 - 951 - v0 / 5 * 709 + 554 / 7 / 5 / 8 * (v0 * (v0 * 842)) * v7 / 6 * 544 - 831 - v5 - v4 + v2 / 9 + (v0 - v1) * (v0 * 21 + v4) * 449 / 9 * 139 - 86 - (v0 * 241 * (v0 + v7 - (v0 / 5 * 359 + v7) + (v0 * 324 * v4 - (v0 / 3 / 4 - 557))) / 9) - 7;
+    int r5 = v0 * (v0 + 741 / 1 + (v0 * (v0 * v5)) + v4) + (v0 + v4 + (v0 - 637 + (v0 + 634 + (v0 - (v0 + v5 - (v0 / 2 / 7) + 683 / 1) / 8)) / 1 * 195)) / 9 - 596 + 857 * v3 * v7 + (v0 + v7 * 333 - v7 + v0) - 994 - (v0 / 4) - 550 + v7 - 221 / 6 - 139 / 2 / 6 - 393 - (v0 + (v0 + v7) / 7 + 292 - v4) + v4 * v1 - v7 + (v0 - 119 / 3) / 6 - v2 / 6 * (v0 * v6) / 3 / 7 - v0 + 411 / 6 - 887 + v4 + (v0 + v4 - 24 + 877) - v4 - v2 - v4 * v4;
+    int r6 = v0 - v7 + (v0 / 5) * 401 + v4 - v0 / 3 * 2 / 3 / 2 - v7 - 553 + (v0 / 4 + (v0 - 660 * 732 + 596 * v0) / 8) + (v0 - 260 * 287 - v6 * v4) / 3 + 446 - v1 / 3 + v4 / 8 + (v0 * v3 - 243 / 2) / 9 / 4 - v4 / 3 - 13 + v0 - 861 + 20 + v3 + 441 * (v0 - 43 + v5 * 220 - (v0 - 273)) + 484 - v6 - 893 - v7 + (v0 / 4 / 8) + 6 * 585 + v5;
+    int r7 = v0 * v4 / 7 + v1 * (v0 + (v0 + 320 + v2 + (v0 - 401 - (v0 / 5 / 5)))) + v2 * (v0 / 9 - (v0 * 244 - (v0 * (v0 + v6 / 6) * 543 * v5 / 1)) / 9 * v2) + 737 + (v0 - 134 * 655 * (v0 / 6 * (v0 * v7 + 51))) * (v0 / 2 * (v0 / 2 * (v0 - (v0 / 8) + v6) - (v0 - 769) / 5)) + (v0 * (v0 - v3 - v1 / 5 / 8) / 3 + 604 * 274) - v3 / 5 + (v0 / 6) - (v0 * 819) - 493 * 999 + 159 / 4;
+    print(r0);
+    return r7;
+}
+
+int expr_8(int x) {
+    int v0 = x + 14;
+    int v1 = 76;
+    int v2 = 60;
+    int v3 = 89;
+    int v4 = 73;
+    int v5 = 73;
+    int v6 = 98;
+    int v7 = 33;
+    int r0 = v0 * (v0 - 561 - (v0 * v5 / 7 - v4 / 2) - 560) / 1 - 139 / 5 - v5 * v1 * (v0 / 1 / 8 * (v0 + (v0 - v7) - 792 * v2 - v5)) - (v0 + v5 + (v0 + (v0 - v6 - v2 - v0 + 488)) - v4 + v5) * 764 - v6 * 51 * v2 / 5 * v2 * 259 + (v0 + (v0 - v4 + v6 + 891)) - (v0 / 8 - (v0 - v5 / 8 / 7 + v6) / 6 - 570) + v4 - v4 / 7 * 81 - v5 * 834 - v7 * v1 / 9 + (v0 * (v0 - 298 - 86 - 889) * (v0 * v0 * 738 - v3)) + 477 - 18 - (v0 - 212) / 7 + 531 / 4 + v5 * (v0 * (v0 - v1 / 1) - 536 * (v0 / 5 * v1 / 7 / 9) / 1) - 648 + 141 * (v0 * v0) / 2 / 2 / 2 / 3 * (v0 * v7) * 810 + (v0 + 611 + 732) / 5 * (v0 - v3 + v5 * v7 + 527) / 1 - 312;
+    int r1 = v0 + (v0 + (v0 / 7) / 9 / 4) * 362 / 1 * 142 - v7 - (v0 / 2 * (v0 / 3 / 5 / 8 + (v0 - 4 * 613 + 18)) * (v0 + 188 / 4)) + v0 + v6 * 308 - (v0 / 6 / 8 + (v0 - (v0 - 518 - v4 + 398 + v1) * 319 * v6)) * 504 * v2 / 5 + v1 - 37 - v6 / 9 - v1 + 462 / 8 - 175 - (v0 / 6 + (v0 - 569)) * 89 / 8 - 187 / 9 * v0 / 4 / 5 / 3 + v7 * 339 / 3 + (v0 + 292 / 4);
+    int r2 = v0 / 8 + v0 + v0 + 711 * (v0 - v4 / 2 / 8 / 6) + 73 * (v0 / 9 / 6) - 298 * 776 / 3 + (v0 / 6 + 964 * 933 * 439) - (v0 - 17 * v6) / 5 / 2 - 241 + 460 + 244 * 165 / 8 / 3 + 377 / 4 / 6 + v0 - (v0 - v5) + v3 + (v0 + v0 * v7 * (v0 * 264 / 6 / 1 * 143) - 868) / 2 - (v0 + 847) * v6 * v3 - (v0 + 576 / 4 * 953) * 536 * 450 + 460 / 5 / 5 / 4 - 984 - v3 / 6 * v0 / 8 / 6 + 908 / 1 + (v0 * (v0 - (v0 * 405 + (v0 + v3))) / 9) * v5 / 8 - 154 * (v0 / 8 * (v0 + 79 + (v0 + v1) / 5)) / 5 + (v0 - 547 + (v0 / 7 - (v0 - (v0 * 783 * 158 - 574 - v1) + (v0 * v5 + 567 / 6 / 6)) / 8 * v2) - v5);
+    int r3 = v0 / 7 - v7 + v3 * 476 + (v0 - (v0 / 6 / 2) - v7 / 4 - (v0 + (v0 / 9 / 9 / 6 * 506) - 440)) * 439 * 787 - v3 * (v0 + 249) * v7 + 113 + 215 * (v0 + 651 / 9 + (v0 * (v0 - 755 + 823) / 3)) / 9 * (v0 - (v0 * v7)) * v6 - v7 * 124 / 2 / 9 / 4 / 3 / 3 * (v0 * 734) / 8 / 9 + v5 * (v0 / 3 - 193 * v5 * 417) - v7 + (v0 + 524 / 8 + v0 * v6) + 414 + v3 / 7 * 40 - 665 + (v0 + (v0 + v0) + v1) + 531 * v2 + v1 + 983 + v0 / 5 - (v0 / 7 / 8 + v2) * 229 / 6 * v3 + 370 * v2 / 2 + 617 * (v0 - 129 - 92 / 1 * v5) / 3;
+    int r4 = v0 + v4 + v4 + v6 / 3 * (v0 - v2) / 8 - v2 - v6 / 5 / 1 * 909 / 2 - 868 * (v0 + v5 * v6) / 9 * (v0 / 8 + v6 * v4 / 7) * 131 * 571 * v0 - v2 * (v0 * v3 - 3 - v6 * 264) / 9 + v1;
+    int r5 = v0 + v0 / 5 + v2 * 779 / 7 + (v0 + v1 + v7 * v3 * (v0 - 949 * v5 + 74)) * v7 + v6 * 253 / 4 * (v0 * 163 / 2 - 996 * 776) * 840 - 839 - 848 * (v0 * 512 * 903) - (v0 + 171) - v2 / 4 * v0 - v0 + 819 - v0 + 673 - 980 / 9 * (v0 * 798) * v7 / 9 + v7 / 7 + 858 - 79;
+    int r6 = v0 - (v0 / 5 + v4 / 1 - v7) + 757 - 964 / 5 * 168 + 723 * 508 + v2 - v0 / 1 + 131 - 579 + v0 - v0 - 672 / 3 - v2 - v0 + 262 / 1 / 2 + 882 / 1 / 1 - v1 * (v0 / 5 - 796 - (v0 + (v0 + (v0 * 505 + v2 - 552) + v7) * v2 / 7 + v0)) / 6 + 25 + 63 / 2 - 595 - v1 / 1 * 374 / 3 + 579 * v7 * 935;
+    int r7 = v0 + v0 / 8 + v4 - v1 * 610 - 526 / 1 / 9 - v0 / 9 + (v0 - (v0 / 5 / 3 / 2) * 918 / 4) - v5 * v4 / 4 - (v0 - v5) * v4 - 352 * v1 / 8 / 9 * (v0 + v3 / 5) + v5 - 797 * (v0 / 2 * v2) / 7;
+    print(r0);
+    return r7;
+}
+
+int expr_9(int x) {
+    int v0 = x + 96;
+    int v1 = 83;
+    int v2 = 49;
+    int v3 = 98;
+    int v4 = 78;
+    int v5 = 37;
+    int v6 = 5;
+    int v7 = 22;
+    int r0 = v0 * 550 + 769 / 4 / 8 * 860 + (v0 * v0 - 748 * 272) * (v0 * 640 * v4) / 7 / 7 - v7 + v0 * v3 - 832 / 9 + v4 * 500 - 285 * v3 * 390 + 292 - 979 + (v0 / 9 / 9) - 957 / 4 * v2 + v1 + 921 / 1 * v5 - 640 - v0 * v5 + 666 - 275 * 250 - v4 * v1 / 4 + 612 * 195 + 482 * (v0 - v5 - 450 * 755 * 211) - v5 + v3 + (v0 + 446 / 5 / 2) * 481 - 671 / 1 * 683 - 533 * (v0 * 845 * (v0 + 823 - 741)) - v0;
+    int r1 = v0 - (v0 / 4 + (v0 - v5 / 8)) - 848 * (v0 * 626 + (v0 + 379) * 102 / 7) * (v0 * v4 * 79 * v5 - (v0 * v5)) / 2 + (v0 * 602 - 311) + 11 + (v0 / 7 + v6 + 207) - v2 + 492 - 220 / 2 - 567 + 564 + 152 / 7 / 4 + 582 / 6 + 652 / 4 + (v0 + v0 / 2);
+    int r2 = v0 * v0 + v2 * 444 - 438 / 4 - 587 / 3 - (v0 / 6 / 3) * v0 / 3 / 6 / 5 / 5 + 337 + v3 + v7 - 946 / 7 - 306 / 2 + v6 - v0;
+    int r3 = v0 / 7 / 5 - v3 + (v0 * 613 - (v0 + v3 * v1 / 1 / 6)) + v4 - 189 - 762 + (v0 - 584 + v4 * v1 / 8) - (v0 * (v0 - v6 / 1 + v4) - v4 * v5) * (v0 - v1 * (v0 / 6 + 606 + v6) - 541 - 972) + 336 * (v0 + 944 - 871) + 998 * 766 / 5 * 453 + v7 - 386 / 2 * v1 / 5 + 683 * v2 / 2 + 685 / 6 * 661 + 5 / 2 + v4 / 8 * 962 * 966 / 9 * v2 * v5 + 655 - (v0 + 905 - v4 / 1 * 879) / 1;
+    int r4 = v0 / 3 / 9 - v0 / 5 - v3 + (v0 * (v0 + v3)) / 8 - v7 - v1 * 145 * 163 * 923 + (v0 * v7 / 4 * (v0 * (v0 - v5 / 2 * (v0 + v2 + 981 + (v0 + 216)) + 675) * (v0 / 8 + v7 / 8) * 390 / 2)) + 307 * v2 / 4 + (v0 / 9 / 2 - v1 / 3) - (v0 + (v0 / 5 + 127 - v2)) + (v0 + 376 / 8 - 6 - 404) + (v0 / 6 - (v0 + v6 - v5) / 6) + 558 - (v0 * 178 - v0) - (v0 - 261 * 896 + v7 / 1) * (v0 - v7) + v2 / 4 + (v0 / 3 + (v0 * (v0 - v5) * v5 - v2) / 1) - v0 + (v0 - 452 * (v0 + v2 / 1 + v2)) * v4 + v1 * v0 + v5 - 766 / 4 * v0 / 9 * v5 / 4 - (v0 / 4) + v7 - 234 * 781 + 718 + v1 / 4 - 162 * v3 - (v0 / 5 + v4 * 41) * v0 * 52 + v0 / 2 + 936 * (v0 - v7 - v0 + v6);
+    int r5 = v0 * (v0 - (v0 * 374 - v2 - 180)) * 316 * v0 / 5 - (v0 - v3 / 1) / 1 + (v0 - 768) + v3 - (v0 + v2) + 688 + (v0 - 999 * (v0 / 6 + 52) - (v0 + v7)) * 436 / 6 * (v0 / 4) + 827 + (v0 * v1 - (v0 - v6 + 367 - 869 / 4) + v5 / 5) * v7 / 5 + 595 - (v0 / 8 + 757) - 189 / 9 - 513 + 283 / 5 + (v0 + 82 - 277 + 304) * 294 / 1 - 781 / 3 / 3 / 4 + v2 - 635 + (v0 / 2) / 5 * v5 / 7 * v4 + 169 * (v0 + 133) * v2 / 4 - (v0 + 294 / 2 + 367 * v3) - v4 + (v0 * v3 - 520 - v4 / 6) / 4 - (v0 * 128) + 30 - 7 / 7 + 48;
+    int r6 = v0 * v4 / 1 / 1 / 8 * v4 * 893 / 6 * (v0 - 94 / 6 + 138) - 364 + 14 - 705 * v5 + v6 + v0 * (v0 / 3 - (v0 / 9 - (v0 + (v0 + 9 / 8 + v5 + v0) + 295 / 4) / 7) + v5) - 315 / 3 / 4 * v0 * v2 + 487 * v4 / 7 + v6 + (v0 + (v0 * 697 * (v0 - 585 * 761 - v4) + v1) * (v0 * 558 - v2)) / 9 - v1 - 774 * v0 - 733 - 750 + v0 - (v0 - (v0 + (v0 + 391 * v3 - 682 - 177) / 9) - (v0 - (v0 + v4 * 694 + v6) / 9) * 632) - 29 * 284 + 85;
+    int r7 = v0 / 5 - v0 - v4 - v1 - 61 - 941 / 6 * v3 + 590 * (v0 / 1 * 64 / 9 * v3) - 307 - v2 + v2 - (v0 / 9 - v4 * (v0 * 992 * v1 / 5 - v6) + 735) / 9 / 8 / 8 + v1 - 817 - v2 * v4 + (v0 * v1 + 928) / 8 * (v0 + v2) - v4 - v0;
+    print(r0);
+    return r7;
+}
+
+int main() {
+    int x = 10;
+    x = x + expr_0(x);
+    x = x + expr_1(x);
+    x = x + expr_2(x);
+    x = x + expr_3(x);
+    x = x + expr_4(x);
+    x = x + expr_5(x);
+    x = x + expr_6(x);
+    x = x + expr_7(x);
+    x = x + expr_8(x);
+    x = x + expr_9(x);
+    print(x);
+    return 0;
+}
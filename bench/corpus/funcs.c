@@ -0,0 +1,2231 @@
+int func_0(int x) {
+    int a = x + 87;
+    int b = a * 99;
+    return b;
+}
+
+int func_1(int x) {
+    int a = x + 60;
+    int b = a * 62;
+    return b;
+}
+
+int func_2(int x) {
+    int a = x + 20;
+    int b = a * 81;
+    return b;
+}
+
+int func_3(int x) {
+    int a = x + 5;
+    int b = a * 13;
+    return b;
+}
+
+int func_4(int x) {
+    int a = x + 43;
+    int b = a * 74;
+    return b;
+}
+
+int func_5(int x) {
+    int a = x + 37;
+    int b = a * 16;
+    return b;
+}
+
+int func_6(int x) {
+    int a = x + 55;
+    int b = a * 26;
+    return b;
+}
+
+int func_7(int x) {
+    int a = x + 78;
+    int b = a * 99;
+    return b;
+}
+
+int func_8(int x) {
+    int a = x + 72;
+    int b = a * 23;
+    return b;
+}
+
+int func_9(int x) {
+    int a = x + 48;
+    int b = a * 78;
+    return b;
+}
+
+int func_10(int x) {
+    int a = x + 22;
+    int b = a * 72;
+    return b;
+}
+
+int func_11(int x) {
+    int a = x + 30;
+    int b = a * 52;
+    return b;
+}
+
+int func_12(int x) {
+    int a = x + 77;
+    int b = a * 49;
+    return b;
+}
+
+int func_13(int x) {
+    int a = x + 47;
+    int b = a * 21;
+    return b;
+}
+
+int func_14(int x) {
+    int a = x + 51;
+    int b = a * 66;
+    return b;
+}
+
+int func_15(int x) {
+    int a = x + 99;
+    int b = a * 13;
+    return b;
+}
+
+int func_16(int x) {
+    int a = x + 93;
+    int b = a * 80;
+    return b;
+}
+
+int func_17(int x) {
+    int a = x + 29;
+    int b = a * 58;
+    return b;
+}
+
+int func_18(int x) {
+    int a = x + 7;
+    int b = a * 94;
+    return b;
+}
+
+int func_19(int x) {
+    int a = x + 11;
+    int b = a * 76;
+    return b;
+}
+
+int func_20(int x) {
+    int a = x + 29;
+    int b = a * 87;
+    return b;
+}
+
+int func_21(int x) {
+    int a = x + 10;
+    int b = a * 53;
+    return b;
+}
+
+int func_22(int x) {
+    int a = x + 53;
+    int b = a * 17;
+    return b;
+}
+
+int func_23(int x) {
+    int a = x + 35;
+    int b = a * 99;
+    return b;
+}
+
+int func_24(int x) {
+    int a = x + 45;
+    int b = a * 88;
+    return b;
+}
+
+int func_25(int x) {
+    int a = x + 85;
+    int b = a * 91;
+    return b;
+}
+
+int func_26(int x) {
+    int a = x + 13;
+    int b = a * 19;
+    return b;
+}
+
+int func_27(int x) {
+    int a = x + 38;
+    int b = a * 24;
+    return b;
+}
+
+int func_28(int x) {
+    int a = x + 62;
+    int b = a * 24;
+    return b;
+}
+
+int func_29(int x) {
+    int a = x + 1;
+    int b = a * 72;
+    return b;
+}
+
+int func_30(int x) {
+    int a = x + 21;
+    int b = a * 50;
+    return b;
+}
+
+int func_31(int x) {
+    int a = x + 12;
+    int b = a * 35;
+    return b;
+}
+
+int func_32(int x) {
+    int a = x + 88;
+    int b = a * 16;
+    return b;
+}
+
+int func_33(int x) {
+    int a = x + 99;
+    int b = a * 84;
+    return b;
+}
+
+int func_34(int x) {
+    int a = x + 86;
+    int b = a * 34;
+    return b;
+}
+
+int func_35(int x) {
+    int a = x + 0;
+    int b = a * 53;
+    return b;
+}
+
+int func_36(int x) {
+    int a = x + 63;
+    int b = a * 69;
+    return b;
+}
+
+int func_37(int x) {
+    int a = x + 64;
+    int b = a * 50;
+    return b;
+}
+
+int func_38(int x) {
+    int a = x + 59;
+    int b = a * 55;
+    return b;
+}
+
+int func_39(int x) {
+    int a = x + 58;
+    int b = a * 7;
+    return b;
+}
+
+int func_40(int x) {
+    int a = x + 6;
+    int b = a * 23;
+    return b;
+}
+
+int func_41(int x) {
+    int a = x + 52;
+    int b = a * 69;
+    return b;
+}
+
+int func_42(int x) {
+    int a = x + 75;
+    int b = a * 30;
+    return b;
+}
+
+int func_43(int x) {
+    int a = x + 54;
+    int b = a * 12;
+    return b;
+}
+
+int func_44(int x) {
+    int a = x + 22;
+    int b = a * 84;
+    return b;
+}
+
+int func_45(int x) {
+    int a = x + 41;
+    int b = a * 89;
+    return b;
+}
+
+int func_46(int x) {
+    int a = x + 85;
+    int b = a * 22;
+    return b;
+}
+
+int func_47(int x) {
+    int a = x + 37;
+    int b = a * 35;
+    return b;
+}
+
+int func_48(int x) {
+    int a = x + 21;
+    int b = a * 36;
+    return b;
+}
+
+int func_49(int x) {
+    int a = x + 25;
+    int b = a * 12;
+    return b;
+}
+
+int func_50(int x) {
+    int a = x + 16;
+    int b = a * 55;
+    return b;
+}
+
+int func_51(int x) {
+    int a = x + 45;
+    int b = a * 76;
+    return b;
+}
+
+int func_52(int x) {
+    int a = x + 85;
+    int b = a * 9;
+    return b;
+}
+
+int func_53(int x) {
+    int a = x + 27;
+    int b = a * 9;
+    return b;
+}
+
+int func_54(int x) {
+    int a = x + 73;
+    int b = a * 87;
+    return b;
+}
+
+int func_55(int x) {
+    int a = x + 15;
+    int b = a * 6;
+    return b;
+}
+
+int func_56(int x) {
+    int a = x + 87;
+    int b = a * 44;
+    return b;
+}
+
+int func_57(int x) {
+    int a = x + 79;
+    int b = a * 35;
+    return b;
+}
+
+int func_58(int x) {
+    int a = x + 22;
+    int b = a * 47;
+    return b;
+}
+
+int func_59(int x) {
+    int a = x + 23;
+    int b = a * 78;
+    return b;
+}
+
+int func_60(int x) {
+    int a = x + 33;
+    int b = a * 95;
+    return b;
+}
+
+int func_61(int x) {
+    int a = x + 43;
+    int b = a * 2;
+    return b;
+}
+
+int func_62(int x) {
+    int a = x + 43;
+    int b = a * 85;
+    return b;
+}
+
+int func_63(int x) {
+    int a = x + 77;
+    int b = a * 78;
+    return b;
+}
+
+int func_64(int x) {
+    int a = x + 38;
+    int b = a * 86;
+    return b;
+}
+
+int func_65(int x) {
+    int a = x + 73;
+    int b = a * 70;
+    return b;
+}
+
+int func_66(int x) {
+    int a = x + 41;
+    int b = a * 49;
+    return b;
+}
+
+int func_67(int x) {
+    int a = x + 34;
+    int b = a * 99;
+    return b;
+}
+
+int func_68(int x) {
+    int a = x + 92;
+    int b = a * 36;
+    return b;
+}
+
+int func_69(int x) {
+    int a = x + 67;
+    int b = a * 83;
+    return b;
+}
+
+int func_70(int x) {
+    int a = x + 67;
+    int b = a * 47;
+    return b;
+}
+
+int func_71(int x) {
+    int a = x + 47;
+    int b = a * 51;
+    return b;
+}
+
+int func_72(int x) {
+    int a = x + 34;
+    int b = a * 77;
+    return b;
+}
+
+int func_73(int x) {
+    int a = x + 65;
+    int b = a * 46;
+    return b;
+}
+
+int func_74(int x) {
+    int a = x + 62;
+    int b = a * 28;
+    return b;
+}
+
+int func_75(int x) {
+    int a = x + 60;
+    int b = a * 7;
+    return b;
+}
+
+int func_76(int x) {
+    int a = x + 32;
+    int b = a * 58;
+    return b;
+}
+
+int func_77(int x) {
+    int a = x + 99;
+    int b = a * 23;
+    return b;
+}
+
+int func_78(int x) {
+    int a = x + 58;
+    int b = a * 82;
+    return b;
+}
+
+int func_79(int x) {
+    int a = x + 34;
+    int b = a * 41;
+    return b;
+}
+
+int func_80(int x) {
+    int a = x + 41;
+    int b = a * 61;
+    return b;
+}
+
+int func_81(int x) {
+    int a = x + 13;
+    int b = a * 88;
+    return b;
+}
+
+int func_82(int x) {
+    int a = x + 31;
+    int b = a * 64;
+    return b;
+}
+
+int func_83(int x) {
+    int a = x + 43;
+    int b = a * 50;
+    return b;
+}
+
+int func_84(int x) {
+    int a = x + 40;
+    int b = a * 59;
+    return b;
+}
+
+int func_85(int x) {
+    int a = x + 84;
+    int b = a * 71;
+    return b;
+}
+
+int func_86(int x) {
+    int a = x + 20;
+    int b = a * 95;
+    return b;
+}
+
+int func_87(int x) {
+    int a = x + 69;
+    int b = a * 58;
+    return b;
+}
+
+int func_88(int x) {
+    int a = x + 7;
+    int b = a * 38;
+    return b;
+}
+
+int func_89(int x) {
+    int a = x + 7;
+    int b = a * 11;
+    return b;
+}
+
+int func_90(int x) {
+    int a = x + 79;
+    int b = a * 20;
+    return b;
+}
+
+int func_91(int x) {
+    int a = x + 12;
+    int b = a * 6;
+    return b;
+}
+
+int func_92(int x) {
+    int a = x + 5;
+    int b = a * 14;
+    return b;
+}
+
+int func_93(int x) {
+    int a = x + 87;
+    int b = a * 54;
+    return b;
+}
+
+int func_94(int x) {
+    int a = x + 90;
+    int b = a * 6;
+    return b;
+}
+
+int func_95(int x) {
+    int a = x + 36;
+    int b = a * 94;
+    return b;
+}
+
+int func_96(int x) {
+    int a = x + 78;
+    int b = a * 62;
+    return b;
+}
+
+int func_97(int x) {
+    int a = x + 56;
+    int b = a * 96;
+    return b;
+}
+
+int func_98(int x) {
+    int a = x + 54;
+    int b = a * 0;
+    return b;
+}
+
+int func_99(int x) {
+    int a = x + 30;
+    int b = a * 83;
+    return b;
+}
+
+int func_100(int x) {
+    int a = x + 4;
+    int b = a * 16;
+    return b;
+}
+
+int func_101(int x) {
+    int a = x + 87;
+    int b = a * 97;
+    return b;
+}
+
+int func_102(int x) {
+    int a = x + 58;
+    int b = a * 56;
+    return b;
+}
+
+int func_103(int x) {
+    int a = x + 55;
+    int b = a * 45;
+    return b;
+}
+
+int func_104(int x) {
+    int a = x + 23;
+    int b = a * 18;
+    return b;
+}
+
+int func_105(int x) {
+    int a = x + 70;
+    int b = a * 99;
+    return b;
+}
+
+int func_106(int x) {
+    int a = x + 85;
+    int b = a * 19;
+    return b;
+}
+
+int func_107(int x) {
+    int a = x + 50;
+    int b = a * 23;
+    return b;
+}
+
+int func_108(int x) {
+    int a = x + 81;
+    int b = a * 70;
+    return b;
+}
+
+int func_109(int x) {
+    int a = x + 16;
+    int b = a * 86;
+    return b;
+}
+
+int func_110(int x) {
+    int a = x + 88;
+    int b = a * 61;
+    return b;
+}
+
+int func_111(int x) {
+    int a = x + 45;
+    int b = a * 45;
+    return b;
+}
+
+int func_112(int x) {
+    int a = x + 90;
+    int b = a * 86;
+    return b;
+}
+
+int func_113(int x) {
+    int a = x + 25;
+    int b = a * 68;
+    return b;
+}
+
+int func_114(int x) {
+    int a = x + 36;
+    int b = a * 67;
+    return b;
+}
+
+int func_115(int x) {
+    int a = x + 20;
+    int b = a * 66;
+    return b;
+}
+
+int func_116(int x) {
+    int a = x + 2;
+    int b = a * 0;
+    return b;
+}
+
+int func_117(int x) {
+    int a = x + 12;
+    int b = a * 97;
+    return b;
+}
+
+int func_118(int x) {
+    int a = x + 71;
+    int b = a * 59;
+    return b;
+}
+
+int func_119(int x) {
+    int a = x + 54;
+    int b = a * 16;
+    return b;
+}
+
+int func_120(int x) {
+    int a = x + 64;
+    int b = a * 72;
+    return b;
+}
+
+int func_121(int x) {
+    int a = x + 66;
+    int b = a * 91;
+    return b;
+}
+
+int func_122(int x) {
+    int a = x + 8;
+    int b = a * 77;
+    return b;
+}
+
+int func_123(int x) {
+    int a = x + 97;
+    int b = a * 2;
+    return b;
+}
+
+int func_124(int x) {
+    int a = x + 28;
+    int b = a * 99;
+    return b;
+}
+
+int func_125(int x) {
+    int a = x + 42;
+    int b = a * 91;
+    return b;
+}
+
+int func_126(int x) {
+    int a = x + 67;
+    int b = a * 59;
+    return b;
+}
+
+int func_127(int x) {
+    int a = x + 33;
+    int b = a * 54;
+    return b;
+}
+
+int func_128(int x) {
+    int a = x + 51;
+    int b = a * 8;
+    return b;
+}
+
+int func_129(int x) {
+    int a = x + 47;
+    int b = a * 12;
+    return b;
+}
+
+int func_130(int x) {
+    int a = x + 14;
+    int b = a * 50;
+    return b;
+}
+
+int func_131(int x) {
+    int a = x + 24;
+    int b = a * 19;
+    return b;
+}
+
+int func_132(int x) {
+    int a = x + 18;
+    int b = a * 24;
+    return b;
+}
+
+int func_133(int x) {
+    int a = x + 71;
+    int b = a * 23;
+    return b;
+}
+
+int func_134(int x) {
+    int a = x + 62;
+    int b = a * 94;
+    return b;
+}
+
+int func_135(int x) {
+    int a = x + 8;
+    int b = a * 74;
+    return b;
+}
+
+int func_136(int x) {
+    int a = x + 96;
+    int b = a * 10;
+    return b;
+}
+
+int func_137(int x) {
+    int a = x + 64;
+    int b = a * 37;
+    return b;
+}
+
+int func_138(int x) {
+    int a = x + 16;
+    int b = a * 50;
+    return b;
+}
+
+int func_139(int x) {
+    int a = x + 17;
+    int b = a * 19;
+    return b;
+}
+
+int func_140(int x) {
+    int a = x + 16;
+    int b = a * 31;
+    return b;
+}
+
+int func_141(int x) {
+    int a = x + 55;
+    int b = a * 85;
+    return b;
+}
+
+int func_142(int x) {
+    int a = x + 35;
+    int b = a * 76;
+    return b;
+}
+
+int func_143(int x) {
+    int a = x + 51;
+    int b = a * 50;
+    return b;
+}
+
+int func_144(int x) {
+    int a = x + 29;
+    int b = a * 45;
+    return b;
+}
+
+int func_145(int x) {
+    int a = x + 1;
+    int b = a * 80;
+    return b;
+}
+
+int func_146(int x) {
+    int a = x + 33;
+    int b = a * 28;
+    return b;
+}
+
+int func_147(int x) {
+    int a = x + 50;
+    int b = a * 35;
+    return b;
+}
+
+int func_148(int x) {
+    int a = x + 97;
+    int b = a * 23;
+    return b;
+}
+
+int func_149(int x) {
+    int a = x + 61;
+    int b = a * 36;
+    return b;
+}
+
+int func_150(int x) {
+    int a = x + 12;
+    int b = a * 23;
+    return b;
+}
+
+int func_151(int x) {
+    int a = x + 57;
+    int b = a * 1;
+    return b;
+}
+
+int func_152(int x) {
+    int a = x + 54;
+    int b = a * 44;
+    return b;
+}
+
+int func_153(int x) {
+    int a = x + 17;
+    int b = a * 2;
+    return b;
+}
+
+int func_154(int x) {
+    int a = x + 15;
+    int b = a * 49;
+    return b;
+}
+
+int func_155(int x) {
+    int a = x + 59;
+    int b = a * 79;
+    return b;
+}
+
+int func_156(int x) {
+    int a = x + 42;
+    int b = a * 82;
+    return b;
+}
+
+int func_157(int x) {
+    int a = x + 74;
+    int b = a * 39;
+    return b;
+}
+
+int func_158(int x) {
+    int a = x + 90;
+    int b = a * 77;
+    return b;
+}
+
+int func_159(int x) {
+    int a = x + 41;
+    int b = a * 50;
+    return b;
+}
+
+int func_160(int x) {
+    int a = x + 98;
+    int b = a * 67;
+    return b;
+}
+
+int func_161(int x) {
+    int a = x + 18;
+    int b = a * 5;
+    return b;
+}
+
+int func_162(int x) {
+    int a = x + 67;
+    int b = a * 39;
+    return b;
+}
+
+int func_163(int x) {
+    int a = x + 25;
+    int b = a * 10;
+    return b;
+}
+
+int func_164(int x) {
+    int a = x + 0;
+    int b = a * 3;
+    return b;
+}
+
+int func_165(int x) {
+    int a = x + 3;
+    int b = a * 45;
+    return b;
+}
+
+int func_166(int x) {
+    int a = x + 37;
+    int b = a * 43;
+    return b;
+}
+
+int func_167(int x) {
+    int a = x + 87;
+    int b = a * 17;
+    return b;
+}
+
+int func_168(int x) {
+    int a = x + 79;
+    int b = a * 92;
+    return b;
+}
+
+int func_169(int x) {
+    int a = x + 21;
+    int b = a * 0;
+    return b;
+}
+
+int func_170(int x) {
+    int a = x + 19;
+    int b = a * 56;
+    return b;
+}
+
+int func_171(int x) {
+    int a = x + 93;
+    int b = a * 28;
+    return b;
+}
+
+int func_172(int x) {
+    int a = x + 67;
+    int b = a * 15;
+    return b;
+}
+
+int func_173(int x) {
+    int a = x + 53;
+    int b = a * 19;
+    return b;
+}
+
+int func_174(int x) {
+    int a = x + 69;
+    int b = a * 75;
+    return b;
+}
+
+int func_175(int x) {
+    int a = x + 93;
+    int b = a * 50;
+    return b;
+}
+
+int func_176(int x) {
+    int a = x + 39;
+    int b = a * 69;
+    return b;
+}
+
+int func_177(int x) {
+    int a = x + 17;
+    int b = a * 14;
+    return b;
+}
+
+int func_178(int x) {
+    int a = x + 94;
+    int b = a * 18;
+    return b;
+}
+
+int func_179(int x) {
+    int a = x + 52;
+    int b = a * 20;
+    return b;
+}
+
+int func_180(int x) {
+    int a = x + 76;
+    int b = a * 96;
+    return b;
+}
+
+int func_181(int x) {
+    int a = x + 75;
+    int b = a * 52;
+    return b;
+}
+
+int func_182(int x) {
+    int a = x + 52;
+    int b = a * 64;
+    return b;
+}
+
+int func_183(int x) {
+    int a = x + 7;
+    int b = a * 7;
+    return b;
+}
+
+int func_184(int x) {
+    int a = x + 61;
+    int b = a * 71;
+    return b;
+}
+
+int func_185(int x) {
+    int a = x + 86;
+    int b = a * 25;
+    return b;
+}
+
+int func_186(int x) {
+    int a = x + 50;
+    int b = a * 53;
+    return b;
+}
+
+int func_187(int x) {
+    int a = x + 67;
+    int b = a * 90;
+    return b;
+}
+
+int func_188(int x) {
+    int a = x + 52;
+    int b = a * 90;
+    return b;
+}
+
+int func_189(int x) {
+    int a = x + 71;
+    int b = a * 49;
+    return b;
+}
+
+int func_190(int x) {
+    int a = x + 31;
+    int b = a * 98;
+    return b;
+}
+
+int func_191(int x) {
+    int a = x + 66;
+    int b = a * 64;
+    return b;
+}
+
+int func_192(int x) {
+    int a = x + 27;
+    int b = a * 87;
+    return b;
+}
+
+int func_193(int x) {
+    int a = x + 22;
+    int b = a * 22;
+    return b;
+}
+
+int func_194(int x) {
+    int a = x + 67;
+    int b = a * 2;
+    return b;
+}
+
+int func_195(int x) {
+    int a = x + 67;
+    int b = a * 24;
+    return b;
+}
+
+int func_196(int x) {
+    int a = x + 45;
+    int b = a * 19;
+    return b;
+}
+
+int func_197(int x) {
+    int a = x + 76;
+    int b = a * 39;
+    return b;
+}
+
+int func_198(int x) {
+    int a = x + 0;
+    int b = a * 41;
+    return b;
+}
+
+int func_199(int x) {
+    int a = x + 39;
+    int b = a * 40;
+    return b;
+}
+
+int func_200(int x) {
+    int a = x + 76;
+    int b = a * 37;
+    return b;
+}
+
+int func_201(int x) {
+    int a = x + 47;
+    int b = a * 49;
+    return b;
+}
+
+int func_202(int x) {
+    int a = x + 42;
+    int b = a * 67;
+    return b;
+}
+
+int func_203(int x) {
+    int a = x + 28;
+    int b = a * 92;
+    return b;
+}
+
+int func_204(int x) {
+    int a = x + 81;
+    int b = a * 40;
+    return b;
+}
+
+int func_205(int x) {
+    int a = x + 45;
+    int b = a * 46;
+    return b;
+}
+
+int func_206(int x) {
+    int a = x + 25;
+    int b = a * 21;
+    return b;
+}
+
+int func_207(int x) {
+    int a = x + 34;
+    int b = a * 40;
+    return b;
+}
+
+int func_208(int x) {
+    int a = x + 8;
+    int b = a * 27;
+    return b;
+}
+
+int func_209(int x) {
+    int a = x + 62;
+    int b = a * 36;
+    return b;
+}
+
+int func_210(int x) {
+    int a = x + 7;
+    int b = a * 86;
+    return b;
+}
+
+int func_211(int x) {
+    int a = x + 38;
+    int b = a * 91;
+    return b;
+}
+
+int func_212(int x) {
+    int a = x + 74;
+    int b = a * 82;
+    return b;
+}
+
+int func_213(int x) {
+    int a = x + 89;
+    int b = a * 96;
+    return b;
+}
+
+int func_214(int x) {
+    int a = x + 30;
+    int b = a * 39;
+    return b;
+}
+
+int func_215(int x) {
+    int a = x + 86;
+    int b = a * 16;
+    return b;
+}
+
+int func_216(int x) {
+    int a = x + 84;
+    int b = a * 78;
+    return b;
+}
+
+int func_217(int x) {
+    int a = x + 86;
+    int b = a * 93;
+    return b;
+}
+
+int func_218(int x) {
+    int a = x + 22;
+    int b = a * 73;
+    return b;
+}
+
+int func_219(int x) {
+    int a = x + 56;
+    int b = a * 32;
+    return b;
+}
+
+int func_220(int x) {
+    int a = x + 73;
+    int b = a * 44;
+    return b;
+}
+
+int func_221(int x) {
+    int a = x + 81;
+    int b = a * 22;
+    return b;
+}
+
+int func_222(int x) {
+    int a = x + 24;
+    int b = a * 59;
+    return b;
+}
+
+int func_223(int x) {
+    int a = x + 87;
+    int b = a * 62;
+    return b;
+}
+
+int func_224(int x) {
+    int a = x + 59;
+    int b = a * 42;
+    return b;
+}
+
+int func_225(int x) {
+    int a = x + 95;
+    int b = a * 43;
+    return b;
+}
+
+int func_226(int x) {
+    int a = x + 88;
+    int b = a * 87;
+    return b;
+}
+
+int func_227(int x) {
+    int a = x + 35;
+    int b = a * 14;
+    return b;
+}
+
+int func_228(int x) {
+    int a = x + 35;
+    int b = a * 77;
+    return b;
+}
+
+int func_229(int x) {
+    int a = x + 96;
+    int b = a * 91;
+    return b;
+}
+
+int func_230(int x) {
+    int a = x + 67;
+    int b = a * 21;
+    return b;
+}
+
+int func_231(int x) {
+    int a = x + 25;
+    int b = a * 22;
+    return b;
+}
+
+int func_232(int x) {
+    int a = x + 98;
+    int b = a * 8;
+    return b;
+}
+
+int func_233(int x) {
+    int a = x + 44;
+    int b = a * 19;
+    return b;
+}
+
+int func_234(int x) {
+    int a = x + 92;
+    int b = a * 20;
+    return b;
+}
+
+int func_235(int x) {
+    int a = x + 83;
+    int b = a * 66;
+    return b;
+}
+
+int func_236(int x) {
+    int a = x + 71;
+    int b = a * 72;
+    return b;
+}
+
+int func_237(int x) {
+    int a = x + 5;
+    int b = a * 65;
+    return b;
+}
+
+int func_238(int x) {
+    int a = x + 90;
+    int b = a * 78;
+    return b;
+}
+
+int func_239(int x) {
+    int a = x + 33;
+    int b = a * 96;
+    return b;
+}
+
+int func_240(int x) {
+    int a = x + 83;
+    int b = a * 17;
+    return b;
+}
+
+int func_241(int x) {
+    int a = x + 18;
+    int b = a * 90;
+    return b;
+}
+
+int func_242(int x) {
+    int a = x + 22;
+    int b = a * 53;
+    return b;
+}
+
+int func_243(int x) {
+    int a = x + 73;
+    int b = a * 94;
+    return b;
+}
+
+int func_244(int x) {
+    int a = x + 96;
+    int b = a * 87;
+    return b;
+}
+
+int func_245(int x) {
+    int a = x + 10;
+    int b = a * 21;
+    return b;
+}
+
+int func_246(int x) {
+    int a = x + 69;
+    int b = a * 17;
+    return b;
+}
+
+int func_247(int x) {
+    int a = x + 47;
+    int b = a * 36;
+    return b;
+}
+
+int func_248(int x) {
+    int a = x + 60;
+    int b = a * 37;
+    return b;
+}
+
+int func_249(int x) {
+    int a = x + 8;
+    int b = a * 22;
+    return b;
+}
+
+int func_250(int x) {
+    int a = x + 12;
+    int b = a * 84;
+    return b;
+}
+
+int func_251(int x) {
+    int a = x + 86;
+    int b = a * 23;
+    return b;
+}
+
+int func_252(int x) {
+    int a = x + 9;
+    int b = a * 41;
+    return b;
+}
+
+int func_253(int x) {
+    int a = x + 64;
+    int b = a * 64;
+    return b;
+}
+
+int func_254(int x) {
+    int a = x + 18;
+    int b = a * 98;
+    return b;
+}
+
+int func_255(int x) {
+    int a = x + 71;
+    int b = a * 95;
+    return b;
+}
+
+int func_256(int x) {
+    int a = x + 91;
+    int b = a * 74;
+    return b;
+}
+
+int func_257(int x) {
+    int a = x + 18;
+    int b = a * 29;
+    return b;
+}
+
+int func_258(int x) {
+    int a = x + 70;
+    int b = a * 40;
+    return b;
+}
+
+int func_259(int x) {
+    int a = x + 30;
+    int b = a * 71;
+    return b;
+}
+
+int func_260(int x) {
+    int a = x + 3;
+    int b = a * 16;
+    return b;
+}
+
+int func_261(int x) {
+    int a = x + 45;
+    int b = a * 61;
+    return b;
+}
+
+int func_262(int x) {
+    int a = x + 58;
+    int b = a * 13;
+    return b;
+}
+
+int func_263(int x) {
+    int a = x + 60;
+    int b = a * 49;
+    return b;
+}
+
+int func_264(int x) {
+    int a = x + 54;
+    int b = a * 10;
+    return b;
+}
+
+int func_265(int x) {
+    int a = x + 55;
+    int b = a * 70;
+    return b;
+}
+
+int func_266(int x) {
+    int a = x + 17;
+    int b = a * 42;
+    return b;
+}
+
+int func_267(int x) {
+    int a = x + 72;
+    int b = a * 61;
+    return b;
+}
+
+int func_268(int x) {
+    int a = x + 21;
+    int b = a * 77;
+    return b;
+}
+
+int func_269(int x) {
+    int a = x + 65;
+    int b = a * 30;
+    return b;
+}
+
+int func_270(int x) {
+    int a = x + 31;
+    int b = a * 3;
+    return b;
+}
+
+int func_271(int x) {
+    int a = x + 83;
+    int b = a * 29;
+    return b;
+}
+
+int func_272(int x) {
+    int a = x + 71;
+    int b = a * 66;
+    return b;
+}
+
+int func_273(int x) {
+    int a = x + 91;
+    int b = a * 97;
+    return b;
+}
+
+int func_274(int x) {
+    int a = x + 78;
+    int b = a * 9;
+    return b;
+}
+
+int func_275(int x) {
+    int a = x + 68;
+    int b = a * 51;
+    return b;
+}
+
+int func_276(int x) {
+    int a = x + 75;
+    int b = a * 82;
+    return b;
+}
+
+int func_277(int x) {
+    int a = x + 4;
+    int b = a * 82;
+    return b;
+}
+
+int func_278(int x) {
+    int a = x + 52;
+    int b = a * 56;
+    return b;
+}
+
+int func_279(int x) {
+    int a = x + 85;
+    int b = a * 98;
+    return b;
+}
+
+int func_280(int x) {
+    int a = x + 49;
+    int b = a * 75;
+    return b;
+}
+
+int func_281(int x) {
+    int a = x + 63;
+    int b = a * 36;
+    return b;
+}
+
+int func_282(int x) {
+    int a = x + 1;
+    int b = a * 92;
+    return b;
+}
+
+int func_283(int x) {
+    int a = x + 40;
+    int b = a * 39;
+    return b;
+}
+
+int func_284(int x) {
+    int a = x + 55;
+    int b = a * 92;
+    return b;
+}
+
+int func_285(int x) {
+    int a = x + 36;
+    int b = a * 91;
+    return b;
+}
+
+int func_286(int x) {
+    int a = x + 33;
+    int b = a * 42;
+    return b;
+}
+
+int func_287(int x) {
+    int a = x + 30;
+    int b = a * 47;
+    return b;
+}
+
+int func_288(int x) {
+    int a = x + 55;
+    int b = a * 64;
+    return b;
+}
+
+int func_289(int x) {
+    int a = x + 81;
+    int b = a * 4;
+    return b;
+}
+
+int func_290(int x) {
+    int a = x + 92;
+    int b = a * 25;
+    return b;
+}
+
+int func_291(int x) {
+    int a = x + 45;
+    int b = a * 19;
+    return b;
+}
+
+int func_292(int x) {
+    int a = x + 16;
+    int b = a * 61;
+    return b;
+}
+
+int func_293(int x) {
+    int a = x + 60;
+    int b = a * 8;
+    return b;
+}
+
+int func_294(int x) {
+    int a = x + 85;
+    int b = a * 30;
+    return b;
+}
+
+int func_295(int x) {
+    int a = x + 40;
+    int b = a * 75;
+    return b;
+}
+
+int func_296(int x) {
+    int a = x + 10;
+    int b = a * 47;
+    return b;
+}
+
+int func_297(int x) {
+    int a = x + 4;
+    int b = a * 57;
+    return b;
+}
+
+int func_298(int x) {
+    int a = x + 78;
+    int b = a * 16;
+    return b;
+}
+
+int func_299(int x) {
+    int a = x + 63;
+    int b = a * 16;
+    return b;
+}
+
+int func_300(int x) {
+    int a = x + 96;
+    int b = a * 89;
+    return b;
+}
+
+int func_301(int x) {
+    int a = x + 71;
+    int b = a * 13;
+    return b;
+}
+
+int func_302(int x) {
+    int a = x + 86;
+    int b = a * 83;
+    return b;
+}
+
+int func_303(int x) {
+    int a = x + 11;
+    int b = a * 40;
+    return b;
+}
+
+int func_304(int x) {
+    int a = x + 42;
+    int b = a * 48;
+    return b;
+}
+
+int func_305(int x) {
+    int a = x + 51;
+    int b = a * 68;
+    return b;
+}
+
+int func_306(int x) {
+    int a = x + 1;
+    int b = a * 74;
+    return b;
+}
+
+int func_307(int x) {
+    int a = x + 84;
+    int b = a * 61;
+    return b;
+}
+
+int func_308(int x) {
+    int a = x + 22;
+    int b = a * 92;
+    return b;
+}
+
+int func_309(int x) {
+    int a = x + 61;
+    int b = a * 5;
+    return b;
+}
+
+int func_310(int x) {
+    int a = x + 77;
+    int b = a * 62;
+    return b;
+}
+
+int func_311(int x) {
+    int a = x + 79;
+    int b = a * 79;
+    return b;
+}
+
+int func_312(int x) {
+    int a = x + 62;
+    int b = a * 77;
+    return b;
+}
+
+int func_313(int x) {
+    int a = x + 74;
+    int b = a * 64;
+    return b;
+}
+
+int func_314(int x) {
+    int a = x + 93;
+    int b = a * 74;
+    return b;
+}
+
+int func_315(int x) {
+    int a = x + 22;
+    int b = a * 1;
+    return b;
+}
+
+int func_316(int x) {
+    int a = x + 82;
+    int b = a * 90;
+    return b;
+}
+
+int func_317(int x) {
+    int a = x + 33;
+    int b = a * 54;
+    return b;
+}
+
+int main() {
+    int x = 318;
+    x = x + func_0(x);
+    x = x + func_1(x);
+    x = x + func_2(x);
+    x = x + func_3(x);
+    x = x + func_4(x);
+    x = x + func_5(x);
+    x = x + func_6(x);
+    x = x + func_7(x);
+    x = x + func_8(x);
+    x = x + func_9(x);
+    x = x + func_10(x);
+    x = x + func_11(x);
+    x = x + func_12(x);
+    x = x + func_13(x);
+    x = x + func_14(x);
+    x = x + func_15(x);
+    x = x + func_16(x);
+    x = x + func_17(x);
+    x = x + func_18(x);
+    x = x + func_19(x);
+    x = x + func_20(x);
+    x = x + func_21(x);
+    x = x + func_22(x);
+    x = x + func_23(x);
+    x = x + func_24(x);
+    x = x + func_25(x);
+    x = x + func_26(x);
+    x = x + func_27(x);
+    x = x + func_28(x);
+    x = x + func_29(x);
+    x = x + func_30(x);
+    x = x + func_31(x);
+    x = x + func_32(x);
+    x = x + func_33(x);
+    x = x + func_34(x);
+    x = x + func_35(x);
+    x = x + func_36(x);
+    x = x + func_37(x);
+    x = x + func_38(x);
+    x = x + func_39(x);
+    x = x + func_40(x);
+    x = x + func_41(x);
+    x = x + func_42(x);
+    x = x + func_43(x);
+    x = x + func_44(x);
+    x = x + func_45(x);
+    x = x + func_46(x);
+    x = x + func_47(x);
+    x = x + func_48(x);
+    x = x + func_49(x);
+    x = x + func_50(x);
+    x = x + func_51(x);
+    x = x + func_52(x);
+    x = x + func_53(x);
+    x = x + func_54(x);
+    x = x + func_55(x);
+    x = x + func_56(x);
+    x = x + func_57(x);
+    x = x + func_58(x);
+    x = x + func_59(x);
+    x = x + func_60(x);
+    x = x + func_61(x);
+    x = x + func_62(x);
+    x = x + func_63(x);
+    x = x + func_64(x);
+    x = x + func_65(x);
+    x = x + func_66(x);
+    x = x + func_67(x);
+    x = x + func_68(x);
+    x = x + func_69(x);
+    x = x + func_70(x);
+    x = x + func_71(x);
+    x = x + func_72(x);
+    x = x + func_73(x);
+    x = x + func_74(x);
+    x = x + func_75(x);
+    x = x + func_76(x);
+    x = x + func_77(x);
+    x = x + func_78(x);
+    x = x + func_79(x);
+    x = x + func_80(x);
+    x = x + func_81(x);
+    x = x + func_82(x);
+    x = x + func_83(x);
+    x = x + func_84(x);
+    x = x + func_85(x);
+    x = x + func_86(x);
+    x = x + func_87(x);
+    x = x + func_88(x);
+    x = x + func_89(x);
+    x = x + func_90(x);
+    x = x + func_91(x);
+    x = x + func_92(x);
+    x = x + func_93(x);
+    x = x + func_94(x);
+    x = x + func_95(x);
+    x = x + func_96(x);
+    x = x + func_97(x);
+    x = x + func_98(x);
+    x = x + func_99(x);
+    x = x + func_100(x);
+    x = x + func_101(x);
+    x = x + func_102(x);
+    x = x + func_103(x);
+    x = x + func_104(x);
+    x = x + func_105(x);
+    x = x + func_106(x);
+    x = x + func_107(x);
+    x = x + func_108(x);
+    x = x + func_109(x);
+    x = x + func_110(x);
+    x = x + func_111(x);
+    x = x + func_112(x);
+    x = x + func_113(x);
+    x = x + func_114(x);
+    x = x + func_115(x);
+    x = x + func_116(x);
+    x = x + func_117(x);
+    x = x + func_118(x);
+    x = x + func_119(x);
+    x = x + func_120(x);
+    x = x + func_121(x);
+    x = x + func_122(x);
+    x = x + func_123(x);
+    x = x + func_124(x);
+    x = x + func_125(x);
+    x = x + func_126(x);
+    x = x + func_127(x);
+    x = x + func_128(x);
+    x = x + func_129(x);
+    x = x + func_130(x);
+    x = x + func_131(x);
+    x = x + func_132(x);
+    x = x + func_133(x);
+    x = x + func_134(x);
+    x = x + func_135(x);
+    x = x + func_136(x);
+    x = x + func_137(x);
+    x = x + func_138(x);
+    x = x + func_139(x);
+    x = x + func_140(x);
+    x = x + func_141(x);
+    x = x + func_142(x);
+    x = x + func_143(x);
+    x = x + func_144(x);
+    x = x + func_145(x);
+    x = x + func_146(x);
+    x = x + func_147(x);
+    x = x + func_148(x);
+    x = x + func_149(x);
+    x = x + func_150(x);
+    x = x + func_151(x);
+    x = x + func_152(x);
+    x = x + func_153(x);
+    x = x + func_154(x);
+    x = x + func_155(x);
+    x = x + func_156(x);
+    x = x + func_157(x);
+    x = x + func_158(x);
+    x = x + func_159(x);
+    x = x + func_160(x);
+    x = x + func_161(x);
+    x = x + func_162(x);
+    x = x + func_163(x);
+    x = x + func_164(x);
+    x = x + func_165(x);
+    x = x + func_166(x);
+    x = x + func_167(x);
+    x = x + func_168(x);
+    x = x + func_169(x);
+    x = x + func_170(x);
+    x = x + func_171(x);
+    x = x + func_172(x);
+    x = x + func_173(x);
+    x = x + func_174(x);
+    x = x + func_175(x);
+    x = x + func_176(x);
+    x = x + func_177(x);
+    x = x + func_178(x);
+    x = x + func_179(x);
+    x = x + func_180(x);
+    x = x + func_181(x);
+    x = x + func_182(x);
+    x = x + func_183(x);
+    x = x + func_184(x);
+    x = x + func_185(x);
+    x = x + func_186(x);
+    x = x + func_187(x);
+    x = x + func_188(x);
+    x = x + func_189(x);
+    x = x + func_190(x);
+    x = x + func_191(x);
+    x = x + func_192(x);
+    x = x + func_193(x);
+    x = x + func_194(x);
+    x = x + func_195(x);
+    x = x + func_196(x);
+    x = x + func_197(x);
+    x = x + func_198(x);
+    x = x + func_199(x);
+    x = x + func_200(x);
+    x = x + func_201(x);
+    x = x + func_202(x);
+    x = x + func_203(x);
+    x = x + func_204(x);
+    x = x + func_205(x);
+    x = x + func_206(x);
+    x = x + func_207(x);
+    x = x + func_208(x);
+    x = x + func_209(x);
+    x = x + func_210(x);
+    x = x + func_211(x);
+    x = x + func_212(x);
+    x = x + func_213(x);
+    x = x + func_214(x);
+    x = x + func_215(x);
+    x = x + func_216(x);
+    x = x + func_217(x);
+    x = x + func_218(x);
+    x = x + func_219(x);
+    x = x + func_220(x);
+    x = x + func_221(x);
+    x = x + func_222(x);
+    x = x + func_223(x);
+    x = x + func_224(x);
+    x = x + func_225(x);
+    x = x + func_226(x);
+    x = x + func_227(x);
+    x = x + func_228(x);
+    x = x + func_229(x);
+    x = x + func_230(x);
+    x = x + func_231(x);
+    x = x + func_232(x);
+    x = x + func_233(x);
+    x = x + func_234(x);
+    x = x + func_235(x);
+    x = x + func_236(x);
+    x = x + func_237(x);
+    x = x + func_238(x);
+    x = x + func_239(x);
+    x = x + func_240(x);
+    x = x + func_241(x);
+    x = x + func_242(x);
+    x = x + func_243(x);
+    x = x + func_244(x);
+    x = x + func_245(x);
+    x = x + func_246(x);
+    x = x + func_247(x);
+    x = x + func_248(x);
+    x = x + func_249(x);
+    x = x + func_250(x);
+    x = x + func_251(x);
+    x = x + func_252(x);
+    x = x + func_253(x);
+    x = x + func_254(x);
+    x = x + func_255(x);
+    x = x + func_256(x);
+    x = x + func_257(x);
+    x = x + func_258(x);
+    x = x + func_259(x);
+    x = x + func_260(x);
+    x = x + func_261(x);
+    x = x + func_262(x);
+    x = x + func_263(x);
+    x = x + func_264(x);
+    x = x + func_265(x);
+    x = x + func_266(x);
+    x = x + func_267(x);
+    x = x + func_268(x);
+    x = x + func_269(x);
+    x = x + func_270(x);
+    x = x + func_271(x);
+    x = x + func_272(x);
+    x = x + func_273(x);
+    x = x + func_274(x);
+    x = x + func_275(x);
+    x = x + func_276(x);
+    x = x + func_277(x);
+    x = x + func_278(x);
+    x = x + func_279(x);
+    x = x + func_280(x);
+    x = x + func_281(x);
+    x = x + func_282(x);
+    x = x + func_283(x);
+    x = x + func_284(x);
+    x = x + func_285(x);
+    x = x + func_286(x);
+    x = x + func_287(x);
+    x = x + func_288(x);
+    x = x + func_289(x);
+    x = x + func_290(x);
+    x = x + func_291(x);
+    x = x + func_292(x);
+    x = x + func_293(x);
+    x = x + func_294(x);
+    x = x + func_295(x);
+    x = x + func_296(x);
+    x = x + func_297(x);
+    x = x + func_298(x);
+    x = x + func_299(x);
+    x = x + func_300(x);
+    x = x + func_301(x);
+    x = x + func_302(x);
+    x = x + func_303(x);
+    x = x + func_304(x);
+    x = x + func_305(x);
+    x = x + func_306(x);
+    x = x + func_307(x);
+    x = x + func_308(x);
+    x = x + func_309(x);
+    x = x + func_310(x);
+    x = x + func_311(x);
+    x = x + func_312(x);
+    x = x + func_313(x);
+    x = x + func_314(x);
+    x = x + func_315(x);
+    x = x + func_316(x);
+    x = x + func_317(x);
+    print(x);
+    return 0;
+}
@@ -0,0 +1,435 @@
+int idents_0(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 1477727819
+    // line comment 1: the quick brown fox jumps over the lazy dog 3534825548
+    // line comment 2: the quick brown fox jumps over the lazy dog 1608101663
+    // line comment 3: the quick brown fox jumps over the lazy dog 726913730
+    // line comment 4: the quick brown fox jumps over the lazy dog 1773698051
+    // line comment 5: the quick brown fox jumps over the lazy dog 2713576764
+    // line comment 6: the quick brown fox jumps over the lazy dog 2834637414
+    // line comment 7: the quick brown fox jumps over the lazy dog 61229076
+    // line comment 8: the quick brown fox jumps over the lazy dog 3357967198
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2763432774
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3535918914
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1511306210
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2730345648
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 612495573
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3315689782
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2460567515
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2545739419
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3163451854 */
+    int _S8tr0DdHNoC5FSWwLRKxdl_0usNQkFB_pQowjWf2qQ5KigcbY3GuLmzDlHVBkHKeV7TYs3t_VIHU_T2U0VR84ephwq = x + 12;
+    // line comment 0: the quick brown fox jumps over the lazy dog 3443114881
+    // line comment 1: the quick brown fox jumps over the lazy dog 717484386
+    // line comment 2: the quick brown fox jumps over the lazy dog 2161040189
+    // line comment 3: the quick brown fox jumps over the lazy dog 808658011
+    // line comment 4: the quick brown fox jumps over the lazy dog 914419994
+    // line comment 5: the quick brown fox jumps over the lazy dog 4058607511
+    // line comment 6: the quick brown fox jumps over the lazy dog 2532640816
+    // line comment 7: the quick brown fox jumps over the lazy dog 3978697980
+    // line comment 8: the quick brown fox jumps over the lazy dog 3804119567
+    // line comment 9: the quick brown fox jumps over the lazy dog 2701302118
+    // line comment 10: the quick brown fox jumps over the lazy dog 4145636176
+    // line comment 11: the quick brown fox jumps over the lazy dog 3300794459
+    // line comment 12: the quick brown fox jumps over the lazy dog 1301746492
+    // line comment 13: the quick brown fox jumps over the lazy dog 1679886585
+    // line comment 14: the quick brown fox jumps over the lazy dog 3573780673
+    // line comment 15: the quick brown fox jumps over the lazy dog 2648983833
+    // line comment 16: the quick brown fox jumps over the lazy dog 3449393648
+    // line comment 17: the quick brown fox jumps over the lazy dog 1704432037
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2142923900
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 865882315
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3470706236
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4208440685
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3821881189
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 701758082
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 877494314
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 144845792
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1558983189
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2106583639
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3035322332
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 714436527
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1061530946
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4008372071
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2762695546
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2211770842
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3897938374
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3308773961 */
+    int _6nLkfcqjD887Jp44OW3OlpSIMSjvnS5ZhYZQhiKY3Ggv3pD1s2RlSpQRSMzOjQ_EkwVcZs6U_KKl16RXvx2Y_xhLmHTMICe3aHk5k4zwHZwg6209gtS1TxyfwPjoP5R7zdOf81XbLJdVHHOweHv4bMaQIclHi1NSS7SFYLnRmJJxEDt0wIozMKAnS0jWYQI06pY6OMKTxVigPZszXax68KoyS8 = _S8tr0DdHNoC5FSWwLRKxdl_0usNQkFB_pQowjWf2qQ5KigcbY3GuLmzDlHVBkHKeV7TYs3t_VIHU_T2U0VR84ephwq * 45;
+    return _6nLkfcqjD887Jp44OW3OlpSIMSjvnS5ZhYZQhiKY3Ggv3pD1s2RlSpQRSMzOjQ_EkwVcZs6U_KKl16RXvx2Y_xhLmHTMICe3aHk5k4zwHZwg6209gtS1TxyfwPjoP5R7zdOf81XbLJdVHHOweHv4bMaQIclHi1NSS7SFYLnRmJJxEDt0wIozMKAnS0jWYQI06pY6OMKTxVigPZszXax68KoyS8;
+}
+
+int idents_1(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 519589584
+    // line comment 1: the quick brown fox jumps over the lazy dog 651005258
+    // line comment 2: the quick brown fox jumps over the lazy dog 2246072933
+    // line comment 3: the quick brown fox jumps over the lazy dog 3888173884
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3598422105
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 406229303
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2078988561
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3259873145 */
+    int _uYNZMiXu8FuHh_p8BiUI3jNBp7yMl5aYBXBGoQxQ3mR5u3SGAT_2CuIkCiQmolp3cyY1w7GMEYxHCbdvtowzgPC36PHSfTZiUHp3zEOAmwIBS384j09RuLizpFEiTu39WmZbttaPZHuk7V4M78DoO8J6f5Gjf7tfwbOKzzU_yIxCRaXoOOgGGMEC0PFx4s6b = x + 37;
+    // line comment 0: the quick brown fox jumps over the lazy dog 1271698596
+    // line comment 1: the quick brown fox jumps over the lazy dog 3199747551
+    // line comment 2: the quick brown fox jumps over the lazy dog 3362899155
+    // line comment 3: the quick brown fox jumps over the lazy dog 59419017
+    // line comment 4: the quick brown fox jumps over the lazy dog 2666605406
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 492042879
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 358964876
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3547429151
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2988380279
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3539326684 */
+    int _V1sX8RTCxeNL_aluLNCPUqFMpOrimQOF3TuQl0PMu4d2FQXIKlxDWWscht_B17PTi1xzx4jvJjFEOomud0YgUClnRj6dB1VLoFtEdZDpYPqtQcOS46D8G36gdWtU9cQ3btfhji0ITob_YKp4pzRMEFTs0iGI1yRvdRtCsnKHGsYpa1veeMMcOemS_dreQkuKE0bMEdK = _uYNZMiXu8FuHh_p8BiUI3jNBp7yMl5aYBXBGoQxQ3mR5u3SGAT_2CuIkCiQmolp3cyY1w7GMEYxHCbdvtowzgPC36PHSfTZiUHp3zEOAmwIBS384j09RuLizpFEiTu39WmZbttaPZHuk7V4M78DoO8J6f5Gjf7tfwbOKzzU_yIxCRaXoOOgGGMEC0PFx4s6b * 93;
+    return _V1sX8RTCxeNL_aluLNCPUqFMpOrimQOF3TuQl0PMu4d2FQXIKlxDWWscht_B17PTi1xzx4jvJjFEOomud0YgUClnRj6dB1VLoFtEdZDpYPqtQcOS46D8G36gdWtU9cQ3btfhji0ITob_YKp4pzRMEFTs0iGI1yRvdRtCsnKHGsYpa1veeMMcOemS_dreQkuKE0bMEdK;
+}
+
+int idents_2(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 875517307
+    // line comment 1: the quick brown fox jumps over the lazy dog 2585269318
+    // line comment 2: the quick brown fox jumps over the lazy dog 1702565023
+    // line comment 3: the quick brown fox jumps over the lazy dog 1227713140
+    // line comment 4: the quick brown fox jumps over the lazy dog 2338337891
+    // line comment 5: the quick brown fox jumps over the lazy dog 2334578538
+    // line comment 6: the quick brown fox jumps over the lazy dog 1759828355
+    // line comment 7: the quick brown fox jumps over the lazy dog 4167876363
+    // line comment 8: the quick brown fox jumps over the lazy dog 3870978100
+    // line comment 9: the quick brown fox jumps over the lazy dog 2227816421
+    // line comment 10: the quick brown fox jumps over the lazy dog 2373665507
+    // line comment 11: the quick brown fox jumps over the lazy dog 189488210
+    // line comment 12: the quick brown fox jumps over the lazy dog 1310934055
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3418939660
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2967753219
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4039183122
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3708448508
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1028574761
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 340657235
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 393772569
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1571659212
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2591574536
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4218854933
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2411962641
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1604907370
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 357940602 */
+    int _RtHxBV0x61j7Yt7RmOd77qmZq3y8yYhFi6Hwr9reWzfhO1lGFqVCyGfanARc64KXp4XYLVhn9uVGEOtkdPEVkCAdlqmlhVy1xpv1_0lgqrP5da2O4dfN92NBnWfbGwySd7E_48j0IGyRrETkriWOlFGqcV10WXDFIh2AbtZ2JrztAAe4oe0m24ymZp = x + 50;
+    // line comment 0: the quick brown fox jumps over the lazy dog 957409156
+    // line comment 1: the quick brown fox jumps over the lazy dog 1756287192
+    // line comment 2: the quick brown fox jumps over the lazy dog 3703116386
+    // line comment 3: the quick brown fox jumps over the lazy dog 2966353022
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 674147224
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3931535959
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1333300703
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3174363033 */
+    int _rrCoacL0oiCZk9QaWdRDdrDeFxRJBl_o0jktVGiGzfML_39t9vhmaxLyy2DeaKsOJtPOJgfu0Yeq8au0wAgjziT0BZ2sbox1pL7r2bWo4BLXXiK43M33MqJQOstVutBLRBdpWpOWTG7vDtPd5bKpBcchWPQPthK3eXxyNxiTc0cAb87s_8tJn4hepy_R_ThKsaDgvkL1 = _RtHxBV0x61j7Yt7RmOd77qmZq3y8yYhFi6Hwr9reWzfhO1lGFqVCyGfanARc64KXp4XYLVhn9uVGEOtkdPEVkCAdlqmlhVy1xpv1_0lgqrP5da2O4dfN92NBnWfbGwySd7E_48j0IGyRrETkriWOlFGqcV10WXDFIh2AbtZ2JrztAAe4oe0m24ymZp * 21;
+    return _rrCoacL0oiCZk9QaWdRDdrDeFxRJBl_o0jktVGiGzfML_39t9vhmaxLyy2DeaKsOJtPOJgfu0Yeq8au0wAgjziT0BZ2sbox1pL7r2bWo4BLXXiK43M33MqJQOstVutBLRBdpWpOWTG7vDtPd5bKpBcchWPQPthK3eXxyNxiTc0cAb87s_8tJn4hepy_R_ThKsaDgvkL1;
+}
+
+int idents_3(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 1773207794
+    // line comment 1: the quick brown fox jumps over the lazy dog 1788746891
+    // line comment 2: the quick brown fox jumps over the lazy dog 1122625448
+    // line comment 3: the quick brown fox jumps over the lazy dog 4048430036
+    // line comment 4: the quick brown fox jumps over the lazy dog 2760582555
+    // line comment 5: the quick brown fox jumps over the lazy dog 2639338237
+    // line comment 6: the quick brown fox jumps over the lazy dog 4187780701
+    // line comment 7: the quick brown fox jumps over the lazy dog 2892877197
+    // line comment 8: the quick brown fox jumps over the lazy dog 2423137825
+    // line comment 9: the quick brown fox jumps over the lazy dog 3619294216
+    // line comment 10: the quick brown fox jumps over the lazy dog 1796994691
+    // line comment 11: the quick brown fox jumps over the lazy dog 900601583
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3247109369
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1657462556
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 36052819
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1010008790
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1195874834
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 769421816
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4082851769
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3945974171
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3483930394
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1383148490
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2296538747
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1833985401 */
+    int _q8YRvKfKk4MsGIqqJlE2RgqZl9YmQlbRdIQbwBKdQlHNLa6a4LS2oiKi5EM01ZbN42TNW03VJ9VD0Ux72f0bh55tPc6w25SkK6hZub_QqpV3w3EVvAhxHTc7fHO2wYgKNsCvN11ozP8H5l8UR = x + 22;
+    // line comment 0: the quick brown fox jumps over the lazy dog 2632555701
+    // line comment 1: the quick brown fox jumps over the lazy dog 992899009
+    // line comment 2: the quick brown fox jumps over the lazy dog 447353555
+    // line comment 3: the quick brown fox jumps over the lazy dog 1991699032
+    // line comment 4: the quick brown fox jumps over the lazy dog 2931341030
+    // line comment 5: the quick brown fox jumps over the lazy dog 4068551054
+    // line comment 6: the quick brown fox jumps over the lazy dog 3420779937
+    // line comment 7: the quick brown fox jumps over the lazy dog 2495393544
+    // line comment 8: the quick brown fox jumps over the lazy dog 954382077
+    // line comment 9: the quick brown fox jumps over the lazy dog 3067103489
+    // line comment 10: the quick brown fox jumps over the lazy dog 3076560808
+    // line comment 11: the quick brown fox jumps over the lazy dog 3257336559
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1048957626
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3225218665
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 800234519
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1185827245
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 379574153
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2215728552
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3185438176
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1281144508
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2956046088
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2677355292
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2930055165
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 303138986 */
+    int _f1EkbY2nICXrsO9erQzVh5I56KDwgWuQ0WBu42QQUIwNUdq38BWuPYfXYMazYcW_hiprojTy0lUrVUGYSTM428uPRMarnDjkKFGutExVHUNsh2fyFs3K0Rmcw6uhvHzXRm1cSQZEHHaRGTF3vO6MVSgzrikAycLCpSENzkiJmfEnGi = _q8YRvKfKk4MsGIqqJlE2RgqZl9YmQlbRdIQbwBKdQlHNLa6a4LS2oiKi5EM01ZbN42TNW03VJ9VD0Ux72f0bh55tPc6w25SkK6hZub_QqpV3w3EVvAhxHTc7fHO2wYgKNsCvN11ozP8H5l8UR * 75;
+    return _f1EkbY2nICXrsO9erQzVh5I56KDwgWuQ0WBu42QQUIwNUdq38BWuPYfXYMazYcW_hiprojTy0lUrVUGYSTM428uPRMarnDjkKFGutExVHUNsh2fyFs3K0Rmcw6uhvHzXRm1cSQZEHHaRGTF3vO6MVSgzrikAycLCpSENzkiJmfEnGi;
+}
+
+int idents_4(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 168227465
+    // line comment 1: the quick brown fox jumps over the lazy dog 967339407
+    // line comment 2: the quick brown fox jumps over the lazy dog 1370316717
+    // line comment 3: the quick brown fox jumps over the lazy dog 1532963562
+    // line comment 4: the quick brown fox jumps over the lazy dog 1975200427
+    // line comment 5: the quick brown fox jumps over the lazy dog 537228318
+    // line comment 6: the quick brown fox jumps over the lazy dog 3874690380
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3576791325
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3484998661
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4260295956
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3806775989
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 266498084
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 784718732
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3300639096 */
+    int _Dv2Z_LzNzvFrdrT4So4n4bPTW299JKbEJNfN0t3mMSNkgjikJj7CI1ZwZWTvIGzhiiIc7NAYKbjLdekI7oqrgtjViKVwZ4dCkUK74AUwOHK0mSbYc4HNFoZZkvU6ii4oNTklr9YHvLcZ2WvU6kqcr7r4rzYsSAaVPgKwHwTKSaOwTZfOSCLoCMqvOmJfC60e4FF6i1XnqHFUKAQhBHyTMOIA3FuMOcMJ3upylxtzpznfWBuYuwSq2950 = x + 80;
+    // line comment 0: the quick brown fox jumps over the lazy dog 2177491604
+    // line comment 1: the quick brown fox jumps over the lazy dog 1025891232
+    // line comment 2: the quick brown fox jumps over the lazy dog 1714741548
+    // line comment 3: the quick brown fox jumps over the lazy dog 1515105654
+    // line comment 4: the quick brown fox jumps over the lazy dog 4096896063
+    // line comment 5: the quick brown fox jumps over the lazy dog 2964307487
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1688855349
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3326517065
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3812401358
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 914622904
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2042483553
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1916791945 */
+    int _N2s_DCbA_QWYLQThVzDJ74iAOUz98KCaQIr3KhcAdET_G9cx_TRmOAmcvpmzqNIheuiCU5X_VlTwlp56p2AvH7nA_01f8KKtfWrebhbqRJ_Vu9GyCLXgAfc8Fd2syndgPKTlgouZTZS27BIVsvoPo8PxyWvZn8ViBsPXqjNqQHNFn_azpY6Zlq7lLvU = _Dv2Z_LzNzvFrdrT4So4n4bPTW299JKbEJNfN0t3mMSNkgjikJj7CI1ZwZWTvIGzhiiIc7NAYKbjLdekI7oqrgtjViKVwZ4dCkUK74AUwOHK0mSbYc4HNFoZZkvU6ii4oNTklr9YHvLcZ2WvU6kqcr7r4rzYsSAaVPgKwHwTKSaOwTZfOSCLoCMqvOmJfC60e4FF6i1XnqHFUKAQhBHyTMOIA3FuMOcMJ3upylxtzpznfWBuYuwSq2950 * 80;
+    return _N2s_DCbA_QWYLQThVzDJ74iAOUz98KCaQIr3KhcAdET_G9cx_TRmOAmcvpmzqNIheuiCU5X_VlTwlp56p2AvH7nA_01f8KKtfWrebhbqRJ_Vu9GyCLXgAfc8Fd2syndgPKTlgouZTZS27BIVsvoPo8PxyWvZn8ViBsPXqjNqQHNFn_azpY6Zlq7lLvU;
+}
+
+int idents_5(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 639096567
+    // line comment 1: the quick brown fox jumps over the lazy dog 3209736534
+    // line comment 2: the quick brown fox jumps over the lazy dog 3145549010
+    // line comment 3: the quick brown fox jumps over the lazy dog 2278515954
+    // line comment 4: the quick brown fox jumps over the lazy dog 1342633881
+    // line comment 5: the quick brown fox jumps over the lazy dog 4028760525
+    // line comment 6: the quick brown fox jumps over the lazy dog 2910276840
+    // line comment 7: the quick brown fox jumps over the lazy dog 1301574251
+    // line comment 8: the quick brown fox jumps over the lazy dog 2666751884
+    // line comment 9: the quick brown fox jumps over the lazy dog 550059821
+    // line comment 10: the quick brown fox jumps over the lazy dog 2306331231
+    // line comment 11: the quick brown fox jumps over the lazy dog 3364684036
+    // line comment 12: the quick brown fox jumps over the lazy dog 3505841429
+    // line comment 13: the quick brown fox jumps over the lazy dog 3626163597
+    // line comment 14: the quick brown fox jumps over the lazy dog 161580107
+    // line comment 15: the quick brown fox jumps over the lazy dog 1232326034
+    // line comment 16: the quick brown fox jumps over the lazy dog 438846882
+    // line comment 17: the quick brown fox jumps over the lazy dog 1789394767
+    // line comment 18: the quick brown fox jumps over the lazy dog 3178567107
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3576200085
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 999188723
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2660027906
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 260480707
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1221665936
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 980876328
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3423195011
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1237234744
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 721314471
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1467581193
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1549391096
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3846849072
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 972686721
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 754818162
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4066171814
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3663111308
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2050558923
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3187856853
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4134296718 */
+    int _HF2gGQ_ax3pCYZZpm3cieux92Jr9TAV3f9lz5yo4P_4lBynkAqPdi5EiluhK6O7J7TzYZ2h2AhqSW2U4nGh2Sif3jXBO = x + 78;
+    // line comment 0: the quick brown fox jumps over the lazy dog 3607741134
+    // line comment 1: the quick brown fox jumps over the lazy dog 2832499736
+    // line comment 2: the quick brown fox jumps over the lazy dog 1923265551
+    // line comment 3: the quick brown fox jumps over the lazy dog 357479320
+    // line comment 4: the quick brown fox jumps over the lazy dog 1410123696
+    // line comment 5: the quick brown fox jumps over the lazy dog 3158857656
+    // line comment 6: the quick brown fox jumps over the lazy dog 3954085913
+    // line comment 7: the quick brown fox jumps over the lazy dog 3947664973
+    // line comment 8: the quick brown fox jumps over the lazy dog 368574156
+    // line comment 9: the quick brown fox jumps over the lazy dog 2166956554
+    // line comment 10: the quick brown fox jumps over the lazy dog 3656406058
+    // line comment 11: the quick brown fox jumps over the lazy dog 102285573
+    // line comment 12: the quick brown fox jumps over the lazy dog 326508734
+    // line comment 13: the quick brown fox jumps over the lazy dog 2891148481
+    // line comment 14: the quick brown fox jumps over the lazy dog 1831928522
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1567064558
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1865276264
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2042125245
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3199733223
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1803276489
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1789694723
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 584021404
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4087819217
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1807245700
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2408254395
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3762374661
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1047612478
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3393931111
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1795908832
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3196524413 */
+    int _nN0TiylzxGC0GuE2d52UpT_4Ygkb33Ys9AdphDA93UV0RWz3lYHwyvzgTwrt6_HRiLt9rqtVWKU0Q1uhL58AJBwsX5DuS6JmvwuhR9IVz03l1TflNyaD8k2sC9FyKV = _HF2gGQ_ax3pCYZZpm3cieux92Jr9TAV3f9lz5yo4P_4lBynkAqPdi5EiluhK6O7J7TzYZ2h2AhqSW2U4nGh2Sif3jXBO * 40;
+    return _nN0TiylzxGC0GuE2d52UpT_4Ygkb33Ys9AdphDA93UV0RWz3lYHwyvzgTwrt6_HRiLt9rqtVWKU0Q1uhL58AJBwsX5DuS6JmvwuhR9IVz03l1TflNyaD8k2sC9FyKV;
+}
+
+int idents_6(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 2420944655
+    // line comment 1: the quick brown fox jumps over the lazy dog 1007216083
+    // line comment 2: the quick brown fox jumps over the lazy dog 3971225313
+    // line comment 3: the quick brown fox jumps over the lazy dog 3087712261
+    // line comment 4: the quick brown fox jumps over the lazy dog 200241037
+    // line comment 5: the quick brown fox jumps over the lazy dog 394505974
+    // line comment 6: the quick brown fox jumps over the lazy dog 4045648015
+    // line comment 7: the quick brown fox jumps over the lazy dog 3715041088
+    // line comment 8: the quick brown fox jumps over the lazy dog 131477814
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3381617532
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1180218740
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3446339370
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3850985914
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1114132051
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2549106440
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1852783320
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 32537067
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 246224239 */
+    int _8XswlExzZ0XaW0rFTtkSMlmBmoqBr_vLeOewCIhmf4Z1LvC9Y6g9OknfJNEmhx8mYc2_wC35JgeoLI2Xol1GhubPRCLHSi0DBE1tYYl5y56shi7DvhzWuc3Pb9PDaqygvTqIjJtpZaA57wmvrB55ibHP_z_BQNmseBrOc41K = x + 0;
+    // line comment 0: the quick brown fox jumps over the lazy dog 3027098085
+    // line comment 1: the quick brown fox jumps over the lazy dog 2373659148
+    // line comment 2: the quick brown fox jumps over the lazy dog 1920191796
+    // line comment 3: the quick brown fox jumps over the lazy dog 3621217231
+    // line comment 4: the quick brown fox jumps over the lazy dog 2762117438
+    // line comment 5: the quick brown fox jumps over the lazy dog 1438349508
+    // line comment 6: the quick brown fox jumps over the lazy dog 1214056652
+    // line comment 7: the quick brown fox jumps over the lazy dog 4078163778
+    // line comment 8: the quick brown fox jumps over the lazy dog 1246134336
+    // line comment 9: the quick brown fox jumps over the lazy dog 2689308937
+    // line comment 10: the quick brown fox jumps over the lazy dog 747550188
+    // line comment 11: the quick brown fox jumps over the lazy dog 1773951706
+    // line comment 12: the quick brown fox jumps over the lazy dog 2044219664
+    // line comment 13: the quick brown fox jumps over the lazy dog 1055218627
+    // line comment 14: the quick brown fox jumps over the lazy dog 2631440774
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2985263398
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4031451792
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3274596769
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4008427722
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2056247179
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 497899257
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2727372954
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4248694084
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3586054999
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 228716283
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3932060351
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 479123958
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 493382224
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1147680259
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1362382802 */
+    int __ZtN8P8Ugn95MAM0sn2smDgJTlp41wUjCBPXzZ8HJU6fCN9FMImQJM9rfU0n7NlUxx688ZKPioFmAxTQmCraRje = _8XswlExzZ0XaW0rFTtkSMlmBmoqBr_vLeOewCIhmf4Z1LvC9Y6g9OknfJNEmhx8mYc2_wC35JgeoLI2Xol1GhubPRCLHSi0DBE1tYYl5y56shi7DvhzWuc3Pb9PDaqygvTqIjJtpZaA57wmvrB55ibHP_z_BQNmseBrOc41K * 19;
+    return __ZtN8P8Ugn95MAM0sn2smDgJTlp41wUjCBPXzZ8HJU6fCN9FMImQJM9rfU0n7NlUxx688ZKPioFmAxTQmCraRje;
+}
+
+int idents_7(int x) {
+    // line comment 0: the quick brown fox jumps over the lazy dog 2160851579
+    // line comment 1: the quick brown fox jumps over the lazy dog 3946123045
+    // line comment 2: the quick brown fox jumps over the lazy dog 1992361510
+    // line comment 3: the quick brown fox jumps over the lazy dog 3283003539
+    // line comment 4: the quick brown fox jumps over the lazy dog 1763012876
+    // line comment 5: the quick brown fox jumps over the lazy dog 3981521697
+    // line comment 6: the quick brown fox jumps over the lazy dog 607374504
+    // line comment 7: the quick brown fox jumps over the lazy dog 1095923957
+    // line comment 8: the quick brown fox jumps over the lazy dog 2519308049
+    // line comment 9: the quick brown fox jumps over the lazy dog 3369357820
+    // line comment 10: the quick brown fox jumps over the lazy dog 1542166576
+    // line comment 11: the quick brown fox jumps over the lazy dog 3100067366
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1256517555
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2749658017
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3963843554
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 111137866
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3083331188
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2975728423
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1253294241
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1816053373
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2415221905
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1360889757
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 824439903
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 4002729172 */
+    int _ec2qnFaChRwd6nF_WURkaPdBh2J9OcB8ZC3pdr67tbUQgC312pDgE8nmFMuHSw6rzviJzkQWqVqj1e9 = x + 79;
+    // line comment 0: the quick brown fox jumps over the lazy dog 3284401411
+    // line comment 1: the quick brown fox jumps over the lazy dog 481298917
+    // line comment 2: the quick brown fox jumps over the lazy dog 1887151361
+    // line comment 3: the quick brown fox jumps over the lazy dog 1353240220
+    // line comment 4: the quick brown fox jumps over the lazy dog 249928808
+    // line comment 5: the quick brown fox jumps over the lazy dog 323370890
+    // line comment 6: the quick brown fox jumps over the lazy dog 4249038400
+    // line comment 7: the quick brown fox jumps over the lazy dog 3907332397
+    // line comment 8: the quick brown fox jumps over the lazy dog 1615539454
+    // line comment 9: the quick brown fox jumps over the lazy dog 2882303976
+    // line comment 10: the quick brown fox jumps over the lazy dog 704229388
+    // line comment 11: the quick brown fox jumps over the lazy dog 2328172172
+    // line comment 12: the quick brown fox jumps over the lazy dog 1192877508
+    // line comment 13: the quick brown fox jumps over the lazy dog 1965894952
+    // line comment 14: the quick brown fox jumps over the lazy dog 2406168178
+    // line comment 15: the quick brown fox jumps over the lazy dog 2645006760
+    // line comment 16: the quick brown fox jumps over the lazy dog 1021823591
+    // line comment 17: the quick brown fox jumps over the lazy dog 663333560
+    // line comment 18: the quick brown fox jumps over the lazy dog 866198885
+    /* block comment
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 313329331
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2685394753
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 716530255
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 1718159860
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 577659317
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 924134472
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2620643182
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2836161893
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 395359322
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3168576655
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3152313704
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3392321362
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 872163321
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2523154490
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 2167251750
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3637097465
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 264229583
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 705880221
+       lorem ipsum dolor sit amet, consectetur adipiscing elit 3875065134 */
+    int _xwTiqpIUGk3VaHfHSdoWmdGOR3g9hznvEgi1yBDDnSCl82YYcU7ixYwcVyzejIqwZgDthhPPipLvDDKbuSlTOM5LoiOiytviGmAvU4bcleW0kyHww1ZLQ0xz4eWWQq1C10RqdI12 = _ec2qnFaChRwd6nF_WURkaPdBh2J9OcB8ZC3pdr67tbUQgC312pDgE8nmFMuHSw6rzviJzkQWqVqj1e9 * 16;
+    return _xwTiqpIUGk3VaHfHSdoWmdGOR3g9hznvEgi1yBDDnSCl82YYcU7ixYwcVyzejIqwZgDthhPPipLvDDKbuSlTOM5LoiOiytviGmAvU4bcleW0kyHww1ZLQ0xz4eWWQq1C10RqdI12;
+}
+
+int main() {
+    int x = 8;
+    x = x + idents_0(x);
+    x = x + idents_1(x);
+    x = x + idents_2(x);
+    x = x + idents_3(x);
+    x = x + idents_4(x);
+    x = x + idents_5(x);
+    x = x + idents_6(x);
+    x = x + idents_7(x);
+    print(x);
+    return 0;
+}
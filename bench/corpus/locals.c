@@ -0,0 +1,997 @@
+int locals_0(int x) {
+    int local_0 = x + 57;
+    int local_1 = local_0 + 34;
+    int local_2 = local_0 + 79;
+    int local_3 = local_1 + 93;
+    int local_4 = local_1 + 12;
+    int local_5 = local_0 + 55;
+    int local_6 = local_3 + 46;
+    int local_7 = local_0 + 8;
+    int local_8 = local_2 + 8;
+    int local_9 = local_8 + 92;
+    int local_10 = local_8 + 39;
+    int local_11 = local_5 + 63;
+    int local_12 = local_0 + 66;
+    int local_13 = local_7 + 96;
+    int local_14 = local_7 + 40;
+    int local_15 = local_14 + 19;
+    int local_16 = local_2 + 0;
+    int local_17 = local_12 + 91;
+    int local_18 = local_12 + 79;
+    int local_19 = local_3 + 17;
+    int local_20 = local_2 + 40;
+    int local_21 = local_1 + 56;
+    int local_22 = local_10 + 39;
+    int local_23 = local_2 + 66;
+    int local_24 = local_20 + 41;
+    int local_25 = local_21 + 9;
+    int local_26 = local_12 + 85;
+    int local_27 = local_8 + 35;
+    int local_28 = local_13 + 1;
+    int local_29 = local_22 + 37;
+    int local_30 = local_27 + 32;
+    int local_31 = local_29 + 48;
+    int local_32 = local_27 + 97;
+    int local_33 = local_3 + 65;
+    int local_34 = local_26 + 97;
+    int local_35 = local_2 + 34;
+    int local_36 = local_30 + 7;
+    int local_37 = local_35 + 28;
+    int local_38 = local_14 + 75;
+    int local_39 = local_30 + 36;
+    int local_40 = local_13 + 1;
+    int local_41 = local_34 + 18;
+    int local_42 = local_36 + 21;
+    int local_43 = local_23 + 49;
+    int local_44 = local_41 + 56;
+    int local_45 = local_40 + 77;
+    int local_46 = local_17 + 94;
+    int local_47 = local_17 + 84;
+    int local_48 = local_47 + 80;
+    int local_49 = local_2 + 67;
+    int local_50 = local_30 + 61;
+    int local_51 = local_38 + 20;
+    int local_52 = local_7 + 63;
+    int local_53 = local_23 + 18;
+    int local_54 = local_37 + 3;
+    int local_55 = local_50 + 93;
+    int local_56 = local_35 + 95;
+    int local_57 = local_7 + 63;
+    int local_58 = local_46 + 28;
+    int local_59 = local_53 + 21;
+    int local_60 = local_43 + 9;
+    int local_61 = local_12 + 46;
+    int local_62 = local_43 + 71;
+    int local_63 = local_53 + 84;
+    int local_64 = local_42 + 70;
+    int local_65 = local_42 + 33;
+    int local_66 = local_14 + 65;
+    int local_67 = local_44 + 76;
+    int local_68 = local_20 + 51;
+    int local_69 = local_62 + 15;
+    int local_70 = local_36 + 63;
+    int local_71 = local_35 + 78;
+    int local_72 = local_69 + 52;
+    int local_73 = local_66 + 23;
+    int local_74 = local_40 + 18;
+    int local_75 = local_18 + 41;
+    int local_76 = local_36 + 66;
+    int local_77 = local_24 + 3;
+    int local_78 = local_16 + 83;
+    int local_79 = local_21 + 56;
+    int local_80 = local_64 + 46;
+    int local_81 = local_29 + 68;
+    int local_82 = local_35 + 58;
+    int local_83 = local_49 + 85;
+    int local_84 = local_58 + 99;
+    int local_85 = local_2 + 60;
+    int local_86 = local_45 + 65;
+    int local_87 = local_10 + 41;
+    int local_88 = local_7 + 28;
+    int local_89 = local_75 + 86;
+    int local_90 = local_15 + 48;
+    int local_91 = local_34 + 18;
+    int local_92 = local_24 + 79;
+    int local_93 = local_16 + 19;
+    int local_94 = local_52 + 36;
+    int local_95 = local_54 + 39;
+    int local_96 = local_92 + 62;
+    int local_97 = local_64 + 6;
+    int local_98 = local_36 + 29;
+    int local_99 = local_96 + 24;
+    int local_100 = local_28 + 90;
+    int local_101 = local_11 + 24;
+    int local_102 = local_7 + 37;
+    int local_103 = local_34 + 65;
+    int local_104 = local_32 + 26;
+    int local_105 = local_65 + 7;
+    int local_106 = local_33 + 74;
+    int local_107 = local_12 + 47;
+    int local_108 = local_46 + 24;
+    int local_109 = local_108 + 2;
+    int local_110 = local_91 + 69;
+    int local_111 = local_3 + 45;
+    int local_112 = local_34 + 47;
+    int local_113 = local_83 + 51;
+    int local_114 = local_43 + 87;
+    int local_115 = local_70 + 34;
+    int local_116 = local_98 + 69;
+    int local_117 = local_19 + 4;
+    int local_118 = local_18 + 97;
+    int local_119 = local_29 + 87;
+    int local_120 = local_3 + 33;
+    int local_121 = local_28 + 96;
+    int local_122 = local_29 + 50;
+    int local_123 = local_75 + 4;
+    int local_124 = local_64 + 34;
+    int local_125 = local_59 + 46;
+    int local_126 = local_22 + 98;
+    int local_127 = local_99 + 20;
+    int local_128 = local_76 + 48;
+    int local_129 = local_98 + 54;
+    int local_130 = local_57 + 98;
+    int local_131 = local_38 + 30;
+    int local_132 = local_56 + 75;
+    int local_133 = local_42 + 94;
+    int local_134 = local_21 + 89;
+    int local_135 = local_80 + 27;
+    int local_136 = local_91 + 60;
+    int local_137 = local_68 + 85;
+    int local_138 = local_95 + 64;
+    int local_139 = local_21 + 70;
+    int local_140 = local_55 + 60;
+    int local_141 = local_119 + 17;
+    int local_142 = local_95 + 82;
+    int local_143 = local_6 + 48;
+    int local_144 = local_51 + 77;
+    int local_145 = local_89 + 47;
+    int local_146 = local_83 + 17;
+    int local_147 = local_130 + 4;
+    int local_148 = local_114 + 96;
+    int local_149 = local_65 + 26;
+    int local_150 = local_134 + 94;
+    int local_151 = local_106 + 33;
+    int local_152 = local_78 + 82;
+    int local_153 = local_129 + 51;
+    int local_154 = local_55 + 87;
+    int local_155 = local_19 + 26;
+    int local_156 = local_102 + 29;
+    int local_157 = local_15 + 60;
+    int local_158 = local_93 + 68;
+    int local_159 = local_19 + 20;
+    int local_160 = local_113 + 57;
+    int local_161 = local_129 + 8;
+    int local_162 = local_10 + 36;
+    int local_163 = local_140 + 62;
+    int local_164 = local_141 + 43;
+    int local_165 = local_53 + 46;
+    int local_166 = local_110 + 93;
+    int local_167 = local_145 + 1;
+    int local_168 = local_137 + 11;
+    int local_169 = local_91 + 94;
+    int local_170 = local_0 + 10;
+    int local_171 = local_32 + 70;
+    int local_172 = local_70 + 71;
+    int local_173 = local_47 + 41;
+    int local_174 = local_6 + 13;
+    int local_175 = local_106 + 17;
+    int local_176 = local_168 + 96;
+    int local_177 = local_144 + 33;
+    int local_178 = local_132 + 51;
+    int local_179 = local_13 + 9;
+    int local_180 = local_146 + 76;
+    int local_181 = local_65 + 62;
+    int local_182 = local_124 + 31;
+    int local_183 = local_7 + 58;
+    int local_184 = local_121 + 74;
+    int local_185 = local_107 + 66;
+    int local_186 = local_152 + 40;
+    int local_187 = local_93 + 69;
+    int local_188 = local_92 + 13;
+    int local_189 = local_150 + 58;
+    int local_190 = local_178 + 41;
+    int local_191 = local_132 + 39;
+    int local_192 = local_177 + 27;
+    int local_193 = local_51 + 14;
+    int local_194 = local_22 + 87;
+    int local_195 = local_183 + 83;
+    int local_196 = local_90 + 17;
+    int local_197 = local_101 + 73;
+    int local_198 = local_123 + 54;
+    int local_199 = local_57 + 99;
+    int local_200 = local_70 + 62;
+    int local_201 = local_148 + 29;
+    int local_202 = local_177 + 92;
+    int local_203 = local_109 + 32;
+    int local_204 = local_202 + 3;
+    int local_205 = local_174 + 89;
+    int local_206 = local_167 + 29;
+    int local_207 = local_108 + 50;
+    int local_208 = local_203 + 38;
+    int local_209 = local_72 + 13;
+    int local_210 = local_172 + 81;
+    int local_211 = local_106 + 40;
+    int local_212 = local_1 + 82;
+    int local_213 = local_115 + 13;
+    int local_214 = local_50 + 59;
+    int local_215 = local_178 + 23;
+    int local_216 = local_15 + 27;
+    int local_217 = local_47 + 70;
+    int local_218 = local_71 + 0;
+    int local_219 = local_1 + 76;
+    int local_220 = local_197 + 33;
+    int local_221 = local_97 + 80;
+    int local_222 = local_110 + 77;
+    int local_223 = local_141 + 95;
+    int local_224 = local_122 + 69;
+    int local_225 = local_9 + 36;
+    int local_226 = local_110 + 36;
+    int local_227 = local_131 + 60;
+    int local_228 = local_227 + 37;
+    int local_229 = local_9 + 54;
+    int local_230 = local_23 + 44;
+    int local_231 = local_172 + 0;
+    int local_232 = local_120 + 5;
+    int local_233 = local_116 + 47;
+    int local_234 = local_83 + 12;
+    int local_235 = local_66 + 69;
+    int local_236 = local_219 + 8;
+    int local_237 = local_156 + 80;
+    int local_238 = local_5 + 1;
+    int local_239 = local_209 + 78;
+    int local_240 = local_196 + 18;
+    int local_241 = local_84 + 17;
+    int local_242 = local_216 + 28;
+    int local_243 = local_2 + 59;
+    int local_244 = local_94 + 72;
+    int local_245 = local_230 + 77;
+    int local_246 = local_200 + 85;
+    int local_247 = local_90 + 62;
+    int local_248 = local_71 + 97;
+    int local_249 = local_143 + 28;
+    int local_250 = local_212 + 17;
+    int local_251 = local_63 + 7;
+    int local_252 = local_30 + 11;
+    int local_253 = local_50 + 41;
+    int local_254 = local_168 + 98;
+    int local_255 = local_85 + 97;
+    int local_256 = local_108 + 45;
+    int local_257 = local_90 + 72;
+    int local_258 = local_143 + 13;
+    int local_259 = local_257 + 82;
+    int local_260 = local_237 + 69;
+    int local_261 = local_21 + 3;
+    int local_262 = local_29 + 46;
+    int local_263 = local_17 + 84;
+    int local_264 = local_239 + 86;
+    int local_265 = local_31 + 9;
+    int local_266 = local_139 + 35;
+    int local_267 = local_184 + 25;
+    int local_268 = local_46 + 36;
+    int local_269 = local_51 + 81;
+    int local_270 = local_27 + 0;
+    int local_271 = local_235 + 60;
+    int local_272 = local_206 + 47;
+    int local_273 = local_202 + 52;
+    int local_274 = local_70 + 23;
+    int local_275 = local_168 + 4;
+    int local_276 = local_20 + 54;
+    int local_277 = local_218 + 66;
+    int local_278 = local_258 + 47;
+    int local_279 = local_133 + 33;
+    int local_280 = local_30 + 87;
+    int local_281 = local_248 + 80;
+    int local_282 = local_16 + 41;
+    int local_283 = local_57 + 11;
+    int local_284 = local_64 + 76;
+    int local_285 = local_200 + 53;
+    int local_286 = local_253 + 91;
+    int local_287 = local_283 + 37;
+    int local_288 = local_150 + 81;
+    int local_289 = local_42 + 53;
+    int local_290 = local_288 + 91;
+    int local_291 = local_202 + 21;
+    int local_292 = local_184 + 88;
+    int local_293 = local_106 + 66;
+    int local_294 = local_186 + 25;
+    int local_295 = local_184 + 1;
+    int local_296 = local_83 + 84;
+    int local_297 = local_150 + 81;
+    int local_298 = local_220 + 3;
+    int local_299 = local_26 + 54;
+    int local_300 = local_58 + 65;
+    int local_301 = local_249 + 3;
+    int local_302 = local_199 + 80;
+    int local_303 = local_17 + 21;
+    int local_304 = local_274 + 35;
+    int local_305 = local_241 + 54;
+    int local_306 = local_279 + 69;
+    int local_307 = local_222 + 51;
+    int local_308 = local_195 + 39;
+    int local_309 = local_259 + 15;
+    int local_310 = local_134 + 99;
+    int local_311 = local_49 + 2;
+    int local_312 = local_141 + 5;
+    int local_313 = local_26 + 74;
+    int local_314 = local_236 + 2;
+    int local_315 = local_263 + 27;
+    int local_316 = local_165 + 50;
+    int local_317 = local_287 + 18;
+    int local_318 = local_111 + 13;
+    int local_319 = local_3 + 97;
+    int local_320 = local_38 + 44;
+    int local_321 = local_241 + 0;
+    int local_322 = local_34 + 81;
+    int local_323 = local_50 + 78;
+    int local_324 = local_123 + 97;
+    int local_325 = local_207 + 7;
+    int local_326 = local_176 + 50;
+    int local_327 = local_146 + 72;
+    int local_328 = local_115 + 59;
+    int local_329 = local_50 + 34;
+    int local_330 = local_75 + 18;
+    int local_331 = local_91 + 47;
+    int local_332 = local_76 + 16;
+    int local_333 = local_53 + 86;
+    int local_334 = local_87 + 68;
+    int local_335 = local_118 + 33;
+    int local_336 = local_263 + 7;
+    int local_337 = local_312 + 27;
+    int local_338 = local_52 + 36;
+    int local_339 = local_250 + 25;
+    int local_340 = local_1 + 93;
+    int local_341 = local_110 + 70;
+    int local_342 = local_25 + 98;
+    int local_343 = local_32 + 33;
+    int local_344 = local_309 + 55;
+    int local_345 = local_148 + 72;
+    int local_346 = local_32 + 46;
+    int local_347 = local_156 + 25;
+    int local_348 = local_41 + 79;
+    int local_349 = local_34 + 45;
+    int local_350 = local_161 + 75;
+    int local_351 = local_131 + 36;
+    int local_352 = local_6 + 86;
+    int local_353 = local_90 + 59;
+    int local_354 = local_199 + 45;
+    print(local_354);
+    return local_354;
+}
+
+int locals_1(int x) {
+    int local_0 = x + 8;
+    int local_1 = local_0 + 7;
+    int local_2 = local_1 + 50;
+    int local_3 = local_1 + 68;
+    int local_4 = local_2 + 88;
+    int local_5 = local_1 + 38;
+    int local_6 = local_1 + 45;
+    int local_7 = local_1 + 74;
+    int local_8 = local_6 + 58;
+    int local_9 = local_5 + 22;
+    int local_10 = local_7 + 52;
+    int local_11 = local_4 + 96;
+    int local_12 = local_3 + 47;
+    int local_13 = local_11 + 86;
+    int local_14 = local_7 + 96;
+    int local_15 = local_14 + 41;
+    int local_16 = local_9 + 29;
+    int local_17 = local_4 + 66;
+    int local_18 = local_12 + 10;
+    int local_19 = local_10 + 31;
+    int local_20 = local_3 + 9;
+    int local_21 = local_15 + 26;
+    int local_22 = local_18 + 27;
+    int local_23 = local_12 + 38;
+    int local_24 = local_18 + 78;
+    int local_25 = local_11 + 51;
+    int local_26 = local_13 + 37;
+    int local_27 = local_24 + 31;
+    int local_28 = local_1 + 34;
+    int local_29 = local_10 + 52;
+    int local_30 = local_12 + 39;
+    int local_31 = local_15 + 89;
+    int local_32 = local_18 + 52;
+    int local_33 = local_11 + 41;
+    int local_34 = local_2 + 47;
+    int local_35 = local_8 + 12;
+    int local_36 = local_19 + 54;
+    int local_37 = local_28 + 57;
+    int local_38 = local_6 + 75;
+    int local_39 = local_11 + 29;
+    int local_40 = local_8 + 43;
+    int local_41 = local_19 + 61;
+    int local_42 = local_31 + 42;
+    int local_43 = local_41 + 61;
+    int local_44 = local_34 + 63;
+    int local_45 = local_21 + 92;
+    int local_46 = local_41 + 28;
+    int local_47 = local_38 + 56;
+    int local_48 = local_36 + 24;
+    int local_49 = local_3 + 75;
+    int local_50 = local_41 + 74;
+    int local_51 = local_36 + 74;
+    int local_52 = local_3 + 20;
+    int local_53 = local_34 + 76;
+    int local_54 = local_43 + 67;
+    int local_55 = local_25 + 50;
+    int local_56 = local_40 + 59;
+    int local_57 = local_23 + 63;
+    int local_58 = local_51 + 26;
+    int local_59 = local_58 + 30;
+    int local_60 = local_35 + 5;
+    int local_61 = local_20 + 79;
+    int local_62 = local_57 + 76;
+    int local_63 = local_47 + 2;
+    int local_64 = local_6 + 6;
+    int local_65 = local_24 + 67;
+    int local_66 = local_63 + 4;
+    int local_67 = local_1 + 10;
+    int local_68 = local_21 + 76;
+    int local_69 = local_4 + 54;
+    int local_70 = local_48 + 96;
+    int local_71 = local_15 + 69;
+    int local_72 = local_3 + 25;
+    int local_73 = local_7 + 77;
+    int local_74 = local_67 + 93;
+    int local_75 = local_39 + 36;
+    int local_76 = local_65 + 88;
+    int local_77 = local_9 + 42;
+    int local_78 = local_43 + 9;
+    int local_79 = local_27 + 84;
+    int local_80 = local_31 + 23;
+    int local_81 = local_52 + 93;
+    int local_82 = local_0 + 67;
+    int local_83 = local_57 + 79;
+    int local_84 = local_21 + 72;
+    int local_85 = local_45 + 80;
+    int local_86 = local_19 + 76;
+    int local_87 = local_50 + 66;
+    int local_88 = local_67 + 96;
+    int local_89 = local_65 + 17;
+    int local_90 = local_87 + 11;
+    int local_91 = local_34 + 3;
+    int local_92 = local_42 + 73;
+    int local_93 = local_0 + 42;
+    int local_94 = local_27 + 85;
+    int local_95 = local_62 + 40;
+    int local_96 = local_49 + 76;
+    int local_97 = local_67 + 9;
+    int local_98 = local_15 + 62;
+    int local_99 = local_70 + 7;
+    int local_100 = local_44 + 15;
+    int local_101 = local_26 + 2;
+    int local_102 = local_39 + 79;
+    int local_103 = local_15 + 92;
+    int local_104 = local_56 + 83;
+    int local_105 = local_7 + 73;
+    int local_106 = local_91 + 97;
+    int local_107 = local_94 + 13;
+    int local_108 = local_73 + 38;
+    int local_109 = local_85 + 35;
+    int local_110 = local_108 + 69;
+    int local_111 = local_54 + 34;
+    int local_112 = local_20 + 10;
+    int local_113 = local_7 + 5;
+    int local_114 = local_85 + 97;
+    int local_115 = local_97 + 68;
+    int local_116 = local_96 + 32;
+    int local_117 = local_42 + 45;
+    int local_118 = local_106 + 69;
+    int local_119 = local_75 + 85;
+    int local_120 = local_19 + 79;
+    int local_121 = local_108 + 3;
+    int local_122 = local_53 + 5;
+    int local_123 = local_49 + 84;
+    int local_124 = local_33 + 92;
+    int local_125 = local_67 + 14;
+    int local_126 = local_55 + 63;
+    int local_127 = local_116 + 35;
+    int local_128 = local_113 + 2;
+    int local_129 = local_80 + 64;
+    int local_130 = local_47 + 76;
+    int local_131 = local_96 + 82;
+    int local_132 = local_39 + 19;
+    int local_133 = local_49 + 1;
+    int local_134 = local_60 + 13;
+    int local_135 = local_56 + 69;
+    int local_136 = local_31 + 22;
+    int local_137 = local_128 + 96;
+    int local_138 = local_84 + 9;
+    int local_139 = local_9 + 89;
+    int local_140 = local_103 + 77;
+    int local_141 = local_94 + 13;
+    int local_142 = local_36 + 24;
+    int local_143 = local_37 + 44;
+    int local_144 = local_77 + 92;
+    int local_145 = local_126 + 62;
+    int local_146 = local_91 + 66;
+    int local_147 = local_120 + 8;
+    int local_148 = local_67 + 60;
+    int local_149 = local_141 + 17;
+    int local_150 = local_118 + 81;
+    int local_151 = local_75 + 18;
+    int local_152 = local_46 + 76;
+    int local_153 = local_76 + 47;
+    int local_154 = local_114 + 32;
+    int local_155 = local_84 + 53;
+    int local_156 = local_145 + 46;
+    int local_157 = local_13 + 13;
+    int local_158 = local_154 + 7;
+    int local_159 = local_75 + 17;
+    int local_160 = local_70 + 59;
+    int local_161 = local_109 + 98;
+    int local_162 = local_106 + 66;
+    int local_163 = local_144 + 21;
+    int local_164 = local_65 + 63;
+    int local_165 = local_89 + 78;
+    int local_166 = local_141 + 25;
+    int local_167 = local_9 + 62;
+    int local_168 = local_15 + 51;
+    int local_169 = local_68 + 49;
+    int local_170 = local_141 + 27;
+    int local_171 = local_48 + 49;
+    int local_172 = local_163 + 50;
+    int local_173 = local_101 + 68;
+    int local_174 = local_15 + 23;
+    int local_175 = local_15 + 26;
+    int local_176 = local_90 + 85;
+    int local_177 = local_104 + 11;
+    int local_178 = local_123 + 78;
+    int local_179 = local_124 + 69;
+    int local_180 = local_83 + 39;
+    int local_181 = local_161 + 73;
+    int local_182 = local_137 + 67;
+    int local_183 = local_118 + 94;
+    int local_184 = local_67 + 66;
+    int local_185 = local_13 + 88;
+    int local_186 = local_78 + 94;
+    int local_187 = local_98 + 60;
+    int local_188 = local_6 + 40;
+    int local_189 = local_107 + 64;
+    int local_190 = local_92 + 23;
+    int local_191 = local_28 + 15;
+    int local_192 = local_149 + 73;
+    int local_193 = local_152 + 95;
+    int local_194 = local_36 + 67;
+    int local_195 = local_185 + 9;
+    int local_196 = local_75 + 99;
+    int local_197 = local_176 + 81;
+    int local_198 = local_154 + 2;
+    int local_199 = local_193 + 99;
+    int local_200 = local_39 + 74;
+    int local_201 = local_187 + 90;
+    int local_202 = local_57 + 37;
+    int local_203 = local_188 + 26;
+    int local_204 = local_94 + 43;
+    int local_205 = local_58 + 40;
+    int local_206 = local_130 + 8;
+    int local_207 = local_159 + 44;
+    int local_208 = local_80 + 64;
+    int local_209 = local_191 + 57;
+    int local_210 = local_191 + 30;
+    int local_211 = local_173 + 24;
+    int local_212 = local_48 + 81;
+    int local_213 = local_194 + 18;
+    int local_214 = local_140 + 78;
+    int local_215 = local_25 + 19;
+    int local_216 = local_21 + 55;
+    int local_217 = local_212 + 38;
+    int local_218 = local_136 + 53;
+    int local_219 = local_107 + 3;
+    int local_220 = local_59 + 99;
+    int local_221 = local_87 + 78;
+    int local_222 = local_180 + 44;
+    int local_223 = local_193 + 37;
+    int local_224 = local_152 + 94;
+    int local_225 = local_112 + 34;
+    int local_226 = local_49 + 87;
+    int local_227 = local_131 + 14;
+    int local_228 = local_34 + 68;
+    int local_229 = local_203 + 56;
+    int local_230 = local_44 + 80;
+    int local_231 = local_5 + 89;
+    int local_232 = local_131 + 82;
+    int local_233 = local_48 + 73;
+    int local_234 = local_220 + 40;
+    int local_235 = local_53 + 80;
+    int local_236 = local_8 + 11;
+    int local_237 = local_75 + 87;
+    int local_238 = local_1 + 71;
+    int local_239 = local_136 + 51;
+    int local_240 = local_183 + 91;
+    int local_241 = local_200 + 49;
+    int local_242 = local_198 + 6;
+    int local_243 = local_130 + 71;
+    int local_244 = local_215 + 88;
+    int local_245 = local_114 + 77;
+    int local_246 = local_96 + 71;
+    int local_247 = local_53 + 4;
+    int local_248 = local_224 + 43;
+    int local_249 = local_79 + 36;
+    int local_250 = local_173 + 73;
+    int local_251 = local_2 + 8;
+    int local_252 = local_103 + 37;
+    int local_253 = local_252 + 40;
+    int local_254 = local_177 + 33;
+    int local_255 = local_20 + 59;
+    int local_256 = local_219 + 90;
+    int local_257 = local_53 + 49;
+    int local_258 = local_5 + 56;
+    int local_259 = local_112 + 37;
+    int local_260 = local_112 + 43;
+    int local_261 = local_244 + 12;
+    int local_262 = local_168 + 33;
+    int local_263 = local_171 + 72;
+    int local_264 = local_209 + 99;
+    int local_265 = local_119 + 59;
+    int local_266 = local_34 + 96;
+    int local_267 = local_59 + 12;
+    int local_268 = local_264 + 1;
+    int local_269 = local_100 + 16;
+    int local_270 = local_126 + 73;
+    int local_271 = local_76 + 68;
+    int local_272 = local_161 + 85;
+    int local_273 = local_82 + 35;
+    int local_274 = local_244 + 32;
+    int local_275 = local_196 + 68;
+    int local_276 = local_250 + 28;
+    int local_277 = local_151 + 67;
+    int local_278 = local_200 + 5;
+    int local_279 = local_141 + 66;
+    int local_280 = local_194 + 62;
+    print(local_280);
+    return local_280;
+}
+
+int locals_2(int x) {
+    int local_0 = x + 62;
+    int local_1 = local_0 + 60;
+    int local_2 = local_0 + 47;
+    int local_3 = local_0 + 33;
+    int local_4 = local_2 + 62;
+    int local_5 = local_2 + 63;
+    int local_6 = local_4 + 91;
+    int local_7 = local_3 + 65;
+    int local_8 = local_3 + 1;
+    int local_9 = local_3 + 29;
+    int local_10 = local_2 + 39;
+    int local_11 = local_0 + 14;
+    int local_12 = local_3 + 96;
+    int local_13 = local_7 + 83;
+    int local_14 = local_11 + 30;
+    int local_15 = local_6 + 44;
+    int local_16 = local_8 + 22;
+    int local_17 = local_10 + 44;
+    int local_18 = local_17 + 24;
+    int local_19 = local_17 + 66;
+    int local_20 = local_17 + 73;
+    int local_21 = local_19 + 36;
+    int local_22 = local_3 + 36;
+    int local_23 = local_5 + 40;
+    int local_24 = local_20 + 8;
+    int local_25 = local_8 + 0;
+    int local_26 = local_18 + 84;
+    int local_27 = local_14 + 77;
+    int local_28 = local_20 + 7;
+    int local_29 = local_12 + 59;
+    int local_30 = local_9 + 93;
+    int local_31 = local_21 + 40;
+    int local_32 = local_13 + 20;
+    int local_33 = local_2 + 54;
+    int local_34 = local_26 + 64;
+    int local_35 = local_24 + 51;
+    int local_36 = local_12 + 89;
+    int local_37 = local_36 + 11;
+    int local_38 = local_30 + 33;
+    int local_39 = local_2 + 32;
+    int local_40 = local_35 + 13;
+    int local_41 = local_37 + 92;
+    int local_42 = local_23 + 14;
+    int local_43 = local_22 + 9;
+    int local_44 = local_17 + 40;
+    int local_45 = local_36 + 74;
+    int local_46 = local_0 + 57;
+    int local_47 = local_14 + 77;
+    int local_48 = local_16 + 34;
+    int local_49 = local_29 + 60;
+    int local_50 = local_17 + 46;
+    int local_51 = local_1 + 34;
+    int local_52 = local_42 + 85;
+    int local_53 = local_20 + 81;
+    int local_54 = local_28 + 5;
+    int local_55 = local_23 + 45;
+    int local_56 = local_22 + 40;
+    int local_57 = local_39 + 90;
+    int local_58 = local_50 + 69;
+    int local_59 = local_52 + 97;
+    int local_60 = local_40 + 63;
+    int local_61 = local_2 + 56;
+    int local_62 = local_28 + 5;
+    int local_63 = local_23 + 41;
+    int local_64 = local_14 + 51;
+    int local_65 = local_40 + 63;
+    int local_66 = local_42 + 90;
+    int local_67 = local_28 + 35;
+    int local_68 = local_8 + 91;
+    int local_69 = local_15 + 42;
+    int local_70 = local_65 + 53;
+    int local_71 = local_42 + 94;
+    int local_72 = local_15 + 15;
+    int local_73 = local_55 + 10;
+    int local_74 = local_73 + 97;
+    int local_75 = local_40 + 22;
+    int local_76 = local_73 + 93;
+    int local_77 = local_8 + 6;
+    int local_78 = local_54 + 7;
+    int local_79 = local_69 + 64;
+    int local_80 = local_74 + 43;
+    int local_81 = local_49 + 46;
+    int local_82 = local_15 + 85;
+    int local_83 = local_11 + 49;
+    int local_84 = local_3 + 9;
+    int local_85 = local_0 + 1;
+    int local_86 = local_10 + 15;
+    int local_87 = local_36 + 84;
+    int local_88 = local_43 + 14;
+    int local_89 = local_61 + 63;
+    int local_90 = local_7 + 7;
+    int local_91 = local_38 + 63;
+    int local_92 = local_90 + 2;
+    int local_93 = local_89 + 89;
+    int local_94 = local_4 + 74;
+    int local_95 = local_86 + 71;
+    int local_96 = local_84 + 68;
+    int local_97 = local_15 + 36;
+    int local_98 = local_72 + 93;
+    int local_99 = local_60 + 24;
+    int local_100 = local_67 + 49;
+    int local_101 = local_78 + 18;
+    int local_102 = local_6 + 80;
+    int local_103 = local_86 + 9;
+    int local_104 = local_32 + 98;
+    int local_105 = local_92 + 48;
+    int local_106 = local_85 + 5;
+    int local_107 = local_15 + 52;
+    int local_108 = local_22 + 88;
+    int local_109 = local_56 + 82;
+    int local_110 = local_109 + 72;
+    int local_111 = local_79 + 34;
+    int local_112 = local_86 + 9;
+    int local_113 = local_60 + 64;
+    int local_114 = local_2 + 76;
+    int local_115 = local_55 + 88;
+    int local_116 = local_97 + 91;
+    int local_117 = local_93 + 45;
+    int local_118 = local_31 + 4;
+    int local_119 = local_117 + 33;
+    int local_120 = local_104 + 43;
+    int local_121 = local_38 + 8;
+    int local_122 = local_10 + 65;
+    int local_123 = local_59 + 35;
+    int local_124 = local_103 + 16;
+    int local_125 = local_42 + 25;
+    int local_126 = local_65 + 24;
+    int local_127 = local_6 + 69;
+    int local_128 = local_108 + 6;
+    int local_129 = local_99 + 78;
+    int local_130 = local_96 + 50;
+    int local_131 = local_50 + 31;
+    int local_132 = local_82 + 67;
+    int local_133 = local_63 + 6;
+    int local_134 = local_64 + 44;
+    int local_135 = local_17 + 93;
+    int local_136 = local_41 + 86;
+    int local_137 = local_85 + 87;
+    int local_138 = local_135 + 20;
+    int local_139 = local_56 + 92;
+    int local_140 = local_116 + 37;
+    int local_141 = local_93 + 77;
+    int local_142 = local_88 + 27;
+    int local_143 = local_90 + 38;
+    int local_144 = local_29 + 82;
+    int local_145 = local_98 + 75;
+    int local_146 = local_93 + 51;
+    int local_147 = local_86 + 77;
+    int local_148 = local_92 + 13;
+    int local_149 = local_17 + 71;
+    int local_150 = local_43 + 12;
+    int local_151 = local_109 + 14;
+    int local_152 = local_103 + 0;
+    int local_153 = local_52 + 21;
+    int local_154 = local_95 + 64;
+    int local_155 = local_52 + 87;
+    int local_156 = local_153 + 6;
+    int local_157 = local_0 + 6;
+    int local_158 = local_52 + 73;
+    int local_159 = local_50 + 53;
+    int local_160 = local_90 + 82;
+    int local_161 = local_43 + 67;
+    int local_162 = local_157 + 49;
+    int local_163 = local_76 + 82;
+    int local_164 = local_130 + 43;
+    int local_165 = local_86 + 39;
+    int local_166 = local_94 + 31;
+    int local_167 = local_157 + 71;
+    int local_168 = local_36 + 88;
+    int local_169 = local_94 + 73;
+    int local_170 = local_105 + 0;
+    int local_171 = local_119 + 79;
+    int local_172 = local_44 + 61;
+    int local_173 = local_102 + 75;
+    int local_174 = local_3 + 82;
+    int local_175 = local_122 + 11;
+    int local_176 = local_27 + 44;
+    int local_177 = local_125 + 47;
+    int local_178 = local_10 + 10;
+    int local_179 = local_101 + 13;
+    int local_180 = local_150 + 3;
+    int local_181 = local_40 + 13;
+    int local_182 = local_13 + 71;
+    int local_183 = local_29 + 44;
+    int local_184 = local_52 + 33;
+    int local_185 = local_33 + 56;
+    int local_186 = local_169 + 74;
+    int local_187 = local_9 + 8;
+    int local_188 = local_177 + 8;
+    int local_189 = local_172 + 15;
+    int local_190 = local_99 + 2;
+    int local_191 = local_71 + 3;
+    int local_192 = local_150 + 82;
+    int local_193 = local_121 + 5;
+    int local_194 = local_98 + 59;
+    int local_195 = local_132 + 46;
+    int local_196 = local_124 + 79;
+    int local_197 = local_97 + 66;
+    int local_198 = local_104 + 30;
+    int local_199 = local_197 + 3;
+    int local_200 = local_80 + 22;
+    int local_201 = local_9 + 5;
+    int local_202 = local_61 + 14;
+    int local_203 = local_105 + 8;
+    int local_204 = local_51 + 24;
+    int local_205 = local_137 + 67;
+    int local_206 = local_192 + 95;
+    int local_207 = local_113 + 27;
+    int local_208 = local_31 + 7;
+    int local_209 = local_185 + 51;
+    int local_210 = local_121 + 40;
+    int local_211 = local_172 + 54;
+    int local_212 = local_203 + 4;
+    int local_213 = local_184 + 37;
+    int local_214 = local_57 + 45;
+    int local_215 = local_150 + 43;
+    int local_216 = local_119 + 75;
+    int local_217 = local_151 + 90;
+    int local_218 = local_63 + 9;
+    int local_219 = local_218 + 63;
+    int local_220 = local_117 + 46;
+    int local_221 = local_114 + 32;
+    int local_222 = local_89 + 24;
+    int local_223 = local_31 + 43;
+    int local_224 = local_143 + 83;
+    int local_225 = local_119 + 12;
+    int local_226 = local_8 + 45;
+    int local_227 = local_224 + 50;
+    int local_228 = local_10 + 1;
+    int local_229 = local_49 + 90;
+    int local_230 = local_154 + 16;
+    int local_231 = local_210 + 81;
+    int local_232 = local_133 + 60;
+    int local_233 = local_187 + 14;
+    int local_234 = local_97 + 76;
+    int local_235 = local_30 + 51;
+    int local_236 = local_214 + 29;
+    int local_237 = local_158 + 15;
+    int local_238 = local_176 + 8;
+    int local_239 = local_202 + 16;
+    int local_240 = local_20 + 76;
+    int local_241 = local_130 + 93;
+    int local_242 = local_113 + 86;
+    int local_243 = local_51 + 23;
+    int local_244 = local_89 + 66;
+    int local_245 = local_79 + 47;
+    int local_246 = local_214 + 81;
+    int local_247 = local_243 + 62;
+    int local_248 = local_6 + 99;
+    int local_249 = local_0 + 89;
+    int local_250 = local_62 + 77;
+    int local_251 = local_158 + 22;
+    int local_252 = local_151 + 30;
+    int local_253 = local_209 + 93;
+    int local_254 = local_70 + 72;
+    int local_255 = local_213 + 52;
+    int local_256 = local_43 + 70;
+    int local_257 = local_186 + 58;
+    int local_258 = local_182 + 35;
+    int local_259 = local_51 + 49;
+    int local_260 = local_151 + 46;
+    int local_261 = local_107 + 88;
+    int local_262 = local_186 + 90;
+    int local_263 = local_252 + 52;
+    int local_264 = local_49 + 76;
+    int local_265 = local_223 + 95;
+    int local_266 = local_28 + 0;
+    int local_267 = local_167 + 47;
+    int local_268 = local_112 + 76;
+    int local_269 = local_138 + 30;
+    int local_270 = local_174 + 59;
+    int local_271 = local_203 + 89;
+    int local_272 = local_108 + 83;
+    int local_273 = local_83 + 95;
+    int local_274 = local_187 + 33;
+    int local_275 = local_99 + 86;
+    int local_276 = local_46 + 72;
+    int local_277 = local_259 + 44;
+    int local_278 = local_93 + 11;
+    int local_279 = local_22 + 48;
+    int local_280 = local_221 + 52;
+    int local_281 = local_51 + 21;
+    int local_282 = local_254 + 26;
+    int local_283 = local_227 + 75;
+    int local_284 = local_250 + 89;
+    int local_285 = local_212 + 33;
+    int local_286 = local_235 + 7;
+    int local_287 = local_132 + 49;
+    int local_288 = local_170 + 25;
+    int local_289 = local_167 + 16;
+    int local_290 = local_154 + 74;
+    int local_291 = local_87 + 95;
+    int local_292 = local_176 + 75;
+    int local_293 = local_52 + 51;
+    int local_294 = local_97 + 61;
+    int local_295 = local_282 + 71;
+    int local_296 = local_103 + 87;
+    int local_297 = local_251 + 13;
+    int local_298 = local_44 + 45;
+    int local_299 = local_105 + 14;
+    int local_300 = local_14 + 5;
+    int local_301 = local_37 + 82;
+    int local_302 = local_45 + 83;
+    int local_303 = local_170 + 96;
+    int local_304 = local_112 + 97;
+    int local_305 = local_54 + 42;
+    int local_306 = local_135 + 93;
+    int local_307 = local_23 + 62;
+    int local_308 = local_286 + 74;
+    int local_309 = local_224 + 93;
+    int local_310 = local_91 + 78;
+    int local_311 = local_165 + 63;
+    int local_312 = local_7 + 17;
+    int local_313 = local_106 + 22;
+    int local_314 = local_146 + 14;
+    int local_315 = local_54 + 83;
+    int local_316 = local_121 + 24;
+    int local_317 = local_176 + 65;
+    int local_318 = local_165 + 2;
+    int local_319 = local_59 + 50;
+    int local_320 = local_95 + 52;
+    int local_321 = local_283 + 12;
+    int local_322 = local_36 + 30;
+    int local_323 = local_296 + 90;
+    int local_324 = local_180 + 32;
+    int local_325 = local_307 + 26;
+    int local_326 = local_70 + 15;
+    int local_327 = local_241 + 18;
+    int local_328 = local_54 + 42;
+    int local_329 = local_99 + 62;
+    int local_330 = local_101 + 95;
+    int local_331 = local_13 + 34;
+    int local_332 = local_63 + 27;
+    int local_333 = local_45 + 36;
+    int local_334 = local_138 + 34;
+    int local_335 = local_41 + 16;
+    int local_336 = local_274 + 12;
+    int local_337 = local_125 + 87;
+    print(local_337);
+    return local_337;
+}
+
+int main() {
+    int x = 3;
+    x = x + locals_0(x);
+    x = x + locals_1(x);
+    x = x + locals_2(x);
+    print(x);
+    return 0;
+}
@@ -0,0 +1,10 @@
+# Minimal process entry for bench_e2e: calls the generated main and exits
+# with its return value, so no libc startup code is counted.
+	.text
+	.globl _start
+_start:
+	call main
+	movq %rax, %rdi
+	movq $60, %rax
+	syscall
+	.section .note.GNU-stack,"",@progbits
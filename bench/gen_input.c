@@ -0,0 +1,192 @@
+// Synthetic input generator for the benchmarks.
+//
+//   gen_input <shape> <size> [seed]
+//
+// Writes a C file of roughly <size> bytes (e.g. 1K, 256K, 100M) to stdout,
+// using only the subset of the language the compiler accepts. Shapes:
+//   expr    long, nested operator chains over a handful of locals
+//   locals  functions with hundreds of locals each
+//   idents  long identifiers and long runs of // and /* */ comments
+//   funcs   many small functions
+//   mixed   all of the above, interleaved function by function
+// Every function takes an argument its result depends on, and main calls
+// them all in turn, each with what the ones before it returned, so the
+// program's work happens at run time and not in the compiler.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static unsigned long long rng_state = 0x2545F4914F6CDD1DULL;
+
+static unsigned int rng()
+{
+    // xorshift64, so a given seed always produces the same file
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned int)(rng_state >> 32);
+}
+
+static long long parse_size(const char* str)
+{
+    char* end = NULL;
+    long long size = strtoll(str, &end, 10);
+    switch (*end) {
+        case 'k': case 'K': size *= 1024LL; break;
+        case 'm': case 'M': size *= 1024LL * 1024LL; break;
+        case 'g': case 'G': size *= 1024LL * 1024LL * 1024LL; break;
+    }
+    return size;
+}
+
+static const char* random_operator()
+{
+    static const char* operators[] = { "+", "-", "*", "/" };
+    return operators[rng() % 4];
+}
+
+// A chain of terms, some of them parenthesized sub-chains down to max_depth
+static long long emit_expr(FILE* out, int terms, int max_depth)
+{
+    long long written = fprintf(out, "v0");
+    for (int t = 0; t < terms; t++) {
+        const char* op = random_operator();
+        if (strcmp(op, "/") == 0) {
+            // Keep divisors non-zero
+            written += fprintf(out, " / %u", rng() % 9 + 1);
+        } else if (max_depth > 0 && rng() % 4 == 0) {
+            written += fprintf(out, " %s (", op);
+            written += emit_expr(out, 1 + rng() % 4, max_depth - 1);
+            written += fprintf(out, ")");
+        } else if (rng() % 2) {
+            written += fprintf(out, " %s v%u", op, rng() % 8);
+        } else {
+            written += fprintf(out, " %s %u", op, rng() % 1000);
+        }
+    }
+    return written;
+}
+
+// Every function declares its own v0..vN locals before using them, so the
+// generated file also assembles and runs.
+static long long emit_expr_function(FILE* out, int index)
+{
+    long long written = fprintf(out, "int expr_%d(int x) {\n", index);
+    written += fprintf(out, "    int v0 = x + %u;\n", rng() % 100 + 1);
+    for (int i = 1; i < 8; i++) {
+        written += fprintf(out, "    int v%d = %u;\n", i, rng() % 100 + 1);
+    }
+    for (int stmt = 0; stmt < 8; stmt++) {
+        written += fprintf(out, "    int r%d = ", stmt);
+        written += emit_expr(out, 16 + rng() % 48, 6);
+        written += fprintf(out, ";\n");
+    }
+    written += fprintf(out, "    print(r0);\n    return r7;\n}\n\n");
+    return written;
+}
+
+static long long emit_locals_function(FILE* out, int index)
+{
+    long long written = fprintf(out, "int locals_%d(int x) {\n", index);
+    int locals = 200 + rng() % 300;
+    written += fprintf(out, "    int local_0 = x + %u;\n", rng() % 100);
+    for (int i = 1; i < locals; i++) {
+        written += fprintf(out, "    int local_%d = local_%u + %u;\n", i, rng() % i, rng() % 100);
+    }
+    written += fprintf(out, "    print(local_%d);\n    return local_%d;\n}\n\n", locals - 1, locals - 1);
+    return written;
+}
+
+// Also written to name, which has room for length + 1 characters
+static long long emit_long_identifier(FILE* out, int length, char* name)
+{
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+    name[0] = '_';
+    for (int i = 1; i < length; i++) {
+        name[i] = alphabet[rng() % (sizeof(alphabet) - 1)];
+    }
+    name[length] = 0;
+    return fprintf(out, "%s", name);
+}
+
+static long long emit_comment_run(FILE* out)
+{
+    long long written = 0;
+    int lines = 4 + rng() % 16;
+    for (int i = 0; i < lines; i++) {
+        written += fprintf(out, "    // line comment %d: the quick brown fox jumps over the lazy dog %u\n", i, rng());
+    }
+    written += fprintf(out, "    /* block comment");
+    for (int i = 0; i < lines; i++) {
+        written += fprintf(out, "\n       lorem ipsum dolor sit amet, consectetur adipiscing elit %u", rng());
+    }
+    written += fprintf(out, " */\n");
+    return written;
+}
+
+static long long emit_idents_function(FILE* out, int index)
+{
+    char first[256], second[256];
+    long long written = fprintf(out, "int idents_%d(int x) {\n", index);
+    written += emit_comment_run(out);
+    written += fprintf(out, "    int ");
+    written += emit_long_identifier(out, 64 + rng() % 192, first);
+    written += fprintf(out, " = x + %u;\n", rng() % 100);
+    written += emit_comment_run(out);
+    written += fprintf(out, "    int ");
+    written += emit_long_identifier(out, 64 + rng() % 192, second);
+    written += fprintf(out, " = %s * %u;\n", first, rng() % 100);
+    written += fprintf(out, "    return %s;\n}\n\n", second);
+    return written;
+}
+
+static long long emit_small_function(FILE* out, int index)
+{
+    return fprintf(out, "int func_%d(int x) {\n    int a = x + %u;\n    int b = a * %u;\n    return b;\n}\n\n",
+                   index, rng() % 100, rng() % 100);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <expr|locals|idents|funcs|mixed> <size> [seed]\n", argv[0]);
+        return 1;
+    }
+    const char* shape = argv[1];
+    long long target = parse_size(argv[2]);
+    if (argc > 3) {
+        rng_state ^= strtoull(argv[3], NULL, 10) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    long long (*emitters[4])(FILE*, int) = {
+        emit_expr_function, emit_locals_function, emit_idents_function, emit_small_function
+    };
+    static const char* names[4] = { "expr", "locals", "idents", "func" };
+    int emitter = -1;
+    if (strcmp(shape, "expr") == 0) emitter = 0;
+    else if (strcmp(shape, "locals") == 0) emitter = 1;
+    else if (strcmp(shape, "idents") == 0) emitter = 2;
+    else if (strcmp(shape, "funcs") == 0) emitter = 3;
+    else if (strcmp(shape, "mixed") != 0) {
+        fprintf(stderr, "unknown shape %s\n", shape);
+        return 1;
+    }
+
+    FILE* out = stdout;
+    // The size counts main's call to every function too, and always leaves
+    // room for the rest of main, so even the smallest size is a full program
+    long long written = 0;
+    int index = 0;
+    while (written + 64 < target) {
+        int shape_index = emitter >= 0 ? emitter : index % 4;
+        written += emitters[shape_index](out, index);
+        written += snprintf(NULL, 0, "    x = x + %s_%d(x);\n", names[shape_index], index);
+        index++;
+    }
+    fprintf(out, "int main() {\n    int x = %d;\n", index);
+    for (int i = 0; i < index; i++) {
+        fprintf(out, "    x = x + %s_%d(x);\n", names[emitter >= 0 ? emitter : i % 4], i);
+    }
+    fprintf(out, "    print(x);\n    return 0;\n}\n");
+    return 0;
+}
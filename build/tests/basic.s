@@ -0,0 +1,126 @@
+	.file "test.s"
+	.text
+	.text
+	.globl main
+	.type main, @function
+main:
+	subq $24, %rsp
+	movq $5, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	movq %rax, 8(%rsp)
+	movq $10, %rax
+	pushq %rax
+	movq $20, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 16(%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	sete %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lmain_6
+	movq $10, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_8
+	negq %rax
+.Lmain_8:
+.Lmain_9:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_9
+	testq %r8, %r8
+	jns .Lmain_10
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_10:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+.Lmain_6:
+	addq $24, %rsp
+	ret
+	.section .note.GNU-stack,"",@progbits
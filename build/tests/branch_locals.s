@@ -0,0 +1,118 @@
+	.file "test.s"
+	.text
+	.text
+	.globl one
+	.type one, @function
+one:
+	subq $16, %rsp
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	jmp .Lone_1
+	.p2align 4
+.Lone_0:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, (%rsp)
+.Lone_1:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lone_0
+	movq 8(%rsp), %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	call one
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	sete %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lmain_0
+	movq $1, %rax
+	movq %rax, -16(%rbp)
+	jmp .Lmain_1
+.Lmain_0:
+	movq $0, %rax
+	movq %rax, -24(%rbp)
+	jmp .Lmain_3
+	.p2align 4
+.Lmain_2:
+	movq -24(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_4
+	negq %rax
+.Lmain_4:
+.Lmain_5:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_5
+	testq %r8, %r8
+	jns .Lmain_6
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_6:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -24(%rbp)
+.Lmain_3:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_2
+.Lmain_1:
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
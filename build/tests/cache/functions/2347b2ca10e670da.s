@@ -0,0 +1,44 @@
+	.text
+	.globl scaled
+	.type scaled, @function
+scaled:
+	subq $40, %rsp
+	movq %rdi, 32(%rsp)
+	movq %rsi, 24(%rsp)
+	movq %rdx, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	jmp .Lscaled_1
+	.p2align 4
+.Lscaled_0:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	cqo
+	idivq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, (%rsp)
+.Lscaled_1:
+	movq (%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lscaled_0
+	movq 8(%rsp), %rax
+	addq $40, %rsp
+	ret
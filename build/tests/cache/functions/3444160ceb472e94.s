@@ -0,0 +1,85 @@
+	.text
+	.globl mixed
+	.type mixed, @function
+mixed:
+	subq $48, %rsp
+	movq %rdi, 40(%rsp)
+	movq %rsi, 32(%rsp)
+	movq %rdx, 24(%rsp)
+	movq 40(%rsp), %rax
+	movq %rax, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	jmp .Lmixed_1
+	.p2align 4
+.Lmixed_0:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $31, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	sarq %cl, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $13, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	sarq %cl, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lmixed_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 32(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmixed_0
+	movq 16(%rsp), %rax
+	addq $48, %rsp
+	ret
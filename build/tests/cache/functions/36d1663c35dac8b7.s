@@ -0,0 +1,44 @@
+	.text
+	.type scaled.constprop, @function
+scaled.constprop:
+	subq $32, %rsp
+	movq %rdi, 24(%rsp)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 24(%rsp), %rax
+	movq %rax, %rcx
+	movq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq %rax, (%rsp)
+	jmp .Lscaled.constprop_1
+	.p2align 4
+.Lscaled.constprop_0:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+.Lscaled.constprop_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lscaled.constprop_0
+	movq 16(%rsp), %rax
+	addq $32, %rsp
+	ret
@@ -0,0 +1,46 @@
+	.text
+	.type reset, @function
+reset:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $4, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lreset_0
+	negq %rax
+.Lreset_0:
+.Lreset_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lreset_1
+	testq %r8, %r8
+	jns .Lreset_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lreset_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq (%rsp), %rax
+	addq $8, %rsp
+	ret
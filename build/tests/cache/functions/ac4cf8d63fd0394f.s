@@ -0,0 +1,64 @@
+	.text
+	.type down, @function
+down:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movq %rdi, -8(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Ldown_0
+	movq -8(%rbp), %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.Ldown_0:
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Ldown_2
+	negq %rax
+.Ldown_2:
+.Ldown_3:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Ldown_3
+	testq %r8, %r8
+	jns .Ldown_4
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Ldown_4:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	popq %rdi
+	movq %rbp, %rsp
+	popq %rbp
+	jmp down
@@ -0,0 +1,337 @@
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $10, %rax
+	pushq %rax
+	popq %rdi
+	call steps
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $100, %rax
+	pushq %rax
+	popq %rdi
+	call steps
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $100, %rax
+	pushq %rax
+	popq %rdi
+	call scaled.constprop
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $50, %rax
+	pushq %rax
+	popq %rdi
+	call scaled.constprop
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $5, %rax
+	pushq %rax
+	popq %rdi
+	call down
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	popq %rdi
+	call reset
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	popq %rdi
+	call reset
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_18
+	negq %rax
+.Lmain_18:
+.Lmain_19:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_19
+	testq %r8, %r8
+	jns .Lmain_20
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_20:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_21
+	negq %rax
+.Lmain_21:
+.Lmain_22:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_22
+	testq %r8, %r8
+	jns .Lmain_23
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_23:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_24
+	negq %rax
+.Lmain_24:
+.Lmain_25:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_25
+	testq %r8, %r8
+	jns .Lmain_26
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_26:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
@@ -0,0 +1,34 @@
+	.text
+	.type steps, @function
+steps:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	jmp .Lsteps_1
+	.p2align 4
+.Lsteps_0:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, (%rsp)
+.Lsteps_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsteps_0
+	movq (%rsp), %rax
+	addq $16, %rsp
+	ret
@@ -0,0 +1,69 @@
+// Dead static functions and constant arguments, see callgraph.c. Only
+// scaled, which divides by its constant, gets a .constprop copy
+static int unused_helper(int x) {
+    int y = x * 2;
+    print(y);
+    return y;
+}
+static int only_from_unused(int x) {
+    print(x);
+    return x;
+}
+static int dead_chain(int x) {
+    return only_from_unused(x) + 1;
+}
+static int steps(int n, int by) {
+    int c = 0;
+    while (n > 0) {
+        n = n - by;
+        c++;
+    }
+    return c;
+}
+int scaled(int x, int d, int k) {
+    int r = 0;
+    int i = 0;
+    while (i < k) {
+        r = r + x / d;
+        i++;
+    }
+    return r;
+}
+// Called with constants, but neither tiny nor dividing by one: copying it
+// would only make the output bigger
+int mixed(int a, int b, int c) {
+    int r = a;
+    int i = 0;
+    while (i < c) {
+        r = r * 37 + b;
+        r = r ^ (r >> 7);
+        r = r + i * b;
+        r = r - (r >> 13);
+        i++;
+    }
+    return r;
+}
+static int down(int n, int limit) {
+    if (n < limit) {
+        return n;
+    }
+    print(n);
+    return down(n - 1, limit);
+}
+static int reset(int v, int w) {
+    v = v + w;
+    print(v);
+    return v;
+}
+int main() {
+    print(steps(10, 3));
+    print(steps(100, 3));
+    print(scaled(100, 7, 3));
+    print(scaled(50, 7, 3));
+    print(down(5, 2));
+    print(reset(1, 4));
+    print(reset(2, 4));
+    print(mixed(1, 5, 4));
+    print(mixed(2, 5, 4));
+    return 0;
+}
@@ -0,0 +1,3460 @@
+	.file "test.s"
+	.text
+	.text
+	.globl main
+	.type main, @function
+main:
+	subq $224, %rsp
+	movq $23, %rcx
+.Lmain_0:
+	decq %rcx
+	movq $0, 40(%rsp,%rcx,8)
+	jne .Lmain_0
+	movq $0, %rax
+	movq %rax, 32(%rsp)
+	movq $0, %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $1, %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $2, %rax
+	pushq %rax
+	movq $1, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $3, %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $4, %rax
+	pushq %rax
+	movq $2, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $5, %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $6, %rax
+	pushq %rax
+	movq $3, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $7, %rax
+	pushq %rax
+	movq $6, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $8, %rax
+	pushq %rax
+	movq $7, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $9, %rax
+	pushq %rax
+	movq $13, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $10, %rax
+	pushq %rax
+	movq $13, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $11, %rax
+	pushq %rax
+	movq $99, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $12, %rax
+	pushq %rax
+	movq $100, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $13, %rax
+	pushq %rax
+	movq $12345, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $14, %rax
+	pushq %rax
+	movq $12345, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $15, %rax
+	pushq %rax
+	movq $1000000006, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $16, %rax
+	pushq %rax
+	movq $4294967297, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $17, %rax
+	pushq %rax
+	movq $4294967297, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $18, %rax
+	pushq %rax
+	movq $9223372036854775807, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $19, %rax
+	pushq %rax
+	movq $9223372036854775807, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $20, %rax
+	pushq %rax
+	movq $9223372036854775807, %rax
+	negq %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $21, %rax
+	pushq %rax
+	movq $123456789012345678, %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $22, %rax
+	pushq %rax
+	movq $123456789012345678, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, 40(%rsp,%rsi,8)
+	movq $0, %rax
+	movq %rax, 24(%rsp)
+	movq $9223372036854775807, %rax
+	negq %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmain_2
+	.p2align 4
+.Lmain_1:
+	movq 24(%rsp), %rax
+	movq 40(%rsp,%rax,8), %rax
+	movq %rax, 8(%rsp)
+	movq 8(%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq $0, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $63, %rdx
+	addq %rdx, %rax
+	sarq $1, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $63, %rdx
+	addq %rdx, %rax
+	andq $-2, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $6148914691236517206, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $6148914691236517206, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $3, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_18
+	negq %rax
+.Lmain_18:
+.Lmain_19:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_19
+	testq %r8, %r8
+	jns .Lmain_20
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_20:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_21
+	negq %rax
+.Lmain_21:
+.Lmain_22:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_22
+	testq %r8, %r8
+	jns .Lmain_23
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_23:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $5, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_24
+	negq %rax
+.Lmain_24:
+.Lmain_25:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_25
+	testq %r8, %r8
+	jns .Lmain_26
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_26:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $3074457345618258603, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_27
+	negq %rax
+.Lmain_27:
+.Lmain_28:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_28
+	testq %r8, %r8
+	jns .Lmain_29
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_29:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $3074457345618258603, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $6, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_30
+	negq %rax
+.Lmain_30:
+.Lmain_31:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_31
+	testq %r8, %r8
+	jns .Lmain_32
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_32:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_33
+	negq %rax
+.Lmain_33:
+.Lmain_34:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_34
+	testq %r8, %r8
+	jns .Lmain_35
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_35:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $7, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_36
+	negq %rax
+.Lmain_36:
+.Lmain_37:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_37
+	testq %r8, %r8
+	jns .Lmain_38
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_38:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $2049638230412172402, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_39
+	negq %rax
+.Lmain_39:
+.Lmain_40:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_40
+	testq %r8, %r8
+	jns .Lmain_41
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_41:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $2049638230412172402, %rdx
+	imulq %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $9, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_42
+	negq %rax
+.Lmain_42:
+.Lmain_43:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_43
+	testq %r8, %r8
+	jns .Lmain_44
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_44:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_45
+	negq %rax
+.Lmain_45:
+.Lmain_46:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_46
+	testq %r8, %r8
+	jns .Lmain_47
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_47:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $10, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_48
+	negq %rax
+.Lmain_48:
+.Lmain_49:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_49
+	testq %r8, %r8
+	jns .Lmain_50
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_50:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $3074457345618258603, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_51
+	negq %rax
+.Lmain_51:
+.Lmain_52:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_52
+	testq %r8, %r8
+	jns .Lmain_53
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_53:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $3074457345618258603, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $12, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_54
+	negq %rax
+.Lmain_54:
+.Lmain_55:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_55
+	testq %r8, %r8
+	jns .Lmain_56
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_56:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $60, %rdx
+	addq %rdx, %rax
+	sarq $4, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_57
+	negq %rax
+.Lmain_57:
+.Lmain_58:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_58
+	testq %r8, %r8
+	jns .Lmain_59
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_59:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $60, %rdx
+	addq %rdx, %rax
+	andq $-16, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_60
+	negq %rax
+.Lmain_60:
+.Lmain_61:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_61
+	testq %r8, %r8
+	jns .Lmain_62
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_62:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $4, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_63
+	negq %rax
+.Lmain_63:
+.Lmain_64:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_64
+	testq %r8, %r8
+	jns .Lmain_65
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_65:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $4, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $25, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_66
+	negq %rax
+.Lmain_66:
+.Lmain_67:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_67
+	testq %r8, %r8
+	jns .Lmain_68
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_68:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-8608480567731124087, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $5, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_69
+	negq %rax
+.Lmain_69:
+.Lmain_70:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_70
+	testq %r8, %r8
+	jns .Lmain_71
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_71:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-8608480567731124087, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $5, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $60, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_72
+	negq %rax
+.Lmain_72:
+.Lmain_73:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_73
+	testq %r8, %r8
+	jns .Lmain_74
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_74:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $58, %rdx
+	addq %rdx, %rax
+	sarq $6, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_75
+	negq %rax
+.Lmain_75:
+.Lmain_76:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_76
+	testq %r8, %r8
+	jns .Lmain_77
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_77:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $58, %rdx
+	addq %rdx, %rax
+	andq $-64, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_78
+	negq %rax
+.Lmain_78:
+.Lmain_79:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_79
+	testq %r8, %r8
+	jns .Lmain_80
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_80:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_81
+	negq %rax
+.Lmain_81:
+.Lmain_82:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_82
+	testq %r8, %r8
+	jns .Lmain_83
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_83:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $100, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_84
+	negq %rax
+.Lmain_84:
+.Lmain_85:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_85
+	testq %r8, %r8
+	jns .Lmain_86
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_86:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7367186400732675841, %rdx
+	imulq %rdx
+	sarq $8, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_87
+	negq %rax
+.Lmain_87:
+.Lmain_88:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_88
+	testq %r8, %r8
+	jns .Lmain_89
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_89:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $7367186400732675841, %rdx
+	imulq %rdx
+	sarq $8, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $641, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_90
+	negq %rax
+.Lmain_90:
+.Lmain_91:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_91
+	testq %r8, %r8
+	jns .Lmain_92
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_92:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $2361183241434822607, %rdx
+	imulq %rdx
+	sarq $7, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_93
+	negq %rax
+.Lmain_93:
+.Lmain_94:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_94
+	testq %r8, %r8
+	jns .Lmain_95
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_95:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $2361183241434822607, %rdx
+	imulq %rdx
+	sarq $7, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $1000, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_96
+	negq %rax
+.Lmain_96:
+.Lmain_97:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_97
+	testq %r8, %r8
+	jns .Lmain_98
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_98:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $52, %rdx
+	addq %rdx, %rax
+	sarq $12, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_99
+	negq %rax
+.Lmain_99:
+.Lmain_100:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_100
+	testq %r8, %r8
+	jns .Lmain_101
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_101:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $52, %rdx
+	addq %rdx, %rax
+	andq $-4096, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_102
+	negq %rax
+.Lmain_102:
+.Lmain_103:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_103
+	testq %r8, %r8
+	jns .Lmain_104
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_104:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $48, %rdx
+	addq %rdx, %rax
+	sarq $16, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_105
+	negq %rax
+.Lmain_105:
+.Lmain_106:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_106
+	testq %r8, %r8
+	jns .Lmain_107
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_107:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $48, %rdx
+	addq %rdx, %rax
+	andq $-65536, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_108
+	negq %rax
+.Lmain_108:
+.Lmain_109:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_109
+	testq %r8, %r8
+	jns .Lmain_110
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_110:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-8543223828751151131, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $29, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_111
+	negq %rax
+.Lmain_111:
+.Lmain_112:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_112
+	testq %r8, %r8
+	jns .Lmain_113
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_113:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-8543223828751151131, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $29, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $1000000007, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_114
+	negq %rax
+.Lmain_114:
+.Lmain_115:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_115
+	testq %r8, %r8
+	jns .Lmain_116
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_116:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $33, %rdx
+	addq %rdx, %rax
+	sarq $31, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_117
+	negq %rax
+.Lmain_117:
+.Lmain_118:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_118
+	testq %r8, %r8
+	jns .Lmain_119
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_119:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $33, %rdx
+	addq %rdx, %rax
+	andq $-2147483648, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_120
+	negq %rax
+.Lmain_120:
+.Lmain_121:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_121
+	testq %r8, %r8
+	jns .Lmain_122
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_122:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $4611686016279904257, %rdx
+	imulq %rdx
+	sarq $29, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_123
+	negq %rax
+.Lmain_123:
+.Lmain_124:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_124
+	testq %r8, %r8
+	jns .Lmain_125
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_125:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $4611686016279904257, %rdx
+	imulq %rdx
+	sarq $29, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $2147483649, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_126
+	negq %rax
+.Lmain_126:
+.Lmain_127:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_127
+	testq %r8, %r8
+	jns .Lmain_128
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_128:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $32, %rdx
+	addq %rdx, %rax
+	sarq $32, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_129
+	negq %rax
+.Lmain_129:
+.Lmain_130:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_130
+	testq %r8, %r8
+	jns .Lmain_131
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_131:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $32, %rdx
+	addq %rdx, %rax
+	sarq $32, %rax
+	salq $32, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_132
+	negq %rax
+.Lmain_132:
+.Lmain_133:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_133
+	testq %r8, %r8
+	jns .Lmain_134
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_134:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $9223372034707292161, %rdx
+	imulq %rdx
+	sarq $31, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_135
+	negq %rax
+.Lmain_135:
+.Lmain_136:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_136
+	testq %r8, %r8
+	jns .Lmain_137
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_137:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $9223372034707292161, %rdx
+	imulq %rdx
+	sarq $31, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $4294967297, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_138
+	negq %rax
+.Lmain_138:
+.Lmain_139:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_139
+	testq %r8, %r8
+	jns .Lmain_140
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_140:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-9223372036829609983, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $39, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_141
+	negq %rax
+.Lmain_141:
+.Lmain_142:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_142
+	testq %r8, %r8
+	jns .Lmain_143
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_143:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-9223372036829609983, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $39, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $1099511627773, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_144
+	negq %rax
+.Lmain_144:
+.Lmain_145:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_145
+	testq %r8, %r8
+	jns .Lmain_146
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_146:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $2, %rdx
+	addq %rdx, %rax
+	sarq $62, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_147
+	negq %rax
+.Lmain_147:
+.Lmain_148:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_148
+	testq %r8, %r8
+	jns .Lmain_149
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_149:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $2, %rdx
+	addq %rdx, %rax
+	sarq $62, %rax
+	salq $62, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_150
+	negq %rax
+.Lmain_150:
+.Lmain_151:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_151
+	testq %r8, %r8
+	jns .Lmain_152
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_152:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $9223372036854775807, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_153
+	negq %rax
+.Lmain_153:
+.Lmain_154:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_154
+	testq %r8, %r8
+	jns .Lmain_155
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_155:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $9223372036854775807, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $4611686018427387905, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_156
+	negq %rax
+.Lmain_156:
+.Lmain_157:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_157
+	testq %r8, %r8
+	jns .Lmain_158
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_158:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $4611686018427387905, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_159
+	negq %rax
+.Lmain_159:
+.Lmain_160:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_160
+	testq %r8, %r8
+	jns .Lmain_161
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_161:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $4611686018427387905, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $9223372036854775807, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_162
+	negq %rax
+.Lmain_162:
+.Lmain_163:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_163
+	testq %r8, %r8
+	jns .Lmain_164
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_164:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $63, %rdx
+	addq %rdx, %rax
+	sarq $1, %rax
+	negq %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_165
+	negq %rax
+.Lmain_165:
+.Lmain_166:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_166
+	testq %r8, %r8
+	jns .Lmain_167
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_167:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $63, %rdx
+	addq %rdx, %rax
+	andq $-2, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_168
+	negq %rax
+.Lmain_168:
+.Lmain_169:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_169
+	testq %r8, %r8
+	jns .Lmain_170
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_170:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $6148914691236517205, %rdx
+	imulq %rdx
+	subq %rcx, %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_171
+	negq %rax
+.Lmain_171:
+.Lmain_172:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_172
+	testq %r8, %r8
+	jns .Lmain_173
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_173:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $6148914691236517205, %rdx
+	imulq %rdx
+	subq %rcx, %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $-3, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_174
+	negq %rax
+.Lmain_174:
+.Lmain_175:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_175
+	testq %r8, %r8
+	jns .Lmain_176
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_176:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_177
+	negq %rax
+.Lmain_177:
+.Lmain_178:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_178
+	testq %r8, %r8
+	jns .Lmain_179
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_179:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7378697629483820647, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $-5, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_180
+	negq %rax
+.Lmain_180:
+.Lmain_181:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_181
+	testq %r8, %r8
+	jns .Lmain_182
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_182:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_183
+	negq %rax
+.Lmain_183:
+.Lmain_184:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_184
+	testq %r8, %r8
+	jns .Lmain_185
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_185:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $-7, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_186
+	negq %rax
+.Lmain_186:
+.Lmain_187:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_187
+	testq %r8, %r8
+	jns .Lmain_188
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_188:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $61, %rdx
+	addq %rdx, %rax
+	sarq $3, %rax
+	negq %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_189
+	negq %rax
+.Lmain_189:
+.Lmain_190:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_190
+	testq %r8, %r8
+	jns .Lmain_191
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_191:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $61, %rdx
+	addq %rdx, %rax
+	andq $-8, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_192
+	negq %rax
+.Lmain_192:
+.Lmain_193:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_193
+	testq %r8, %r8
+	jns .Lmain_194
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_194:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_195
+	negq %rax
+.Lmain_195:
+.Lmain_196:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_196
+	testq %r8, %r8
+	jns .Lmain_197
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_197:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7378697629483820647, %rdx
+	imulq %rdx
+	sarq $2, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $-10, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_198
+	negq %rax
+.Lmain_198:
+.Lmain_199:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_199
+	testq %r8, %r8
+	jns .Lmain_200
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_200:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $60, %rdx
+	addq %rdx, %rax
+	sarq $4, %rax
+	negq %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_201
+	negq %rax
+.Lmain_201:
+.Lmain_202:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_202
+	testq %r8, %r8
+	jns .Lmain_203
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_203:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $60, %rdx
+	addq %rdx, %rax
+	andq $-16, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_204
+	negq %rax
+.Lmain_204:
+.Lmain_205:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_205
+	testq %r8, %r8
+	jns .Lmain_206
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_206:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7367186400732675841, %rdx
+	imulq %rdx
+	sarq $8, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_207
+	negq %rax
+.Lmain_207:
+.Lmain_208:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_208
+	testq %r8, %r8
+	jns .Lmain_209
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_209:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-7367186400732675841, %rdx
+	imulq %rdx
+	sarq $8, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $-641, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_210
+	negq %rax
+.Lmain_210:
+.Lmain_211:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_211
+	testq %r8, %r8
+	jns .Lmain_212
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_212:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $33, %rdx
+	addq %rdx, %rax
+	sarq $31, %rax
+	negq %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_213
+	negq %rax
+.Lmain_213:
+.Lmain_214:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_214
+	testq %r8, %r8
+	jns .Lmain_215
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_215:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $33, %rdx
+	addq %rdx, %rax
+	andq $-2147483648, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_216
+	negq %rax
+.Lmain_216:
+.Lmain_217:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_217
+	testq %r8, %r8
+	jns .Lmain_218
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_218:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-9223372034707292161, %rdx
+	imulq %rdx
+	sarq $31, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_219
+	negq %rax
+.Lmain_219:
+.Lmain_220:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_220
+	testq %r8, %r8
+	jns .Lmain_221
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_221:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-9223372034707292161, %rdx
+	imulq %rdx
+	sarq $31, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $-4294967297, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_222
+	negq %rax
+.Lmain_222:
+.Lmain_223:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_223
+	testq %r8, %r8
+	jns .Lmain_224
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_224:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $2, %rdx
+	addq %rdx, %rax
+	sarq $62, %rax
+	negq %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_225
+	negq %rax
+.Lmain_225:
+.Lmain_226:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_226
+	testq %r8, %r8
+	jns .Lmain_227
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_227:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $2, %rdx
+	addq %rdx, %rax
+	sarq $62, %rax
+	salq $62, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_228
+	negq %rax
+.Lmain_228:
+.Lmain_229:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_229
+	testq %r8, %r8
+	jns .Lmain_230
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_230:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-4611686018427387905, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_231
+	negq %rax
+.Lmain_231:
+.Lmain_232:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_232
+	testq %r8, %r8
+	jns .Lmain_233
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_233:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq $-4611686018427387905, %rdx
+	imulq %rdx
+	sarq $61, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq $-9223372036854775807, %rdx
+	imulq %rdx, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_234
+	negq %rax
+.Lmain_234:
+.Lmain_235:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_235
+	testq %r8, %r8
+	jns .Lmain_236
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_236:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	cqo
+	idivq %rcx
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_237
+	negq %rax
+.Lmain_237:
+.Lmain_238:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_238
+	testq %r8, %r8
+	jns .Lmain_239
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_239:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	cqo
+	idivq %rcx
+	movq %rdx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_240
+	negq %rax
+.Lmain_240:
+.Lmain_241:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_241
+	testq %r8, %r8
+	jns .Lmain_242
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_242:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 8(%rsp), %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	movq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_243
+	negq %rax
+.Lmain_243:
+.Lmain_244:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_244
+	testq %r8, %r8
+	jns .Lmain_245
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_245:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $16, %rax
+	negq %rax
+	popq %rsi
+	movq 40(%rsp,%rsi,8), %rcx
+	movq %rcx, %rax
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $60, %rdx
+	addq %rdx, %rax
+	sarq $4, %rax
+	negq %rax
+	movq %rax, %rcx
+	movq %rcx, 40(%rsp,%rsi,8)
+	movq %rcx, %rax
+	movq 24(%rsp), %rax
+	movq 40(%rsp,%rax,8), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_246
+	negq %rax
+.Lmain_246:
+.Lmain_247:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_247
+	testq %r8, %r8
+	jns .Lmain_248
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_248:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq 24(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 24(%rsp)
+.Lmain_2:
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $23, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_1
+	movq $0, %rax
+	addq $224, %rsp
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,377 @@
+	.file "test.s"
+	.text
+	.text
+	.globl sum
+	.type sum, @function
+sum:
+	subq $40, %rsp
+	movq %rdi, 32(%rsp)
+	movq $0, %rax
+	movq %rax, 24(%rsp)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lsum_1
+	.p2align 4
+.Lsum_0:
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	movq 24(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 24(%rsp)
+	movq %rcx, %rax
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+.Lsum_1:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsum_0
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	jmp .Lsum_3
+	.p2align 4
+.Lsum_2:
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	movq 24(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 24(%rsp)
+	movq %rcx, %rax
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lsum_3:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsum_2
+	movq 24(%rsp), %rax
+	addq $40, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $72, %rsp
+	movq $0, %rax
+	movq %rax, -8(%rbp)
+	movq $0, %rax
+	movq %rax, -16(%rbp)
+	jmp .Lmain_1
+	.p2align 4
+.Lmain_0:
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -8(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -16(%rbp)
+.Lmain_1:
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_0
+	movq $0, %rax
+	movq %rax, -24(%rbp)
+	movq $0, %rax
+	movq %rax, -32(%rbp)
+	jmp .Lmain_3
+	.p2align 4
+.Lmain_2:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	popq %rcx
+	movq -24(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -24(%rbp)
+	movq %rcx, %rax
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -32(%rbp)
+.Lmain_3:
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_2
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_4
+	negq %rax
+.Lmain_4:
+.Lmain_5:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_5
+	testq %r8, %r8
+	jns .Lmain_6
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_6:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -24(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_7
+	negq %rax
+.Lmain_7:
+.Lmain_8:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_8
+	testq %r8, %r8
+	jns .Lmain_9
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_9:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4, %rax
+	pushq %rax
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_10
+	negq %rax
+.Lmain_10:
+.Lmain_11:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_11
+	testq %r8, %r8
+	jns .Lmain_12
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_12:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rax, -40(%rbp)
+	movq $0, %rax
+	movq %rax, -48(%rbp)
+	jmp .Lmain_14
+	.p2align 4
+.Lmain_13:
+	movq $10, %rax
+	movq %rax, -56(%rbp)
+	movq -40(%rbp), %rax
+	pushq %rax
+	movq -56(%rbp), %rax
+	popq %rcx
+	movq -40(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -40(%rbp)
+	movq %rcx, %rax
+	movq -48(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -48(%rbp)
+.Lmain_14:
+	movq -48(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_13
+	movq -40(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	movq %rax, -64(%rbp)
+	movq $2, %rax
+	movq %rax, -72(%rbp)
+	movq -72(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_18
+	negq %rax
+.Lmain_18:
+.Lmain_19:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_19
+	testq %r8, %r8
+	jns .Lmain_20
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_20:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -64(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_21
+	negq %rax
+.Lmain_21:
+.Lmain_22:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_22
+	testq %r8, %r8
+	jns .Lmain_23
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_23:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,238 @@
+	.file "test.s"
+	.text
+	.text
+	.globl classify
+	.type classify, @function
+classify:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movq $0, %rax
+	movq %rax, -24(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lclassify_0
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lclassify_2
+	movq $1, %rax
+	movq %rax, -24(%rbp)
+	jmp .Lclassify_3
+.Lclassify_2:
+	movq $2, %rax
+	movq %rax, -24(%rbp)
+.Lclassify_3:
+	jmp .Lclassify_1
+.Lclassify_0:
+	movq $3, %rax
+	movq %rax, -24(%rbp)
+.Lclassify_1:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	sete %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lclassify_4
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -24(%rbp)
+	jmp .Lclassify_5
+.Lclassify_4:
+.Lclassify_5:
+	movq -24(%rbp), %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $1, %rax
+	pushq %rax
+	movq $1, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call classify
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $1, %rax
+	negq %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call classify
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	negq %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call classify
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	negq %rax
+	pushq %rax
+	movq $2, %rax
+	negq %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call classify
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
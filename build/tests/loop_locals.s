@@ -0,0 +1,143 @@
+	.file "test.s"
+	.text
+	.text
+	.globl one
+	.type one, @function
+one:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movq %rdi, -8(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lone_0
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	popq %rdi
+	movq %rbp, %rsp
+	popq %rbp
+	jmp one
+.Lone_0:
+	movq -8(%rbp), %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $64, %rsp
+	movq $0, %rax
+	movq %rax, -8(%rbp)
+	movq $0, %rax
+	movq %rax, -16(%rbp)
+	jmp .Lmain_1
+	.p2align 4
+.Lmain_0:
+	movq $1, %rax
+	pushq %rax
+	popq %rdi
+	call one
+	movq %rax, -24(%rbp)
+	movq $0, %rax
+	movq %rax, -32(%rbp)
+	jmp .Lmain_3
+	.p2align 4
+.Lmain_2:
+	movq $4, %rcx
+.Lmain_4:
+	decq %rcx
+	movq $0, -64(%rbp,%rcx,8)
+	jne .Lmain_4
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	popq %rsi
+	movq %rax, -64(%rbp,%rsi,8)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -32(%rbp), %rax
+	movq -64(%rbp,%rax,8), %rax
+	popq %rcx
+	movq -8(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -8(%rbp)
+	movq %rcx, %rax
+	movq -32(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -32(%rbp)
+.Lmain_3:
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_2
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -16(%rbp)
+.Lmain_1:
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq $5000000, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_0
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_5
+	negq %rax
+.Lmain_5:
+.Lmain_6:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_6
+	testq %r8, %r8
+	jns .Lmain_7
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_7:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
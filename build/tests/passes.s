@@ -0,0 +1,314 @@
+	.file "test.s"
+	.text
+	.text
+	.globl scale
+	.type scale, @function
+scale:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq %rsi, (%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl sum
+	.type sum, @function
+sum:
+	subq $56, %rsp
+	movq %rdi, 48(%rsp)
+	movq %rsi, 40(%rsp)
+	movq %rdx, 32(%rsp)
+	movq $0, %rax
+	movq %rax, 24(%rsp)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	movq 40(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	xorq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	jmp .Lsum_1
+	.p2align 4
+.Lsum_0:
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	movq 24(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 24(%rsp)
+	movq %rcx, %rax
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lsum_1:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 56(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsum_0
+	movq 24(%rsp), %rax
+	addq $56, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $24, %rsp
+	movq $0, -8(%rbp)
+	movq $0, -16(%rbp)
+	movq $3, %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $4, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -24(%rbp)
+	movq %rax, -8(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, -16(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $10, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $2, %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movq $1, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
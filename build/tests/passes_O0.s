@@ -0,0 +1,304 @@
+	.file "test.s"
+	.text
+	.text
+	.globl scale
+	.type scale, @function
+scale:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $16, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.text
+	.globl sum
+	.type sum, @function
+sum:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $40, %rsp
+	movq %rdi, -8(%rbp)
+	movq %rsi, -16(%rbp)
+	movq %rdx, -24(%rbp)
+	movq $0, %rax
+	movq %rax, -32(%rbp)
+	movq $0, %rax
+	movq %rax, -40(%rbp)
+	jmp .Lsum_1
+.Lsum_0:
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq -40(%rbp), %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	popq %rcx
+	xorq %rcx, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	popq %rcx
+	movq -32(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -32(%rbp)
+	movq %rcx, %rax
+	movq -40(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -40(%rbp)
+.Lsum_1:
+	movq -40(%rbp), %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsum_0
+	movq -32(%rbp), %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movq $3, %rax
+	movq %rax, -8(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call scale
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -8(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -8(%rbp)
+	pushq %rax
+	movq -8(%rbp), %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call scale
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $10, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $2, %rax
+	pushq %rax
+	movq -8(%rbp), %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call scale
+	pushq %rax
+	movq $1, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call sum
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
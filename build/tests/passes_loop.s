@@ -0,0 +1,31 @@
+.Lsum_0:
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	movq 24(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 24(%rsp)
+	movq %rcx, %rax
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lsum_1:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 56(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsum_0
@@ -0,0 +1,28 @@
+int unused(int x) {
+    return x * 3;
+}
+
+int mix(int a, int b) {
+    return (a * 31 + b) ^ (a >> 3) ^ (b << 2) ^ (a * b) ^ (a - b) ^ (a + 7) ^ (b + 11);
+}
+
+int main() {
+    int h = 0;
+    int odd = 0;
+    for (int i = 0; i < 100000; i++) {
+        if (i % 100 == 99) {
+            odd = odd + 1;
+        } else {
+            h = h + (i & 7);
+        }
+        if (i < 0) {
+            print(unused(i));
+            h = h - 1;
+        }
+        h = mix(h, i) & 1048575;
+    }
+    print(h);
+    print(odd);
+    return 0;
+}
+int extra() { return 1; }
@@ -0,0 +1,303 @@
+	.file "test.s"
+	.text
+	.text
+	.globl unused
+	.type unused, @function
+unused:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl mix
+	.type mix, @function
+mix:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq %rsi, (%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $31, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	sarq %cl, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	salq %cl, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $11, %rax
+	popq %rcx
+	addq %rcx, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $32, %rsp
+	movq $0, %rax
+	movq %rax, -8(%rbp)
+	movq $0, %rax
+	movq %rax, -16(%rbp)
+	movq $0, %rax
+	movq %rax, -24(%rbp)
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, -32(%rbp)
+	jmp .Lmain_1
+	.p2align 4
+.Lmain_0:
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	movq $-6640827866535438581, %rdx
+	imulq %rdx
+	addq %rcx, %rdx
+	sarq $6, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	imulq $100, %rax, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq $99, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	sete %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lmain_2
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -16(%rbp)
+	jmp .Lmain_3
+.Lmain_2:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rcx
+	andq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+.Lmain_3:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lmain_4
+	movq -32(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, -8(%rbp)
+.Lmain_4:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq -24(%rbp), %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call mix
+	pushq %rax
+	movq $1048575, %rax
+	popq %rcx
+	andq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -24(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -24(%rbp)
+	movq -32(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	movq -32(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -32(%rbp)
+	movq %rcx, %rax
+.Lmain_1:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $100000, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_0
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -16(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.text
+	.globl extra
+	.type extra, @function
+extra:
+	movq $1, %rax
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,267 @@
+	.file "test.s"
+	.text
+	.text
+	.globl twice
+	.type twice, @function
+twice:
+	subq $8, %rsp
+	incq __profile_counters+24(%rip)
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	subq $24, %rsp
+	incq __profile_counters+32(%rip)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	jmp .Lmain_1
+	.p2align 4
+.Lmain_0:
+	incq __profile_counters+40(%rip)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $62, %rdx
+	addq %rdx, %rax
+	andq $-4, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	cmpq $0, %rax
+	je .Lmain_2
+	cmpq $1, %rax
+	je .Lmain_3
+	cmpq $3, %rax
+	je .Lmain_4
+	jmp .Lmain_5
+.Lmain_2:
+	incq __profile_counters+48(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+.Lmain_3:
+	incq __profile_counters+56(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmain_6
+.Lmain_4:
+	incq __profile_counters+64(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmain_6
+.Lmain_5:
+	incq __profile_counters+72(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 16(%rsp)
+.Lmain_6:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $6, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Lmain_9
+	incq __profile_counters+96(%rip)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $9, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	setne %al
+	movzbq %al, %rax
+	jmp .Lmain_10
+.Lmain_9:
+	movq $0, %rax
+.Lmain_10:
+	cmpq $0, %rax
+	je .Lmain_7
+	incq __profile_counters+80(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmain_8
+.Lmain_7:
+	incq __profile_counters+88(%rip)
+.Lmain_8:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $100, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_13
+	incq __profile_counters+120(%rip)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	setne %al
+	movzbq %al, %rax
+	jmp .Lmain_14
+.Lmain_13:
+	movq $1, %rax
+.Lmain_14:
+	cmpq $0, %rax
+	je .Lmain_11
+	incq __profile_counters+104(%rip)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmain_12
+.Lmain_11:
+	incq __profile_counters+112(%rip)
+.Lmain_12:
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lmain_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_0
+	movq 16(%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	call __profile_write
+	addq $24, %rsp
+	ret
+__profile_write:
+	pushq %rax
+	pushq %rdx
+	pushq %rsi
+	pushq %rdi
+	movq $28548172593721968, %rax
+	movq %rax, __profile_counters+0(%rip)
+	movq $4575677229941558216, %rax
+	movq %rax, __profile_counters+8(%rip)
+	movq $13, %rax
+	movq %rax, __profile_counters+16(%rip)
+	movq $28548172593721968, %rax
+	pushq %rax
+	movq $3347146965831869279, %rax
+	pushq %rax
+	movq $7308332183992823855, %rax
+	pushq %rax
+	movq $8319401291238302828, %rax
+	pushq %rax
+	movq $7599087901035425648, %rax
+	pushq %rax
+	movq $7309957322308022831, %rax
+	pushq %rax
+	movq %rsp, %rdi
+	movq $577, %rsi
+	movq $420, %rdx
+	movq $2, %rax
+	syscall
+	addq $48, %rsp
+	testq %rax, %rax
+	js .Lmain_18
+	movq %rax, %rdi
+	leaq __profile_counters(%rip), %rsi
+	movq $128, %rdx
+	movq $1, %rax
+	syscall
+	movq $3, %rax
+	syscall
+.Lmain_18:
+	popq %rdi
+	popq %rsi
+	popq %rdx
+	popq %rax
+	ret
+	.local __profile_counters
+	.comm __profile_counters,128,8
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,657 @@
+	.file "test.s"
+	.text
+	.text
+	.type steps, @function
+steps:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	jmp .Lsteps_1
+	.p2align 4
+.Lsteps_0:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, (%rsp)
+.Lsteps_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setg %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lsteps_0
+	movq (%rsp), %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl scaled
+	.type scaled, @function
+scaled:
+	subq $40, %rsp
+	movq %rdi, 32(%rsp)
+	movq %rsi, 24(%rsp)
+	movq %rdx, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	jmp .Lscaled_1
+	.p2align 4
+.Lscaled_0:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	cqo
+	idivq %rcx
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 8(%rsp)
+	movq (%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, (%rsp)
+.Lscaled_1:
+	movq (%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lscaled_0
+	movq 8(%rsp), %rax
+	addq $40, %rsp
+	ret
+	.text
+	.type scaled.constprop, @function
+scaled.constprop:
+	subq $32, %rsp
+	movq %rdi, 24(%rsp)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 24(%rsp), %rax
+	movq %rax, %rcx
+	movq $5270498306774157605, %rdx
+	imulq %rdx
+	sarq $1, %rdx
+	movq %rdx, %rax
+	shrq $63, %rax
+	addq %rdx, %rax
+	movq %rax, (%rsp)
+	jmp .Lscaled.constprop_1
+	.p2align 4
+.Lscaled.constprop_0:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+.Lscaled.constprop_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lscaled.constprop_0
+	movq 16(%rsp), %rax
+	addq $32, %rsp
+	ret
+	.text
+	.globl mixed
+	.type mixed, @function
+mixed:
+	subq $48, %rsp
+	movq %rdi, 40(%rsp)
+	movq %rsi, 32(%rsp)
+	movq %rdx, 24(%rsp)
+	movq 40(%rsp), %rax
+	movq %rax, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	jmp .Lmixed_1
+	.p2align 4
+.Lmixed_0:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $31, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	sarq %cl, %rax
+	popq %rcx
+	xorq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 8(%rsp), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	pushq %rax
+	movq $13, %rax
+	popq %rcx
+	xchgq %rax, %rcx
+	sarq %cl, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	movq %rax, 16(%rsp)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq 40(%rsp), %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lmixed_1:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 32(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmixed_0
+	movq 16(%rsp), %rax
+	addq $48, %rsp
+	ret
+	.text
+	.type down, @function
+down:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $8, %rsp
+	movq %rdi, -8(%rbp)
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	je .Ldown_0
+	movq -8(%rbp), %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+.Ldown_0:
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Ldown_2
+	negq %rax
+.Ldown_2:
+.Ldown_3:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Ldown_3
+	testq %r8, %r8
+	jns .Ldown_4
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Ldown_4:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	popq %rdi
+	movq %rbp, %rsp
+	popq %rbp
+	jmp down
+	.text
+	.type reset, @function
+reset:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	pushq %rax
+	movq $4, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lreset_0
+	negq %rax
+.Lreset_0:
+.Lreset_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lreset_1
+	testq %r8, %r8
+	jns .Lreset_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lreset_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq (%rsp), %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $10, %rax
+	pushq %rax
+	popq %rdi
+	call steps
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $100, %rax
+	pushq %rax
+	popq %rdi
+	call steps
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $100, %rax
+	pushq %rax
+	popq %rdi
+	call scaled.constprop
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $50, %rax
+	pushq %rax
+	popq %rdi
+	call scaled.constprop
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $5, %rax
+	pushq %rax
+	popq %rdi
+	call down
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	popq %rdi
+	call reset
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	popq %rdi
+	call reset
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_18
+	negq %rax
+.Lmain_18:
+.Lmain_19:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_19
+	testq %r8, %r8
+	jns .Lmain_20
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_20:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_21
+	negq %rax
+.Lmain_21:
+.Lmain_22:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_22
+	testq %r8, %r8
+	jns .Lmain_23
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_23:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_24
+	negq %rax
+.Lmain_24:
+.Lmain_25:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_25
+	testq %r8, %r8
+	jns .Lmain_26
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_26:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,1441 @@
+	.file "test.s"
+	.text
+	.text
+	.globl dense
+	.type dense, @function
+dense:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	cmpq $6, %rax
+	ja .Ldense_6
+	leaq .Ldense_8(%rip), %rcx
+	movslq (%rcx,%rax,4), %rax
+	addq %rcx, %rax
+	jmp *%rax
+.Ldense_8:
+	.long .Ldense_0-.Ldense_8
+	.long .Ldense_1-.Ldense_8
+	.long .Ldense_2-.Ldense_8
+	.long .Ldense_3-.Ldense_8
+	.long .Ldense_6-.Ldense_8
+	.long .Ldense_4-.Ldense_8
+	.long .Ldense_5-.Ldense_8
+.Ldense_0:
+	movq $10, %rax
+	addq $8, %rsp
+	ret
+.Ldense_1:
+	movq $11, %rax
+	addq $8, %rsp
+	ret
+.Ldense_2:
+	movq $12, %rax
+	addq $8, %rsp
+	ret
+.Ldense_3:
+	movq $13, %rax
+	addq $8, %rsp
+	ret
+.Ldense_4:
+	movq $15, %rax
+	addq $8, %rsp
+	ret
+.Ldense_5:
+	movq $16, %rax
+	addq $8, %rsp
+	ret
+.Ldense_6:
+	movq $1, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl sparse
+	.type sparse, @function
+sparse:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	movq 8(%rsp), %rax
+	cmpq $50000, %rax
+	je .Lsparse_4
+	jg .Lsparse_9
+	cmpq $300, %rax
+	je .Lsparse_2
+	jg .Lsparse_10
+	cmpq $-1000, %rax
+	je .Lsparse_0
+	cmpq $7, %rax
+	je .Lsparse_1
+	jmp .Lsparse_8
+.Lsparse_10:
+	cmpq $4000, %rax
+	je .Lsparse_3
+	jmp .Lsparse_8
+.Lsparse_9:
+	cmpq $600000, %rax
+	je .Lsparse_5
+	cmpq $7000000, %rax
+	je .Lsparse_6
+	movq $80000000000, %rcx
+	cmpq %rcx, %rax
+	je .Lsparse_7
+	jmp .Lsparse_8
+.Lsparse_0:
+	movq $1, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_1:
+	movq $2, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_2:
+	movq $3, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_3:
+	movq $4, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_4:
+	movq $5, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_5:
+	movq $6, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_6:
+	movq $7, %rax
+	movq %rax, (%rsp)
+	jmp .Lsparse_8
+.Lsparse_7:
+	movq $8, %rax
+	movq %rax, (%rsp)
+.Lsparse_8:
+	movq (%rsp), %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl clusters
+	.type clusters, @function
+clusters:
+	subq $16, %rsp
+	movq %rdi, 8(%rsp)
+	movq $0, %rax
+	movq %rax, (%rsp)
+	movq 8(%rsp), %rax
+	cmpq $104, %rax
+	je .Lclusters_4
+	jg .Lclusters_14
+	cmpq $101, %rax
+	je .Lclusters_1
+	jg .Lclusters_15
+	cmpq $-5, %rax
+	je .Lclusters_10
+	cmpq $55, %rax
+	je .Lclusters_12
+	cmpq $100, %rax
+	je .Lclusters_0
+	jmp .Lclusters_11
+.Lclusters_15:
+	cmpq $102, %rax
+	je .Lclusters_2
+	cmpq $103, %rax
+	je .Lclusters_3
+	jmp .Lclusters_11
+.Lclusters_14:
+	subq $9000, %rax
+	cmpq $4, %rax
+	ja .Lclusters_11
+	leaq .Lclusters_16(%rip), %rcx
+	movslq (%rcx,%rax,4), %rax
+	addq %rcx, %rax
+	jmp *%rax
+.Lclusters_16:
+	.long .Lclusters_5-.Lclusters_16
+	.long .Lclusters_6-.Lclusters_16
+	.long .Lclusters_7-.Lclusters_16
+	.long .Lclusters_8-.Lclusters_16
+	.long .Lclusters_9-.Lclusters_16
+.Lclusters_0:
+.Lclusters_1:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lclusters_2:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+	jmp .Lclusters_13
+.Lclusters_3:
+	movq $30, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_4:
+	movq $40, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_5:
+	movq $900, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_6:
+	movq $901, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_7:
+	movq $902, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_8:
+	movq $903, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_9:
+	movq $904, %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_10:
+	movq $50, %rax
+	negq %rax
+	movq %rax, (%rsp)
+	jmp .Lclusters_13
+.Lclusters_11:
+	movq $7, %rax
+	movq %rax, (%rsp)
+.Lclusters_12:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rcx
+	movq (%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, (%rsp)
+	movq %rcx, %rax
+.Lclusters_13:
+	movq (%rsp), %rax
+	addq $16, %rsp
+	ret
+	.text
+	.globl negative
+	.type negative, @function
+negative:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	subq $-3, %rax
+	cmpq $4, %rax
+	ja .Lnegative_5
+	leaq .Lnegative_6(%rip), %rcx
+	movslq (%rcx,%rax,4), %rax
+	addq %rcx, %rax
+	jmp *%rax
+.Lnegative_6:
+	.long .Lnegative_0-.Lnegative_6
+	.long .Lnegative_1-.Lnegative_6
+	.long .Lnegative_2-.Lnegative_6
+	.long .Lnegative_3-.Lnegative_6
+	.long .Lnegative_4-.Lnegative_6
+.Lnegative_0:
+	movq $3, %rax
+	addq $8, %rsp
+	ret
+.Lnegative_1:
+	movq $2, %rax
+	addq $8, %rsp
+	ret
+.Lnegative_2:
+	movq $1, %rax
+	addq $8, %rsp
+	ret
+.Lnegative_3:
+	movq $0, %rax
+	addq $8, %rsp
+	ret
+.Lnegative_4:
+	movq $1, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+.Lnegative_5:
+	movq $100, %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl nested
+	.type nested, @function
+nested:
+	subq $32, %rsp
+	movq %rdi, 24(%rsp)
+	movq %rsi, 16(%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	movq 24(%rsp), %rax
+	cmpq $1, %rax
+	je .Lnested_0
+	cmpq $2, %rax
+	je .Lnested_1
+	jmp .Lnested_2
+.Lnested_0:
+	movq 16(%rsp), %rax
+	cmpq $1, %rax
+	je .Lnested_3
+	cmpq $2, %rax
+	je .Lnested_4
+	jmp .Lnested_5
+.Lnested_3:
+	movq $11, %rax
+	movq %rax, 8(%rsp)
+	jmp .Lnested_5
+.Lnested_4:
+	movq $12, %rax
+	movq %rax, 8(%rsp)
+.Lnested_5:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $100, %rax
+	popq %rcx
+	movq 8(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 8(%rsp)
+	movq %rcx, %rax
+	jmp .Lnested_2
+.Lnested_1:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $2, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, (%rsp)
+	movq (%rsp), %rax
+	movq %rax, 8(%rsp)
+.Lnested_2:
+	movq 8(%rsp), %rax
+	addq $32, %rsp
+	ret
+	.text
+	.globl extremes
+	.type extremes, @function
+extremes:
+	subq $8, %rsp
+	movq %rdi, (%rsp)
+	movq (%rsp), %rax
+	movq $9223372036854775804, %rcx
+	subq %rcx, %rax
+	cmpq $3, %rax
+	ja .Lextremes_4
+	leaq .Lextremes_5(%rip), %rcx
+	movslq (%rcx,%rax,4), %rax
+	addq %rcx, %rax
+	jmp *%rax
+.Lextremes_5:
+	.long .Lextremes_0-.Lextremes_5
+	.long .Lextremes_1-.Lextremes_5
+	.long .Lextremes_2-.Lextremes_5
+	.long .Lextremes_3-.Lextremes_5
+.Lextremes_0:
+	movq $1, %rax
+	addq $8, %rsp
+	ret
+.Lextremes_1:
+	movq $2, %rax
+	addq $8, %rsp
+	ret
+.Lextremes_2:
+	movq $3, %rax
+	addq $8, %rsp
+	ret
+.Lextremes_3:
+	movq $4, %rax
+	addq $8, %rsp
+	ret
+.Lextremes_4:
+	movq (%rsp), %rax
+	movq $4294967296, %rcx
+	cmpq %rcx, %rax
+	je .Lextremes_8
+	jg .Lextremes_11
+	movq $-9223372036854775807, %rcx
+	cmpq %rcx, %rax
+	je .Lextremes_6
+	movq $-4294967296, %rcx
+	cmpq %rcx, %rax
+	je .Lextremes_7
+	jmp .Lextremes_10
+.Lextremes_11:
+	movq $9223372036854775800, %rcx
+	cmpq %rcx, %rax
+	je .Lextremes_9
+	jmp .Lextremes_10
+.Lextremes_6:
+	movq $1, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+.Lextremes_7:
+	movq $2, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+.Lextremes_8:
+	movq $3, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+.Lextremes_9:
+	movq $4, %rax
+	negq %rax
+	addq $8, %rsp
+	ret
+.Lextremes_10:
+	movq $0, %rax
+	addq $8, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	subq $160, %rsp
+	movq $0, %rax
+	movq %rax, -8(%rbp)
+	movq $2, %rax
+	negq %rax
+	movq %rax, -16(%rbp)
+	jmp .Lmain_1
+	.p2align 4
+.Lmain_0:
+	movq -8(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq -16(%rbp), %rax
+	pushq %rax
+	popq %rdi
+	call dense
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -8(%rbp)
+	movq -16(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -16(%rbp)
+.Lmain_1:
+	movq -16(%rbp), %rax
+	pushq %rax
+	movq $9, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_0
+	movq -8(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_2
+	negq %rax
+.Lmain_2:
+.Lmain_3:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_3
+	testq %r8, %r8
+	jns .Lmain_4
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_4:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rax, -24(%rbp)
+	movq $10, %rcx
+.Lmain_5:
+	decq %rcx
+	movq $0, -104(%rbp,%rcx,8)
+	jne .Lmain_5
+	movq $0, %rax
+	pushq %rax
+	movq $1000, %rax
+	negq %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $1, %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $2, %rax
+	pushq %rax
+	movq $300, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $3, %rax
+	pushq %rax
+	movq $4000, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $4, %rax
+	pushq %rax
+	movq $50000, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $5, %rax
+	pushq %rax
+	movq $600000, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $6, %rax
+	pushq %rax
+	movq $7000000, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $7, %rax
+	pushq %rax
+	movq $80000000000, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $8, %rax
+	pushq %rax
+	movq $8, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $9, %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rsi
+	movq %rax, -104(%rbp,%rsi,8)
+	movq $0, %rax
+	movq %rax, -112(%rbp)
+	jmp .Lmain_7
+	.p2align 4
+.Lmain_6:
+	movq -24(%rbp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq -112(%rbp), %rax
+	movq -104(%rbp,%rax,8), %rax
+	pushq %rax
+	popq %rdi
+	call sparse
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -24(%rbp)
+	movq -112(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -112(%rbp)
+.Lmain_7:
+	movq -112(%rbp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_6
+	movq -24(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_8
+	negq %rax
+.Lmain_8:
+.Lmain_9:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_9
+	testq %r8, %r8
+	jns .Lmain_10
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_10:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $99, %rax
+	movq %rax, -120(%rbp)
+	jmp .Lmain_12
+	.p2align 4
+.Lmain_11:
+	movq -120(%rbp), %rax
+	pushq %rax
+	popq %rdi
+	call clusters
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_13
+	negq %rax
+.Lmain_13:
+.Lmain_14:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_14
+	testq %r8, %r8
+	jns .Lmain_15
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_15:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -120(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -120(%rbp)
+.Lmain_12:
+	movq -120(%rbp), %rax
+	pushq %rax
+	movq $106, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_11
+	movq $9003, %rax
+	pushq %rax
+	popq %rdi
+	call clusters
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_16
+	negq %rax
+.Lmain_16:
+.Lmain_17:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_17
+	testq %r8, %r8
+	jns .Lmain_18
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_18:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $5, %rax
+	negq %rax
+	pushq %rax
+	popq %rdi
+	call clusters
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_19
+	negq %rax
+.Lmain_19:
+.Lmain_20:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_20
+	testq %r8, %r8
+	jns .Lmain_21
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_21:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $55, %rax
+	pushq %rax
+	popq %rdi
+	call clusters
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_22
+	negq %rax
+.Lmain_22:
+.Lmain_23:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_23
+	testq %r8, %r8
+	jns .Lmain_24
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_24:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $56, %rax
+	pushq %rax
+	popq %rdi
+	call clusters
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_25
+	negq %rax
+.Lmain_25:
+.Lmain_26:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_26
+	testq %r8, %r8
+	jns .Lmain_27
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_27:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4, %rax
+	negq %rax
+	movq %rax, -128(%rbp)
+	jmp .Lmain_29
+	.p2align 4
+.Lmain_28:
+	movq -128(%rbp), %rax
+	pushq %rax
+	popq %rdi
+	call negative
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_30
+	negq %rax
+.Lmain_30:
+.Lmain_31:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_31
+	testq %r8, %r8
+	jns .Lmain_32
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_32:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -128(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -128(%rbp)
+.Lmain_29:
+	movq -128(%rbp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_28
+	movq $1, %rax
+	pushq %rax
+	movq $1, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call nested
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_33
+	negq %rax
+.Lmain_33:
+.Lmain_34:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_34
+	testq %r8, %r8
+	jns .Lmain_35
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_35:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $2, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call nested
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_36
+	negq %rax
+.Lmain_36:
+.Lmain_37:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_37
+	testq %r8, %r8
+	jns .Lmain_38
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_38:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call nested
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_39
+	negq %rax
+.Lmain_39:
+.Lmain_40:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_40
+	testq %r8, %r8
+	jns .Lmain_41
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_41:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	movq $21, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call nested
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_42
+	negq %rax
+.Lmain_42:
+.Lmain_43:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_43
+	testq %r8, %r8
+	jns .Lmain_44
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_44:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $3, %rax
+	pushq %rax
+	movq $21, %rax
+	pushq %rax
+	popq %rsi
+	popq %rdi
+	call nested
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_45
+	negq %rax
+.Lmain_45:
+.Lmain_46:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_46
+	testq %r8, %r8
+	jns .Lmain_47
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_47:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rax, -136(%rbp)
+	movq $0, %rax
+	movq %rax, -144(%rbp)
+	jmp .Lmain_49
+	.p2align 4
+.Lmain_48:
+	movq -144(%rbp), %rax
+	movq %rax, %rcx
+	movq %rax, %rdx
+	sarq $63, %rdx
+	shrq $62, %rdx
+	addq %rdx, %rax
+	andq $-4, %rax
+	subq %rax, %rcx
+	movq %rcx, %rax
+	cmpq $3, %rax
+	ja .Lmain_54
+	leaq .Lmain_55(%rip), %rcx
+	movslq (%rcx,%rax,4), %rax
+	addq %rcx, %rax
+	jmp *%rax
+.Lmain_55:
+	.long .Lmain_50-.Lmain_55
+	.long .Lmain_51-.Lmain_55
+	.long .Lmain_52-.Lmain_55
+	.long .Lmain_53-.Lmain_55
+.Lmain_50:
+	movq -136(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	movq -136(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -136(%rbp)
+	movq %rcx, %rax
+	jmp .Lmain_54
+.Lmain_51:
+	movq -136(%rbp), %rax
+	pushq %rax
+	movq $10, %rax
+	popq %rcx
+	movq -136(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -136(%rbp)
+	movq %rcx, %rax
+	jmp .Lmain_54
+.Lmain_52:
+	movq -136(%rbp), %rax
+	pushq %rax
+	movq $100, %rax
+	popq %rcx
+	movq -136(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -136(%rbp)
+	movq %rcx, %rax
+	jmp .Lmain_54
+.Lmain_53:
+	movq -136(%rbp), %rax
+	pushq %rax
+	movq $1000, %rax
+	popq %rcx
+	movq -136(%rbp), %rcx
+	addq %rax, %rcx
+	movq %rcx, -136(%rbp)
+	movq %rcx, %rax
+.Lmain_54:
+	movq -144(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -144(%rbp)
+.Lmain_49:
+	movq -144(%rbp), %rax
+	pushq %rax
+	movq $1000, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_48
+	movq -136(%rbp), %rax
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_56
+	negq %rax
+.Lmain_56:
+.Lmain_57:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_57
+	testq %r8, %r8
+	jns .Lmain_58
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_58:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $9223372036854775803, %rax
+	movq %rax, -152(%rbp)
+	movq $0, %rax
+	movq %rax, -160(%rbp)
+	jmp .Lmain_60
+	.p2align 4
+.Lmain_59:
+	movq -152(%rbp), %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_61
+	negq %rax
+.Lmain_61:
+.Lmain_62:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_62
+	testq %r8, %r8
+	jns .Lmain_63
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_63:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq -152(%rbp), %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, -152(%rbp)
+	movq -160(%rbp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, -160(%rbp)
+.Lmain_60:
+	movq -160(%rbp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmain_59
+	movq $9223372036854775807, %rax
+	negq %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_64
+	negq %rax
+.Lmain_64:
+.Lmain_65:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_65
+	testq %r8, %r8
+	jns .Lmain_66
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_66:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $9223372036854775807, %rax
+	negq %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_67
+	negq %rax
+.Lmain_67:
+.Lmain_68:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_68
+	testq %r8, %r8
+	jns .Lmain_69
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_69:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4294967296, %rax
+	negq %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_70
+	negq %rax
+.Lmain_70:
+.Lmain_71:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_71
+	testq %r8, %r8
+	jns .Lmain_72
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_72:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4294967296, %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_73
+	negq %rax
+.Lmain_73:
+.Lmain_74:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_74
+	testq %r8, %r8
+	jns .Lmain_75
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_75:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4294967295, %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_76
+	negq %rax
+.Lmain_76:
+.Lmain_77:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_77
+	testq %r8, %r8
+	jns .Lmain_78
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_78:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $9223372036854775800, %rax
+	pushq %rax
+	popq %rdi
+	call extremes
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_79
+	negq %rax
+.Lmain_79:
+.Lmain_80:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_80
+	testq %r8, %r8
+	jns .Lmain_81
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_81:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,897 @@
+	.file "test.s"
+	.text
+	.text
+	.globl mixed
+	.type mixed, @function
+mixed:
+	subq $312, %rsp
+	movq %rdi, 304(%rsp)
+	movq %rsi, 296(%rsp)
+	movq %rdx, 288(%rsp)
+	movq $11, %rcx
+.Lmixed_0:
+	decq %rcx
+	movq $0, 200(%rsp,%rcx,8)
+	jne .Lmixed_0
+	movq $11, %rcx
+.Lmixed_1:
+	decq %rcx
+	movq $0, 112(%rsp,%rcx,8)
+	jne .Lmixed_1
+	movq $11, %rcx
+.Lmixed_2:
+	decq %rcx
+	movq $0, 24(%rsp,%rcx,8)
+	jne .Lmixed_2
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	movq %rax, 8(%rsp)
+	jmp .Lmixed_4
+	.p2align 4
+.Lmixed_3:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $0, %rax
+	popq %rsi
+	movq %rax, 200(%rsp,%rsi,8)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rsi
+	movq %rax, 112(%rsp,%rsi,8)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $100, %rax
+	pushq %rax
+	movq 32(%rsp), %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	popq %rsi
+	movq %rax, 24(%rsp,%rsi,8)
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	movq 8(%rsp), %rcx
+	addq %rax, %rcx
+	movq %rcx, 8(%rsp)
+	movq %rcx, %rax
+.Lmixed_4:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $11, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmixed_3
+	movq 304(%rsp), %rax
+	movq %rax, 16(%rsp)
+	.comm __vector_isa,8,8
+	movq __vector_isa(%rip), %rax
+	testq %rax, %rax
+	jne .Lmixed_7
+	pushq %rbx
+	movq $1, %rsi
+	movq $1, %rax
+	cpuid
+	andq $402653184, %rcx
+	cmpq $402653184, %rcx
+	jne .Lmixed_8
+	xorq %rcx, %rcx
+	xgetbv
+	andq $6, %rax
+	cmpq $6, %rax
+	jne .Lmixed_8
+	movq $7, %rax
+	xorq %rcx, %rcx
+	cpuid
+	testq $32, %rbx
+	je .Lmixed_8
+	movq $2, %rsi
+.Lmixed_8:
+	popq %rbx
+	movq %rsi, __vector_isa(%rip)
+	movq %rsi, %rax
+.Lmixed_7:
+	movq 296(%rsp), %rdx
+	movq 16(%rsp), %rcx
+	cmpq $2, %rax
+	jne .Lmixed_5
+	movq 288(%rsp), %rax
+	vmovq %rax, %xmm15
+	vpbroadcastq %xmm15, %ymm15
+	movq $5, %rax
+	vmovq %rax, %xmm14
+	vpbroadcastq %xmm14, %ymm14
+	jmp .Lmixed_10
+	.p2align 4
+.Lmixed_9:
+	vmovdqu 112(%rsp,%rcx,8), %ymm0
+	vmovdqu 24(%rsp,%rcx,8), %ymm1
+	vpaddq %ymm1, %ymm0, %ymm0
+	vpxor %ymm15, %ymm0, %ymm0
+	vmovdqu %ymm0, 200(%rsp,%rcx,8)
+	vmovdqu 24(%rsp,%rcx,8), %ymm0
+	vpsubq %ymm14, %ymm0, %ymm0
+	vmovdqu %ymm0, 24(%rsp,%rcx,8)
+	addq $4, %rcx
+.Lmixed_10:
+	cmpq %rdx, %rcx
+	jge .Lmixed_11
+	movq %rdx, %rax
+	subq %rcx, %rax
+	cmpq $4, %rax
+	jge .Lmixed_9
+.Lmixed_11:
+	vzeroupper
+	jmp .Lmixed_6
+.Lmixed_5:
+	movq 288(%rsp), %rax
+	movq %rax, %xmm15
+	punpcklqdq %xmm15, %xmm15
+	movq $5, %rax
+	movq %rax, %xmm14
+	punpcklqdq %xmm14, %xmm14
+	jmp .Lmixed_13
+	.p2align 4
+.Lmixed_12:
+	movdqu 112(%rsp,%rcx,8), %xmm0
+	movdqu 24(%rsp,%rcx,8), %xmm1
+	paddq %xmm1, %xmm0
+	pxor %xmm15, %xmm0
+	movdqu %xmm0, 200(%rsp,%rcx,8)
+	movdqu 24(%rsp,%rcx,8), %xmm0
+	psubq %xmm14, %xmm0
+	movdqu %xmm0, 24(%rsp,%rcx,8)
+	addq $2, %rcx
+.Lmixed_13:
+	cmpq %rdx, %rcx
+	jge .Lmixed_6
+	movq %rdx, %rax
+	subq %rcx, %rax
+	cmpq $2, %rax
+	jge .Lmixed_12
+.Lmixed_6:
+	movq %rcx, 16(%rsp)
+	jmp .Lmixed_16
+	.p2align 4
+.Lmixed_15:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	movq 120(%rsp,%rax,8), %rax
+	pushq %rax
+	movq 32(%rsp), %rax
+	movq 40(%rsp,%rax,8), %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movq 304(%rsp), %rax
+	popq %rcx
+	xorq %rcx, %rax
+	popq %rsi
+	movq %rax, 200(%rsp,%rsi,8)
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rsi
+	movq 24(%rsp,%rsi,8), %rcx
+	subq %rax, %rcx
+	movq %rcx, 24(%rsp,%rsi,8)
+	movq %rcx, %rax
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+.Lmixed_16:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 304(%rsp), %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmixed_15
+	movq $0, %rax
+	movq %rax, (%rsp)
+	movq $0, %rax
+	movq %rax, 16(%rsp)
+	jmp .Lmixed_18
+	.p2align 4
+.Lmixed_17:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $7, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	movq 208(%rsp,%rax,8), %rax
+	pushq %rax
+	movq $3, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	movq 32(%rsp,%rax,8), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, (%rsp)
+	movq 16(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 16(%rsp)
+.Lmixed_18:
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq $11, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lmixed_17
+	movq (%rsp), %rax
+	addq $312, %rsp
+	ret
+	.text
+	.globl constant_bound
+	.type constant_bound, @function
+constant_bound:
+	subq $168, %rsp
+	movq %rdi, 160(%rsp)
+	movq $9, %rcx
+.Lconstant_bound_0:
+	decq %rcx
+	movq $0, 88(%rsp,%rcx,8)
+	jne .Lconstant_bound_0
+	movq $9, %rcx
+.Lconstant_bound_1:
+	decq %rcx
+	movq $0, 16(%rsp,%rcx,8)
+	jne .Lconstant_bound_1
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	jmp .Lconstant_bound_3
+	.p2align 4
+.Lconstant_bound_2:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	popq %rsi
+	movq %rax, 88(%rsp,%rsi,8)
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	pushq %rax
+	movq 24(%rsp), %rax
+	popq %rcx
+	imulq %rcx, %rax
+	popq %rsi
+	movq %rax, 16(%rsp,%rsi,8)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+.Lconstant_bound_3:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $9, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lconstant_bound_2
+	movq $2, %rax
+	movq %rax, 8(%rsp)
+	.comm __vector_isa,8,8
+	movq __vector_isa(%rip), %rax
+	testq %rax, %rax
+	jne .Lconstant_bound_6
+	pushq %rbx
+	movq $1, %rsi
+	movq $1, %rax
+	cpuid
+	andq $402653184, %rcx
+	cmpq $402653184, %rcx
+	jne .Lconstant_bound_7
+	xorq %rcx, %rcx
+	xgetbv
+	andq $6, %rax
+	cmpq $6, %rax
+	jne .Lconstant_bound_7
+	movq $7, %rax
+	xorq %rcx, %rcx
+	cpuid
+	testq $32, %rbx
+	je .Lconstant_bound_7
+	movq $2, %rsi
+.Lconstant_bound_7:
+	popq %rbx
+	movq %rsi, __vector_isa(%rip)
+	movq %rsi, %rax
+.Lconstant_bound_6:
+	movq $9, %rdx
+	movq 8(%rsp), %rcx
+	cmpq $2, %rax
+	jne .Lconstant_bound_4
+	movq 160(%rsp), %rax
+	vmovq %rax, %xmm15
+	vpbroadcastq %xmm15, %ymm15
+	movq $1, %rax
+	vmovq %rax, %xmm14
+	vpbroadcastq %xmm14, %ymm14
+	movq $12, %rax
+	vmovq %rax, %xmm13
+	vpbroadcastq %xmm13, %ymm13
+	jmp .Lconstant_bound_9
+	.p2align 4
+.Lconstant_bound_8:
+	vmovdqu 88(%rsp,%rcx,8), %ymm0
+	vmovdqu 16(%rsp,%rcx,8), %ymm1
+	vpsubq %ymm15, %ymm1, %ymm1
+	vpor %ymm14, %ymm1, %ymm1
+	vpaddq %ymm1, %ymm0, %ymm0
+	vmovdqu %ymm0, 88(%rsp,%rcx,8)
+	vmovdqu 88(%rsp,%rcx,8), %ymm0
+	vpand %ymm13, %ymm0, %ymm0
+	vmovdqu %ymm0, 16(%rsp,%rcx,8)
+	addq $4, %rcx
+.Lconstant_bound_9:
+	cmpq %rdx, %rcx
+	jge .Lconstant_bound_10
+	movq %rdx, %rax
+	subq %rcx, %rax
+	cmpq $4, %rax
+	jge .Lconstant_bound_8
+.Lconstant_bound_10:
+	vzeroupper
+	jmp .Lconstant_bound_5
+.Lconstant_bound_4:
+	movq 160(%rsp), %rax
+	movq %rax, %xmm15
+	punpcklqdq %xmm15, %xmm15
+	movq $1, %rax
+	movq %rax, %xmm14
+	punpcklqdq %xmm14, %xmm14
+	movq $12, %rax
+	movq %rax, %xmm13
+	punpcklqdq %xmm13, %xmm13
+	jmp .Lconstant_bound_12
+	.p2align 4
+.Lconstant_bound_11:
+	movdqu 88(%rsp,%rcx,8), %xmm0
+	movdqu 16(%rsp,%rcx,8), %xmm1
+	psubq %xmm15, %xmm1
+	por %xmm14, %xmm1
+	paddq %xmm1, %xmm0
+	movdqu %xmm0, 88(%rsp,%rcx,8)
+	movdqu 88(%rsp,%rcx,8), %xmm0
+	pand %xmm13, %xmm0
+	movdqu %xmm0, 16(%rsp,%rcx,8)
+	addq $2, %rcx
+.Lconstant_bound_12:
+	cmpq %rdx, %rcx
+	jge .Lconstant_bound_5
+	movq %rdx, %rax
+	subq %rcx, %rax
+	cmpq $2, %rax
+	jge .Lconstant_bound_11
+.Lconstant_bound_5:
+	movq %rcx, 8(%rsp)
+	jmp .Lconstant_bound_15
+	.p2align 4
+.Lconstant_bound_14:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	movq 24(%rsp,%rax,8), %rax
+	pushq %rax
+	movq 176(%rsp), %rax
+	popq %rcx
+	subq %rax, %rcx
+	movq %rcx, %rax
+	pushq %rax
+	movq $1, %rax
+	popq %rcx
+	orq %rcx, %rax
+	popq %rsi
+	movq 88(%rsp,%rsi,8), %rcx
+	addq %rax, %rcx
+	movq %rcx, 88(%rsp,%rsi,8)
+	movq %rcx, %rax
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	movq 96(%rsp,%rax,8), %rax
+	pushq %rax
+	movq $12, %rax
+	popq %rcx
+	andq %rcx, %rax
+	popq %rsi
+	movq %rax, 16(%rsp,%rsi,8)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+.Lconstant_bound_15:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $9, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lconstant_bound_14
+	movq $0, %rax
+	movq %rax, (%rsp)
+	movq $0, %rax
+	movq %rax, 8(%rsp)
+	jmp .Lconstant_bound_17
+	.p2align 4
+.Lconstant_bound_16:
+	movq (%rsp), %rax
+	pushq %rax
+	movq $5, %rax
+	popq %rcx
+	imulq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	movq 96(%rsp,%rax,8), %rax
+	popq %rcx
+	addq %rcx, %rax
+	pushq %rax
+	movq 16(%rsp), %rax
+	movq 24(%rsp,%rax,8), %rax
+	popq %rcx
+	addq %rcx, %rax
+	movq %rax, (%rsp)
+	movq 8(%rsp), %rax
+	movq %rax, %rcx
+	incq %rcx
+	movq %rcx, 8(%rsp)
+.Lconstant_bound_17:
+	movq 8(%rsp), %rax
+	pushq %rax
+	movq $9, %rax
+	popq %rcx
+	cmpq %rax, %rcx
+	setl %al
+	movzbq %al, %rax
+	cmpq $0, %rax
+	jne .Lconstant_bound_16
+	movq (%rsp), %rax
+	addq $168, %rsp
+	ret
+	.text
+	.globl main
+	.type main, @function
+main:
+	pushq %rbp
+	movq %rsp, %rbp
+	movq $0, %rax
+	pushq %rax
+	movq $11, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_0
+	negq %rax
+.Lmain_0:
+.Lmain_1:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_1
+	testq %r8, %r8
+	jns .Lmain_2
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_2:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	pushq %rax
+	movq $9, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_3
+	negq %rax
+.Lmain_3:
+.Lmain_4:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_4
+	testq %r8, %r8
+	jns .Lmain_5
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_5:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $3, %rax
+	pushq %rax
+	movq $10, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_6
+	negq %rax
+.Lmain_6:
+.Lmain_7:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_7
+	testq %r8, %r8
+	jns .Lmain_8
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_8:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $1, %rax
+	pushq %rax
+	movq $8, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_9
+	negq %rax
+.Lmain_9:
+.Lmain_10:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_10
+	testq %r8, %r8
+	jns .Lmain_11
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_11:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $5, %rax
+	pushq %rax
+	movq $8, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_12
+	negq %rax
+.Lmain_12:
+.Lmain_13:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_13
+	testq %r8, %r8
+	jns .Lmain_14
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_14:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $2, %rax
+	pushq %rax
+	movq $3, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_15
+	negq %rax
+.Lmain_15:
+.Lmain_16:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_16
+	testq %r8, %r8
+	jns .Lmain_17
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_17:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	pushq %rax
+	movq $1, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_18
+	negq %rax
+.Lmain_18:
+.Lmain_19:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_19
+	testq %r8, %r8
+	jns .Lmain_20
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_20:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $4, %rax
+	pushq %rax
+	movq $4, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_21
+	negq %rax
+.Lmain_21:
+.Lmain_22:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_22
+	testq %r8, %r8
+	jns .Lmain_23
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_23:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $7, %rax
+	pushq %rax
+	movq $5, %rax
+	pushq %rax
+	movq $6, %rax
+	pushq %rax
+	popq %rdx
+	popq %rsi
+	popq %rdi
+	call mixed
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_24
+	negq %rax
+.Lmain_24:
+.Lmain_25:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_25
+	testq %r8, %r8
+	jns .Lmain_26
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_26:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $3, %rax
+	pushq %rax
+	popq %rdi
+	call constant_bound
+	# Convert integer to string and print
+	subq $32, %rsp
+	leaq 31(%rsp), %rsi
+	movb $10, (%rsi)
+	movq $1, %r10
+	movq %rax, %r8
+	movq $10, %r9
+	testq %rax, %rax
+	jns .Lmain_27
+	negq %rax
+.Lmain_27:
+.Lmain_28:
+	xorq %rdx, %rdx
+	divq %r9
+	addq $48, %rdx
+	decq %rsi
+	movb %dl, (%rsi)
+	incq %r10
+	testq %rax, %rax
+	jnz .Lmain_28
+	testq %r8, %r8
+	jns .Lmain_29
+	decq %rsi
+	movb $45, (%rsi)
+	incq %r10
+.Lmain_29:
+	movq %r10, %rdx
+	movq $1, %rdi
+	movq $1, %rax
+	syscall
+	addq $32, %rsp
+	movq $0, %rax
+	movq %rbp, %rsp
+	popq %rbp
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,993 @@
+// Bytecode backend (./main --interpret).
+//
+// Lowers the same AST the x86-64 generator takes to a compact register
+// bytecode and runs it on a direct-threaded interpreter. Every function gets
+// a frame of 64-bit registers: its locals first, in the order the generator
+// hands out their stack slots (so what is -8(%rbp), -16(%rbp), ... there is
+// r0, r1, ... here), with expression temporaries above them. Identifiers
+// are used in place, so `a + b` is a single ADD with no loads. An array
+// takes a register holding its length, which indexing checks against, and
+// one register per element after it.
+//
+// Instructions are three-address, { opcode, a, b, c }. Before the first run
+// each opcode is replaced with the address of its handler in the
+// interpreter loop (GCC's labels as values), so dispatching the next
+// instruction is one indirect jump.
+#define _GNU_SOURCE
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <dlfcn.h>
+
+// Registers and frames available to a running program
+#define BC_STACK_REGISTERS (1 << 20)
+#define BC_STACK_FRAMES (1 << 16)
+#define BC_MAX_ARGUMENTS 6
+
+// a = destination register, b and c = operand registers, unless noted
+enum {
+    BC_LOADK,     // r[a] = constants[b]
+    BC_MOVE,      // r[a] = r[b]
+    BC_ADD,
+    BC_SUB,
+    BC_MUL,
+    BC_DIV,
+    BC_MOD,
+    BC_AND,
+    BC_OR,
+    BC_XOR,
+    BC_SHL,
+    BC_SHR,
+    BC_EQ,
+    BC_NE,
+    BC_LT,
+    BC_LE,
+    BC_GT,
+    BC_GE,
+    BC_NEG,       // r[a] = -r[b]
+    BC_NOT,       // r[a] = !r[b]
+    BC_BIT_NOT,   // r[a] = ~r[b]
+    BC_INC,       // r[a] += 1
+    BC_DEC,       // r[a] -= 1
+    BC_JUMP,      // pc = a
+    BC_JUMP_ZERO,     // if r[a] == 0, pc = b
+    BC_JUMP_NOT_ZERO, // if r[a] != 0, pc = b
+    BC_CALL,      // r[a] = functions[b](r[a], ..., r[a + c - 1])
+    BC_TAIL_CALL, // return functions[b](r[a], ..., r[a + c - 1]), in this frame
+    BC_RETURN,    // return r[a]
+    BC_PRINT,     // print r[a] and a newline
+    BC_CLEAR,     // r[a], ..., r[a + b - 1] = 0
+    BC_LOAD_INDEX,  // r[a] = r[b + r[c]], r[b - 1] is the length
+    BC_STORE_INDEX, // r[b + r[c]] = r[a], r[b - 1] is the length
+    BC_SWITCH,    // jump table for r[a] at constants[b], see bc_lower_switch
+    BC_SWITCH_SEARCH, // sorted cases for r[a] at constants[b], ditto
+    BC_OPCODE_COUNT
+};
+
+struct bc_local {
+    char* name;
+    // The first element of an array
+    int reg;
+    // Number of elements of an array, 0 for a variable
+    int length;
+};
+
+struct bc_lower {
+    struct bc_program* program;
+    // Index of the function being lowered; calls can grow the table
+    int function;
+    struct bc_local* locals;
+    int local_count;
+    int local_capacity;
+    // Next free register; temporaries are handed out above the locals and
+    // released at the end of every statement
+    int next_register;
+    // Jumps of the breaks in the switches being lowered, to patch once the
+    // end of their switch is known
+    int* breaks;
+    int break_count;
+    int break_capacity;
+};
+
+static int bc_emit(struct bc_lower* lower, int opcode, int a, int b, int c)
+{
+    struct bc_program* program = lower->program;
+    if (program->instruction_count == program->instruction_capacity) {
+        program->instruction_capacity = program->instruction_capacity ? program->instruction_capacity * 2 : 256;
+        program->instructions = realloc(program->instructions, program->instruction_capacity * sizeof(struct bc_instruction));
+    }
+    struct bc_instruction* instruction = &program->instructions[program->instruction_count];
+    instruction->opcode = opcode;
+    instruction->a = a;
+    instruction->b = b;
+    instruction->c = c;
+    return program->instruction_count++;
+}
+
+static int bc_constant(struct bc_lower* lower, long long value)
+{
+    struct bc_program* program = lower->program;
+    if (program->constant_count == program->constant_capacity) {
+        program->constant_capacity = program->constant_capacity ? program->constant_capacity * 2 : 64;
+        program->constants = realloc(program->constants, program->constant_capacity * sizeof(long long));
+    }
+    program->constants[program->constant_count] = value;
+    return program->constant_count++;
+}
+
+static int bc_registers(struct bc_lower* lower, int count)
+{
+    int reg = lower->next_register;
+    lower->next_register += count;
+    struct bc_function* function = &lower->program->functions[lower->function];
+    if (lower->next_register > function->frame_size) {
+        function->frame_size = lower->next_register;
+    }
+    return reg;
+}
+
+static int bc_register(struct bc_lower* lower)
+{
+    return bc_registers(lower, 1);
+}
+
+static int bc_function_index(struct bc_program* program, const char* name)
+{
+    for (int i = 0; i < program->function_count; i++) {
+        if (strcmp(program->functions[i].name, name) == 0) {
+            return i;
+        }
+    }
+    if (program->function_count == program->function_capacity) {
+        program->function_capacity = program->function_capacity ? program->function_capacity * 2 : 16;
+        program->functions = realloc(program->functions, program->function_capacity * sizeof(struct bc_function));
+    }
+    struct bc_function* function = &program->functions[program->function_count];
+    memset(function, 0, sizeof(*function));
+    function->name = strdup(name);
+    return program->function_count++;
+}
+
+static int bc_add_local(struct bc_lower* lower, const char* name, int length)
+{
+    if (lower->local_count == lower->local_capacity) {
+        lower->local_capacity = lower->local_capacity ? lower->local_capacity * 2 : 64;
+        lower->locals = realloc(lower->locals, lower->local_capacity * sizeof(struct bc_local));
+    }
+    int reg = length ? bc_registers(lower, length + 1) + 1 : bc_register(lower);
+    lower->locals[lower->local_count].name = strdup(name);
+    lower->locals[lower->local_count].reg = reg;
+    lower->locals[lower->local_count].length = length;
+    lower->local_count++;
+    return reg;
+}
+
+// Forgets the locals declared since there were count of them. Their
+// registers stay allocated, like the generator's stack slots
+static void bc_pop_locals(struct bc_lower* lower, int count)
+{
+    for (int i = count; i < lower->local_count; i++) {
+        free(lower->locals[i].name);
+    }
+    lower->local_count = count;
+}
+
+// Like get_variable_offset, the newest local declared with the name wins
+static struct bc_local* bc_find_local(struct bc_lower* lower, const char* name)
+{
+    for (int i = lower->local_count - 1; i >= 0; i--) {
+        if (strcmp(lower->locals[i].name, name) == 0) {
+            return &lower->locals[i];
+        }
+    }
+    compiler_error(NULL, "Error: Variable %s not found\n", name);
+}
+
+static int bc_local(struct bc_lower* lower, const char* name)
+{
+    struct bc_local* local = bc_find_local(lower, name);
+    if (local->length) {
+        compiler_error(NULL, "Error: Array %s is used as a value\n", name);
+    }
+    return local->reg;
+}
+
+// The first element register of the array node indexes
+static int bc_array(struct bc_lower* lower, struct ast_node* node)
+{
+    if (node->array_access.array->type != AST_IDENTIFIER) {
+        compiler_error(NULL, "Error: Only local arrays can be indexed\n");
+    }
+    struct bc_local* local = bc_find_local(lower, node->array_access.array->id_literal.value);
+    if (!local->length) {
+        compiler_error(NULL, "Error: %s is not an array\n", local->name);
+    }
+    return local->reg;
+}
+
+static int bc_lvalue(struct bc_lower* lower, struct ast_node* node)
+{
+    if (!node || node->type != AST_IDENTIFIER) {
+        compiler_error(NULL, "Error: Left hand side of assignment is not a variable\n");
+    }
+    return bc_local(lower, node->id_literal.value);
+}
+
+// Whether evaluating node can change a local, in which case an operand
+// evaluated before it has to be copied out of the local first
+static bool bc_writes_locals(struct ast_node* node)
+{
+    if (!node) {
+        return false;
+    }
+    switch (node->type) {
+        case AST_BINARY_OP:
+            switch (node->binary_op.op) {
+                case OP_ASSIGN:
+                case OP_ADD_ASSIGN:
+                case OP_SUB_ASSIGN:
+                case OP_MUL_ASSIGN:
+                case OP_DIV_ASSIGN:
+                    return true;
+                default:
+                    return bc_writes_locals(node->binary_op.left) || bc_writes_locals(node->binary_op.right);
+            }
+        case AST_UNARY_OP:
+            return node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT ||
+                   bc_writes_locals(node->unary_op.operand);
+        case AST_FUNCTION_CALL:
+            for (int i = 0; i < node->function_call.arg_count; i++) {
+                if (bc_writes_locals(node->function_call.arguments[i])) {
+                    return true;
+                }
+            }
+            return false;
+        default:
+            return false;
+    }
+}
+
+static int bc_lower_expression(struct bc_lower* lower, struct ast_node* node);
+
+// Evaluates the index of the array element node, then value_node, in the
+// generator's order; the index is copied if the value could change it
+static int bc_lower_index(struct bc_lower* lower, struct ast_node* node, struct ast_node* value_node)
+{
+    int index = bc_lower_expression(lower, node->array_access.index);
+    if (bc_writes_locals(value_node)) {
+        int copy = bc_register(lower);
+        bc_emit(lower, BC_MOVE, copy, index, 0);
+        index = copy;
+    }
+    return index;
+}
+
+static void bc_lower_into(struct bc_lower* lower, struct ast_node* node, int reg)
+{
+    int value = bc_lower_expression(lower, node);
+    if (value != reg) {
+        bc_emit(lower, BC_MOVE, reg, value, 0);
+    }
+}
+
+static void bc_patch_jump(struct bc_lower* lower, int jump)
+{
+    struct bc_instruction* instruction = &lower->program->instructions[jump];
+    if (instruction->opcode == BC_JUMP) {
+        instruction->a = lower->program->instruction_count;
+    } else {
+        instruction->b = lower->program->instruction_count;
+    }
+}
+
+static int bc_lower_logical(struct bc_lower* lower, struct ast_node* node)
+{
+    bool is_and = node->binary_op.op == OP_LOGICAL_AND;
+    int result = bc_register(lower);
+    int left = bc_lower_expression(lower, node->binary_op.left);
+    int short_circuit = bc_emit(lower, is_and ? BC_JUMP_ZERO : BC_JUMP_NOT_ZERO, left, 0, 0);
+    int right = bc_lower_expression(lower, node->binary_op.right);
+    int zero = bc_register(lower);
+    bc_emit(lower, BC_LOADK, zero, bc_constant(lower, 0), 0);
+    bc_emit(lower, BC_NE, result, right, zero);
+    int end = bc_emit(lower, BC_JUMP, 0, 0, 0);
+    bc_patch_jump(lower, short_circuit);
+    bc_emit(lower, BC_LOADK, result, bc_constant(lower, is_and ? 0 : 1), 0);
+    bc_patch_jump(lower, end);
+    return result;
+}
+
+// opcode is BC_CALL, or BC_TAIL_CALL for `return f(...)`
+static int bc_lower_call(struct bc_lower* lower, struct ast_node* node, int opcode)
+{
+    int arg_count = node->function_call.arg_count;
+    if (arg_count > BC_MAX_ARGUMENTS) {
+        compiler_error(NULL, "Error: Call to %s passes more than %d arguments\n", node->function_call.name, BC_MAX_ARGUMENTS);
+    }
+    // The arguments go in consecutive registers, the result comes back in
+    // the first one
+    int base = lower->next_register;
+    for (int i = 0; i < (arg_count ? arg_count : 1); i++) {
+        bc_register(lower);
+    }
+    for (int i = 0; i < arg_count; i++) {
+        bc_lower_into(lower, node->function_call.arguments[i], base + i);
+    }
+    bc_emit(lower, opcode, base, bc_function_index(lower->program, node->function_call.name), arg_count);
+    return base;
+}
+
+static const int bc_binary_opcodes[OP_KIND_COUNT] = {
+    [OP_ADD] = BC_ADD, [OP_SUB] = BC_SUB, [OP_MUL] = BC_MUL, [OP_DIV] = BC_DIV, [OP_MOD] = BC_MOD,
+    [OP_BIT_AND] = BC_AND, [OP_BIT_OR] = BC_OR, [OP_BIT_XOR] = BC_XOR, [OP_SHL] = BC_SHL, [OP_SHR] = BC_SHR,
+    [OP_EQ] = BC_EQ, [OP_NE] = BC_NE, [OP_LT] = BC_LT, [OP_LE] = BC_LE, [OP_GT] = BC_GT, [OP_GE] = BC_GE,
+    [OP_ADD_ASSIGN] = BC_ADD, [OP_SUB_ASSIGN] = BC_SUB, [OP_MUL_ASSIGN] = BC_MUL, [OP_DIV_ASSIGN] = BC_DIV
+};
+
+// Returns the register that holds the value of node, which is the local
+// itself for an identifier
+static int bc_lower_expression(struct bc_lower* lower, struct ast_node* node)
+{
+    switch (node->type) {
+        case AST_NUMBER: {
+            int reg = bc_register(lower);
+            bc_emit(lower, BC_LOADK, reg, bc_constant(lower, node->number.value), 0);
+            return reg;
+        }
+        case AST_IDENTIFIER:
+            return bc_local(lower, node->id_literal.value);
+
+        case AST_FUNCTION_CALL:
+            return bc_lower_call(lower, node, BC_CALL);
+
+        case AST_ARRAY_ACCESS: {
+            int array = bc_array(lower, node);
+            int index = bc_lower_expression(lower, node->array_access.index);
+            int reg = bc_register(lower);
+            bc_emit(lower, BC_LOAD_INDEX, reg, array, index);
+            return reg;
+        }
+
+        case AST_UNARY_OP: {
+            int opcode = node->unary_op.op == OP_INCREMENT ? BC_INC : BC_DEC;
+            if ((node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) &&
+                node->unary_op.operand && node->unary_op.operand->type == AST_ARRAY_ACCESS) {
+                struct ast_node* element = node->unary_op.operand;
+                int array = bc_array(lower, element);
+                int index = bc_lower_index(lower, element, NULL);
+                int value = bc_register(lower);
+                bc_emit(lower, BC_LOAD_INDEX, value, array, index);
+                int result = value;
+                if (node->unary_op.is_postfix) {
+                    result = bc_register(lower);
+                    bc_emit(lower, BC_MOVE, result, value, 0);
+                }
+                bc_emit(lower, opcode, value, 0, 0);
+                bc_emit(lower, BC_STORE_INDEX, value, array, index);
+                return result;
+            }
+            if (node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) {
+                int local = bc_lvalue(lower, node->unary_op.operand);
+                int result = local;
+                if (node->unary_op.is_postfix) {
+                    // Postfix forms yield the original value
+                    result = bc_register(lower);
+                    bc_emit(lower, BC_MOVE, result, local, 0);
+                }
+                bc_emit(lower, opcode, local, 0, 0);
+                return result;
+            }
+            int operand = bc_lower_expression(lower, node->unary_op.operand);
+            int result = bc_register(lower);
+            switch (node->unary_op.op) {
+                case OP_SUB: bc_emit(lower, BC_NEG, result, operand, 0); break;
+                case OP_ADD: bc_emit(lower, BC_MOVE, result, operand, 0); break;
+                case OP_BIT_NOT: bc_emit(lower, BC_BIT_NOT, result, operand, 0); break;
+                case OP_NOT: bc_emit(lower, BC_NOT, result, operand, 0); break;
+                default:
+                    compiler_error(NULL, "Error: Unary operator %s is not supported\n", node->unary_op.operator);
+            }
+            return result;
+        }
+
+        case AST_BINARY_OP:
+            break;
+
+        default:
+            compiler_error(NULL, "Error: Expression is not supported by the bytecode backend\n");
+    }
+
+    enum operator_kind op = node->binary_op.op;
+    if (node->binary_op.left && node->binary_op.left->type == AST_ARRAY_ACCESS &&
+        (op == OP_ASSIGN || op == OP_ADD_ASSIGN || op == OP_SUB_ASSIGN || op == OP_MUL_ASSIGN || op == OP_DIV_ASSIGN)) {
+        struct ast_node* element = node->binary_op.left;
+        int array = bc_array(lower, element);
+        int index = bc_lower_index(lower, element, node->binary_op.right);
+        int value = bc_lower_expression(lower, node->binary_op.right);
+        if (op != OP_ASSIGN) {
+            int result = bc_register(lower);
+            bc_emit(lower, BC_LOAD_INDEX, result, array, index);
+            bc_emit(lower, bc_binary_opcodes[op], result, result, value);
+            value = result;
+        }
+        bc_emit(lower, BC_STORE_INDEX, value, array, index);
+        return value;
+    }
+    switch (op) {
+        case OP_ASSIGN: {
+            int local = bc_lvalue(lower, node->binary_op.left);
+            bc_lower_into(lower, node->binary_op.right, local);
+            return local;
+        }
+        case OP_ADD_ASSIGN:
+        case OP_SUB_ASSIGN:
+        case OP_MUL_ASSIGN:
+        case OP_DIV_ASSIGN: {
+            // The right operand is evaluated first, as in the generator
+            int value = bc_lower_expression(lower, node->binary_op.right);
+            int local = bc_lvalue(lower, node->binary_op.left);
+            bc_emit(lower, bc_binary_opcodes[op], local, local, value);
+            return local;
+        }
+        case OP_LOGICAL_AND:
+        case OP_LOGICAL_OR:
+            return bc_lower_logical(lower, node);
+        case OP_COMMA:
+            bc_lower_expression(lower, node->binary_op.left);
+            return bc_lower_expression(lower, node->binary_op.right);
+        default:
+            break;
+    }
+    if (op <= OP_NONE || op >= OP_KIND_COUNT || !bc_binary_opcodes[op]) {
+        compiler_error(NULL, "Error: Operator %s is not supported in expressions\n", node->binary_op.operator);
+    }
+    int left = bc_lower_expression(lower, node->binary_op.left);
+    if (bc_writes_locals(node->binary_op.right)) {
+        int copy = bc_register(lower);
+        bc_emit(lower, BC_MOVE, copy, left, 0);
+        left = copy;
+    }
+    int right = bc_lower_expression(lower, node->binary_op.right);
+    int result = bc_register(lower);
+    bc_emit(lower, bc_binary_opcodes[op], result, left, right);
+    return result;
+}
+
+static void bc_lower_switch(struct bc_lower* lower, struct ast_node* node);
+
+static void bc_lower_statement(struct bc_lower* lower, struct ast_node* node)
+{
+    if (!node) {
+        return;
+    }
+    // Temporaries don't live past the statement that made them
+    int registers = lower->next_register;
+    switch (node->type) {
+        case AST_DECLARATION: {
+            struct ast_node* size = node->declaration.array_size;
+            int length = size ? (int) size->number.value : 0;
+            int local = bc_add_local(lower, node->declaration.name, length);
+            registers = lower->next_register;
+            if (length) {
+                bc_emit(lower, BC_LOADK, local - 1, bc_constant(lower, length), 0);
+                bc_emit(lower, BC_CLEAR, local, length, 0);
+            } else if (node->declaration.initial_value) {
+                bc_lower_into(lower, node->declaration.initial_value, local);
+            } else {
+                bc_emit(lower, BC_LOADK, local, bc_constant(lower, 0), 0);
+            }
+            break;
+        }
+        case AST_BINARY_OP:
+        case AST_UNARY_OP:
+        case AST_FUNCTION_CALL:
+        case AST_ARRAY_ACCESS:
+        case AST_NUMBER:
+        case AST_IDENTIFIER:
+            bc_lower_expression(lower, node);
+            break;
+        case AST_PRINT:
+            bc_emit(lower, BC_PRINT, bc_lower_expression(lower, node->print.expression), 0, 0);
+            break;
+        case AST_BLOCK: {
+            int locals = lower->local_count;
+            for (int i = 0; i < node->block.stmt_count; i++) {
+                bc_lower_statement(lower, node->block.statements[i]);
+            }
+            bc_pop_locals(lower, locals);
+            registers = lower->next_register;
+            break;
+        }
+        case AST_IF_STMT: {
+            int condition = bc_lower_expression(lower, node->if_stmt.condition);
+            int to_else = bc_emit(lower, BC_JUMP_ZERO, condition, 0, 0);
+            lower->next_register = registers;
+            bc_lower_statement(lower, node->if_stmt.true_body);
+            if (node->if_stmt.false_body) {
+                int to_end = bc_emit(lower, BC_JUMP, 0, 0, 0);
+                bc_patch_jump(lower, to_else);
+                bc_lower_statement(lower, node->if_stmt.false_body);
+                bc_patch_jump(lower, to_end);
+            } else {
+                bc_patch_jump(lower, to_else);
+            }
+            registers = lower->next_register;
+            break;
+        }
+        case AST_WHILE:
+        case AST_WHILE_LOOP: {
+            int start = lower->program->instruction_count;
+            int condition = bc_lower_expression(lower, node->while_loop.condition);
+            int to_end = bc_emit(lower, BC_JUMP_ZERO, condition, 0, 0);
+            lower->next_register = registers;
+            bc_lower_statement(lower, node->while_loop.body);
+            bc_emit(lower, BC_JUMP, start, 0, 0);
+            bc_patch_jump(lower, to_end);
+            registers = lower->next_register;
+            break;
+        }
+        case AST_SWITCH:
+            bc_lower_switch(lower, node);
+            // Like a block, its locals stay allocated
+            registers = lower->next_register;
+            break;
+        case AST_BREAK:
+            if (lower->break_count == lower->break_capacity) {
+                lower->break_capacity = lower->break_capacity ? lower->break_capacity * 2 : 16;
+                lower->breaks = realloc(lower->breaks, lower->break_capacity * sizeof(int));
+            }
+            lower->breaks[lower->break_count++] = bc_emit(lower, BC_JUMP, 0, 0, 0);
+            break;
+        case AST_RETURN: {
+            int value;
+            if (node->return_stmt.value && node->return_stmt.value->type == AST_FUNCTION_CALL) {
+                // Like the generator's jumps, so tail recursion doesn't
+                // run out of frames
+                bc_lower_call(lower, node->return_stmt.value, BC_TAIL_CALL);
+                break;
+            }
+            if (node->return_stmt.value) {
+                value = bc_lower_expression(lower, node->return_stmt.value);
+            } else {
+                value = bc_register(lower);
+                bc_emit(lower, BC_LOADK, value, bc_constant(lower, 0), 0);
+            }
+            bc_emit(lower, BC_RETURN, value, 0, 0);
+            break;
+        }
+        default:
+            compiler_error(NULL, "Error: Statement is not supported by the bytecode backend\n");
+    }
+    lower->next_register = registers;
+}
+
+// Dense cases go in a table indexed by value, at constants[b]:
+//   lowest value, table length, default target, one target per value
+// and sparse ones in a table searched by value:
+//   case count, default target, then value and target pairs by value
+// The targets are only known once the body is lowered, so the constants
+// are filled in afterwards
+static void bc_lower_switch(struct bc_lower* lower, struct ast_node* node)
+{
+    struct ast_node* body = node->switch_stmt.body;
+    struct switch_case* cases;
+    int default_statement;
+    int count = switch_cases(node, &cases, &default_statement);
+    bool dense = switch_is_dense(cases, count);
+    compiler_trace(TRACE_LEVEL_DUMP, "Switch over %d cases lowered to a %s\n", count, dense ? "jump table" : "binary search");
+
+    int registers = lower->next_register;
+    int value = bc_lower_expression(lower, node->switch_stmt.value);
+    int table;
+    if (dense) {
+        long long length = cases[count - 1].value - cases[0].value + 1;
+        table = bc_constant(lower, cases[0].value);
+        bc_constant(lower, length);
+        bc_constant(lower, 0);
+        for (long long i = 0; i < length; i++) {
+            bc_constant(lower, -1);
+        }
+    } else {
+        table = bc_constant(lower, count);
+        bc_constant(lower, 0);
+        for (int i = 0; i < count; i++) {
+            bc_constant(lower, cases[i].value);
+            bc_constant(lower, 0);
+        }
+    }
+    bc_emit(lower, dense ? BC_SWITCH : BC_SWITCH_SEARCH, value, table, 0);
+    lower->next_register = registers;
+
+    int* targets = malloc((body->block.stmt_count ? body->block.stmt_count : 1) * sizeof(int));
+    int first_break = lower->break_count;
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        targets[i] = lower->program->instruction_count;
+        if (body->block.statements[i]->type != AST_CASE) {
+            bc_lower_statement(lower, body->block.statements[i]);
+        }
+    }
+    int end = lower->program->instruction_count;
+    for (int i = first_break; i < lower->break_count; i++) {
+        lower->program->instructions[lower->breaks[i]].a = end;
+    }
+    lower->break_count = first_break;
+
+    long long* constants = lower->program->constants + table;
+    long long default_target = default_statement >= 0 ? targets[default_statement] : end;
+    if (dense) {
+        constants[2] = default_target;
+        for (long long i = 0; i < constants[1]; i++) {
+            constants[3 + i] = default_target;
+        }
+        for (int i = 0; i < count; i++) {
+            constants[3 + cases[i].value - constants[0]] = targets[cases[i].statement];
+        }
+    } else {
+        constants[1] = default_target;
+        for (int i = 0; i < count; i++) {
+            constants[3 + 2 * i] = targets[cases[i].statement];
+        }
+    }
+    free(targets);
+    free(cases);
+}
+
+static void bc_lower_function(struct bc_lower* lower, struct ast_node* node)
+{
+    int index = bc_function_index(lower->program, node->function_def.name);
+    struct bc_function* function = &lower->program->functions[index];
+    if (function->defined) {
+        compiler_error(NULL, "Error: Function %s is defined twice\n", node->function_def.name);
+    }
+    function->defined = true;
+    function->entry = lower->program->instruction_count;
+    function->param_count = node->function_def.param_count;
+    lower->function = index;
+    lower->next_register = 0;
+    bc_pop_locals(lower, 0);
+
+    // Parameters are the first locals, the caller's arguments land in them
+    for (int i = 0; i < node->function_def.param_count; i++) {
+        bc_add_local(lower, node->function_def.parameters[i]->id_literal.value, 0);
+    }
+    bc_lower_statement(lower, node->function_def.body);
+    // Falling off the end returns 0
+    int zero = bc_register(lower);
+    bc_emit(lower, BC_LOADK, zero, bc_constant(lower, 0), 0);
+    bc_emit(lower, BC_RETURN, zero, 0, 0);
+}
+
+struct bc_compile {
+    struct bc_lower lower;
+    struct ast_node* root;
+};
+
+static void bc_compile(void* data)
+{
+    struct bc_compile* compile = data;
+    struct ast_node* root = compile->root;
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type != AST_FUNCTION_DEFINITION) {
+            compiler_error(NULL, "Error: Only functions can be defined at the top level\n");
+        }
+        if (statement->function_def.body) {
+            bc_lower_function(&compile->lower, statement);
+        }
+    }
+}
+
+void bytecode_compile(struct ast_node* root, struct bc_program* program)
+{
+    memset(program, 0, sizeof(*program));
+    struct bc_compile compile = { { program }, root };
+    bool compiled = compiler_run_protected(bc_compile, &compile);
+    for (int i = 0; i < compile.lower.local_count; i++) {
+        free(compile.lower.locals[i].name);
+    }
+    free(compile.lower.locals);
+    free(compile.lower.breaks);
+    if (!compiled) {
+        compiler_abort();
+    }
+}
+
+void bytecode_program_free(struct bc_program* program)
+{
+    for (int i = 0; i < program->function_count; i++) {
+        free(program->functions[i].name);
+    }
+    free(program->functions);
+    free(program->instructions);
+    free(program->constants);
+    memset(program, 0, sizeof(*program));
+}
+
+__attribute__((force_align_arg_pointer))
+static long bc_print_int(long value)
+{
+    return printf("%ld\n", value);
+}
+
+// Functions the program calls but doesn't define: the runtime helpers,
+// then the C library, as with ./main --run
+static bool bc_resolve(struct bc_program* program, char* error, size_t error_size)
+{
+    for (int i = 0; i < program->function_count; i++) {
+        struct bc_function* function = &program->functions[i];
+        if (function->defined) {
+            continue;
+        }
+        function->native = strcmp(function->name, "print_int") == 0 ? (void*) bc_print_int : dlsym(RTLD_DEFAULT, function->name);
+        if (!function->native) {
+            snprintf(error, error_size, "undefined reference to %s\n", function->name);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct bc_frame {
+    struct bc_instruction* return_pc;
+    long long* registers;
+    // Caller register that gets the return value
+    long long* result;
+    struct bc_function* function;
+};
+
+bool bytecode_run(struct bc_program* program, const char* entry, int* exit_code, char* error, size_t error_size)
+{
+    static const void* const handlers[BC_OPCODE_COUNT] = {
+        [BC_LOADK] = &&op_loadk, [BC_MOVE] = &&op_move,
+        [BC_ADD] = &&op_add, [BC_SUB] = &&op_sub, [BC_MUL] = &&op_mul, [BC_DIV] = &&op_div, [BC_MOD] = &&op_mod,
+        [BC_AND] = &&op_and, [BC_OR] = &&op_or, [BC_XOR] = &&op_xor, [BC_SHL] = &&op_shl, [BC_SHR] = &&op_shr,
+        [BC_EQ] = &&op_eq, [BC_NE] = &&op_ne, [BC_LT] = &&op_lt, [BC_LE] = &&op_le, [BC_GT] = &&op_gt, [BC_GE] = &&op_ge,
+        [BC_NEG] = &&op_neg, [BC_NOT] = &&op_not, [BC_BIT_NOT] = &&op_bit_not, [BC_INC] = &&op_inc, [BC_DEC] = &&op_dec,
+        [BC_JUMP] = &&op_jump, [BC_JUMP_ZERO] = &&op_jump_zero, [BC_JUMP_NOT_ZERO] = &&op_jump_not_zero,
+        [BC_CALL] = &&op_call, [BC_TAIL_CALL] = &&op_tail_call, [BC_RETURN] = &&op_return, [BC_PRINT] = &&op_print,
+        [BC_CLEAR] = &&op_clear, [BC_LOAD_INDEX] = &&op_load_index, [BC_STORE_INDEX] = &&op_store_index,
+        [BC_SWITCH] = &&op_switch, [BC_SWITCH_SEARCH] = &&op_switch_search
+    };
+
+    int entry_function = -1;
+    for (int i = 0; i < program->function_count; i++) {
+        if (program->functions[i].defined && strcmp(program->functions[i].name, entry) == 0) {
+            entry_function = i;
+        }
+    }
+    if (entry_function < 0) {
+        snprintf(error, error_size, "there is no %s function to run\n", entry);
+        return false;
+    }
+    if (!bc_resolve(program, error, error_size)) {
+        return false;
+    }
+    if (!program->threaded) {
+        for (int i = 0; i < program->instruction_count; i++) {
+            program->instructions[i].handler = handlers[program->instructions[i].opcode];
+        }
+        program->threaded = true;
+    }
+
+    long long* stack = calloc(BC_STACK_REGISTERS, sizeof(long long));
+    struct bc_frame* frames = malloc(BC_STACK_FRAMES * sizeof(struct bc_frame));
+    struct bc_frame* frame = frames;
+    struct bc_function* functions = program->functions;
+    struct bc_instruction* code = program->instructions;
+    const long long* constants = program->constants;
+    long long result = 0;
+    const char* failure = NULL;
+
+    if (functions[entry_function].frame_size > BC_STACK_REGISTERS) {
+        failure = "stack overflow\n";
+        goto done;
+    }
+    frame->return_pc = NULL;
+    frame->registers = stack;
+    frame->result = &result;
+    long long* r = stack;
+    struct bc_instruction* pc = code + functions[entry_function].entry;
+    struct bc_function* current = &functions[entry_function];
+
+#define DISPATCH() goto *pc->handler
+#define NEXT() do { pc++; DISPATCH(); } while (0)
+#define A pc->a
+#define B pc->b
+#define C pc->c
+// Wrapping arithmetic, like the machine code
+#define WRAP(op) (long long) ((unsigned long long) r[B] op (unsigned long long) r[C])
+
+    DISPATCH();
+
+op_loadk:    r[A] = constants[B]; NEXT();
+op_move:     r[A] = r[B]; NEXT();
+op_add:      r[A] = WRAP(+); NEXT();
+op_sub:      r[A] = WRAP(-); NEXT();
+op_mul:      r[A] = WRAP(*); NEXT();
+op_div:
+    // idiv traps on both of these
+    if (r[C] == 0 || (r[B] == LLONG_MIN && r[C] == -1)) {
+        failure = "division by zero or overflow\n";
+        goto done;
+    }
+    r[A] = r[B] / r[C];
+    NEXT();
+op_mod:
+    if (r[C] == 0 || (r[B] == LLONG_MIN && r[C] == -1)) {
+        failure = "division by zero or overflow\n";
+        goto done;
+    }
+    r[A] = r[B] % r[C];
+    NEXT();
+op_and:      r[A] = r[B] & r[C]; NEXT();
+op_or:       r[A] = r[B] | r[C]; NEXT();
+op_xor:      r[A] = r[B] ^ r[C]; NEXT();
+// The shift count is masked to 6 bits, as salq/sarq do
+op_shl:      r[A] = (long long) ((unsigned long long) r[B] << (r[C] & 63)); NEXT();
+op_shr:      r[A] = r[B] >> (r[C] & 63); NEXT();
+op_eq:       r[A] = r[B] == r[C]; NEXT();
+op_ne:       r[A] = r[B] != r[C]; NEXT();
+op_lt:       r[A] = r[B] < r[C]; NEXT();
+op_le:       r[A] = r[B] <= r[C]; NEXT();
+op_gt:       r[A] = r[B] > r[C]; NEXT();
+op_ge:       r[A] = r[B] >= r[C]; NEXT();
+op_neg:      r[A] = (long long) -(unsigned long long) r[B]; NEXT();
+op_not:      r[A] = !r[B]; NEXT();
+op_bit_not:  r[A] = ~r[B]; NEXT();
+op_inc:      r[A] = (long long) ((unsigned long long) r[A] + 1); NEXT();
+op_dec:      r[A] = (long long) ((unsigned long long) r[A] - 1); NEXT();
+op_jump:     pc = code + A; DISPATCH();
+op_jump_zero:
+    if (r[A] == 0) {
+        pc = code + B;
+        DISPATCH();
+    }
+    NEXT();
+op_jump_not_zero:
+    if (r[A] != 0) {
+        pc = code + B;
+        DISPATCH();
+    }
+    NEXT();
+op_call: {
+    struct bc_function* callee = &functions[B];
+    if (!callee->defined) {
+        long long arguments[BC_MAX_ARGUMENTS] = { 0 };
+        for (int i = 0; i < C; i++) {
+            arguments[i] = r[A + i];
+        }
+        long (*native)(long, long, long, long, long, long) = callee->native;
+        r[A] = native(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], arguments[5]);
+        NEXT();
+    }
+    // The callee's frame starts above the caller's, and its parameters are
+    // its first registers
+    long long* registers = r + current->frame_size;
+    if (frame + 1 == frames + BC_STACK_FRAMES || registers + callee->frame_size > stack + BC_STACK_REGISTERS) {
+        failure = "stack overflow\n";
+        goto done;
+    }
+    int arguments = C < callee->param_count ? C : callee->param_count;
+    for (int i = 0; i < arguments; i++) {
+        registers[i] = r[A + i];
+    }
+    for (int i = arguments; i < callee->param_count; i++) {
+        registers[i] = 0;
+    }
+    frame++;
+    frame->return_pc = pc + 1;
+    frame->registers = registers;
+    frame->result = &r[A];
+    frame->function = current;
+    r = registers;
+    current = callee;
+    pc = code + callee->entry;
+    DISPATCH();
+}
+op_tail_call: {
+    struct bc_function* callee = &functions[B];
+    if (!callee->defined) {
+        // Nothing to reuse, call it and return what it returns
+        long long arguments[BC_MAX_ARGUMENTS] = { 0 };
+        for (int i = 0; i < C; i++) {
+            arguments[i] = r[A + i];
+        }
+        long (*native)(long, long, long, long, long, long) = callee->native;
+        r[A] = native(arguments[0], arguments[1], arguments[2], arguments[3], arguments[4], arguments[5]);
+        goto op_return;
+    }
+    // The callee takes over this frame; the arguments are above the
+    // registers they move down to
+    if (r + callee->frame_size > stack + BC_STACK_REGISTERS) {
+        failure = "stack overflow\n";
+        goto done;
+    }
+    int arguments = C < callee->param_count ? C : callee->param_count;
+    for (int i = 0; i < arguments; i++) {
+        r[i] = r[A + i];
+    }
+    for (int i = arguments; i < callee->param_count; i++) {
+        r[i] = 0;
+    }
+    current = callee;
+    pc = code + callee->entry;
+    DISPATCH();
+}
+op_return:
+    *frame->result = r[A];
+    if (frame == frames) {
+        goto done;
+    }
+    pc = frame->return_pc;
+    current = frame->function;
+    frame--;
+    r = frame->registers;
+    DISPATCH();
+op_print:
+    printf("%lld\n", r[A]);
+    NEXT();
+op_clear:
+    memset(&r[A], 0, B * sizeof(long long));
+    NEXT();
+op_load_index:
+    if ((unsigned long long) r[C] >= (unsigned long long) r[B - 1]) {
+        failure = "array index out of bounds\n";
+        goto done;
+    }
+    r[A] = r[B + r[C]];
+    NEXT();
+op_store_index:
+    if ((unsigned long long) r[C] >= (unsigned long long) r[B - 1]) {
+        failure = "array index out of bounds\n";
+        goto done;
+    }
+    r[B + r[C]] = r[A];
+    NEXT();
+op_switch: {
+    const long long* table = constants + B;
+    // Below the lowest value wraps around past the end
+    unsigned long long index = (unsigned long long) r[A] - (unsigned long long) table[0];
+    pc = code + (index < (unsigned long long) table[1] ? table[3 + index] : table[2]);
+    DISPATCH();
+}
+op_switch_search: {
+    const long long* table = constants + B;
+    long long value = r[A];
+    long long low = 0;
+    long long high = table[0];
+    pc = code + table[1];
+    while (low < high) {
+        long long middle = low + (high - low) / 2;
+        long long key = table[2 + 2 * middle];
+        if (key == value) {
+            pc = code + table[3 + 2 * middle];
+            break;
+        }
+        if (key < value) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    DISPATCH();
+}
+
+#undef DISPATCH
+#undef NEXT
+#undef A
+#undef B
+#undef C
+#undef WRAP
+
+done:
+    fflush(stdout);
+    free(stack);
+    free(frames);
+    if (failure) {
+        snprintf(error, error_size, "%s", failure);
+        return false;
+    }
+    *exit_code = (int) result;
+    return true;
+}
@@ -0,0 +1,346 @@
+// On-disk cache of generated assembly.
+//
+// With a cache directory set (./main --cache-dir <dir>) there are two levels:
+//   <dir>/files/<key>.s      whole outputs, keyed by a hash of the input
+//   <dir>/objects/<key>.o    bytes, the compiler build and the compile flags;
+//   <dir>/asts/<key>.ast     assembly, objects from -c and AST files from
+//                            --emit-ast each have their own directory.
+//                            A hit is copied out without lexing at all.
+//   <dir>/functions/<key>.s  the assembly of every function definition, keyed
+//                            by a hash of the function's tokens (and those of
+//                            the functions inlined into it, and the constant
+//                            arguments optimize_calls took out of it and its
+//                            callees), the compiler build and the flags that
+//                            change code generation. An object is assembled
+//                            from the same text, so -c and .s compiles share
+//                            these.
+//                            After a whole-file miss, unchanged functions are
+//                            copied from here instead of being generated
+//                            again.
+// The function level relies on a function's assembly depending on nothing but
+// its own tokens, which is why labels are numbered per function. Entries are
+// renamed into place, so several compilers can share one directory.
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define CACHE_FNV_OFFSET 0xcbf29ce484222325ULL
+#define CACHE_FNV_PRIME 0x100000001b3ULL
+
+static const char* cache_dir = NULL;
+__thread struct cache_stats cache_stats;
+
+void compiler_set_cache_dir(const char* dir)
+{
+    cache_dir = dir;
+}
+
+const char* compiler_cache_dir()
+{
+    return cache_dir;
+}
+
+// 64-bit FNV-1a
+static unsigned long long cache_hash(unsigned long long hash, const void* data, size_t size)
+{
+    const unsigned char* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+// Identifies the compiler that wrote a cache entry. The running executable
+// is hashed along with COMPILER_VERSION, so any rebuild of the compiler
+// invalidates everything it cached before
+unsigned long long compiler_build_id()
+{
+    static unsigned long long build_id = 0;
+    if (build_id) {
+        return build_id;
+    }
+    unsigned long long hash = cache_hash(CACHE_FNV_OFFSET, COMPILER_VERSION, strlen(COMPILER_VERSION));
+    FILE* exe = fopen("/proc/self/exe", "rb");
+    if (exe) {
+        char buffer[65536];
+        size_t size;
+        while ((size = fread(buffer, 1, sizeof(buffer), exe)) > 0) {
+            hash = cache_hash(hash, buffer, size);
+        }
+        fclose(exe);
+    }
+    build_id = hash;
+    return build_id;
+}
+
+// Of the compile flags, the ones that change a function's assembly. What the
+// output is written as doesn't, and profile builds aren't cached at all
+#define CACHE_CODEGEN_FLAGS COMPILE_PROCESS_NO_OPTIMIZE
+
+// Every key covers the compiler build and the flags it was compiled with
+static unsigned long long cache_key_seed(int flags)
+{
+    unsigned long long build_id = compiler_build_id();
+    unsigned long long hash = cache_hash(CACHE_FNV_OFFSET, &build_id, sizeof(build_id));
+    return cache_hash(hash, &flags, sizeof(flags));
+}
+
+// Hashes what the tokens mean, not where they are, so moving a function or
+// editing its comments keeps it cached
+static unsigned long long hash_tokens(unsigned long long hash, struct vector* tokens, struct ast_node* function)
+{
+    for (int i = function->function_def.token_start; i < function->function_def.token_end; i++) {
+        struct token* token = vector_get(tokens, i);
+        if (token->type == TOKEN_TYPE_COMMENT || token->type == TOKEN_TYPE_NEWLINE) {
+            continue;
+        }
+        hash = cache_hash(hash, &token->type, sizeof(token->type));
+        switch (token->type) {
+            case TOKEN_TYPE_IDENTIFIER:
+            case TOKEN_TYPE_KEYWORD:
+            case TOKEN_TYPE_STRING:
+            case TOKEN_TYPE_OPERATOR:
+                // Including the terminator keeps "ab" "c" apart from "a" "bc"
+                hash = cache_hash(hash, token->sval, strlen(token->sval) + 1);
+                break;
+            case TOKEN_TYPE_SYMBOL:
+                hash = cache_hash(hash, &token->cval, sizeof(token->cval));
+                break;
+            case TOKEN_TYPE_NUMBER:
+                hash = cache_hash(hash, &token->llnum, sizeof(token->llnum));
+                break;
+        }
+    }
+    return hash;
+}
+
+// What optimize_calls made of a function besides its tokens: its name,
+// which a clone doesn't share with them, whether it's static, which a
+// prototype may say, and the constants taken out of its parameters
+static unsigned long long hash_specialization(unsigned long long hash, struct ast_node* function)
+{
+    hash = cache_hash(hash, function->function_def.name, strlen(function->function_def.name) + 1);
+    hash = cache_hash(hash, &function->function_def.is_static, sizeof(function->function_def.is_static));
+    for (int i = 0; i < function->function_def.constant_argument_count; i++) {
+        struct ast_node* constant = function->function_def.constant_arguments[i];
+        bool taken = constant != NULL;
+        hash = cache_hash(hash, &taken, sizeof(taken));
+        if (taken) {
+            hash = cache_hash(hash, &constant->number.value, sizeof(constant->number.value));
+        }
+    }
+    return hash;
+}
+
+// A function's key covers the functions inlined into it too, since their
+// bodies are part of its assembly, and the calls optimize_calls changed
+static unsigned long long hash_function_tokens(struct vector* tokens, struct ast_node* function, int flags)
+{
+    unsigned long long hash = hash_tokens(cache_key_seed(flags & CACHE_CODEGEN_FLAGS), tokens, function);
+    for (int i = 0; i < function->function_def.inlined_count; i++) {
+        hash = hash_tokens(hash, tokens, function->function_def.inlined[i]);
+    }
+    hash = hash_specialization(hash, function);
+    for (int i = 0; i < function->function_def.specialized_count; i++) {
+        hash = hash_specialization(hash, function->function_def.specialized[i]);
+    }
+    return hash;
+}
+
+// Where a whole output of a compile with these flags is kept
+static const char* cache_file_kind(int flags)
+{
+    if (flags & COMPILE_PROCESS_EMIT_OBJECT) {
+        return "objects";
+    }
+    if (flags & COMPILE_PROCESS_EMIT_AST) {
+        return "asts";
+    }
+    return "files";
+}
+
+static void cache_entry_path(char* path, size_t size, const char* kind, unsigned long long key)
+{
+    const char* extension = ".s";
+    if (strcmp(kind, "objects") == 0) {
+        extension = ".o";
+    } else if (strcmp(kind, "asts") == 0) {
+        extension = ".ast";
+    }
+    snprintf(path, size, "%s/%s/%016llx%s", cache_dir, kind, key, extension);
+}
+
+// Appends a cached entry to output, false if there is none
+static bool cache_fetch(const char* kind, unsigned long long key, FILE* output)
+{
+    char path[4096];
+    cache_entry_path(path, sizeof(path), kind, key);
+    FILE* entry = fopen(path, "rb");
+    if (!entry) {
+        return false;
+    }
+    char buffer[65536];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), entry)) > 0) {
+        fwrite(buffer, 1, size, output);
+    }
+    fclose(entry);
+    return true;
+}
+
+// Entries are written to a temporary file and renamed into place, so a
+// concurrent reader sees either the whole entry or none at all. A failed store
+// only means a miss next time, so errors are ignored
+static int cache_create_temp(const char* kind, char* temp_path, size_t size)
+{
+    snprintf(temp_path, size, "%s/%s", cache_dir, kind);
+    mkdir(cache_dir, 0755);
+    mkdir(temp_path, 0755);
+    snprintf(temp_path, size, "%s/%s/tmp-XXXXXX", cache_dir, kind);
+    return mkstemp(temp_path);
+}
+
+static void cache_commit_temp(const char* kind, unsigned long long key, const char* temp_path, bool written)
+{
+    char path[4096];
+    cache_entry_path(path, sizeof(path), kind, key);
+    if (!written || rename(temp_path, path) != 0) {
+        unlink(temp_path);
+    }
+}
+
+static void cache_store(const char* kind, unsigned long long key, const char* data, size_t size)
+{
+    char temp_path[4096];
+    int fd = cache_create_temp(kind, temp_path, sizeof(temp_path));
+    if (fd < 0) {
+        return;
+    }
+    bool written = write(fd, data, size) == (ssize_t) size;
+    close(fd);
+    cache_commit_temp(kind, key, temp_path, written);
+}
+
+static unsigned long long hash_file(const char* filename, int flags, bool* ok)
+{
+    unsigned long long hash = cache_key_seed(flags);
+    FILE* input = fopen(filename, "rb");
+    *ok = input != NULL;
+    if (!input) {
+        return hash;
+    }
+    char buffer[65536];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), input)) > 0) {
+        hash = cache_hash(hash, buffer, size);
+    }
+    fclose(input);
+    return hash;
+}
+
+// Writes the cached output for filename to out_filename, false on a miss.
+// The key is handed back for cache_store_file once the output is generated
+bool cache_fetch_file(const char* filename, const char* out_filename, int flags, unsigned long long* key)
+{
+    bool ok;
+    *key = hash_file(filename, flags, &ok);
+    if (!ok) {
+        return false;
+    }
+    const char* kind = cache_file_kind(flags);
+    char path[4096];
+    cache_entry_path(path, sizeof(path), kind, *key);
+    if (access(path, R_OK) != 0) {
+        cache_stats.file_misses++;
+        return false;
+    }
+    // Copied rather than hard-linked: the next compile to out_filename
+    // truncates it in place and would clobber the cache entry too
+    FILE* output = fopen(out_filename, "w");
+    if (!output) {
+        return false;
+    }
+    bool hit = cache_fetch(kind, *key, output);
+    fclose(output);
+    if (hit) {
+        cache_stats.file_hits++;
+    } else {
+        cache_stats.file_misses++;
+    }
+    return hit;
+}
+
+void cache_store_file(unsigned long long key, const char* out_filename, int flags)
+{
+    const char* kind = cache_file_kind(flags);
+    FILE* output = fopen(out_filename, "rb");
+    if (!output) {
+        return;
+    }
+    char temp_path[4096];
+    int fd = cache_create_temp(kind, temp_path, sizeof(temp_path));
+    if (fd < 0) {
+        fclose(output);
+        return;
+    }
+    bool written = true;
+    char buffer[65536];
+    size_t size;
+    while (written && (size = fread(buffer, 1, sizeof(buffer), output)) > 0) {
+        written = write(fd, buffer, size) == (ssize_t) size;
+    }
+    fclose(output);
+    close(fd);
+    cache_commit_temp(kind, key, temp_path, written);
+}
+
+// generate_code for AST_ROOT, taking function definitions from the cache
+// when they haven't changed. Everything else goes through generate_statements,
+// so the misses are generated in parallel with --jobs
+void generate_code_cached(FILE* output, struct ast_node* root, struct vector* tokens, int flags)
+{
+    int count = root->root.stmt_count;
+    struct ast_node** misses = calloc(count, sizeof(struct ast_node*));
+    unsigned long long* keys = calloc(count, sizeof(unsigned long long));
+    char** texts = calloc(count, sizeof(char*));
+    size_t* sizes = calloc(count, sizeof(size_t));
+    for (int i = 0; i < count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type != AST_FUNCTION_DEFINITION || !statement->function_def.body) {
+            misses[i] = statement;
+            continue;
+        }
+        keys[i] = hash_function_tokens(tokens, statement, flags);
+        FILE* buffer = open_memstream(&texts[i], &sizes[i]);
+        bool hit = cache_fetch("functions", keys[i], buffer);
+        fclose(buffer);
+        if (hit) {
+            cache_stats.function_hits++;
+        } else {
+            cache_stats.function_misses++;
+            free(texts[i]);
+            texts[i] = NULL;
+            misses[i] = statement;
+        }
+    }
+
+    generate_statements(misses, count, texts, sizes);
+
+    generate_file_header(output);
+    for (int i = 0; i < count; i++) {
+        fwrite(texts[i], 1, sizes[i], output);
+        if (misses[i] && keys[i]) {
+            cache_store("functions", keys[i], texts[i], sizes[i]);
+        }
+        free(texts[i]);
+    }
+    generate_file_footer(output);
+    free(misses);
+    free(keys);
+    free(texts);
+    free(sizes);
+}
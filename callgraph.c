@@ -0,0 +1,559 @@
+// Call graph of the file: dead static functions and constant arguments.
+//
+// Every call to a function defined in the file is an edge from the function
+// it's in. Functions without static may be called from other files, and
+// main is where the program starts, so those are the roots. A static
+// function no root reaches through the edges can't be called at all, and is
+// dropped. This runs after inlining, so a static helper inlined into every
+// caller goes too.
+//
+// A parameter is then taken out of a function when every call in the file
+// passes it the same constant, or is a recursive call passing the parameter
+// on unchanged. The constant replaces the parameter in the body, or becomes
+// the initial value of a local of the same name when the body assigns to
+// it, and the calls stop passing it:
+//
+//   static int steps(int n, int by) {          static int steps(int n) {
+//       int c = 0;                                 int c = 0;
+//       while (n > 0) { n = n - by; c++; }         while (n > 0) { n = n - 3; c++; }
+//       return c;                                  return c;
+//   }                                          }
+//   steps(x, 3); steps(y, 3);                  steps(x); steps(y);
+//
+// which saves loading the argument and spilling it, and lets the other
+// passes and the generator see the constant (a division by it, say). A
+// function without static may also be called with other arguments from
+// outside the file, so it's kept as it is and a specialized copy, named
+// f.constprop with a dot no identifier in the source can contain, takes the
+// calls in the file instead. The copy makes the output bigger, so it's only
+// made when the function is tiny, or when a constant becomes a divisor,
+// which the generator then divides by without idivq. What was taken out is
+// recorded in function_def.constant_arguments, and the callers'
+// function_def.specialized, for the function cache keys.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Specializing a function can make the arguments of the calls in it
+// constant, for callees that were looked at before it
+#define CALL_GRAPH_MAX_ROUNDS 4
+// Nodes in the body of a function without static that is copied however
+// little the constants save
+#define CALL_GRAPH_MAX_CLONE_NODES 12
+
+struct call_site {
+    struct ast_node* call;
+    // Indexes of the function the call is in and the one it calls
+    int caller;
+    int callee;
+};
+
+struct call_graph_function {
+    struct ast_node* function;
+    // Its calls are sites[first_site, end_site)
+    int first_site;
+    int end_site;
+    bool is_static;
+    bool reachable;
+    // Already specialized, or cloned
+    bool specialized;
+};
+
+struct call_graph {
+    struct call_graph_function* functions;
+    int count;
+    int capacity;
+    struct call_site* sites;
+    int site_count;
+    int site_capacity;
+    // Function name -> index + 1, open addressing
+    int* slots;
+    int slot_count;
+};
+
+static unsigned int call_graph_hash(const char* name)
+{
+    unsigned int hash = 2166136261u;
+    for (; *name; name++) {
+        hash = (hash ^ (unsigned char) *name) * 16777619u;
+    }
+    return hash;
+}
+
+static int* call_graph_slot(struct call_graph* graph, const char* name)
+{
+    unsigned int slot = call_graph_hash(name) & (graph->slot_count - 1);
+    while (graph->slots[slot] &&
+           strcmp(graph->functions[graph->slots[slot] - 1].function->function_def.name, name) != 0) {
+        slot = (slot + 1) & (graph->slot_count - 1);
+    }
+    return &graph->slots[slot];
+}
+
+static void call_graph_collect(struct call_graph* graph, struct ast_node* node, int caller)
+{
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_FUNCTION_CALL) {
+        int callee = *call_graph_slot(graph, node->function_call.name) - 1;
+        if (callee >= 0) {
+            if (graph->site_count == graph->site_capacity) {
+                graph->site_capacity = graph->site_capacity ? graph->site_capacity * 2 : 64;
+                graph->sites = realloc(graph->sites, graph->site_capacity * sizeof(struct call_site));
+            }
+            graph->sites[graph->site_count++] = (struct call_site) { node, caller, callee };
+        }
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            call_graph_collect(graph, (*list)[i], caller);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        call_graph_collect(graph, *slots[i], caller);
+    }
+}
+
+// Adds a function with a body, and the calls in it, to the graph
+static int call_graph_add(struct call_graph* graph, struct ast_node* function)
+{
+    if (graph->count == graph->capacity) {
+        graph->capacity = graph->capacity ? graph->capacity * 2 : 64;
+        graph->functions = realloc(graph->functions, graph->capacity * sizeof(struct call_graph_function));
+    }
+    int index = graph->count++;
+    struct call_graph_function* node = &graph->functions[index];
+    memset(node, 0, sizeof(*node));
+    node->function = function;
+    node->is_static = function->function_def.is_static;
+    int* slot = call_graph_slot(graph, function->function_def.name);
+    if (!*slot) {
+        *slot = index + 1;
+    }
+    return index;
+}
+
+static void call_graph_add_sites(struct call_graph* graph, int index)
+{
+    graph->functions[index].first_site = graph->site_count;
+    call_graph_collect(graph, graph->functions[index].function->function_def.body, index);
+    graph->functions[index].end_site = graph->site_count;
+}
+
+static void call_graph_reach(struct call_graph* graph, int root)
+{
+    int* stack = malloc(graph->count * sizeof(int));
+    int depth = 0;
+    graph->functions[root].reachable = true;
+    stack[depth++] = root;
+    while (depth) {
+        struct call_graph_function* function = &graph->functions[stack[--depth]];
+        for (int i = function->first_site; i < function->end_site; i++) {
+            struct call_graph_function* callee = &graph->functions[graph->sites[i].callee];
+            if (!callee->reachable) {
+                callee->reachable = true;
+                stack[depth++] = graph->sites[i].callee;
+            }
+        }
+    }
+    free(stack);
+}
+
+// Whether node assigns to name, or declares a local that hides it
+static bool call_graph_writes(struct ast_node* node, const char* name)
+{
+    if (!node) {
+        return false;
+    }
+    struct ast_node* target = NULL;
+    switch (node->type) {
+        case AST_DECLARATION:
+            if (strcmp(node->declaration.name, name) == 0) {
+                return true;
+            }
+            break;
+        case AST_UNARY_OP:
+            if (node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) {
+                target = node->unary_op.operand;
+            }
+            break;
+        case AST_BINARY_OP:
+            switch (node->binary_op.op) {
+                case OP_ASSIGN:
+                case OP_ADD_ASSIGN:
+                case OP_SUB_ASSIGN:
+                case OP_MUL_ASSIGN:
+                case OP_DIV_ASSIGN:
+                    target = node->binary_op.left;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+    if (target && target->type == AST_IDENTIFIER && strcmp(target->id_literal.value, name) == 0) {
+        return true;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            if (call_graph_writes((*list)[i], name)) {
+                return true;
+            }
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        if (call_graph_writes(*slots[i], name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Replaces the reads of name under *slot with copies of constant
+static void call_graph_substitute(struct ast_node** slot, const char* name, struct ast_node* constant)
+{
+    struct ast_node* node = *slot;
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_IDENTIFIER && strcmp(node->id_literal.value, name) == 0) {
+        *slot = create_number_node(node->offset, constant->number.value);
+        return;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            call_graph_substitute(&(*list)[i], name, constant);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        call_graph_substitute(slots[i], name, constant);
+    }
+}
+
+static int call_graph_size(struct ast_node* node)
+{
+    if (!node) {
+        return 0;
+    }
+    int size = 1;
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            size += call_graph_size((*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        size += call_graph_size(*slots[i]);
+    }
+    return size;
+}
+
+// Whether node divides by name, or takes a remainder by it
+static bool call_graph_divides_by(struct ast_node* node, const char* name)
+{
+    if (!node) {
+        return false;
+    }
+    if (node->type == AST_BINARY_OP &&
+        (node->binary_op.op == OP_DIV || node->binary_op.op == OP_MOD || node->binary_op.op == OP_DIV_ASSIGN) &&
+        node->binary_op.right && node->binary_op.right->type == AST_IDENTIFIER &&
+        strcmp(node->binary_op.right->id_literal.value, name) == 0) {
+        return true;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            if (call_graph_divides_by((*list)[i], name)) {
+                return true;
+            }
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        if (call_graph_divides_by(*slots[i], name)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Whether a .constprop copy of function is worth its size: a parameter
+// the body writes just becomes a local, which saves nothing
+static bool call_graph_worth_cloning(struct ast_node* function, struct ast_node** constants)
+{
+    struct ast_node* body = function->function_def.body;
+    if (call_graph_size(body) <= CALL_GRAPH_MAX_CLONE_NODES) {
+        return true;
+    }
+    for (int i = 0; i < function->function_def.param_count; i++) {
+        const char* parameter = function->function_def.parameters[i]->id_literal.value;
+        if (constants[i] && divide_by_constant(constants[i]->number.value) && !call_graph_writes(body, parameter) &&
+            call_graph_divides_by(body, parameter)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The constant every call in the file passes to each parameter of the
+// function, or NULL; false if there's none at all
+static bool call_graph_constants(struct call_graph* graph, int index, struct ast_node** constants)
+{
+    struct ast_node* function = graph->functions[index].function;
+    int param_count = function->function_def.param_count;
+    bool any = false;
+    for (int i = 0; i < param_count; i++) {
+        const char* parameter = function->function_def.parameters[i]->id_literal.value;
+        bool passed_on = !call_graph_writes(function->function_def.body, parameter);
+        bool same = true;
+        long long value = 0;
+        constants[i] = NULL;
+        for (int s = 0; s < graph->site_count && same; s++) {
+            struct call_site* site = &graph->sites[s];
+            if (site->callee != index || !graph->functions[site->caller].reachable) {
+                continue;
+            }
+            struct ast_node* argument = site->call->function_call.arguments[i];
+            long long constant;
+            if (ast_constant(argument, &constant)) {
+                same = !constants[i] || constant == value;
+                value = constant;
+                constants[i] = argument;
+            } else {
+                same = site->caller == index && passed_on && argument->type == AST_IDENTIFIER &&
+                       strcmp(argument->id_literal.value, parameter) == 0;
+            }
+        }
+        if (!same || !constants[i]) {
+            constants[i] = NULL;
+            continue;
+        }
+        constants[i] = create_number_node(constants[i]->offset, value);
+        any = true;
+    }
+    return any;
+}
+
+static void call_graph_record(struct ast_node* caller, struct ast_node* callee)
+{
+    for (int i = 0; i < caller->function_def.specialized_count; i++) {
+        if (caller->function_def.specialized[i] == callee) {
+            return;
+        }
+    }
+    caller->function_def.specialized =
+        ast_node_list_append(caller->function_def.specialized, caller->function_def.specialized_count++, callee);
+}
+
+// Points call at function, without the constant arguments
+static void call_graph_redirect(struct ast_node* call, struct ast_node* function, struct ast_node** constants,
+                                int param_count)
+{
+    struct ast_node** arguments = NULL;
+    int arg_count = 0;
+    for (int i = 0; i < param_count; i++) {
+        if (!constants[i]) {
+            arguments = ast_node_list_append(arguments, arg_count++, call->function_call.arguments[i]);
+        }
+    }
+    call->function_call.name = function->function_def.name;
+    call->function_call.arguments = arguments;
+    call->function_call.arg_count = arg_count;
+}
+
+// Takes the constant parameters out of function
+static void call_graph_specialize(struct ast_node* function, struct ast_node** constants)
+{
+    struct ast_node* body = function->function_def.body;
+    struct ast_node** parameters = NULL;
+    int param_count = 0;
+    struct ast_node** statements = NULL;
+    int stmt_count = 0;
+    for (int i = 0; i < function->function_def.param_count; i++) {
+        struct ast_node* parameter = function->function_def.parameters[i];
+        if (!constants[i]) {
+            parameters = ast_node_list_append(parameters, param_count++, parameter);
+        } else if (call_graph_writes(body, parameter->id_literal.value)) {
+            struct ast_node* local = create_declaration_node(parameter->offset, "int", parameter->id_literal.value,
+                                                             create_number_node(parameter->offset,
+                                                                                constants[i]->number.value));
+            statements = ast_node_list_append(statements, stmt_count++, local);
+        } else {
+            call_graph_substitute(&function->function_def.body, parameter->id_literal.value, constants[i]);
+        }
+    }
+    // The locals go first, where the parameters were
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        statements = ast_node_list_append(statements, stmt_count++, body->block.statements[i]);
+    }
+    body->block.statements = statements;
+    body->block.stmt_count = stmt_count;
+
+    function->function_def.constant_arguments = constants;
+    function->function_def.constant_argument_count = function->function_def.param_count;
+    function->function_def.parameters = parameters;
+    function->function_def.param_count = param_count;
+}
+
+// A static copy of the function at index, after it in the file, for the
+// calls in the file to take
+static int call_graph_clone(struct call_graph* graph, struct ast_node* root, int index)
+{
+    struct ast_node* function = graph->functions[index].function;
+    struct ast_node* clone = ast_copy(function);
+    char* name = ast_arena_alloc(strlen(function->function_def.name) + sizeof(".constprop"));
+    sprintf(name, "%s.constprop", function->function_def.name);
+    clone->function_def.name = name;
+    clone->function_def.is_static = true;
+    clone->function_def.specialized = NULL;
+    clone->function_def.specialized_count = 0;
+    for (int i = 0; i < function->function_def.specialized_count; i++) {
+        call_graph_record(clone, function->function_def.specialized[i]);
+    }
+
+    struct ast_node** statements = NULL;
+    int count = 0;
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        statements = ast_node_list_append(statements, count++, root->root.statements[i]);
+        if (root->root.statements[i] == function) {
+            statements = ast_node_list_append(statements, count++, clone);
+        }
+    }
+    root->root.statements = statements;
+    root->root.stmt_count = count;
+
+    int clone_index = call_graph_add(graph, clone);
+    graph->functions[clone_index].reachable = true;
+    graph->functions[clone_index].specialized = true;
+    call_graph_add_sites(graph, clone_index);
+    return clone_index;
+}
+
+static bool call_graph_propagate(struct call_graph* graph, struct ast_node* root, int index)
+{
+    struct call_graph_function* node = &graph->functions[index];
+    struct ast_node* function = node->function;
+    int param_count = function->function_def.param_count;
+    if (node->specialized || !node->reachable || !param_count || strcmp(function->function_def.name, "main") == 0 || function->function_def.body->type != AST_BLOCK) {
+        return false;
+    }
+    int call_count = 0;
+    for (int s = 0; s < graph->site_count; s++) {
+        struct call_site* site = &graph->sites[s];
+        if (site->callee == index && graph->functions[site->caller].reachable) {
+            if (site->call->function_call.arg_count != param_count) {
+                return false;
+            }
+            call_count++;
+        }
+    }
+    struct ast_node** constants = ast_arena_alloc(param_count * sizeof(struct ast_node*));
+    if (!call_count || !call_graph_constants(graph, index, constants) ||
+        (!node->is_static && !call_graph_worth_cloning(function, constants))) {
+        return false;
+    }
+    node->specialized = true;
+
+    // Calls in the original stay as they are when there's a clone
+    int target = node->is_static ? index : call_graph_clone(graph, root, index);
+    struct ast_node* specialized = graph->functions[target].function;
+    call_graph_specialize(specialized, constants);
+    for (int s = 0; s < graph->site_count; s++) {
+        struct call_site* site = &graph->sites[s];
+        if (!graph->functions[site->caller].reachable || (site->caller == index && target != index)) {
+            continue;
+        }
+        if (site->callee == index) {
+            call_graph_redirect(site->call, specialized, constants, param_count);
+            site->callee = target;
+            call_graph_record(graph->functions[site->caller].function, specialized);
+        }
+    }
+    return true;
+}
+
+void optimize_calls(struct ast_node* root)
+{
+    struct call_graph graph = { 0 };
+    graph.slot_count = 16;
+    while (graph.slot_count < root->root.stmt_count * 4) {
+        graph.slot_count *= 2;
+    }
+    graph.slots = calloc(graph.slot_count, sizeof(int));
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.body &&
+            !*call_graph_slot(&graph, statement->function_def.name)) {
+            call_graph_add(&graph, statement);
+        }
+    }
+    // A prototype saying static makes the definition static too
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.is_static) {
+            int index = *call_graph_slot(&graph, statement->function_def.name) - 1;
+            if (index >= 0) {
+                graph.functions[index].is_static = true;
+                graph.functions[index].function->function_def.is_static = true;
+            }
+        }
+    }
+    for (int i = 0; i < graph.count; i++) {
+        call_graph_add_sites(&graph, i);
+    }
+
+    for (int i = 0; i < graph.count; i++) {
+        struct call_graph_function* function = &graph.functions[i];
+        bool root_function = !function->is_static || strcmp(function->function->function_def.name, "main") == 0;
+        if (root_function && !function->reachable) {
+            call_graph_reach(&graph, i);
+        }
+    }
+    int kept = 0;
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.body) {
+            int index = *call_graph_slot(&graph, statement->function_def.name) - 1;
+            if (graph.functions[index].function == statement && !graph.functions[index].reachable) {
+                continue;
+            }
+        }
+        root->root.statements[kept++] = statement;
+    }
+    root->root.stmt_count = kept;
+
+    for (int round = 0; round < CALL_GRAPH_MAX_ROUNDS; round++) {
+        bool changed = false;
+        // Clones added on the way are specialized already
+        int count = graph.count;
+        for (int i = 0; i < count; i++) {
+            changed = call_graph_propagate(&graph, root, i) || changed;
+        }
+        if (!changed) {
+            break;
+        }
+    }
+    free(graph.functions);
+    free(graph.sites);
+    free(graph.slots);
+}
@@ -1,6 +1,51 @@
 //this will contain some core compielr routines
 #include "compiler.h"
 #include "./helpers/vector.h"
+#include <stdlib.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef COMPILER_TRACE
+int compiler_trace_level = TRACE_LEVEL_NONE;
+#endif
+
+void compiler_trace_init()
+{
+#ifdef COMPILER_TRACE
+    const char* level = getenv("COMPILER_TRACE");
+    compiler_trace_level = level ? atoi(level) : TRACE_LEVEL_NONE;
+#endif
+}
+
+void compiler_trace_token(const char* what, struct token* token)
+{
+    if (!token) {
+        printf("%s: (null)\n", what);
+        return;
+    }
+    printf("%s at offset %d : ", what, token->offset);
+    switch (token->type) {
+        case TOKEN_TYPE_COMMENT:
+        case TOKEN_TYPE_IDENTIFIER:
+        case TOKEN_TYPE_KEYWORD:
+        case TOKEN_TYPE_STRING:
+        case TOKEN_TYPE_OPERATOR:
+            printf("%s\n", token->sval);
+            break;
+        case TOKEN_TYPE_SYMBOL:
+            printf("%c\n", token->cval);
+            break;
+        case TOKEN_TYPE_NEWLINE:
+            printf("newline encountered\n");
+            break;
+        case TOKEN_TYPE_NUMBER:
+            printf("%lld\n", token->llnum);
+            break;
+        default:
+            printf("unknown token type %d\n", token->type);
+    }
+}
 
 
 struct lex_process_functions compiler_lex_functions = {
@@ -15,49 +60,130 @@ struct parse_process_functions parse_process_functions =
     .peek_token= peek_next_token,
     
 };
-int compile_file(const char* filename, const char* out_filename, int flags)
+// Where compiler_error() unwinds to. Set for the duration of compile_file,
+// so a bad input fails that compile instead of exiting the whole process
+static __thread jmp_buf* compile_recover = NULL;
+
+void compiler_abort()
 {
-    struct compile_process* process =  compile_process_create(filename, out_filename, flags);
-    if(!process)
-    {
-        return COMPILER_FAILED_WITH_ERRORS;
+    if (compile_recover) {
+        longjmp(*compile_recover, 1);
     }
+    exit(COMPILER_FAILED_WITH_ERRORS);
+}
 
-    //perform lexical analysis
-    struct lex_process* lex_process=  lex_process_create(process, &compiler_lex_functions, NULL);
+// Runs function with a recovery point of its own, for code that must not
+// unwind past it (compile_file, and code generation worker threads, which
+// have no compile_file of their own to return to). False on a compiler_error
+bool compiler_run_protected(void (*function)(void* data), void* data)
+{
+    jmp_buf recover;
+    jmp_buf* previous_recover = compile_recover;
+    compile_recover = &recover;
+    volatile bool completed = false;
+    if (setjmp(recover) == 0) {
+        function(data);
+        completed = true;
+    }
+    compile_recover = previous_recover;
+    return completed;
+}
 
-    if (!lex_process) {
-        return COMPILER_FAILED_WITH_ERRORS;
+// The cache keys don't cover the profile file, whose counts change the code
+static bool compile_process_cacheable(int flags)
+{
+    return compiler_cache_dir() && !(flags & (COMPILE_PROCESS_PROFILE_GENERATE | COMPILE_PROCESS_PROFILE_USE));
+}
+
+static void compile_process_generate(struct compile_process* process, FILE* output)
+{
+    // The function cache is keyed by tokens, which an AST file doesn't have
+    if (compile_process_cacheable(process->flags) && process->token_vec) {
+        generate_code_cached(output, process->ast, process->token_vec, process->flags);
+        compiler_trace(TRACE_LEVEL_PHASE, "function cache: %d hits, %d misses\n",
+                       cache_stats.function_hits, cache_stats.function_misses);
+    } else {
+        generate_code(output, process->ast);
     }
-    if (lex(lex_process) != LEXICAL_ANALYSIS_ALL_OK) {
-        return COMPILER_FAILED_WITH_ERRORS;
+}
+
+struct generate_run {
+    struct compile_process* process;
+    FILE* output;
+    char* assembly;
+    size_t assembly_size;
+};
+
+static void generate_run(void* data)
+{
+    struct generate_run* run = data;
+    compile_process_generate(run->process, run->output);
+}
+
+// Generates the assembly into memory and assembles it into object
+static void compile_process_assemble(struct compile_process* process, struct asm_object* object)
+{
+    struct generate_run run = { process, NULL, NULL, 0 };
+    run.output = open_memstream(&run.assembly, &run.assembly_size);
+    bool generated = compiler_run_protected(generate_run, &run);
+    fclose(run.output);
+    if (!generated) {
+        free(run.assembly);
+        compiler_abort();
     }
-    int count = 0;
-    process -> token_vec = lex_process -> token_vec;
-    printf("size of vector in compile file %d\n", (vector_total(process->token_vec)));
-    for(int i = 0 ;i <  lex_process -> token_vec -> total; i++)
-    {
-        struct token * token =vector_get(lex_process -> token_vec, i);
-        printf("token at %d %d : ", token->pos.line, token->pos.col);
-        if(token -> type == TOKEN_TYPE_COMMENT|| token -> type == TOKEN_TYPE_IDENTIFIER || token-> type == TOKEN_TYPE_KEYWORD|| token -> type == TOKEN_TYPE_STRING || token->type == TOKEN_TYPE_OPERATOR ){
-            printf("%s\n", token->sval);
-            count ++;
-        }
-        else if(token -> type == TOKEN_TYPE_SYMBOL)
-        {
-            printf("%c\n", token->cval);
-            count ++;
+
+    char error[256];
+    bool assembled = assemble(run.assembly, run.assembly_size, object, error, sizeof(error));
+    free(run.assembly);
+    if (!assembled) {
+        compiler_error(NULL, "Error: couldn't assemble the generated code, %s", error);
+    }
+}
+
+// Reads the AST from an AST file instead of lexing and parsing; process
+// gets no tokens
+static int compile_process_load_ast(struct compile_process* process)
+{
+    struct flat_ast flat;
+    char error[256];
+    if (!flat_ast_map(process->cfile.fp, &flat, error, sizeof(error))) {
+        compiler_error(NULL, "Error: %s: %s", process->cfile.abs_path, error);
+    }
+    process->ast = ast_unflatten(&flat, &process->ast_arena);
+    compiler_trace(TRACE_LEVEL_PHASE, "Loaded %d AST nodes from %s\n", flat.node_count, process->cfile.abs_path);
+    flat_ast_unmap(&flat);
+    if (compiler_trace_enabled(TRACE_LEVEL_DUMP)) {
+        print_ast(process -> ast);
+    }
+    return COMPILER_FILE_COMPILED_OK;
+}
+
+// Lexes and parses; the tokens and AST are left in process
+static int compile_process_parse(struct compile_process* process)
+{
+    if (flat_ast_is_file(process->cfile.fp)) {
+        return compile_process_load_ast(process);
+    }
+    //perform lexical analysis, split over threads for large inputs
+    if (!lex_parallel(process)) {
+        struct lex_process* lex_process=  lex_process_create(process, &compiler_lex_functions, NULL);
+
+        if (!lex_process) {
+            return COMPILER_FAILED_WITH_ERRORS;
         }
-        else if(token -> type == TOKEN_TYPE_NEWLINE){
-            printf("newline encountered\n");
-            count ++;
+        if (lex(lex_process) != LEXICAL_ANALYSIS_ALL_OK) {
+            return COMPILER_FAILED_WITH_ERRORS;
         }
-        else if(token -> type == TOKEN_TYPE_NUMBER){
-            printf("%lld\n", token->llnum);
-            count ++;
+        process -> token_vec = lex_process -> token_vec;
+        free(lex_process);
+    }
+    compiler_trace(TRACE_LEVEL_PHASE, "size of vector in compile file %d\n", (vector_total(process->token_vec)));
+    if (compiler_trace_enabled(TRACE_LEVEL_DUMP)) {
+        for(int i = 0 ;i <  process -> token_vec -> total; i++)
+        {
+            compiler_trace_token("token", vector_get(process -> token_vec, i));
         }
     }
-    printf("count of tokens printed: %d\n", count);
 
 
     // perform parsing
@@ -71,22 +197,201 @@ int compile_file(const char* filename, const char* out_filename, int flags)
     {
         return PARSER_FAILED_WITH_ERRORS;
     }
-    printf("parserd successfully\n");
-    print_ast(parse_process -> root);
-    // FILE* asm_output = fopen("output.s", "w");
-    // if (!asm_output) {
-    //     fprintf(stderr, "Failed to open output assembly file\n");
-    //     return COMPILER_FAILED_WITH_ERRORS;
-    // }
-  
-    generate_code(process->ofile, parse_process->root);
+    process -> ast = parse_process -> root;
+    free(parse_process);
+    compiler_trace(TRACE_LEVEL_PHASE, "parserd successfully\n");
+    if (compiler_trace_enabled(TRACE_LEVEL_DUMP)) {
+        print_ast(process -> ast);
+    }
+    return COMPILER_FILE_COMPILED_OK;
+}
 
-    fclose(process->ofile);
-    printf("Code generation completed. Assembly written to test.s\n");
+// Lexes, parses and generates code. With COMPILE_PROCESS_EMIT_OBJECT the
+// assembly is assembled in memory into object, and written out as an ELF
+// object if there's an output file. With COMPILE_PROCESS_EMIT_AST the AST
+// is written out instead
+static int compile_process_run(struct compile_process* process, const char* out_filename, int flags, struct asm_object* object)
+{
+    int res = compile_process_parse(process);
+    if (res != COMPILER_FILE_COMPILED_OK) {
+        return res;
+    }
+
+    if (flags & COMPILE_PROCESS_EMIT_AST) {
+        struct flat_ast flat;
+        ast_flatten(process->ast, &flat);
+        bool written = flat_ast_write(process->ofile, &flat);
+        flat_ast_free(&flat);
+        if (!written) {
+            compiler_error(NULL, "Error: couldn't write the AST file %s\n", out_filename);
+        }
+        compiler_trace(TRACE_LEVEL_PHASE, "AST written to %s\n", out_filename);
+        return COMPILER_FILE_COMPILED_OK;
+    }
+
+    // Counters are numbered on the AST as parsed, before any pass changes it
+    if (flags & (COMPILE_PROCESS_PROFILE_GENERATE | COMPILE_PROCESS_PROFILE_USE)) {
+        ast_arena_use(&process->ast_arena);
+        profile_attach(process, flags);
+        ast_arena_use(NULL);
+    }
+
+    if (!(flags & COMPILE_PROCESS_NO_OPTIMIZE)) {
+        ast_arena_use(&process->ast_arena);
+        inline_functions(process->ast);
+        optimize_calls(process->ast);
+        optimize_loops(process->ast);
+        vectorize_loops(process->ast);
+        optimize_frames(process->ast);
+        optimize_jumps(process->ast);
+        ast_arena_use(NULL);
+    }
+
+    //perform code generation.. into memory first when it gets assembled here
+    if (!(flags & COMPILE_PROCESS_EMIT_OBJECT)) {
+        compile_process_generate(process, process->ofile);
+        compiler_trace(TRACE_LEVEL_PHASE, "Code generation completed. Assembly written to %s\n", out_filename);
+        return COMPILER_FILE_COMPILED_OK;
+    }
+
+    compile_process_assemble(process, object);
+    if (!process->ofile) {
+        // compile_and_run takes it from here
+        return COMPILER_FILE_COMPILED_OK;
+    }
+    bool written = elf_write_object(process->ofile, object);
+    asm_object_free(object);
+    if (!written) {
+        compiler_error(NULL, "Error: couldn't write the object file %s\n", out_filename);
+    }
+    compiler_trace(TRACE_LEVEL_PHASE, "Code generation completed. Object written to %s\n", out_filename);
 
     return COMPILER_FILE_COMPILED_OK;
+}
 
-    
-    //perform code generation..
-    return 0;
-}
\ No newline at end of file
+struct compile_run {
+    struct compile_process* process;
+    const char* out_filename;
+    int flags;
+    int res;
+    struct asm_object object;
+};
+
+static void compile_run(void* data)
+{
+    struct compile_run* run = data;
+    run->res = compile_process_run(run->process, run->out_filename, run->flags, &run->object);
+}
+
+int compile_file(const char* filename, const char* out_filename, int flags)
+{
+    compiler_trace_init();
+    unsigned long long cache_key = 0;
+    if (compile_process_cacheable(flags) && out_filename && cache_fetch_file(filename, out_filename, flags, &cache_key)) {
+        compiler_trace(TRACE_LEVEL_PHASE, "%s taken from the cache\n", out_filename);
+        return COMPILER_FILE_COMPILED_OK;
+    }
+    struct compile_process* process =  compile_process_create(filename, out_filename, flags);
+    if(!process)
+    {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    struct compile_run run = { process, out_filename, flags, COMPILER_FAILED_WITH_ERRORS };
+    if (!compiler_run_protected(compile_run, &run)) {
+        run.res = COMPILER_FAILED_WITH_ERRORS;
+    }
+    int res = run.res;
+    compile_process_free(process);
+
+    if (res != COMPILER_FILE_COMPILED_OK) {
+        // Don't leave half an output behind for the build system to pick up,
+        // but only remove a file: -o /dev/null mustn't take the device away
+        struct stat output;
+        if (out_filename && stat(out_filename, &output) == 0 && S_ISREG(output.st_mode)) {
+            unlink(out_filename);
+        }
+        return res;
+    }
+    if (compile_process_cacheable(flags)) {
+        cache_store_file(cache_key, out_filename, flags);
+    }
+    return COMPILER_FILE_COMPILED_OK;
+}
+
+// Compiles filename and runs its main() in this process, without writing
+// any file (./main --run). The program's return value goes to exit_code
+int compile_and_run(const char* filename, int flags, int* exit_code)
+{
+    compiler_trace_init();
+    struct compile_process* process = compile_process_create(filename, NULL, flags | COMPILE_PROCESS_EMIT_OBJECT);
+    if (!process) {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    struct compile_run run = { process, NULL, flags | COMPILE_PROCESS_EMIT_OBJECT, COMPILER_FAILED_WITH_ERRORS };
+    if (!compiler_run_protected(compile_run, &run)) {
+        run.res = COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_process_free(process);
+    if (run.res != COMPILER_FILE_COMPILED_OK) {
+        return run.res;
+    }
+
+    char error[256];
+    bool ran = jit_run(&run.object, "main", exit_code, error, sizeof(error));
+    asm_object_free(&run.object);
+    if (!ran) {
+        FILE* out = compiler_diagnostics ? compiler_diagnostics : stderr;
+        fprintf(out, "Error: %s", error);
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    return COMPILER_FILE_COMPILED_OK;
+}
+
+struct interpret_run {
+    struct compile_process* process;
+    int res;
+    struct bc_program program;
+};
+
+static void interpret_run(void* data)
+{
+    struct interpret_run* run = data;
+    run->res = compile_process_parse(run->process);
+    if (run->res == COMPILER_FILE_COMPILED_OK) {
+        bytecode_compile(run->process->ast, &run->program);
+    }
+}
+
+// Compiles filename to bytecode and interprets its main() (./main
+// --interpret); no assembly, no machine code. The program's return value
+// goes to exit_code
+int compile_and_interpret(const char* filename, int* exit_code)
+{
+    compiler_trace_init();
+    struct compile_process* process = compile_process_create(filename, NULL, 0);
+    if (!process) {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    struct interpret_run run = { process, COMPILER_FAILED_WITH_ERRORS };
+    if (!compiler_run_protected(interpret_run, &run)) {
+        run.res = COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_process_free(process);
+    if (run.res != COMPILER_FILE_COMPILED_OK) {
+        bytecode_program_free(&run.program);
+        return run.res;
+    }
+    compiler_trace(TRACE_LEVEL_PHASE, "Bytecode: %d instructions, %d constants\n",
+                   run.program.instruction_count, run.program.constant_count);
+
+    char error[256];
+    bool ran = bytecode_run(&run.program, "main", exit_code, error, sizeof(error));
+    bytecode_program_free(&run.program);
+    if (!ran) {
+        FILE* out = compiler_diagnostics ? compiler_diagnostics : stderr;
+        fprintf(out, "Error: %s", error);
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    return COMPILER_FILE_COMPILED_OK;
+}
@@ -4,6 +4,8 @@
     #include <stdio.h>
     #include <stdbool.h>
 
+    #define COMPILER_VERSION "0.2.0"
+
     #define NUMERIC_CASE\
         case '0':       \
         case '1':       \
@@ -29,6 +31,7 @@
         case '!':                        \
         case '?':                        \
         case '%':                        \
+        case '|':                        \
         case '<':                        \
         case '>':                      \
         case '='
@@ -49,6 +52,39 @@
 
 
 
+    // Diagnostic tracing. Every call compiles away unless the compiler is
+    // built with -DCOMPILER_TRACE (`make debug`), so release builds do no
+    // formatting work at all. In a debug build the COMPILER_TRACE environment
+    // variable selects how much is printed, e.g. COMPILER_TRACE=3 ./main
+    enum {
+        TRACE_LEVEL_NONE,
+        TRACE_LEVEL_PHASE,  // one line per compiler phase
+        TRACE_LEVEL_DUMP,   // full token and AST dumps
+        TRACE_LEVEL_PARSER  // every token the parser consumes
+    };
+
+    #ifdef COMPILER_TRACE
+    extern int compiler_trace_level;
+    #define compiler_trace_enabled(level) ((level) <= compiler_trace_level)
+    #else
+    #define compiler_trace_enabled(level) 0
+    #endif
+
+    #define compiler_trace(level, ...)               \
+        do {                                         \
+            if (compiler_trace_enabled(level))       \
+                printf(__VA_ARGS__);                 \
+        } while (0)
+
+    #define trace_token(level, what, token)          \
+        do {                                         \
+            if (compiler_trace_enabled(level))       \
+                compiler_trace_token(what, token);   \
+        } while (0)
+
+    // Tokens and AST nodes only keep a byte offset into the input; the line
+    // and column are worked out from it when a diagnostic needs them, see
+    // compile_process_pos
     struct pos {
         int line;
         int col;
@@ -79,7 +115,8 @@
     struct token {
         int type;
         int flags;
-        struct pos pos;
+        // Byte offset of the token's first character
+        int offset;
         // char* value;
         union {
             char cval;
@@ -110,7 +147,8 @@
     void compile_process_push_char(struct lex_process* lex_process, char c);
 
     struct lex_process {
-        struct pos pos;
+        // Byte offset of the next character to be read
+        int offset;
         struct vector* token_vec;
         struct compile_process* compiler;
         int current_expression_count;
@@ -124,9 +162,36 @@
         COMPILER_FAILED_WITH_ERRORS
     };
 
+    // compile_file flags
+    enum {
+        // Write a relocatable ELF object instead of assembly (./main -c)
+        COMPILE_PROCESS_EMIT_OBJECT = 0b00000001,
+        // Write the parsed AST as an AST file instead (./main --emit-ast)
+        COMPILE_PROCESS_EMIT_AST = 0b00000010,
+        // Generate code for the AST as parsed, without the optimization
+        // passes (./main -O0)
+        COMPILE_PROCESS_NO_OPTIMIZE = 0b00000100,
+        // Count branches into the profile file (./main -fprofile-generate),
+        // or optimize with the counts in it (./main -fprofile-use)
+        COMPILE_PROCESS_PROFILE_GENERATE = 0b00001000,
+        COMPILE_PROCESS_PROFILE_USE = 0b00010000
+    };
+
+    // Where the AST of a compile lives: nodes, the names in them and their
+    // child lists are carved out of big blocks, and freed all at once
+    struct ast_arena_block;
+    struct ast_arena {
+        struct ast_arena_block* blocks;
+    };
+
     struct compile_process {
         int flags;
-        struct pos pos;
+        // Byte offset diagnostics point at: the lexer's position while
+        // lexing, then the token the parser last looked at
+        int offset;
+        // Start offset of every line, built on the first compile_process_pos
+        int* line_starts;
+        int line_count;
         struct compile_process_input_file {
             FILE* fp;
             const char* abs_path;
@@ -135,6 +200,7 @@
         int token_vector_count;
         FILE* ofile;
         struct ast_node* ast;
+        struct ast_arena ast_arena;
     };
 
     struct parse_process {
@@ -146,7 +212,8 @@
         int index;
         void* private;
         struct ast_node* root; 
-        
+        // Whether a break here leaves a switch; loops have no break
+        bool in_switch;
     };
 enum ast_node_type {
     AST_PROGRAM,
@@ -181,11 +248,85 @@ enum ast_node_type {
     AST_LITERAL,
     AST_PREPROCESSOR,
     AST_ROOT,
-    AST_PRINT
+    AST_PRINT,
+    AST_SWITCH,
+    AST_CASE,
+    AST_BREAK
+};
+// Operators as classified from operator tokens, see operator_table in token.c.
+// The same kind is used for binary and unary nodes, e.g. OP_SUB on a unary
+// node is negation and OP_MUL is a dereference.
+enum operator_kind {
+    OP_NONE,
+    OP_COMMA,
+    OP_ASSIGN,
+    OP_ADD_ASSIGN,
+    OP_SUB_ASSIGN,
+    OP_MUL_ASSIGN,
+    OP_DIV_ASSIGN,
+    OP_LOGICAL_OR,
+    OP_LOGICAL_AND,
+    OP_BIT_OR,
+    OP_BIT_XOR,
+    OP_BIT_AND,
+    OP_EQ,
+    OP_NE,
+    OP_LT,
+    OP_GT,
+    OP_LE,
+    OP_GE,
+    OP_SHL,
+    OP_SHR,
+    OP_ADD,
+    OP_SUB,
+    OP_MUL,
+    OP_DIV,
+    OP_MOD,
+    OP_NOT,
+    OP_BIT_NOT,
+    OP_INCREMENT,
+    OP_DECREMENT,
+    OP_DOT,
+    OP_ARROW,
+    OP_QUESTION,
+    OP_KIND_COUNT
 };
+
+// Binding powers for the expression parser, loosest first
+enum {
+    PREC_NONE,
+    PREC_COMMA,
+    PREC_ASSIGN,
+    PREC_LOGICAL_OR,
+    PREC_LOGICAL_AND,
+    PREC_BIT_OR,
+    PREC_BIT_XOR,
+    PREC_BIT_AND,
+    PREC_EQUALITY,
+    PREC_RELATIONAL,
+    PREC_SHIFT,
+    PREC_ADDITIVE,
+    PREC_MULTIPLICATIVE,
+    PREC_UNARY,
+    PREC_POSTFIX
+};
+
+struct operator_info {
+    const char* text;
+    int binary_precedence;  // PREC_NONE if it can't be used as a binary operator
+    bool right_assoc;
+    bool prefix;
+    bool postfix;
+};
+
+extern const struct operator_info operator_table[OP_KIND_COUNT];
+enum operator_kind token_operator(struct token* token);
+
+// Nodes are only as large as the union member their type uses (see
+// ast_node_size), so only that member may be touched
 struct ast_node {
     enum ast_node_type type;
-    struct pos pos;
+    int offset;
     union {
         struct {
             struct ast_node** statements;
@@ -195,20 +336,35 @@ struct ast_node {
         struct {
             char* value;
         } id_literal;
+
+        // For numeric literals
+        struct {
+            long long value;
+        } number;
         
         // For binary operations
         struct {
             struct ast_node* left;
             struct ast_node* right;
-            char* operator;
+            const char* operator;
+            enum operator_kind op;
+            // For && and ||, the profile counter of the right operand, or 0
+            int counter;
         } binary_op;
         
         // For unary operations
         struct {
             struct ast_node* operand;
-            char* operator;
+            const char* operator;
+            enum operator_kind op;
             bool is_postfix;
         } unary_op;
+
+        // For array indexing, array[index]
+        struct {
+            struct ast_node* array;
+            struct ast_node* index;
+        } array_access;
         
         // For function calls
         struct {
@@ -222,6 +378,8 @@ struct ast_node {
             char* type;
             char* name;
             struct ast_node* initial_value;
+            // Number of elements of an array, a constant; NULL otherwise
+            struct ast_node* array_size;
         } declaration;
       
         
@@ -230,12 +388,20 @@ struct ast_node {
             struct ast_node* condition;
             struct ast_node* true_body;
             struct ast_node* false_body;
+            // First of the two profile counters, for the true and false
+            // sides, or 0 (see profile.c)
+            int counter;
         } if_stmt;
         
         // For while loops
         struct {
             struct ast_node* condition;
             struct ast_node* body;
+            // Set by vectorize_loops when the generator may run the loop on
+            // vector registers (see vectorize.c)
+            bool vectorize;
+            // Profile counter of the body, or 0
+            int counter;
         } while_loop;
         
         // For for loops
@@ -259,13 +425,59 @@ struct ast_node {
             struct ast_node** parameters;
             int param_count;
             struct ast_node* body;
+            // Declared static, so nothing outside the file can call it
+            bool is_static;
+            // Token vector span [token_start, token_end) of the definition,
+            // used to key the per-function assembly cache
+            int token_start;
+            int token_end;
+            // Functions inlined into this one (see inline.c), whose tokens
+            // the cache key has to cover too
+            struct ast_node** inlined;
+            int inlined_count;
+            // Set by optimize_calls for parameters every call passed the
+            // same constant, which it took out of the function: the
+            // constant by the parameter's original position, NULL for the
+            // ones kept (see callgraph.c)
+            struct ast_node** constant_arguments;
+            int constant_argument_count;
+            // Functions whose constants calls in this one no longer pass,
+            // which the cache key has to cover too
+            struct ast_node** specialized;
+            int specialized_count;
+            // Set by optimize_frames for functions that make no calls,
+            // which address their locals from %rsp instead of setting up
+            // %rbp (see frame.c)
+            bool frameless;
+            // Set by optimize_jumps: the generated code goes through
+            // peephole_function, and loop heads are aligned (see peephole.c)
+            bool peephole;
+            // Profile counter of the calls, or 0, and the profile of the
+            // program when compiling with one
+            int counter;
+            struct profile* profile;
         } function_def;
         struct {
             struct ast_node* value;
+            // Set by optimize_frames when value is a call the function can
+            // jump to instead of calling it and returning
+            bool tail_call;
         }return_stmt;
         struct {
             struct ast_node* expression;
         } print;
+        // For switch statements. body is a block, and the case labels are
+        // statements of it, so cases fall through into the next
+        struct {
+            struct ast_node* value;
+            struct ast_node* body;
+        } switch_stmt;
+        // For case labels: the case value, a number, or NULL for default
+        struct {
+            struct ast_node* value;
+            // Profile counter of the code after the label, or 0
+            int counter;
+        } case_label;
         
        
     };
@@ -273,20 +485,89 @@ struct ast_node {
 
 
 // AST node creation function declarations
-struct ast_node* create_ast_node(enum ast_node_type type, struct pos pos);
-struct ast_node* create_id_literal_node(enum ast_node_type type, struct pos pos, const char* value);
-struct ast_node* create_binary_op_node(struct pos pos, struct ast_node* left, struct ast_node* right, const char* operator);
-struct ast_node* create_unary_op_node(struct pos pos, struct ast_node* operand, const char* operator, bool is_postfix);
-struct ast_node* create_function_call_node(struct pos pos, const char* name, struct ast_node** arguments, int arg_count);
-struct ast_node* create_declaration_node(struct pos pos, const char* type, const char* name, struct ast_node* initial_value);
-struct ast_node* create_if_stmt_node(struct pos pos, struct ast_node* condition, struct ast_node* true_body, struct ast_node* false_body);
-struct ast_node* create_while_loop_node(struct pos pos, struct ast_node* condition, struct ast_node* body);
-struct ast_node* create_for_node(struct pos pos, struct ast_node* init, struct ast_node* condition, struct ast_node* update, struct ast_node* body);
-struct ast_node* create_block_node(struct pos pos);
-struct ast_node* create_function_definition_node(struct pos pos, const char* return_type, const char* name, struct ast_node** parameters, int param_count, struct ast_node* body);
-struct ast_node* create_print_node(struct pos pos, struct ast_node* expression) ;
-
-struct ast_node* create_ast_node_with_value(enum ast_node_type type, const char* value, struct pos pos);
+struct ast_node* create_ast_node(enum ast_node_type type, int offset);
+struct ast_node* create_id_literal_node(enum ast_node_type type, int offset, const char* value);
+struct ast_node* create_number_node(int offset, long long value);
+struct ast_node* create_binary_op_node(int offset, struct ast_node* left, struct ast_node* right, enum operator_kind op);
+struct ast_node* create_unary_op_node(int offset, struct ast_node* operand, enum operator_kind op, bool is_postfix);
+struct ast_node* create_array_access_node(int offset, struct ast_node* array, struct ast_node* index);
+struct ast_node* create_function_call_node(int offset, const char* name, struct ast_node** arguments, int arg_count);
+struct ast_node* create_declaration_node(int offset, const char* type, const char* name, struct ast_node* initial_value);
+struct ast_node* create_if_stmt_node(int offset, struct ast_node* condition, struct ast_node* true_body, struct ast_node* false_body);
+struct ast_node* create_while_loop_node(int offset, struct ast_node* condition, struct ast_node* body);
+struct ast_node* create_for_node(int offset, struct ast_node* init, struct ast_node* condition, struct ast_node* update, struct ast_node* body);
+struct ast_node* create_block_node(int offset);
+struct ast_node* create_function_definition_node(int offset, const char* return_type, const char* name, struct ast_node** parameters, int param_count, struct ast_node* body);
+struct ast_node* create_print_node(int offset, struct ast_node* expression) ;
+
+struct ast_node* create_ast_node_with_value(enum ast_node_type type, const char* value, int offset);
+struct ast_node** ast_node_list_append(struct ast_node** list, int count, struct ast_node* node);
+// Nodes are allocated from the arena set here, per thread, until it's unset
+void ast_arena_use(struct ast_arena* arena);
+void* ast_arena_alloc(size_t size);
+void ast_arena_free(struct ast_arena* arena);
+char* ast_arena_strdup(const char* string);
+// The child fields of a node, for passes that treat all nodes alike: the
+// fixed ones (left/right, condition/body, ...) in order, the list of
+// statements, arguments or parameters if it has one, and its names
+#define AST_MAX_SLOTS 4
+int ast_node_slots(struct ast_node* node, struct ast_node** slots[AST_MAX_SLOTS]);
+bool ast_node_list(struct ast_node* node, struct ast_node**** list, int** count);
+bool ast_constant(struct ast_node* node, long long* value);
+struct ast_node* ast_copy(struct ast_node* node);
+void ast_node_names(struct ast_node* node, char*** name, char*** type_name);
+
+// Flat form of the AST (flat_ast.c): nodes in post-order, names in a
+// string table
+enum {
+    FLAT_NODE_POSTFIX = 1,
+    // Past the FLAT_NODE_SLOT bits
+    FLAT_NODE_STATIC = 1 << (AST_MAX_SLOTS + 1)
+};
+// Set for each fixed child field (left/right, condition/body, ...) that
+// isn't NULL, and so has a subtree before the node
+#define FLAT_NODE_SLOT(i) (1 << ((i) + 1))
+struct flat_node {
+    unsigned char type;     // enum ast_node_type
+    unsigned char op;       // enum operator_kind of operator nodes
+    unsigned short flags;
+    int offset;
+    // Nodes in the subtree, this one included, so the subtree is
+    // [i - size + 1, i]
+    int size;
+    // Children: the list (statements, arguments, parameters) first, then
+    // the fixed fields that are set
+    int count;
+    union {
+        long long value;
+        struct {
+            // Offsets in the string table
+            int name;
+            int type_name;
+        };
+    };
+    // Function definitions only, see function_def
+    int token_start;
+    int token_end;
+};
+struct flat_ast {
+    struct flat_node* nodes;
+    int node_count;
+    char* strings;
+    int strings_size;
+    // Set when nodes and strings point into a mapped AST file
+    void* mapping;
+    size_t mapping_size;
+};
+void ast_flatten(struct ast_node* root, struct flat_ast* flat);
+struct ast_node* ast_unflatten(struct flat_ast* flat, struct ast_arena* arena);
+void flat_ast_free(struct flat_ast* flat);
+// AST files (./main --emit-ast): a versioned header, then the nodes and
+// strings as they are in memory
+bool flat_ast_write(FILE* output, struct flat_ast* flat);
+bool flat_ast_is_file(FILE* input);
+bool flat_ast_map(FILE* input, struct flat_ast* flat, char* error, size_t error_size);
+void flat_ast_unmap(struct flat_ast* flat);
 
 void add_child(struct ast_node* parent, struct ast_node* child);
 
@@ -307,14 +588,32 @@ void add_child(struct ast_node* parent, struct ast_node* child);
     };
 
     int compile_file(const char* filename, const char* out_filename, int flags);
+    int compile_and_run(const char* filename, int flags, int* exit_code);
+    int compile_and_interpret(const char* filename, int* exit_code);
     struct compile_process* compile_process_create(const char* filename, const char* out_filename, int flags);
+    void compile_process_free(struct compile_process* process);
+    struct pos compile_process_pos(struct compile_process* process, int offset);
     struct lex_process* lex_process_create(struct compile_process* compiler, struct lex_process_functions* functions, void* private);
     void lex_process_free(struct lex_process* process);
+    void lex_tokens_free(struct vector* tokens);
+    void compiler_set_lex_threads(int threads);
+    bool lex_parallel(struct compile_process* process);
     void* lex_process_private(struct lex_process* process);
     struct vector* lex_process_token(struct lex_process* process);
     int lex(struct lex_process* process);
-    void compiler_error(struct compile_process* compiler, const char* msg, ...);
+    // Reports to compiler_diagnostics (stderr when NULL) and fails the
+    // current compile_file; see compiler_abort
+    __attribute__((noreturn)) void compiler_error(struct compile_process* compiler, const char* msg, ...);
+    __attribute__((noreturn)) void compiler_abort();
+    bool compiler_run_protected(void (*function)(void* data), void* data);
+    extern __thread FILE* compiler_diagnostics;
+    // What diagnostics call the input when not the path it's opened by, NULL
+    // otherwise: the compile server opens the absolute path a client sends
+    // and reports the name the client was given
+    extern __thread const char* compiler_input_name;
     void compiler_warning(struct compile_process* compiler, const char* msg, ...);
+    void compiler_trace_init();
+    void compiler_trace_token(const char* what, struct token* token);
     bool is_token_keyword(struct token* token, char* keyword);
     struct ast_node* parse_expression(struct parse_process* parser);
     struct ast_node* parse_statement(struct parse_process* parser);
@@ -322,7 +621,6 @@ void add_child(struct ast_node* parent, struct ast_node* child);
     struct ast_node* parse_function_definition(struct parse_process* parser);
     void parse_process_expect(struct parse_process* parser, int token_type, const char* value);
     int parse_process_match(struct parse_process* parser, int token_type, const char* value);
-    void free_ast_node(struct ast_node* node);
     struct ast_node* parse(struct parse_process* parser);
    void print_ast(struct ast_node* root);
 
@@ -337,9 +635,182 @@ void add_child(struct ast_node* parent, struct ast_node* child);
     struct ast_node* parse_program(struct parse_process* process);
     struct ast_node* parse_print_statement(struct parse_process* parser);
     void generate_code(FILE* output, struct ast_node* root);
+    void generate_file_header(FILE* output);
+    void generate_file_footer(FILE* output);
+    void compiler_set_codegen_threads(int threads);
+    void generate_statements(struct ast_node** statements, int count, char** texts, size_t* sizes);
+
+    // On-disk assembly cache (cache.c), off unless a cache directory is set
+    struct cache_stats {
+        int file_hits;
+        int file_misses;
+        int function_hits;
+        int function_misses;
+    };
+    extern __thread struct cache_stats cache_stats;
+    void compiler_set_cache_dir(const char* dir);
+    const char* compiler_cache_dir();
+    unsigned long long compiler_build_id();
+    bool cache_fetch_file(const char* filename, const char* out_filename, int flags, unsigned long long* key);
+    void cache_store_file(unsigned long long key, const char* out_filename, int flags);
+    void generate_code_cached(FILE* output, struct ast_node* root, struct vector* tokens, int flags);
+
+    // AST optimization passes, run between parsing and code generation
+    // unless compiling with -O0
+    void inline_functions(struct ast_node* root);
+    void optimize_calls(struct ast_node* root);
+    void optimize_loops(struct ast_node* root);
+    void vectorize_loops(struct ast_node* root);
+    void optimize_frames(struct ast_node* root);
+    void optimize_jumps(struct ast_node* root);
+    // Rewrites the assembly of a function to take fewer jumps, into output
+    void peephole_function(FILE* output, char* text, size_t size);
+    // Aligns the head of a loop in functions optimize_jumps marked
+    void generate_loop_alignment(FILE* output);
+    // Emits the vector part of a loop vectorize_loops marked (vectorize.c)
+    void generate_vector_loop(FILE* output, struct ast_node* loop);
+
+    // Switch statements (switch.c): the cases of a switch in order of
+    // value, whether they're dense enough for a jump table, and the code
+    // for the whole statement
+    struct switch_case {
+        long long value;
+        // Index of the case label in the switch body
+        int statement;
+    };
+    int switch_cases(struct ast_node* node, struct switch_case** cases, int* default_statement);
+    bool switch_is_dense(struct switch_case* cases, int count);
+    void generate_switch(FILE* output, struct ast_node* node);
+    void generate_break(FILE* output);
+    // Division and remainder by constants without idivq (divide.c), for
+    // the divisors divide_by_constant accepts
+    bool divide_by_constant(long long divisor);
+    void generate_divide_constant(FILE* output, long long divisor, bool remainder);
+    // Profile-guided optimization (profile.c): counters numbered over the
+    // AST after parsing, the code that counts into them, and the counts
+    // read back from the profile file
+    struct profile {
+        // Counters, numbered after the header of the file, and a checksum
+        // of what they count, which the file has to match
+        int counter_count;
+        unsigned long long checksum;
+        // With -fprofile-use, the whole file; counters index it
+        long long* counts;
+        // With -fprofile-generate, the file the program writes
+        const char* path;
+    };
+    void compiler_set_profile_path(const char* path);
+    const char* compiler_profile_path();
+    void profile_attach(struct compile_process* process, int flags);
+    bool profile_if_counts(struct profile* profile, struct ast_node* node, long long counts[2]);
+    // How often the code in *slot of node ran when node ran count times,
+    // or -1 without a profile
+    long long profile_slot_count(struct profile* profile, struct ast_node* node, struct ast_node** slot, long long count);
+    void generate_profile_counters(FILE* output, struct ast_node* root);
+    void generate_profile_counter(FILE* output, struct profile* profile, int counter);
+    void generate_profile_writer(FILE* output, struct profile* profile);
+
+    // In-process assembler (assembler.c) for the assembly the generator
+    // writes, and the ELF object writer (elf.c) for its output
+    enum {
+        // R_X86_64_PC32, for sym(%rip) operands
+        ASM_RELOCATION_PC32 = 2,
+        // R_X86_64_PLT32
+        ASM_RELOCATION_PLT32 = 4
+    };
+    struct asm_symbol {
+        char* name;
+        // Offset in .text, or in .bss for a .comm symbol, once defined
+        size_t offset;
+        bool defined;
+        bool bss;
+        bool global;
+        bool function;
+        // .L labels, which don't go in the symbol table
+        bool local_label;
+    };
+    struct asm_relocation {
+        // Offset in .text of the field to patch
+        size_t offset;
+        int symbol;
+        int type;
+        long long addend;
+    };
+    struct asm_object {
+        unsigned char* text;
+        size_t text_size;
+        // The largest .p2align, which the section must be aligned to for
+        // the padding to mean anything; 0 when there's none
+        size_t text_align;
+        // .bss takes no space in the object, only its size is kept
+        size_t bss_size;
+        struct asm_symbol* symbols;
+        int symbol_count;
+        int symbol_capacity;
+        // Sorted by offset
+        struct asm_relocation* relocations;
+        int relocation_count;
+        int relocation_capacity;
+        // From the .file directive
+        char* file_name;
+    };
+    // False with a message in error when source uses something the
+    // assembler doesn't know
+    bool assemble(const char* source, size_t size, struct asm_object* object, char* error, size_t error_size);
+    void asm_object_free(struct asm_object* object);
+    bool elf_write_object(FILE* output, struct asm_object* object);
+    // Runs entry() of an assembled program in this process (jit.c)
+    bool jit_run(struct asm_object* object, const char* entry, int* exit_code, char* error, size_t error_size);
+
+    // Bytecode backend and its interpreter (bytecode.c)
+    struct bc_instruction {
+        // The opcode until the program first runs, then the address of
+        // its handler in the interpreter
+        union {
+            int opcode;
+            const void* handler;
+        };
+        int a;
+        int b;
+        int c;
+    };
+    struct bc_function {
+        char* name;
+        // Index of the first instruction
+        int entry;
+        int param_count;
+        // Registers used: locals first, then temporaries
+        int frame_size;
+        bool defined;
+        // For functions the program only calls, resolved when it runs
+        void* native;
+    };
+    struct bc_program {
+        struct bc_instruction* instructions;
+        int instruction_count;
+        int instruction_capacity;
+        long long* constants;
+        int constant_count;
+        int constant_capacity;
+        struct bc_function* functions;
+        int function_count;
+        int function_capacity;
+        bool threaded;
+    };
+    void bytecode_compile(struct ast_node* root, struct bc_program* program);
+    void bytecode_program_free(struct bc_program* program);
+    bool bytecode_run(struct bc_program* program, const char* entry, int* exit_code, char* error, size_t error_size);
+
+    // Compile server (server.c): compile_file on a pool of warm threads
+    // behind a Unix socket, and the client side that replaces ./main runs
+    int compile_server_run(const char* socket_path, int threads);
+    int compile_client_run(const char* socket_path, const char* filename, const char* out_filename, int flags, long long* elapsed_us);
     // Helper functions
     int count_local_variables(struct ast_node* node);
     int get_variable_offset(const char* name);
+    int get_array_offset(const char* name);
+    const char* local_address(int offset, const char* index);
+    char* generate_label();
 
     // Internal functions (you may choose to keep these private)
     void generate_expression(FILE* output, struct ast_node* node);
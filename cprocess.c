@@ -2,8 +2,12 @@
 #include <stdlib.h>
 #include "compiler.h"
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "./helpers/vector.h"
 
+__thread const char* compiler_input_name = NULL;
+
 struct compile_process* compile_process_create(const char* filename, const char* out_filename, int flags) {
     FILE *file = fopen(filename, "r");
     if (!file) {
@@ -17,6 +21,7 @@ struct compile_process* compile_process_create(const char* filename, const char*
         out_file = fopen(out_filename, "w");
         if (!out_file) {
             // printf("couldn't open output file, check path\n"); //debug statement
+            fclose(file);
             return NULL;
         }
     }
@@ -26,21 +31,88 @@ struct compile_process* compile_process_create(const char* filename, const char*
     process->flags = flags;
     process->cfile.fp = file;
     process->ofile = out_file;
+    process->cfile.abs_path = compiler_input_name ? compiler_input_name : filename;
     process->token_vector_count++;
 
     return process;
 }
 
-char compile_process_next_char(struct lex_process* lex_process) {
-    struct compile_process* compiler = lex_process->compiler;
-    compiler->pos.col += 1;
-    char c = getc(compiler->cfile.fp);
-    if (c == '\n') {
-        compiler->pos.line += 1;
-        compiler->pos.col = 1;
+void compile_process_free(struct compile_process* process) {
+    if (process->cfile.fp) {
+        fclose(process->cfile.fp);
     }
+    if (process->ofile) {
+        fclose(process->ofile);
+    }
+    if (process->token_vec) {
+        lex_tokens_free(process->token_vec);
+        vector_free(process->token_vec);
+    }
+    ast_arena_free(&process->ast_arena);
+    free(process->line_starts);
+    free(process);
+}
 
-    return c;
+// Records the offset every line starts at. memchr is vectorized by libc, so
+// this costs about as much as reading the file once
+static void compile_process_index_lines(struct compile_process* process)
+{
+    int capacity = 1024;
+    process->line_starts = malloc(capacity * sizeof(int));
+    process->line_starts[0] = 0;
+    process->line_count = 1;
+
+    struct stat st;
+    int fd = fileno(process->cfile.fp);
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        return;
+    }
+    const char* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return;
+    }
+    const char* end = data + st.st_size;
+    const char* newline = data;
+    while ((newline = memchr(newline, '\n', end - newline)) != NULL) {
+        newline++;
+        if (process->line_count == capacity) {
+            capacity *= 2;
+            process->line_starts = realloc(process->line_starts, capacity * sizeof(int));
+        }
+        process->line_starts[process->line_count++] = newline - data;
+    }
+    munmap((void*) data, st.st_size);
+}
+
+// Line and column of a byte offset in the input, both counted from 1. Tokens
+// only carry their offset, and the line index is built the first time a
+// diagnostic asks for a position
+struct pos compile_process_pos(struct compile_process* process, int offset)
+{
+    if (!process->line_starts) {
+        compile_process_index_lines(process);
+    }
+    // The last line that starts at or before offset
+    int low = 0;
+    int high = process->line_count - 1;
+    while (low < high) {
+        int middle = (low + high + 1) / 2;
+        if (process->line_starts[middle] <= offset) {
+            low = middle;
+        } else {
+            high = middle - 1;
+        }
+    }
+    struct pos pos;
+    pos.line = low + 1;
+    pos.col = offset - process->line_starts[low] + 1;
+    pos.filename = process->cfile.abs_path;
+    return pos;
+}
+
+char compile_process_next_char(struct lex_process* lex_process) {
+    struct compile_process* compiler = lex_process->compiler;
+    return getc(compiler->cfile.fp);
 }
 
 char compile_process_peek_char(struct lex_process* lex_process) {
@@ -81,15 +153,23 @@ struct token* get_curr_token(struct parse_process* parser)
 // }
 
 struct token* get_next_token(struct parse_process* parser) {
-    if (parser->index < parser->token_vector_count) {
-        return vector_get(parser->token_vector, parser->index++);
+    struct token* token = peek_next_token(parser);
+    if (token) {
+        parser->index++;
     }
-    return NULL;
+    return token;
 }
 
+// Comments carry no meaning for the parser, so peeking steps over them
 struct token* peek_next_token(struct parse_process* parser) {
-    if (parser->index < parser->token_vector_count) {
-        return vector_get(parser->token_vector, parser->index);
+    while (parser->index < parser->token_vector_count) {
+        struct token* token = vector_get(parser->token_vector, parser->index);
+        if (token->type != TOKEN_TYPE_COMMENT) {
+            // Parser diagnostics point at the token it's looking at
+            parser->compiler->offset = token->offset;
+            return token;
+        }
+        parser->index++;
     }
     return NULL;
 }
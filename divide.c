@@ -0,0 +1,154 @@
+// Division and remainder by constants.
+//
+// idivq takes tens of cycles. Dividing by a constant c can be done with a
+// multiply instead (Granlund and Montgomery, as worked out in Hacker's
+// Delight, chapter 10): for a magic number m close to 2^(64+s)/c, the high
+// half of x * m, shifted right by s, is x / c rounded towards minus
+// infinity, and adding one when it is negative rounds it towards zero
+// like idivq does. When m doesn't fit in a signed word, x is added to
+// the high half to make up for it.
+//
+//     movq $m, %rdx; imulq %rdx           high half of x * m in %rdx
+//     [addq %rcx, %rdx]; sarq $s, %rdx
+//     movq %rdx, %rax; shrq $63, %rax; addq %rdx, %rax
+//
+// A power of two 2^k only needs x biased by 2^k - 1 when it is negative,
+// and an arithmetic shift:
+//
+//     movq %rax, %rdx; sarq $63, %rdx; shrq $(64 - k), %rdx
+//     addq %rdx, %rax; sarq $k, %rax
+//
+// and the remainder is x less the biased x with the low k bits cleared.
+// Other remainders are x - (x / c) * c. Every value is a signed 64-bit
+// integer in this language, so there's no unsigned division to do.
+//
+// Dividing by 0 or -1 is left to idivq, so the traps on x / 0 and on the
+// most negative number / -1 stay where they were.
+#include "compiler.h"
+
+struct divide_magic {
+    long long multiplier;
+    int shift;
+};
+
+// Hacker's Delight, figure 10-1, for 64-bit words. divisor is not 0, 1 or -1
+static struct divide_magic divide_magic(long long divisor)
+{
+    const unsigned long long two63 = 1ULL << 63;
+    unsigned long long absolute = divisor < 0 ? -(unsigned long long) divisor : (unsigned long long) divisor;
+    unsigned long long t = two63 + ((unsigned long long) divisor >> 63);
+    // Largest value whose remainder by the divisor is divisor - 1
+    unsigned long long limit = t - 1 - t % absolute;
+    int p = 63;
+    unsigned long long q1 = two63 / limit;
+    unsigned long long r1 = two63 - q1 * limit;
+    unsigned long long q2 = two63 / absolute;
+    unsigned long long r2 = two63 - q2 * absolute;
+    unsigned long long delta;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= limit) {
+            q1++;
+            r1 -= limit;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= absolute) {
+            q2++;
+            r2 -= absolute;
+        }
+        delta = absolute - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    struct divide_magic magic;
+    magic.multiplier = (long long) (q2 + 1);
+    if (divisor < 0) {
+        magic.multiplier = (long long) -(unsigned long long) magic.multiplier;
+    }
+    magic.shift = p - 64;
+    return magic;
+}
+
+bool divide_by_constant(long long divisor)
+{
+    return divisor != 0 && divisor != -1;
+}
+
+// 2^k is the magnitude of divisor, or -1 if that isn't a power of two
+static int divide_power_of_two(long long divisor)
+{
+    unsigned long long absolute = divisor < 0 ? -(unsigned long long) divisor : (unsigned long long) divisor;
+    if (absolute & (absolute - 1)) {
+        return -1;
+    }
+    return __builtin_ctzll(absolute);
+}
+
+// %rax = %rax / divisor, or %rax % divisor, as idivq would give them, for a
+// divisor divide_by_constant accepts. Uses %rcx and %rdx
+void generate_divide_constant(FILE* output, long long divisor, bool remainder)
+{
+    int k = divide_power_of_two(divisor);
+    if (k == 0) {
+        // Dividing by 1
+        if (remainder) {
+            fprintf(output, "\tmovq $0, %%rax\n");
+        }
+        return;
+    }
+    if (k > 0) {
+        if (remainder) {
+            fprintf(output, "\tmovq %%rax, %%rcx\n");
+        }
+        fprintf(output, "\tmovq %%rax, %%rdx\n");
+        fprintf(output, "\tsarq $63, %%rdx\n");
+        fprintf(output, "\tshrq $%d, %%rdx\n", 64 - k);
+        fprintf(output, "\taddq %%rdx, %%rax\n");
+        if (remainder) {
+            // The remainder has the sign of x whatever the sign of the
+            // divisor
+            if (k < 32) {
+                fprintf(output, "\tandq $%lld, %%rax\n", -(1LL << k));
+            } else {
+                fprintf(output, "\tsarq $%d, %%rax\n", k);
+                fprintf(output, "\tsalq $%d, %%rax\n", k);
+            }
+            fprintf(output, "\tsubq %%rax, %%rcx\n");
+            fprintf(output, "\tmovq %%rcx, %%rax\n");
+            return;
+        }
+        fprintf(output, "\tsarq $%d, %%rax\n", k);
+        if (divisor < 0) {
+            fprintf(output, "\tnegq %%rax\n");
+        }
+        return;
+    }
+
+    struct divide_magic magic = divide_magic(divisor);
+    fprintf(output, "\tmovq %%rax, %%rcx\n");
+    fprintf(output, "\tmovq $%lld, %%rdx\n", magic.multiplier);
+    fprintf(output, "\timulq %%rdx\n");
+    if (divisor > 0 && magic.multiplier < 0) {
+        fprintf(output, "\taddq %%rcx, %%rdx\n");
+    } else if (divisor < 0 && magic.multiplier > 0) {
+        fprintf(output, "\tsubq %%rcx, %%rdx\n");
+    }
+    if (magic.shift) {
+        fprintf(output, "\tsarq $%d, %%rdx\n", magic.shift);
+    }
+    fprintf(output, "\tmovq %%rdx, %%rax\n");
+    fprintf(output, "\tshrq $63, %%rax\n");
+    fprintf(output, "\taddq %%rdx, %%rax\n");
+    if (remainder) {
+        if (divisor >= -2147483648LL && divisor <= 2147483647LL) {
+            fprintf(output, "\timulq $%lld, %%rax, %%rax\n", divisor);
+        } else {
+            fprintf(output, "\tmovq $%lld, %%rdx\n", divisor);
+            fprintf(output, "\timulq %%rdx, %%rax\n");
+        }
+        fprintf(output, "\tsubq %%rax, %%rcx\n");
+        fprintf(output, "\tmovq %%rcx, %%rax\n");
+    }
+}
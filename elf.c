@@ -0,0 +1,223 @@
+// Writes the output of assemble() as a relocatable ELF64 x86-64 object:
+//
+//   .text            the machine code
+//   .rela.text       its relocations: calls into other symbols, and
+//                    sym(%rip) operands
+//   .bss             zeroed data from .comm, which takes no space in the file
+//   .note.GNU-stack  empty, marks the stack as non-executable
+//   .symtab          the file, the .text and .bss sections, then locals
+//                    before globals
+//   .strtab          symbol names
+//   .shstrtab        section names
+//
+// .L labels are resolved by the assembler and left out, like `as` does.
+#include "compiler.h"
+#include <elf.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum {
+    ELF_SECTION_NULL,
+    ELF_SECTION_TEXT,
+    ELF_SECTION_RELA_TEXT,
+    ELF_SECTION_BSS,
+    ELF_SECTION_NOTE_GNU_STACK,
+    ELF_SECTION_SYMTAB,
+    ELF_SECTION_STRTAB,
+    ELF_SECTION_SHSTRTAB,
+    ELF_SECTION_COUNT
+};
+
+struct elf_strings {
+    char* data;
+    size_t size;
+    size_t capacity;
+};
+
+static Elf64_Word elf_string(struct elf_strings* strings, const char* string)
+{
+    size_t length = strlen(string) + 1;
+    if (strings->size + length > strings->capacity) {
+        strings->capacity = (strings->size + length) * 2;
+        strings->data = realloc(strings->data, strings->capacity);
+    }
+    Elf64_Word offset = strings->size;
+    memcpy(strings->data + strings->size, string, length);
+    strings->size += length;
+    return offset;
+}
+
+static size_t elf_align(size_t offset, size_t alignment)
+{
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+static void elf_pad(FILE* output, size_t* written, size_t offset)
+{
+    while (*written < offset) {
+        fputc(0, output);
+        (*written)++;
+    }
+}
+
+static void elf_write(FILE* output, size_t* written, const void* data, size_t size)
+{
+    fwrite(data, 1, size, output);
+    *written += size;
+}
+
+static Elf64_Sym elf_symbol(struct elf_strings* strings, struct asm_symbol* symbol)
+{
+    Elf64_Sym elf_symbol = { 0 };
+    elf_symbol.st_name = elf_string(strings, symbol->name);
+    int type = symbol->function ? STT_FUNC : symbol->bss ? STT_OBJECT : STT_NOTYPE;
+    elf_symbol.st_info = ELF64_ST_INFO(symbol->global || !symbol->defined ? STB_GLOBAL : STB_LOCAL, type);
+    elf_symbol.st_shndx = !symbol->defined ? SHN_UNDEF : symbol->bss ? ELF_SECTION_BSS : ELF_SECTION_TEXT;
+    elf_symbol.st_value = symbol->defined ? symbol->offset : 0;
+    return elf_symbol;
+}
+
+bool elf_write_object(FILE* output, struct asm_object* object)
+{
+    struct elf_strings strings = { 0 };
+    struct elf_strings section_names = { 0 };
+    elf_string(&strings, "");
+    elf_string(&section_names, "");
+
+    // Locals first, globals after them; sh_info is the first global
+    Elf64_Sym* symbols = calloc(object->symbol_count + 4, sizeof(Elf64_Sym));
+    int* symbol_indexes = calloc(object->symbol_count ? object->symbol_count : 1, sizeof(int));
+    int symbol_count = 1;
+    if (object->file_name) {
+        symbols[symbol_count].st_name = elf_string(&strings, object->file_name);
+        symbols[symbol_count].st_info = ELF64_ST_INFO(STB_LOCAL, STT_FILE);
+        symbols[symbol_count].st_shndx = SHN_ABS;
+        symbol_count++;
+    }
+    symbols[symbol_count].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    symbols[symbol_count].st_shndx = ELF_SECTION_TEXT;
+    symbol_count++;
+    symbols[symbol_count].st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION);
+    symbols[symbol_count].st_shndx = ELF_SECTION_BSS;
+    symbol_count++;
+    int first_global = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        bool globals = pass == 1;
+        if (globals) {
+            first_global = symbol_count;
+        }
+        for (int i = 0; i < object->symbol_count; i++) {
+            struct asm_symbol* symbol = &object->symbols[i];
+            if (symbol->local_label || (symbol->global || !symbol->defined) != globals) {
+                continue;
+            }
+            symbol_indexes[i] = symbol_count;
+            symbols[symbol_count++] = elf_symbol(&strings, symbol);
+        }
+    }
+
+    Elf64_Rela* relocations = calloc(object->relocation_count ? object->relocation_count : 1, sizeof(Elf64_Rela));
+    for (int i = 0; i < object->relocation_count; i++) {
+        struct asm_relocation* relocation = &object->relocations[i];
+        relocations[i].r_offset = relocation->offset;
+        relocations[i].r_info = ELF64_R_INFO(symbol_indexes[relocation->symbol], relocation->type);
+        relocations[i].r_addend = relocation->addend;
+    }
+
+    Elf64_Shdr sections[ELF_SECTION_COUNT] = { 0 };
+    sections[ELF_SECTION_TEXT].sh_name = elf_string(&section_names, ".text");
+    sections[ELF_SECTION_TEXT].sh_type = SHT_PROGBITS;
+    sections[ELF_SECTION_TEXT].sh_flags = SHF_ALLOC | SHF_EXECINSTR;
+    sections[ELF_SECTION_TEXT].sh_size = object->text_size;
+    sections[ELF_SECTION_TEXT].sh_addralign = object->text_align ? object->text_align : 1;
+
+    sections[ELF_SECTION_RELA_TEXT].sh_name = elf_string(&section_names, ".rela.text");
+    sections[ELF_SECTION_RELA_TEXT].sh_type = SHT_RELA;
+    sections[ELF_SECTION_RELA_TEXT].sh_flags = SHF_INFO_LINK;
+    sections[ELF_SECTION_RELA_TEXT].sh_size = object->relocation_count * sizeof(Elf64_Rela);
+    sections[ELF_SECTION_RELA_TEXT].sh_link = ELF_SECTION_SYMTAB;
+    sections[ELF_SECTION_RELA_TEXT].sh_info = ELF_SECTION_TEXT;
+    sections[ELF_SECTION_RELA_TEXT].sh_addralign = 8;
+    sections[ELF_SECTION_RELA_TEXT].sh_entsize = sizeof(Elf64_Rela);
+
+    sections[ELF_SECTION_BSS].sh_name = elf_string(&section_names, ".bss");
+    sections[ELF_SECTION_BSS].sh_type = SHT_NOBITS;
+    sections[ELF_SECTION_BSS].sh_flags = SHF_ALLOC | SHF_WRITE;
+    sections[ELF_SECTION_BSS].sh_size = object->bss_size;
+    sections[ELF_SECTION_BSS].sh_addralign = 8;
+
+    sections[ELF_SECTION_NOTE_GNU_STACK].sh_name = elf_string(&section_names, ".note.GNU-stack");
+    sections[ELF_SECTION_NOTE_GNU_STACK].sh_type = SHT_PROGBITS;
+    sections[ELF_SECTION_NOTE_GNU_STACK].sh_addralign = 1;
+
+    sections[ELF_SECTION_SYMTAB].sh_name = elf_string(&section_names, ".symtab");
+    sections[ELF_SECTION_SYMTAB].sh_type = SHT_SYMTAB;
+    sections[ELF_SECTION_SYMTAB].sh_size = symbol_count * sizeof(Elf64_Sym);
+    sections[ELF_SECTION_SYMTAB].sh_link = ELF_SECTION_STRTAB;
+    sections[ELF_SECTION_SYMTAB].sh_info = first_global;
+    sections[ELF_SECTION_SYMTAB].sh_addralign = 8;
+    sections[ELF_SECTION_SYMTAB].sh_entsize = sizeof(Elf64_Sym);
+
+    sections[ELF_SECTION_STRTAB].sh_name = elf_string(&section_names, ".strtab");
+    sections[ELF_SECTION_STRTAB].sh_type = SHT_STRTAB;
+    sections[ELF_SECTION_STRTAB].sh_size = strings.size;
+    sections[ELF_SECTION_STRTAB].sh_addralign = 1;
+
+    sections[ELF_SECTION_SHSTRTAB].sh_name = elf_string(&section_names, ".shstrtab");
+    sections[ELF_SECTION_SHSTRTAB].sh_type = SHT_STRTAB;
+    sections[ELF_SECTION_SHSTRTAB].sh_size = section_names.size;
+    sections[ELF_SECTION_SHSTRTAB].sh_addralign = 1;
+
+    // Section contents follow the ELF header in section order, each at its
+    // alignment, and the section header table comes last
+    size_t offset = sizeof(Elf64_Ehdr);
+    for (int i = 1; i < ELF_SECTION_COUNT; i++) {
+        offset = elf_align(offset, sections[i].sh_addralign);
+        sections[i].sh_offset = offset;
+        if (sections[i].sh_type != SHT_NOBITS) {
+            offset += sections[i].sh_size;
+        }
+    }
+    size_t section_headers = elf_align(offset, 8);
+
+    Elf64_Ehdr header = { 0 };
+    memcpy(header.e_ident, ELFMAG, SELFMAG);
+    header.e_ident[EI_CLASS] = ELFCLASS64;
+    header.e_ident[EI_DATA] = ELFDATA2LSB;
+    header.e_ident[EI_VERSION] = EV_CURRENT;
+    header.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    header.e_type = ET_REL;
+    header.e_machine = EM_X86_64;
+    header.e_version = EV_CURRENT;
+    header.e_shoff = section_headers;
+    header.e_ehsize = sizeof(Elf64_Ehdr);
+    header.e_shentsize = sizeof(Elf64_Shdr);
+    header.e_shnum = ELF_SECTION_COUNT;
+    header.e_shstrndx = ELF_SECTION_SHSTRTAB;
+
+    const void* contents[ELF_SECTION_COUNT] = {
+        [ELF_SECTION_TEXT] = object->text,
+        [ELF_SECTION_RELA_TEXT] = relocations,
+        [ELF_SECTION_SYMTAB] = symbols,
+        [ELF_SECTION_STRTAB] = strings.data,
+        [ELF_SECTION_SHSTRTAB] = section_names.data
+    };
+    size_t written = 0;
+    elf_write(output, &written, &header, sizeof(header));
+    for (int i = 1; i < ELF_SECTION_COUNT; i++) {
+        if (sections[i].sh_type == SHT_NOBITS) {
+            continue;
+        }
+        elf_pad(output, &written, sections[i].sh_offset);
+        elf_write(output, &written, contents[i], sections[i].sh_size);
+    }
+    elf_pad(output, &written, section_headers);
+    elf_write(output, &written, sections, sizeof(sections));
+
+    free(symbols);
+    free(symbol_indexes);
+    free(relocations);
+    free(strings.data);
+    free(section_names.data);
+    return !ferror(output);
+}
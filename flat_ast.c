@@ -0,0 +1,460 @@
+// Flat form of the AST: every node in one array, in post-order.
+//
+// A node's children come right before it, each as a contiguous subtree, so
+// node i's subtree is [i - size + 1, i] and its last child is i - 1. Passes
+// that only need to see every node (counting, searching, per-function
+// summaries) are a loop over the array, and rebuilding the pointer tree is a
+// single pass with a stack of finished children. Names are offsets into one
+// string table, so the whole thing is two flat buffers that can be written
+// out and read back as they are.
+//
+// On disk (./main --emit-ast) that's a struct flat_ast_header, the nodes,
+// then the strings. Readers map the file and use it in place.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+struct flat_builder {
+    struct flat_ast* flat;
+    // Open addressing over string table offsets, to store each name once
+    int* interned;
+    int interned_capacity;
+    int interned_count;
+    int string_capacity;
+    int node_capacity;
+};
+
+static unsigned int flat_hash(const char* string)
+{
+    unsigned int hash = 2166136261u;
+    for (; *string; string++) {
+        hash = (hash ^ (unsigned char) *string) * 16777619u;
+    }
+    return hash;
+}
+
+static int flat_add_string(struct flat_builder* builder, const char* string)
+{
+    struct flat_ast* flat = builder->flat;
+    if (builder->interned_count * 2 >= builder->interned_capacity) {
+        int capacity = builder->interned_capacity ? builder->interned_capacity * 2 : 256;
+        int* interned = malloc(capacity * sizeof(int));
+        memset(interned, -1, capacity * sizeof(int));
+        for (int i = 0; i < builder->interned_capacity; i++) {
+            if (builder->interned[i] < 0) {
+                continue;
+            }
+            unsigned int slot = flat_hash(flat->strings + builder->interned[i]) & (capacity - 1);
+            while (interned[slot] >= 0) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            interned[slot] = builder->interned[i];
+        }
+        free(builder->interned);
+        builder->interned = interned;
+        builder->interned_capacity = capacity;
+    }
+
+    unsigned int slot = flat_hash(string) & (builder->interned_capacity - 1);
+    while (builder->interned[slot] >= 0) {
+        if (strcmp(flat->strings + builder->interned[slot], string) == 0) {
+            return builder->interned[slot];
+        }
+        slot = (slot + 1) & (builder->interned_capacity - 1);
+    }
+
+    int length = strlen(string) + 1;
+    if (flat->strings_size + length > builder->string_capacity) {
+        builder->string_capacity = (flat->strings_size + length) * 2;
+        flat->strings = realloc(flat->strings, builder->string_capacity);
+    }
+    int offset = flat->strings_size;
+    memcpy(flat->strings + offset, string, length);
+    flat->strings_size += length;
+    builder->interned[slot] = offset;
+    builder->interned_count++;
+    return offset;
+}
+
+static void flatten_node(struct flat_builder* builder, struct ast_node* node)
+{
+    struct flat_ast* flat = builder->flat;
+    int first = flat->node_count;
+    int count = 0;
+
+    struct ast_node*** list;
+    int* list_count;
+    if (ast_node_list(node, &list, &list_count)) {
+        for (int i = 0; i < *list_count; i++) {
+            flatten_node(builder, (*list)[i]);
+        }
+        count += *list_count;
+    }
+    unsigned short flags = 0;
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        if (*slots[i]) {
+            flatten_node(builder, *slots[i]);
+            flags |= FLAT_NODE_SLOT(i);
+            count++;
+        }
+    }
+
+    if (flat->node_count == builder->node_capacity) {
+        builder->node_capacity = builder->node_capacity ? builder->node_capacity * 2 : 1024;
+        flat->nodes = realloc(flat->nodes, builder->node_capacity * sizeof(struct flat_node));
+    }
+    struct flat_node* flat_node = &flat->nodes[flat->node_count++];
+    memset(flat_node, 0, sizeof(*flat_node));
+    flat_node->type = node->type;
+    flat_node->offset = node->offset;
+    flat_node->size = flat->node_count - first;
+    flat_node->count = count;
+    if (node->type == AST_BINARY_OP) {
+        flat_node->op = node->binary_op.op;
+    } else if (node->type == AST_UNARY_OP) {
+        flat_node->op = node->unary_op.op;
+        if (node->unary_op.is_postfix) {
+            flags |= FLAT_NODE_POSTFIX;
+        }
+    } else if (node->type == AST_NUMBER) {
+        flat_node->value = node->number.value;
+    } else if (node->type == AST_FUNCTION_DEFINITION) {
+        flat_node->token_start = node->function_def.token_start;
+        flat_node->token_end = node->function_def.token_end;
+        if (node->function_def.is_static) {
+            flags |= FLAT_NODE_STATIC;
+        }
+    }
+    flat_node->flags = flags;
+
+    char** name;
+    char** type_name;
+    ast_node_names(node, &name, &type_name);
+    if (name) {
+        flat_node->name = flat_add_string(builder, *name);
+    }
+    if (type_name) {
+        flat_node->type_name = flat_add_string(builder, *type_name);
+    }
+}
+
+void ast_flatten(struct ast_node* root, struct flat_ast* flat)
+{
+    memset(flat, 0, sizeof(*flat));
+    struct flat_builder builder = { flat };
+    if (root) {
+        flatten_node(&builder, root);
+    }
+    free(builder.interned);
+}
+
+// Builds the pointer tree back, in the arena. Children are finished before
+// their parent, so a stack of the finished subtrees is all it takes
+struct ast_node* ast_unflatten(struct flat_ast* flat, struct ast_arena* arena)
+{
+    if (!flat->node_count) {
+        return NULL;
+    }
+    ast_arena_use(arena);
+    struct ast_node** stack = malloc(flat->node_count * sizeof(struct ast_node*));
+    int depth = 0;
+    for (int i = 0; i < flat->node_count; i++) {
+        struct flat_node* flat_node = &flat->nodes[i];
+        struct ast_node* node = create_ast_node(flat_node->type, flat_node->offset);
+        struct ast_node** children = stack + depth - flat_node->count;
+        depth -= flat_node->count;
+
+        struct ast_node** slots[AST_MAX_SLOTS];
+        int slot_count = ast_node_slots(node, slots);
+        int present = 0;
+        for (int s = 0; s < slot_count; s++) {
+            present += (flat_node->flags & FLAT_NODE_SLOT(s)) != 0;
+        }
+        int listed = flat_node->count - present;
+        struct ast_node*** list;
+        int* list_count;
+        if (ast_node_list(node, &list, &list_count) && listed) {
+            *list = ast_arena_alloc(listed * sizeof(struct ast_node*));
+            memcpy(*list, children, listed * sizeof(struct ast_node*));
+            *list_count = listed;
+        }
+        children += listed;
+        for (int s = 0; s < slot_count; s++) {
+            if (flat_node->flags & FLAT_NODE_SLOT(s)) {
+                *slots[s] = *children++;
+            }
+        }
+
+        if (node->type == AST_BINARY_OP) {
+            node->binary_op.op = flat_node->op;
+            node->binary_op.operator = operator_table[flat_node->op].text;
+        } else if (node->type == AST_UNARY_OP) {
+            node->unary_op.op = flat_node->op;
+            node->unary_op.operator = operator_table[flat_node->op].text;
+            node->unary_op.is_postfix = flat_node->flags & FLAT_NODE_POSTFIX;
+        } else if (node->type == AST_NUMBER) {
+            node->number.value = flat_node->value;
+        } else if (node->type == AST_FUNCTION_DEFINITION) {
+            node->function_def.token_start = flat_node->token_start;
+            node->function_def.token_end = flat_node->token_end;
+            node->function_def.is_static = flat_node->flags & FLAT_NODE_STATIC;
+        }
+        char** name;
+        char** type_name;
+        ast_node_names(node, &name, &type_name);
+        if (name) {
+            *name = ast_arena_strdup(flat->strings + flat_node->name);
+        }
+        if (type_name) {
+            *type_name = ast_arena_strdup(flat->strings + flat_node->type_name);
+        }
+        stack[depth++] = node;
+    }
+    struct ast_node* root = stack[depth - 1];
+    free(stack);
+    ast_arena_use(NULL);
+    return root;
+}
+
+void flat_ast_free(struct flat_ast* flat)
+{
+    free(flat->nodes);
+    free(flat->strings);
+    memset(flat, 0, sizeof(*flat));
+}
+
+// Bump FLAT_AST_VERSION whenever struct flat_node, the node types, their
+// children (ast_node_slots) or the operator kinds change; the node size is
+// checked separately
+#define FLAT_AST_MAGIC "CAST"
+#define FLAT_AST_VERSION 4
+
+struct flat_ast_header {
+    char magic[4];
+    unsigned int version;
+    unsigned int node_size;
+    int node_count;
+    int strings_size;
+    int reserved[3];
+};
+
+bool flat_ast_write(FILE* output, struct flat_ast* flat)
+{
+    struct flat_ast_header header = { FLAT_AST_MAGIC, FLAT_AST_VERSION, sizeof(struct flat_node), flat->node_count, flat->strings_size };
+    fwrite(&header, sizeof(header), 1, output);
+    fwrite(flat->nodes, sizeof(struct flat_node), flat->node_count, output);
+    fwrite(flat->strings, 1, flat->strings_size, output);
+    return !ferror(output);
+}
+
+bool flat_ast_is_file(FILE* input)
+{
+    char magic[4];
+    bool is_ast = fread(magic, 1, sizeof(magic), input) == sizeof(magic) && memcmp(magic, FLAT_AST_MAGIC, sizeof(magic)) == 0;
+    rewind(input);
+    return is_ast;
+}
+
+static bool flat_is_expression(int type)
+{
+    switch (type) {
+        case AST_BINARY_OP:
+        case AST_UNARY_OP:
+        case AST_IDENTIFIER:
+        case AST_NUMBER:
+        case AST_LITERAL:
+        case AST_FUNCTION_CALL:
+        case AST_ARRAY_ACCESS:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static bool flat_is_statement(int type)
+{
+    switch (type) {
+        case AST_DECLARATION:
+        case AST_IF_STMT:
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+        case AST_RETURN:
+        case AST_BLOCK:
+        case AST_PRINT:
+        case AST_SWITCH:
+        case AST_CASE:
+        case AST_BREAK:
+            return true;
+        default:
+            // An expression is a statement too, whose value is dropped
+            return flat_is_expression(type);
+    }
+}
+
+// Whether a node of type child may be in the given slot of a node of type
+// parent, or in its list when slot is -1. The generator and the passes
+// take these for granted
+static bool flat_child_valid(int parent, int slot, int child)
+{
+    switch (parent) {
+        case AST_ROOT:
+            return child == AST_FUNCTION_DEFINITION || child == AST_DECLARATION;
+        case AST_PROGRAM:
+        case AST_BLOCK:
+            return flat_is_statement(child);
+        case AST_FUNCTION_DEFINITION:
+            return slot < 0 ? child == AST_VARIABLE : child == AST_BLOCK;
+        case AST_DECLARATION:
+            // The array size is a constant
+            return slot == 0 ? flat_is_expression(child) : child == AST_NUMBER;
+        case AST_IF_STMT:
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+            return slot == 0 ? flat_is_expression(child) : flat_is_statement(child);
+        case AST_FOR:
+            return slot == 1 ? flat_is_expression(child) : flat_is_statement(child);
+        case AST_SWITCH:
+            return slot == 0 ? flat_is_expression(child) : child == AST_BLOCK;
+        case AST_CASE:
+            return child == AST_NUMBER;
+        default:
+            return flat_is_expression(child);
+    }
+}
+
+// Slots a node of type can't do without; the others are optional, like an
+// else, a return value or the body of a prototype
+static bool flat_slot_required(int type, int slot)
+{
+    switch (type) {
+        case AST_BINARY_OP:
+        case AST_UNARY_OP:
+        case AST_ARRAY_ACCESS:
+        case AST_PRINT:
+        case AST_SWITCH:
+            return true;
+        case AST_IF_STMT:
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+            return slot < 2;
+        default:
+            return false;
+    }
+}
+
+// A flat AST from a file has to be checked before it's used: every subtree
+// and name in range, and every node's children there to take and of the
+// kinds its type has. types holds the types of the finished subtrees, as
+// ast_unflatten's stack will hold the subtrees
+static bool flat_ast_valid(struct flat_ast* flat)
+{
+    if (flat->strings_size && flat->strings[flat->strings_size - 1] != 0) {
+        return false;
+    }
+    if (!flat->node_count || flat->nodes[flat->node_count - 1].type != AST_ROOT) {
+        return false;
+    }
+    int* types = malloc(flat->node_count * sizeof(int));
+    int depth = 0;
+    bool valid = true;
+    for (int i = 0; i < flat->node_count && valid; i++) {
+        struct flat_node* node = &flat->nodes[i];
+        if (node->type > AST_BREAK || node->op >= OP_KIND_COUNT || node->size < 1 || node->size > i + 1 ||
+            node->count < 0 || node->count > depth) {
+            valid = false;
+            break;
+        }
+        struct ast_node shape = { .type = node->type };
+        struct ast_node** slots[AST_MAX_SLOTS];
+        int slot_count = ast_node_slots(&shape, slots);
+        int present = 0;
+        for (int s = 0; s < slot_count; s++) {
+            present += (node->flags & FLAT_NODE_SLOT(s)) != 0;
+            if (!(node->flags & FLAT_NODE_SLOT(s)) && flat_slot_required(node->type, s)) {
+                valid = false;
+            }
+        }
+        struct ast_node*** list;
+        int* list_count;
+        if (node->count < present || (!ast_node_list(&shape, &list, &list_count) && node->count != present)) {
+            valid = false;
+            break;
+        }
+        int* children = types + depth - node->count;
+        int listed = node->count - present;
+        for (int c = 0; c < listed; c++) {
+            valid = valid && flat_child_valid(node->type, -1, children[c]);
+        }
+        children += listed;
+        for (int s = 0; s < slot_count; s++) {
+            if (node->flags & FLAT_NODE_SLOT(s)) {
+                valid = valid && flat_child_valid(node->type, s, *children++);
+            }
+        }
+        char** name;
+        char** type_name;
+        ast_node_names(&shape, &name, &type_name);
+        if ((name && (node->name < 0 || node->name >= flat->strings_size)) ||
+            (type_name && (node->type_name < 0 || node->type_name >= flat->strings_size))) {
+            valid = false;
+        }
+        depth -= node->count;
+        types[depth++] = node->type;
+    }
+    free(types);
+    return valid && depth == 1;
+}
+
+// Maps an AST file written by flat_ast_write; flat points into the mapping
+// until flat_ast_unmap
+bool flat_ast_map(FILE* input, struct flat_ast* flat, char* error, size_t error_size)
+{
+    memset(flat, 0, sizeof(*flat));
+    struct stat st;
+    int fd = fileno(input);
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(struct flat_ast_header)) {
+        snprintf(error, error_size, "not an AST file\n");
+        return false;
+    }
+    void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        snprintf(error, error_size, "couldn't map the AST file\n");
+        return false;
+    }
+    struct flat_ast_header* header = data;
+    size_t nodes_size = header->node_count * (size_t) sizeof(struct flat_node);
+    if (memcmp(header->magic, FLAT_AST_MAGIC, sizeof(header->magic)) != 0 || header->version != FLAT_AST_VERSION ||
+        header->node_size != sizeof(struct flat_node)) {
+        snprintf(error, error_size, "AST file is from another version of the compiler\n");
+        munmap(data, st.st_size);
+        return false;
+    }
+    if (header->node_count < 0 || header->strings_size < 0 ||
+        sizeof(*header) + nodes_size + header->strings_size != (size_t) st.st_size) {
+        snprintf(error, error_size, "AST file is truncated\n");
+        munmap(data, st.st_size);
+        return false;
+    }
+    flat->nodes = (struct flat_node*) (header + 1);
+    flat->node_count = header->node_count;
+    flat->strings = (char*) flat->nodes + nodes_size;
+    flat->strings_size = header->strings_size;
+    flat->mapping = data;
+    flat->mapping_size = st.st_size;
+    if (!flat_ast_valid(flat)) {
+        snprintf(error, error_size, "AST file is corrupt\n");
+        flat_ast_unmap(flat);
+        return false;
+    }
+    return true;
+}
+
+void flat_ast_unmap(struct flat_ast* flat)
+{
+    munmap(flat->mapping, flat->mapping_size);
+    memset(flat, 0, sizeof(*flat));
+}
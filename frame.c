@@ -0,0 +1,80 @@
+// Frame and tail call decisions, made once the other passes have settled
+// what each function calls.
+//
+// A function that calls nothing never needs %rbp: nothing below it walks
+// the frame chain and nothing it calls needs the stack aligned. The
+// generator then addresses its locals from %rsp, keeping track of its own
+// pushes, instead of saving and setting up %rbp. Either way the whole
+// frame is reserved with one subq on entry.
+//
+// `return f(...)` in a function that keeps its frame becomes a jump: the
+// arguments are all in registers, so once the frame is torn down the stack
+// is exactly as the caller left it, and f returns straight to it. Recursion
+// through tail calls then runs in constant stack space. A function without a
+// frame makes no calls, so the two never meet.
+#include "compiler.h"
+
+static bool frame_makes_calls(struct ast_node* node)
+{
+    if (!node) {
+        return false;
+    }
+    if (node->type == AST_FUNCTION_CALL) {
+        return true;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            if (frame_makes_calls((*list)[i])) {
+                return true;
+            }
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        if (frame_makes_calls(*slots[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void frame_mark_tail_calls(struct ast_node* node)
+{
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_RETURN) {
+        struct ast_node* value = node->return_stmt.value;
+        node->return_stmt.tail_call = value && value->type == AST_FUNCTION_CALL;
+        return;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            frame_mark_tail_calls((*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        frame_mark_tail_calls(*slots[i]);
+    }
+}
+
+void optimize_frames(struct ast_node* root)
+{
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* function = root->root.statements[i];
+        if (function->type != AST_FUNCTION_DEFINITION || !function->function_def.body) {
+            continue;
+        }
+        function->function_def.frameless = !frame_makes_calls(function->function_def.body);
+        if (!function->function_def.frameless) {
+            frame_mark_tail_calls(function->function_def.body);
+        }
+    }
+}
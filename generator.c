@@ -3,37 +3,137 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
-// Helper function to generate unique labels
-static int label_counter = 0;
-static char* generate_label() {
-    char* label = malloc(20);
-    sprintf(label, "L%d", label_counter++);
+#include <pthread.h>
+
+// Helper function to generate unique labels. Labels are numbered per
+// function and carry its name, so a function's assembly doesn't depend on
+// what was generated before it and can be reused on its own
+static __thread int label_counter = 0;
+static __thread const char* current_function = "";
+char* generate_label() {
+    char* label = malloc(strlen(current_function) + 24);
+    sprintf(label, ".L%s_%d", current_function, label_counter++);
     return label;
 }
 struct symbol {
     char* name;
     int offset;
+    // Number of elements for arrays, whose offset is that of element 0;
+    // 0 for scalars
+    int length;
 };
 
-struct symbol symbol_table[100];  // Adjust size as needed
-int symbol_count = 0;
+// Locals of the function being generated; reset at every function definition.
+// Like the label counter they're per thread, for the compile server
+__thread struct symbol* symbol_table = NULL;
+__thread int symbol_count = 0;
+static __thread int symbol_capacity = 0;
+static __thread int stack_offset = 8;
+// Every function reserves frame_size bytes for its locals on entry, once,
+// whichever paths through it run. Functions optimize_frames marked
+// frameless address them from %rsp, which moves by 8 for each of the
+// push_depth values the generator has pushed and not popped yet
+static __thread bool frameless = false;
+static __thread int frame_size = 0;
+static __thread int push_depth = 0;
+// Profile of the function being generated when compiling with one (see
+// profile.c), and the code of if sides that never ran, which goes after
+// the end of the function
+static __thread struct profile* profile = NULL;
+static __thread FILE* cold_output = NULL;
+static __thread char* cold_text = NULL;
+static __thread size_t cold_size = 0;
+// Code of a function optimize_jumps marked, which goes through
+// peephole_function once it's all there
+static __thread bool peephole = false;
+static __thread FILE* function_output = NULL;
+static __thread char* function_text = NULL;
+static __thread size_t function_size = 0;
+
+// Forgets the symbols declared since the table had count of them. Their
+// stack slots stay taken
+static void pop_symbols(int count) {
+    for (int i = count; i < symbol_count; i++) {
+        free(symbol_table[i].name);
+    }
+    symbol_count = count;
+}
+
+static void reset_symbols() {
+    pop_symbols(0);
+    stack_offset = 8;
+}
 
 void add_symbol(const char* name, int offset) {
+    if (symbol_count == symbol_capacity) {
+        symbol_capacity = symbol_capacity ? symbol_capacity * 2 : 64;
+        symbol_table = realloc(symbol_table, symbol_capacity * sizeof(struct symbol));
+    }
     symbol_table[symbol_count].name = strdup(name);
     symbol_table[symbol_count].offset = offset;
+    symbol_table[symbol_count].length = 0;
     symbol_count++;
 }
 
-int get_variable_offset(const char* name) {
-    for (int i = 0; i < symbol_count; i++) {
+// Newest first, so a declaration in a block hides one outside it
+static struct symbol* find_symbol(const char* name) {
+    for (int i = symbol_count - 1; i >= 0; i--) {
         if (strcmp(symbol_table[i].name, name) == 0) {
-            return symbol_table[i].offset;
+            return &symbol_table[i];
         }
     }
-    fprintf(stderr, "Error: Variable %s not found\n", name);
-    exit(1);
+    compiler_error(NULL, "Error: Variable %s not found\n", name);
+}
+
+int get_variable_offset(const char* name) {
+    struct symbol* symbol = find_symbol(name);
+    if (symbol->length) {
+        compiler_error(NULL, "Error: Array %s is used as a value\n", name);
+    }
+    return symbol->offset;
 }
+
+// Element i of an array is at -offset + 8 * i from %rbp
+int get_array_offset(const char* name) {
+    struct symbol* symbol = find_symbol(name);
+    if (!symbol->length) {
+        compiler_error(NULL, "Error: %s is not an array\n", name);
+    }
+    return symbol->offset;
+}
+// The operand for the local at offset, or for element %index of the array
+// at offset. The text lives until the next call
+const char* local_address(int offset, const char* index) {
+    static __thread char address[64];
+    char base[48];
+    if (frameless) {
+        int displacement = frame_size - offset + 8 * push_depth;
+        if (displacement) {
+            snprintf(base, sizeof(base), "%d(%%rsp", displacement);
+        } else {
+            snprintf(base, sizeof(base), "(%%rsp");
+        }
+    } else {
+        snprintf(base, sizeof(base), "-%d(%%rbp", offset);
+    }
+    if (index) {
+        snprintf(address, sizeof(address), "%s,%s,8)", base, index);
+    } else {
+        snprintf(address, sizeof(address), "%s)", base);
+    }
+    return address;
+}
+
+static void generate_push(FILE* output, const char* reg) {
+    fprintf(output, "\tpushq %s\n", reg);
+    push_depth++;
+}
+
+static void generate_pop(FILE* output, const char* reg) {
+    fprintf(output, "\tpopq %s\n", reg);
+    push_depth--;
+}
+
 // Helper function to get the size of a type
 static int get_type_size(const char* type) {
     if (strcmp(type, "int") == 0) return 8;  // 64-bit integers
@@ -42,118 +142,460 @@ static int get_type_size(const char* type) {
     return 8;  // Default to 8 bytes for 64-bit architecture
 }
 
-void generate_function_prologue(FILE* output, const char* function_name) {
+void generate_function_prologue(FILE* output, const char* function_name, bool global) {
     fprintf(output, "\t.text\n");
-    fprintf(output, "\t.globl %s\n", function_name);
+    if (global) {
+        fprintf(output, "\t.globl %s\n", function_name);
+    }
     fprintf(output, "\t.type %s, @function\n", function_name);
     fprintf(output, "%s:\n", function_name);
-    fprintf(output, "\tpushq %%rbp\n");
-    fprintf(output, "\tmovq %%rsp, %%rbp\n");
+    if (!frameless) {
+        fprintf(output, "\tpushq %%rbp\n");
+        fprintf(output, "\tmovq %%rsp, %%rbp\n");
+    }
+    if (frame_size) {
+        fprintf(output, "\tsubq $%d, %%rsp\n", frame_size);
+    }
 }
 
-void generate_function_epilogue(FILE* output) {
+// Puts the stack back the way the caller left it
+static void generate_frame_teardown(FILE* output) {
+    if (frameless) {
+        if (frame_size) {
+            fprintf(output, "\taddq $%d, %%rsp\n", frame_size);
+        }
+        return;
+    }
     fprintf(output, "\tmovq %%rbp, %%rsp\n");
     fprintf(output, "\tpopq %%rbp\n");
+}
+
+void generate_function_epilogue(FILE* output) {
+    generate_frame_teardown(output);
     fprintf(output, "\tret\n");
 }
 
+// An instrumented main writes the profile before it returns
+static bool generator_writes_profile() {
+    return profile && profile->path && strcmp(current_function, "main") == 0;
+}
+
+static FILE* generator_cold_output() {
+    if (!cold_output) {
+        cold_output = open_memstream(&cold_text, &cold_size);
+    }
+    return cold_output;
+}
+
+// Writes the cold code of the function to output, or drops it when output
+// is NULL
+static void generate_cold_code(FILE* output) {
+    if (!cold_output) {
+        return;
+    }
+    fclose(cold_output);
+    cold_output = NULL;
+    if (output) {
+        fwrite(cold_text, 1, cold_size, output);
+    }
+    free(cold_text);
+    cold_text = NULL;
+}
+
+// Takes the jumps out of the code of the function and writes it to
+// output, or drops it when output is NULL
+static void generate_peephole_code(FILE* output) {
+    if (!function_output) {
+        return;
+    }
+    fclose(function_output);
+    function_output = NULL;
+    if (output) {
+        peephole_function(output, function_text, function_size);
+    }
+    free(function_text);
+    function_text = NULL;
+}
+
+void generate_loop_alignment(FILE* output) {
+    if (peephole) {
+        fprintf(output, "\t.p2align 4\n");
+    }
+}
+
+// Bytes of stack the locals of node take, as the declarations hand them out
+// below
+static int local_size(struct ast_node* node) {
+    if (!node) {
+        return 0;
+    }
+    int size = 0;
+    if (node->type == AST_DECLARATION) {
+        struct ast_node* length = node->declaration.array_size;
+        // At least a whole slot each, since every store is 8 bytes
+        size = length ? 8 * (int) length->number.value : 8;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            size += local_size((*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        size += local_size(*slots[i]);
+    }
+    return size;
+}
+
 void generate_variable_assignment(FILE* output, const char* var_name, int offset, const char* value) {
-    fprintf(output, "\tmovq $%s, -%d(%%rbp)\n", value, offset);
+    fprintf(output, "\tmovq $%s, %s\n", value, local_address(offset, NULL));
 }
 void generate_print_variable(FILE* output, const char* var_name, int offset) {
-    fprintf(output, "\tmovq -%d(%%rbp), %%rdi\n", offset);
+    fprintf(output, "\tmovq %s, %%rdi\n", local_address(offset, NULL));
     fprintf(output, "\tcall print_int\n");
 }
+static const char* argument_registers[] = { "%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9" };
+#define MAX_REGISTER_ARGUMENTS 6
+
+// Compares %rcx (left) with %rax (right) and leaves 0/1 in %rax
+static void generate_comparison(FILE* output, const char* set_instruction) {
+    fprintf(output, "\tcmpq %%rax, %%rcx\n");
+    fprintf(output, "\t%s %%al\n", set_instruction);
+    fprintf(output, "\tmovzbq %%al, %%rax\n");
+}
+
+// Leaves the index of an array access in %rax and returns the offset of the
+// array
+static int generate_array_index(FILE* output, struct ast_node* node) {
+    if (node->array_access.array->type != AST_IDENTIFIER) {
+        compiler_error(NULL, "Error: Only local arrays can be indexed\n");
+    }
+    int offset = get_array_offset(node->array_access.array->id_literal.value);
+    generate_expression(output, node->array_access.index);
+    return offset;
+}
+
+// Whether the right operand of a division is a constant divide.c can divide
+// by without idivq
+static bool generator_constant_divisor(struct ast_node* node, long long* divisor) {
+    return node->binary_op.right && ast_constant(node->binary_op.right, divisor) && divide_by_constant(*divisor);
+}
+
+// Assignments to array elements: the index is evaluated before the value,
+// and kept in %rsi, which nothing else in an expression uses
+static void generate_array_assignment(FILE* output, struct ast_node* node) {
+    int offset = generate_array_index(output, node->binary_op.left);
+    generate_push(output, "%rax");
+    generate_expression(output, node->binary_op.right);
+    generate_pop(output, "%rsi");
+    if (node->binary_op.op == OP_ASSIGN) {
+        fprintf(output, "\tmovq %%rax, %s\n", local_address(offset, "%rsi"));
+        return;
+    }
+    fprintf(output, "\tmovq %s, %%rcx\n", local_address(offset, "%rsi"));
+    long long divisor;
+    switch (node->binary_op.op) {
+        case OP_ADD_ASSIGN: fprintf(output, "\taddq %%rax, %%rcx\n"); break;
+        case OP_SUB_ASSIGN: fprintf(output, "\tsubq %%rax, %%rcx\n"); break;
+        case OP_MUL_ASSIGN: fprintf(output, "\timulq %%rax, %%rcx\n"); break;
+        default:
+            if (generator_constant_divisor(node, &divisor)) {
+                fprintf(output, "\tmovq %%rcx, %%rax\n");
+                generate_divide_constant(output, divisor, false);
+            } else {
+                fprintf(output, "\txchgq %%rax, %%rcx\n");
+                fprintf(output, "\tcqo\n");
+                fprintf(output, "\tidivq %%rcx\n");
+            }
+            fprintf(output, "\tmovq %%rax, %%rcx\n");
+            break;
+    }
+    fprintf(output, "\tmovq %%rcx, %s\n", local_address(offset, "%rsi"));
+    fprintf(output, "\tmovq %%rcx, %%rax\n");
+}
+
+static int get_lvalue_offset(struct ast_node* node) {
+    if (!node || node->type != AST_IDENTIFIER) {
+        compiler_error(NULL, "Error: Left hand side of assignment is not a variable\n");
+    }
+    return get_variable_offset(node->id_literal.value);
+}
+
+// && and || only evaluate their right operand when the left one doesn't
+// already decide the result
+static void generate_logical(FILE* output, struct ast_node* node) {
+    char* short_circuit_label = generate_label();
+    char* end_label = generate_label();
+    bool is_and = node->binary_op.op == OP_LOGICAL_AND;
+
+    generate_expression(output, node->binary_op.left);
+    fprintf(output, "\tcmpq $0, %%rax\n");
+    fprintf(output, "\t%s %s\n", is_and ? "je" : "jne", short_circuit_label);
+    generate_profile_counter(output, profile, node->binary_op.counter);
+    generate_expression(output, node->binary_op.right);
+    fprintf(output, "\tcmpq $0, %%rax\n");
+    fprintf(output, "\tsetne %%al\n");
+    fprintf(output, "\tmovzbq %%al, %%rax\n");
+    fprintf(output, "\tjmp %s\n", end_label);
+    fprintf(output, "%s:\n", short_circuit_label);
+    fprintf(output, "\tmovq $%d, %%rax\n", is_and ? 0 : 1);
+    fprintf(output, "%s:\n", end_label);
+
+    free(short_circuit_label);
+    free(end_label);
+}
+
+static void generate_call_arguments(FILE* output, struct ast_node* node) {
+    int arg_count = node->function_call.arg_count;
+    if (arg_count > MAX_REGISTER_ARGUMENTS) {
+        compiler_error(NULL, "Error: Call to %s passes more than %d arguments\n", node->function_call.name, MAX_REGISTER_ARGUMENTS);
+    }
+    // Evaluate every argument before loading any register, since evaluating
+    // one argument may itself contain a call
+    for (int i = 0; i < arg_count; i++) {
+        generate_expression(output, node->function_call.arguments[i]);
+        generate_push(output, "%rax");
+    }
+    for (int i = arg_count - 1; i >= 0; i--) {
+        generate_pop(output, argument_registers[i]);
+    }
+}
+
+static void generate_function_call(FILE* output, struct ast_node* node) {
+    generate_call_arguments(output, node);
+    fprintf(output, "\tcall %s\n", node->function_call.name);
+}
+
+// With a profile, the side of an if that ran more often falls through from
+// the test, and a side that never ran, when the other did, is moved into
+// the cold code after the function
+static void generate_if(FILE* output, struct ast_node* node) {
+    struct ast_node* bodies[2] = { node->if_stmt.true_body, node->if_stmt.false_body };
+    int counter = node->if_stmt.counter;
+    int first = 0;
+    bool second_cold = false;
+    long long counts[2];
+    if (profile_if_counts(profile, node, counts)) {
+        first = counts[1] > counts[0];
+        // Cold code isn't split again
+        second_cold = counts[!first] == 0 && counts[first] > 0 && bodies[!first] && output != cold_output;
+    }
+    int second = !first;
+    char* second_label = generate_label();
+    char* end_if_label = generate_label();
+
+    generate_expression(output, node->if_stmt.condition);
+    fprintf(output, "\tcmpq $0, %%rax\n");
+    fprintf(output, "\t%s %s\n", first ? "jne" : "je", second_label);
+
+    generate_profile_counter(output, profile, counter ? counter + first : 0);
+    generate_code(output, bodies[first]);
+
+    FILE* second_output = output;
+    if (second_cold) {
+        second_output = generator_cold_output();
+    } else {
+        fprintf(output, "\tjmp %s\n", end_if_label);
+    }
+    fprintf(second_output, "%s:\n", second_label);
+    generate_profile_counter(second_output, profile, counter ? counter + second : 0);
+    generate_code(second_output, bodies[second]);
+    if (second_cold) {
+        fprintf(second_output, "\tjmp %s\n", end_if_label);
+    }
+    fprintf(output, "%s:\n", end_if_label);
+
+    free(second_label);
+    free(end_if_label);
+}
+
 void generate_expression(FILE* output, struct ast_node* node) {
     if (!node) return;
+    long long divisor;
 
     switch (node->type) {
         case AST_BINARY_OP:
+            if (node->binary_op.left && node->binary_op.left->type == AST_ARRAY_ACCESS) {
+                switch (node->binary_op.op) {
+                    case OP_ASSIGN:
+                    case OP_ADD_ASSIGN:
+                    case OP_SUB_ASSIGN:
+                    case OP_MUL_ASSIGN:
+                    case OP_DIV_ASSIGN:
+                        generate_array_assignment(output, node);
+                        return;
+                    default:
+                        break;
+                }
+            }
+            switch (node->binary_op.op) {
+                case OP_ASSIGN:
+                    generate_expression(output, node->binary_op.right);
+                    fprintf(output, "\tmovq %%rax, %s\n", local_address(get_lvalue_offset(node->binary_op.left), NULL));
+                    return;
+                case OP_LOGICAL_AND:
+                case OP_LOGICAL_OR:
+                    generate_logical(output, node);
+                    return;
+                case OP_COMMA:
+                    generate_expression(output, node->binary_op.left);
+                    generate_expression(output, node->binary_op.right);
+                    return;
+                case OP_DIV:
+                case OP_MOD:
+                case OP_DIV_ASSIGN:
+                    if (!generator_constant_divisor(node, &divisor)) {
+                        break;
+                    }
+                    // The divisor has no side effects to order against
+                    generate_expression(output, node->binary_op.left);
+                    generate_divide_constant(output, divisor, node->binary_op.op == OP_MOD);
+                    if (node->binary_op.op == OP_DIV_ASSIGN) {
+                        fprintf(output, "\tmovq %%rax, %s\n", local_address(get_lvalue_offset(node->binary_op.left), NULL));
+                    }
+                    return;
+                default:
+                    break;
+            }
             generate_expression(output, node->binary_op.left);
-            fprintf(output, "\tpushq %%rax\n");
+            generate_push(output, "%rax");
             generate_expression(output, node->binary_op.right);
-            fprintf(output, "\tpopq %%rcx\n");
-
-            if (strcmp(node->binary_op.operator, "+") == 0) {
-                fprintf(output, "\taddq %%rcx, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "-") == 0) {
-                fprintf(output, "\tsubq %%rax, %%rcx\n");
-                fprintf(output, "\tmovq %%rcx, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "*") == 0) {
-                fprintf(output, "\timulq %%rcx, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "/") == 0) {
-                fprintf(output, "\tcqo\n");
-                fprintf(output, "\tidivq %%rcx\n");
-            } else if (strcmp(node->binary_op.operator, ">") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsetg %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "<") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsetl %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, ">=") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsetge %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "<=") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsetle %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "==") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsete %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "!=") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsetne %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            } else if (strcmp(node->binary_op.operator, "+=") == 0 ||
-                       strcmp(node->binary_op.operator, "-=") == 0 ||
-                       strcmp(node->binary_op.operator, "*=") == 0 ||
-                       strcmp(node->binary_op.operator, "/=") == 0) {
-                // Compound assignment operators
-                char op = node->binary_op.operator[0];
-                int offset = get_variable_offset(node->binary_op.left->id_literal.value);
-                fprintf(output, "\tmovq -%d(%%rbp), %%rcx\n", offset);
-                switch (op) {
-                    case '+': fprintf(output, "\taddq %%rax, %%rcx\n"); break;
-                    case '-': fprintf(output, "\tsubq %%rax, %%rcx\n"); break;
-                    case '*': fprintf(output, "\timulq %%rax, %%rcx\n"); break;
-                    case '/': 
-                        fprintf(output, "\txchgq %%rax, %%rcx\n");
-                        fprintf(output, "\tcqo\n");
-                        fprintf(output, "\tidivq %%rcx\n");
-                        fprintf(output, "\tmovq %%rax, %%rcx\n");
-                        break;
+            generate_pop(output, "%rcx");
+
+            switch (node->binary_op.op) {
+                case OP_ADD:
+                    fprintf(output, "\taddq %%rcx, %%rax\n");
+                    break;
+                case OP_SUB:
+                    fprintf(output, "\tsubq %%rax, %%rcx\n");
+                    fprintf(output, "\tmovq %%rcx, %%rax\n");
+                    break;
+                case OP_MUL:
+                    fprintf(output, "\timulq %%rcx, %%rax\n");
+                    break;
+                case OP_DIV:
+                case OP_MOD:
+                    fprintf(output, "\txchgq %%rax, %%rcx\n");
+                    fprintf(output, "\tcqo\n");
+                    fprintf(output, "\tidivq %%rcx\n");
+                    if (node->binary_op.op == OP_MOD) {
+                        fprintf(output, "\tmovq %%rdx, %%rax\n");
+                    }
+                    break;
+                case OP_BIT_AND:
+                    fprintf(output, "\tandq %%rcx, %%rax\n");
+                    break;
+                case OP_BIT_OR:
+                    fprintf(output, "\torq %%rcx, %%rax\n");
+                    break;
+                case OP_BIT_XOR:
+                    fprintf(output, "\txorq %%rcx, %%rax\n");
+                    break;
+                case OP_SHL:
+                case OP_SHR:
+                    fprintf(output, "\txchgq %%rax, %%rcx\n");
+                    fprintf(output, "\t%s %%cl, %%rax\n", node->binary_op.op == OP_SHL ? "salq" : "sarq");
+                    break;
+                case OP_GT: generate_comparison(output, "setg"); break;
+                case OP_LT: generate_comparison(output, "setl"); break;
+                case OP_GE: generate_comparison(output, "setge"); break;
+                case OP_LE: generate_comparison(output, "setle"); break;
+                case OP_EQ: generate_comparison(output, "sete"); break;
+                case OP_NE: generate_comparison(output, "setne"); break;
+                case OP_ADD_ASSIGN:
+                case OP_SUB_ASSIGN:
+                case OP_MUL_ASSIGN:
+                case OP_DIV_ASSIGN: {
+                    // Compound assignment operators
+                    int offset = get_lvalue_offset(node->binary_op.left);
+                    fprintf(output, "\tmovq %s, %%rcx\n", local_address(offset, NULL));
+                    switch (node->binary_op.op) {
+                        case OP_ADD_ASSIGN: fprintf(output, "\taddq %%rax, %%rcx\n"); break;
+                        case OP_SUB_ASSIGN: fprintf(output, "\tsubq %%rax, %%rcx\n"); break;
+                        case OP_MUL_ASSIGN: fprintf(output, "\timulq %%rax, %%rcx\n"); break;
+                        default:
+                            fprintf(output, "\txchgq %%rax, %%rcx\n");
+                            fprintf(output, "\tcqo\n");
+                            fprintf(output, "\tidivq %%rcx\n");
+                            fprintf(output, "\tmovq %%rax, %%rcx\n");
+                            break;
+                    }
+                    fprintf(output, "\tmovq %%rcx, %s\n", local_address(offset, NULL));
+                    fprintf(output, "\tmovq %%rcx, %%rax\n");
+                    break;
                 }
-                fprintf(output, "\tmovq %%rcx, -%d(%%rbp)\n", offset);
-                fprintf(output, "\tmovq %%rcx, %%rax\n");
+                default:
+                    compiler_error(NULL, "Error: Operator %s is not supported in expressions\n", node->binary_op.operator);
             }
             break;
 
         case AST_UNARY_OP:
-            if (strcmp(node->unary_op.operator, "++") == 0 ||
-                strcmp(node->unary_op.operator, "--") == 0) {
-                int offset = get_variable_offset(node->unary_op.operand->id_literal.value);
-                fprintf(output, "\tmovq -%d(%%rbp), %%rax\n", offset);
-                if (strcmp(node->unary_op.operator, "++") == 0) {
-                    fprintf(output, "\tincq %%rax\n");
-                } else {
-                    fprintf(output, "\tdecq %%rax\n");
+            if ((node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) &&
+                node->unary_op.operand && node->unary_op.operand->type == AST_ARRAY_ACCESS) {
+                int offset = generate_array_index(output, node->unary_op.operand);
+                fprintf(output, "\tmovq %%rax, %%rsi\n");
+                fprintf(output, "\tmovq %s, %%rax\n", local_address(offset, "%rsi"));
+                fprintf(output, "\tmovq %%rax, %%rcx\n");
+                fprintf(output, "\t%s %%rcx\n", node->unary_op.op == OP_INCREMENT ? "incq" : "decq");
+                fprintf(output, "\tmovq %%rcx, %s\n", local_address(offset, "%rsi"));
+                if (!node->unary_op.is_postfix) {
+                    fprintf(output, "\tmovq %%rcx, %%rax\n");
                 }
-                fprintf(output, "\tmovq %%rax, -%d(%%rbp)\n", offset);
+                break;
+            }
+            if (node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) {
+                int offset = get_lvalue_offset(node->unary_op.operand);
+                fprintf(output, "\tmovq %s, %%rax\n", local_address(offset, NULL));
+                fprintf(output, "\tmovq %%rax, %%rcx\n");
+                fprintf(output, "\t%s %%rcx\n", node->unary_op.op == OP_INCREMENT ? "incq" : "decq");
+                fprintf(output, "\tmovq %%rcx, %s\n", local_address(offset, NULL));
+                // Prefix forms yield the updated value, postfix the original
+                if (!node->unary_op.is_postfix) {
+                    fprintf(output, "\tmovq %%rcx, %%rax\n");
+                }
+                break;
+            }
+            generate_expression(output, node->unary_op.operand);
+            switch (node->unary_op.op) {
+                case OP_SUB:
+                    fprintf(output, "\tnegq %%rax\n");
+                    break;
+                case OP_ADD:
+                    break;
+                case OP_BIT_NOT:
+                    fprintf(output, "\tnotq %%rax\n");
+                    break;
+                case OP_NOT:
+                    fprintf(output, "\tcmpq $0, %%rax\n");
+                    fprintf(output, "\tsete %%al\n");
+                    fprintf(output, "\tmovzbq %%al, %%rax\n");
+                    break;
+                default:
+                    compiler_error(NULL, "Error: Unary operator %s is not supported\n", node->unary_op.operator);
             }
             break;
 
+        case AST_FUNCTION_CALL:
+            generate_function_call(output, node);
+            break;
+
+        case AST_ARRAY_ACCESS: {
+            int offset = generate_array_index(output, node);
+            fprintf(output, "\tmovq %s, %%rax\n", local_address(offset, "%rax"));
+            break;
+        }
+
         case AST_IDENTIFIER:
             // Load variable value into rax
-            fprintf(output, "\tmovq -%d(%%rbp), %%rax\n", get_variable_offset(node->id_literal.value));
+            fprintf(output, "\tmovq %s, %%rax\n", local_address(get_variable_offset(node->id_literal.value), NULL));
             break;
 
         case AST_NUMBER:
             // Load immediate value into rax
-            fprintf(output, "\tmovq $%s, %%rax\n", node->id_literal.value);
+            fprintf(output, "\tmovq $%lld, %%rax\n", node->number.value);
             break;
 
         // Add more cases as needed
@@ -164,52 +606,56 @@ void generate_expression(FILE* output, struct ast_node* node) {
 
 
 void generate_print_int(FILE* output) {
-    // Convert integer to string and print
+    // Convert integer to string and print it with a single write, using a
+    // scratch buffer below the current stack pointer
+    char* positive_label = generate_label();
+    char* convert_label = generate_label();
+    char* print_label = generate_label();
+
     fprintf(output, "\t# Convert integer to string and print\n");
-    fprintf(output, "\tmovq $10, %%r9\n");  // Divisor
-    fprintf(output, "\tmovq $0, %%r10\n");  // Digit count
-    fprintf(output, "\tmovq %%rax, %%rcx\n");  // Copy number to rcx
+    fprintf(output, "\tsubq $32, %%rsp\n");
+    fprintf(output, "\tleaq 31(%%rsp), %%rsi\n");  // Buffer is filled backwards
+    fprintf(output, "\tmovb $10, (%%rsi)\n");      // ASCII newline
+    fprintf(output, "\tmovq $1, %%r10\n");         // Length so far
+    fprintf(output, "\tmovq %%rax, %%r8\n");       // Keep the sign
+    fprintf(output, "\tmovq $10, %%r9\n");         // Divisor
 
     // Handle negative numbers
-    fprintf(output, "\ttestq %%rcx, %%rcx\n");
-    fprintf(output, "\tjns .Lpositive_%d\n", label_counter);
-    fprintf(output, "\tnegq %%rcx\n");
-    fprintf(output, "\tmovq $45, (%%rsp)\n");  // ASCII '-'
-    fprintf(output, "\tdecq %%rsp\n");
-    fprintf(output, "\tincq %%r10\n");
+    fprintf(output, "\ttestq %%rax, %%rax\n");
+    fprintf(output, "\tjns %s\n", positive_label);
+    fprintf(output, "\tnegq %%rax\n");
 
-    fprintf(output, ".Lpositive_%d:\n", label_counter);
-    // Convert to ASCII and push onto stack
-    fprintf(output, ".Lconvert_loop_%d:\n", label_counter);
+    fprintf(output, "%s:\n", positive_label);
+    // Convert to ASCII, least significant digit first
+    fprintf(output, "%s:\n", convert_label);
     fprintf(output, "\txorq %%rdx, %%rdx\n");
     fprintf(output, "\tdivq %%r9\n");
     fprintf(output, "\taddq $48, %%rdx\n");  // Convert to ASCII
-    fprintf(output, "\tdecq %%rsp\n");
-    fprintf(output, "\tmovb %%dl, (%%rsp)\n");
+    fprintf(output, "\tdecq %%rsi\n");
+    fprintf(output, "\tmovb %%dl, (%%rsi)\n");
     fprintf(output, "\tincq %%r10\n");
     fprintf(output, "\ttestq %%rax, %%rax\n");
-    fprintf(output, "\tjnz .Lconvert_loop_%d\n", label_counter);
+    fprintf(output, "\tjnz %s\n", convert_label);
 
-    // Print the number
-    fprintf(output, "\tmovq %%r10, %%rdx\n");  // Length
-    fprintf(output, "\tmovq %%rsp, %%rsi\n");  // Buffer
-    fprintf(output, "\tmovq $1, %%rdi\n");     // File descriptor (stdout)
-    fprintf(output, "\tmovq $1, %%rax\n");     // System call number (sys_write)
-    fprintf(output, "\tsyscall\n");
+    fprintf(output, "\ttestq %%r8, %%r8\n");
+    fprintf(output, "\tjns %s\n", print_label);
+    fprintf(output, "\tdecq %%rsi\n");
+    fprintf(output, "\tmovb $45, (%%rsi)\n");  // ASCII '-'
+    fprintf(output, "\tincq %%r10\n");
 
-    // Print newline
-    fprintf(output, "\tmovq $10, (%%rsp)\n");  // ASCII newline
-    fprintf(output, "\tmovq $1, %%rdx\n");     // Length
-    fprintf(output, "\tmovq %%rsp, %%rsi\n");  // Buffer
+    // Print the number and the newline
+    fprintf(output, "%s:\n", print_label);
+    fprintf(output, "\tmovq %%r10, %%rdx\n");  // Length
     fprintf(output, "\tmovq $1, %%rdi\n");     // File descriptor (stdout)
     fprintf(output, "\tmovq $1, %%rax\n");     // System call number (sys_write)
     fprintf(output, "\tsyscall\n");
 
     // Restore stack
-    fprintf(output, "\taddq %%r10, %%rsp\n");
-    fprintf(output, "\tincq %%rsp\n");
+    fprintf(output, "\taddq $32, %%rsp\n");
 
-    label_counter++;
+    free(positive_label);
+    free(convert_label);
+    free(print_label);
 }
 void generate_print_string(FILE* output, const char* string) {
     fprintf(output, "\t# Print string\n");
@@ -228,48 +674,197 @@ void generate_print_string(FILE* output, const char* string) {
 
     label_counter += 2;
 }
+void generate_file_header(FILE* output) {
+    fprintf(output, "\t.file \"test.s\"\n");
+    fprintf(output, "\t.text\n");
+}
+
+void generate_file_footer(FILE* output) {
+    fprintf(output, "\t.section .note.GNU-stack,\"\",@progbits\n");
+}
+
+// Top-level statements are generated on this many threads; set with
+// ./main --jobs <n>
+static int codegen_threads = 1;
+
+void compiler_set_codegen_threads(int threads) {
+    codegen_threads = threads < 1 ? 1 : threads;
+}
+
+struct codegen_job {
+    struct ast_node** statements;
+    int count;
+    char** texts;
+    size_t* sizes;
+    int next;
+    bool failed;
+    FILE* diagnostics;
+};
+
+// Takes statements off the job until there are none left. NULL statements
+// are left alone, their text is already there
+static void codegen_job_run(void* data) {
+    struct codegen_job* job = data;
+    int i;
+    while ((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->count) {
+        if (!job->statements[i]) {
+            continue;
+        }
+        FILE* buffer = open_memstream(&job->texts[i], &job->sizes[i]);
+        generate_code(buffer, job->statements[i]);
+        fclose(buffer);
+    }
+}
+
+static void* codegen_worker(void* data) {
+    struct codegen_job* job = data;
+    compiler_diagnostics = job->diagnostics;
+    if (!compiler_run_protected(codegen_job_run, job)) {
+        __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+// Generates every non-NULL statement into its own malloc'd texts[i]. Top-level
+// statements don't share any generator state (labels and locals are per
+// function), so they are spread over the codegen threads; the caller writes
+// the texts out in source order, so the output doesn't depend on scheduling
+void generate_statements(struct ast_node** statements, int count, char** texts, size_t* sizes) {
+    struct codegen_job job = { statements, count, texts, sizes, 0, false, compiler_diagnostics };
+    int threads = codegen_threads < count ? codegen_threads : count;
+    if (threads <= 1) {
+        codegen_job_run(&job);
+        return;
+    }
+    pthread_t* workers = calloc(threads - 1, sizeof(pthread_t));
+    int started = 0;
+    for (int i = 0; i < threads - 1; i++) {
+        if (pthread_create(&workers[started], NULL, codegen_worker, &job) == 0) {
+            started++;
+        }
+    }
+    // Takes whatever the threads don't, everything if none started
+    codegen_worker(&job);
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+    if (job.failed) {
+        // The error has been reported already, fail the compile on this thread
+        compiler_abort();
+    }
+}
+
+static void generate_root_statements(FILE* output, struct ast_node* root) {
+    if (codegen_threads <= 1) {
+        for (int i = 0; i < root->root.stmt_count; i++) {
+            generate_code(output, root->root.statements[i]);
+        }
+        return;
+    }
+    int count = root->root.stmt_count;
+    char** texts = calloc(count, sizeof(char*));
+    size_t* sizes = calloc(count, sizeof(size_t));
+    generate_statements(root->root.statements, count, texts, sizes);
+    for (int i = 0; i < count; i++) {
+        fwrite(texts[i], 1, sizes[i], output);
+        free(texts[i]);
+    }
+    free(texts);
+    free(sizes);
+}
+
+void generate_function(FILE* output, struct ast_node* node) {
+    reset_symbols();
+    current_function = node->function_def.name;
+    label_counter = 0;
+    frameless = node->function_def.frameless;
+    frame_size = 8 * node->function_def.param_count + local_size(node->function_def.body);
+    push_depth = 0;
+    profile = node->function_def.profile;
+    peephole = node->function_def.peephole;
+    // Left over from a function whose compile failed
+    generate_cold_code(NULL);
+    generate_peephole_code(NULL);
+    FILE* function = output;
+    if (peephole) {
+        function_output = open_memstream(&function_text, &function_size);
+        function = function_output;
+    }
+    generate_function_prologue(function, node->function_def.name, !node->function_def.is_static);
+    generate_profile_counter(function, profile, node->function_def.counter);
+    // Spill the register arguments into locals
+    for (int i = 0; i < node->function_def.param_count && i < MAX_REGISTER_ARGUMENTS; i++) {
+        fprintf(function, "\tmovq %s, %s\n", argument_registers[i], local_address(stack_offset, NULL));
+        add_symbol(node->function_def.parameters[i]->id_literal.value, stack_offset);
+        stack_offset += 8;
+    }
+    generate_code(function, node->function_def.body);
+    if (generator_writes_profile()) {
+        fprintf(function, "\tcall __profile_write\n");
+    }
+    generate_function_epilogue(function);
+    generate_cold_code(function);
+    if (generator_writes_profile()) {
+        generate_profile_writer(function, profile);
+    }
+    generate_peephole_code(output);
+    frameless = false;
+    profile = NULL;
+    peephole = false;
+}
+
 void generate_code(FILE* output, struct ast_node* root) {
     if (!root) return;
 
-     static int data_section_added = 0;
     switch (root->type) {
         case AST_IDENTIFIER:
-            fprintf(output, "\tmovq -%d(%%rbp), %%rax\n", get_variable_offset(root->id_literal.value));
+            fprintf(output, "\tmovq %s, %%rax\n", local_address(get_variable_offset(root->id_literal.value), NULL));
             break;
         case AST_FUNCTION_DEFINITION:
-            generate_function_prologue(output, root->function_def.name);
-            generate_code(output, root->function_def.body);
-            generate_function_epilogue(output);
+            if (!root->function_def.body) {
+                // Prototype only
+                break;
+            }
+            generate_function(output, root);
             break;
 
         case AST_DECLARATION:
-            static int stack_offset = 8;
-            fprintf(output, "\tsubq $%d, %%rsp\n", get_type_size(root->declaration.type));
+            if (root->declaration.array_size) {
+                // Elements are 8 bytes, like every local, and start out zero
+                long long length = root->declaration.array_size->number.value;
+                if (length > (1 << 24)) {
+                    compiler_error(NULL, "Error: Array %s is too large for the stack\n", root->declaration.name);
+                }
+                int offset = stack_offset + 8 * ((int) length - 1);
+                char* clear_label = generate_label();
+                fprintf(output, "\tmovq $%lld, %%rcx\n", length);
+                fprintf(output, "%s:\n", clear_label);
+                fprintf(output, "\tdecq %%rcx\n");
+                fprintf(output, "\tmovq $0, %s\n", local_address(offset, "%rcx"));
+                fprintf(output, "\tjne %s\n", clear_label);
+                free(clear_label);
+                add_symbol(root->declaration.name, offset);
+                symbol_table[symbol_count - 1].length = (int) length;
+                stack_offset = offset + 8;
+                break;
+            }
             add_symbol(root->declaration.name, stack_offset);
             if (root->declaration.initial_value) {
                 generate_expression(output, root->declaration.initial_value);
-                fprintf(output, "\tmovq %%rax, -%d(%%rbp)\n", stack_offset);
+                fprintf(output, "\tmovq %%rax, %s\n", local_address(stack_offset, NULL));
             } else {
                 generate_variable_assignment(output, root->declaration.name, stack_offset, "0");
             }
             stack_offset += get_type_size(root->declaration.type);
             break;
         case AST_BINARY_OP:
-            if (strcmp(root->binary_op.operator, "=") == 0) {
-                struct ast_node* lhs = root->binary_op.left;
-                struct ast_node* rhs = root->binary_op.right;
-                generate_expression(output, rhs);  // Compute right-hand side and store in rax
-                if (lhs->type == AST_IDENTIFIER) {
-                    fprintf(output, "\tmovq %%rax, -%d(%%rbp)\n", get_variable_offset(lhs->id_literal.value));
-                }
-            } if (strcmp(root->binary_op.operator, "==") == 0) {
-                fprintf(output, "\tcmpq %%rax, %%rcx\n");
-                fprintf(output, "\tsete %%al\n");
-                fprintf(output, "\tmovzbq %%al, %%rax\n");
-            }
-            else {
-                generate_expression(output, root);
-            }
+        case AST_UNARY_OP:
+        case AST_FUNCTION_CALL:
+        case AST_ARRAY_ACCESS:
+        case AST_NUMBER:
+            // Expression statement, the value is discarded
+            generate_expression(output, root);
             break;
 
         case AST_PRINT:
@@ -279,87 +874,81 @@ void generate_code(FILE* output, struct ast_node* root) {
             break;
 
 
-        case AST_BLOCK:
+        case AST_BLOCK: {
+            int symbols = symbol_count;
             for (int i = 0; i < root->block.stmt_count; i++) {
                 generate_code(output, root->block.statements[i]);
             }
+            pop_symbols(symbols);
             break;
+        }
 
         case AST_ROOT:
-            fprintf(output, "\t.file \"test.s\"\n");
-            fprintf(output, "\t.text\n");
-            for (int i = 0; i < root->root.stmt_count; i++) {
-                generate_code(output, root->root.statements[i]);
-            }
-            fprintf(output, "\t.section .note.GNU-stack,\"\",@progbits\n");
+            generate_file_header(output);
+            generate_root_statements(output, root);
+            generate_profile_counters(output, root);
+            generate_file_footer(output);
             break;
         case AST_IF_STMT:
-                
-                char* else_label = generate_label();
-                char* end_if_label = generate_label();
-
-                // Generate code for the condition
-                generate_expression(output, root->if_stmt.condition);
-                
-                // Compare the result with 0
-                fprintf(output, "\tcmpq $0, %%rax\n");
-                fprintf(output, "\tje %s\n", else_label);
-
-                // Generate code for the then branch
-                generate_code(output, root->if_stmt.true_body);
-                fprintf(output, "\tjmp %s\n", end_if_label);
-               
-                // Else branch (if it exists)
-                fprintf(output, "%s:\n", else_label);
-                if (root->if_stmt.false_body) {
-                    generate_code(output, root->if_stmt.false_body);
-                }
-
-                // End of if statement
-                fprintf(output, "%s:\n", end_if_label);
-                
-                free(else_label);
-                free(end_if_label);
-            
+            generate_if(output, root);
             break;
         case AST_WHILE:
+        case AST_WHILE_LOOP:
             {
-                char* start_label = generate_label();
-                char* end_label = generate_label();
-
-                // Start of while loop
-                fprintf(output, "%s:\n", start_label);
+                if (root->while_loop.vectorize) {
+                    // Runs as many iterations as it can on vector
+                    // registers, and leaves the rest to the loop below
+                    generate_vector_loop(output, root);
+                }
+                // Rotated: the condition is tested at the bottom, so each
+                // iteration takes one branch instead of two
+                char* body_label = generate_label();
+                char* condition_label = generate_label();
 
-                // Generate code for the condition
-                generate_expression(output, root->while_loop.condition);
-
-                // Compare the result with 0
-                fprintf(output, "\tcmpq $0, %%rax\n");
-                fprintf(output, "\tje %s\n", end_label);
+                fprintf(output, "\tjmp %s\n", condition_label);
+                generate_loop_alignment(output);
+                fprintf(output, "%s:\n", body_label);
+                generate_profile_counter(output, profile, root->while_loop.counter);
 
                 // Generate code for the loop body
                 generate_code(output, root->while_loop.body);
 
-                // Jump back to the start of the loop
-                fprintf(output, "\tjmp %s\n", start_label);
-
-                // End of while loop
-                fprintf(output, "%s:\n", end_label);
+                // Loop again while the condition holds
+                fprintf(output, "%s:\n", condition_label);
+                generate_expression(output, root->while_loop.condition);
+                fprintf(output, "\tcmpq $0, %%rax\n");
+                fprintf(output, "\tjne %s\n", body_label);
 
-                free(start_label);
-                free(end_label);
+                free(body_label);
+                free(condition_label);
             }
             break;
+        case AST_SWITCH:
+            generate_switch(output, root);
+            break;
+        case AST_CASE:
+            // generate_switch has placed the label
+            generate_profile_counter(output, profile, root->case_label.counter);
+            break;
+        case AST_BREAK:
+            generate_break(output);
+            break;
         case AST_RETURN:
+            if (root->return_stmt.tail_call && !generator_writes_profile()) {
+                // The callee returns straight to our caller
+                generate_call_arguments(output, root->return_stmt.value);
+                generate_frame_teardown(output);
+                fprintf(output, "\tjmp %s\n", root->return_stmt.value->function_call.name);
+                break;
+            }
             // Generate code for the return expression (if any)
             if (root->return_stmt.value) {
                 generate_expression(output, root->return_stmt.value);
             }
-
-            // Function epilogue
-            fprintf(output, "\tmovq %%rbp, %%rsp\n");
-            fprintf(output, "\tpopq %%rbp\n");
-            fprintf(output, "\tret\n");
+            if (generator_writes_profile()) {
+                fprintf(output, "\tcall __profile_write\n");
+            }
+            generate_function_epilogue(output);
             break;
     }
 }
\ No newline at end of file
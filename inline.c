@@ -0,0 +1,359 @@
+// Inlining of small leaf functions.
+//
+// A function whose body is `return <expression>;`, where the expression
+// only reads the parameters and calls nothing, is copied into its call
+// sites in place of the call. Each parameter is replaced by the argument
+// when that can't change what the program does: constants and, when no
+// argument has side effects, variables go in as they are. Anything else is
+// evaluated first, in order, into a temporary of the caller:
+//
+//   f(x++, 2)   with   int f(int a, int b) { return a * b + a; }
+//   becomes            (f.a.0 = x++, f.a.0 * 2 + f.a.0)
+//
+// Temporaries are named after the callee and parameter with a dot, which no
+// identifier in the source can contain, and declared at the top of the
+// caller. The callee is still generated for other callers. A caller's
+// assembly now depends on the callees inlined into it, so they are recorded
+// in its function_def.inlined for the function cache key.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Nodes in the callee's return expression, past which a call is left alone
+#define INLINE_MAX_NODES 16
+// With a profile, calls that ran at least INLINE_HOT_COUNT times may take
+// bigger callees, and calls that never ran aren't inlined at all
+#define INLINE_HOT_COUNT 1000
+#define INLINE_HOT_MAX_NODES 64
+// Inlining into a function can make it a leaf small enough to inline too
+#define INLINE_MAX_ROUNDS 4
+
+struct inliner {
+    // Function definitions with a body, by name; open addressing
+    struct ast_node** functions;
+    int capacity;
+    // The function being inlined into, its temporaries and their count
+    struct ast_node* caller;
+    struct ast_node** temporaries;
+    int temporary_count;
+    bool changed;
+};
+
+static unsigned int inline_hash(const char* name)
+{
+    unsigned int hash = 2166136261u;
+    for (; *name; name++) {
+        hash = (hash ^ (unsigned char) *name) * 16777619u;
+    }
+    return hash;
+}
+
+static struct ast_node** inline_slot(struct inliner* inliner, const char* name)
+{
+    unsigned int slot = inline_hash(name) & (inliner->capacity - 1);
+    while (inliner->functions[slot] && strcmp(inliner->functions[slot]->function_def.name, name) != 0) {
+        slot = (slot + 1) & (inliner->capacity - 1);
+    }
+    return &inliner->functions[slot];
+}
+
+static int inline_parameter(struct ast_node* function, const char* name)
+{
+    for (int i = 0; i < function->function_def.param_count; i++) {
+        if (strcmp(function->function_def.parameters[i]->id_literal.value, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Counts the nodes of a callee's return expression into size; false if it
+// does anything but read parameters and compute
+static bool inline_expression_ok(struct ast_node* function, struct ast_node* node, int* size, int max_nodes)
+{
+    if (++*size > max_nodes) {
+        return false;
+    }
+    switch (node->type) {
+        case AST_NUMBER:
+            return true;
+        case AST_IDENTIFIER:
+            // Anything else would be a caller's variable once inlined
+            return inline_parameter(function, node->id_literal.value) >= 0;
+        case AST_UNARY_OP:
+            if (node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT) {
+                return false;
+            }
+            return inline_expression_ok(function, node->unary_op.operand, size, max_nodes);
+        case AST_BINARY_OP:
+            switch (node->binary_op.op) {
+                case OP_ASSIGN:
+                case OP_ADD_ASSIGN:
+                case OP_SUB_ASSIGN:
+                case OP_MUL_ASSIGN:
+                case OP_DIV_ASSIGN:
+                    return false;
+                default:
+                    return inline_expression_ok(function, node->binary_op.left, size, max_nodes) &&
+                           inline_expression_ok(function, node->binary_op.right, size, max_nodes);
+            }
+        default:
+            return false;
+    }
+}
+
+// The return expression of function if calls to it with arg_count
+// arguments can be inlined
+static struct ast_node* inline_candidate(struct ast_node* function, int arg_count, int max_nodes)
+{
+    struct ast_node* body = function->function_def.body;
+    if (function->function_def.param_count != arg_count || body->type != AST_BLOCK || body->block.stmt_count != 1) {
+        return NULL;
+    }
+    struct ast_node* statement = body->block.statements[0];
+    if (statement->type != AST_RETURN || !statement->return_stmt.value) {
+        return NULL;
+    }
+    int size = 0;
+    return inline_expression_ok(function, statement->return_stmt.value, &size, max_nodes) ? statement->return_stmt.value : NULL;
+}
+
+// Whether evaluating node does anything but compute a value: writes,
+// calls, or a division that may trap
+static bool inline_impure(struct ast_node* node, bool divisions)
+{
+    if (!node) {
+        return false;
+    }
+    switch (node->type) {
+        case AST_NUMBER:
+        case AST_IDENTIFIER:
+            return false;
+        case AST_UNARY_OP:
+            return node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT ||
+                   inline_impure(node->unary_op.operand, divisions);
+        case AST_BINARY_OP:
+            switch (node->binary_op.op) {
+                case OP_ASSIGN:
+                case OP_ADD_ASSIGN:
+                case OP_SUB_ASSIGN:
+                case OP_MUL_ASSIGN:
+                case OP_DIV_ASSIGN:
+                    return true;
+                case OP_DIV:
+                case OP_MOD:
+                    if (divisions) {
+                        return true;
+                    }
+                    // fallthrough
+                default:
+                    return inline_impure(node->binary_op.left, divisions) || inline_impure(node->binary_op.right, divisions);
+            }
+        default:
+            return true;
+    }
+}
+
+static int inline_uses(struct ast_node* node, const char* name)
+{
+    switch (node->type) {
+        case AST_IDENTIFIER:
+            return strcmp(node->id_literal.value, name) == 0;
+        case AST_UNARY_OP:
+            return inline_uses(node->unary_op.operand, name);
+        case AST_BINARY_OP:
+            return inline_uses(node->binary_op.left, name) + inline_uses(node->binary_op.right, name);
+        default:
+            return 0;
+    }
+}
+
+// Copies node, with parameters of function replaced by copies of
+// replacements. Only called on what inline_expression_ok accepted and on
+// arguments
+static struct ast_node* inline_copy(struct ast_node* node, struct ast_node* function, struct ast_node** replacements)
+{
+    switch (node->type) {
+        case AST_NUMBER:
+            return create_number_node(node->offset, node->number.value);
+        case AST_IDENTIFIER: {
+            int parameter = function ? inline_parameter(function, node->id_literal.value) : -1;
+            if (parameter >= 0) {
+                return inline_copy(replacements[parameter], NULL, NULL);
+            }
+            return create_id_literal_node(AST_IDENTIFIER, node->offset, node->id_literal.value);
+        }
+        case AST_UNARY_OP:
+            return create_unary_op_node(node->offset, inline_copy(node->unary_op.operand, function, replacements),
+                                        node->unary_op.op, node->unary_op.is_postfix);
+        case AST_BINARY_OP:
+            return create_binary_op_node(node->offset, inline_copy(node->binary_op.left, function, replacements),
+                                         inline_copy(node->binary_op.right, function, replacements), node->binary_op.op);
+        default:
+            // Arguments that aren't copied are only used once, as they are
+            return node;
+    }
+}
+
+static void inline_record(struct ast_node* caller, struct ast_node* callee)
+{
+    for (int i = 0; i < caller->function_def.inlined_count; i++) {
+        if (caller->function_def.inlined[i] == callee) {
+            return;
+        }
+    }
+    caller->function_def.inlined = ast_node_list_append(caller->function_def.inlined, caller->function_def.inlined_count++, callee);
+}
+
+static struct ast_node* inline_call(struct inliner* inliner, struct ast_node* call, struct ast_node* callee, struct ast_node* expression)
+{
+    int arg_count = call->function_call.arg_count;
+    struct ast_node** arguments = call->function_call.arguments;
+    bool impure = false;
+    for (int i = 0; i < arg_count; i++) {
+        impure = impure || inline_impure(arguments[i], false);
+    }
+
+    struct ast_node* replacements[arg_count ? arg_count : 1];
+    struct ast_node* assignments[arg_count ? arg_count : 1];
+    for (int i = 0; i < arg_count; i++) {
+        struct ast_node* argument = arguments[i];
+        const char* parameter = callee->function_def.parameters[i]->id_literal.value;
+        assignments[i] = NULL;
+        if (argument->type == AST_NUMBER || (!impure && argument->type == AST_IDENTIFIER) ||
+            (!impure && !inline_impure(argument, true) && inline_uses(expression, parameter) == 1)) {
+            replacements[i] = argument;
+            continue;
+        }
+        char name[256];
+        snprintf(name, sizeof(name), "%s.%s.%d", callee->function_def.name, parameter, inliner->temporary_count);
+        struct ast_node* temporary = create_declaration_node(call->offset, "int", name, NULL);
+        inliner->temporaries = ast_node_list_append(inliner->temporaries, inliner->temporary_count++, temporary);
+        replacements[i] = create_id_literal_node(AST_IDENTIFIER, call->offset, name);
+        assignments[i] = create_binary_op_node(call->offset, create_id_literal_node(AST_IDENTIFIER, call->offset, name),
+                                               argument, OP_ASSIGN);
+    }
+
+    struct ast_node* result = inline_copy(expression, callee, replacements);
+    for (int i = arg_count - 1; i >= 0; i--) {
+        if (assignments[i]) {
+            result = create_binary_op_node(call->offset, assignments[i], result, OP_COMMA);
+        }
+    }
+
+    inline_record(inliner->caller, callee);
+    for (int i = 0; i < callee->function_def.inlined_count; i++) {
+        inline_record(inliner->caller, callee->function_def.inlined[i]);
+    }
+    inliner->changed = true;
+    return result;
+}
+
+// Inlines the calls under *slot, innermost first so arguments are done
+// before the call that takes them. runs is how often the profile says the
+// code there ran, or -1
+static void inline_walk(struct inliner* inliner, struct ast_node** slot, long long runs)
+{
+    struct ast_node* node = *slot;
+    if (!node) {
+        return;
+    }
+    struct profile* profile = inliner->caller->function_def.profile;
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            inline_walk(inliner, &(*list)[i], runs);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        inline_walk(inliner, slots[i], profile_slot_count(profile, node, slots[i], runs));
+    }
+
+    if (node->type != AST_FUNCTION_CALL) {
+        return;
+    }
+    struct ast_node* callee = *inline_slot(inliner, node->function_call.name);
+    if (!callee || callee == inliner->caller) {
+        return;
+    }
+    if (runs == 0) {
+        return;
+    }
+    int max_nodes = runs >= INLINE_HOT_COUNT ? INLINE_HOT_MAX_NODES : INLINE_MAX_NODES;
+    struct ast_node* expression = inline_candidate(callee, node->function_call.arg_count, max_nodes);
+    if (expression) {
+        *slot = inline_call(inliner, node, callee, expression);
+    }
+}
+
+static void inline_function(struct inliner* inliner, struct ast_node* function)
+{
+    struct ast_node* body = function->function_def.body;
+    if (body->type != AST_BLOCK) {
+        return;
+    }
+    inliner->caller = function;
+    inliner->temporaries = NULL;
+    inliner->temporary_count = 0;
+    // Temporaries from earlier rounds lead the body already; keep them
+    // there and keep counting
+    int existing = 0;
+    while (existing < body->block.stmt_count && body->block.statements[existing]->type == AST_DECLARATION &&
+           strchr(body->block.statements[existing]->declaration.name, '.')) {
+        inliner->temporaries = ast_node_list_append(inliner->temporaries, existing, body->block.statements[existing]);
+        existing++;
+    }
+    inliner->temporary_count = existing;
+
+    inline_walk(inliner, &function->function_def.body,
+                profile_slot_count(function->function_def.profile, function, &function->function_def.body, -1));
+
+    if (inliner->temporary_count == existing) {
+        return;
+    }
+    // The temporaries go first, so they have their stack slots before any
+    // statement that uses them
+    struct ast_node** statements = inliner->temporaries;
+    int count = inliner->temporary_count;
+    for (int i = existing; i < body->block.stmt_count; i++) {
+        statements = ast_node_list_append(statements, count++, body->block.statements[i]);
+    }
+    body->block.statements = statements;
+    body->block.stmt_count = count;
+}
+
+void inline_functions(struct ast_node* root)
+{
+    struct inliner inliner = { 0 };
+    inliner.capacity = 16;
+    while (inliner.capacity < root->root.stmt_count * 2) {
+        inliner.capacity *= 2;
+    }
+    inliner.functions = calloc(inliner.capacity, sizeof(struct ast_node*));
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* statement = root->root.statements[i];
+        if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.body) {
+            struct ast_node** slot = inline_slot(&inliner, statement->function_def.name);
+            if (!*slot) {
+                *slot = statement;
+            }
+        }
+    }
+
+    for (int round = 0; round < INLINE_MAX_ROUNDS; round++) {
+        inliner.changed = false;
+        for (int i = 0; i < root->root.stmt_count; i++) {
+            struct ast_node* statement = root->root.statements[i];
+            if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.body) {
+                inline_function(&inliner, statement);
+            }
+        }
+        if (!inliner.changed) {
+            break;
+        }
+    }
+    free(inliner.functions);
+}
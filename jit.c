@@ -0,0 +1,141 @@
+// Runs an assembled program in this process (./main --run).
+//
+// The code from assemble() is copied into an anonymous mapping, its
+// relocations are patched the way the linker would, and main() is called
+// directly. Calls to functions the program doesn't define go through a stub
+// per function at the end of the mapping, which calls the absolute address:
+// the runtime helpers below, or else whatever dlsym() finds in the
+// compiler's own process (libc, mostly). The stubs keep every call a rel32
+// however far away the target is. Generated code doesn't keep the stack
+// 16-byte aligned at calls, as the ABI wants and libc's SSE code relies on,
+// so the stubs align it first. Calls pass at most 6 arguments, all in
+// registers, so moving the stack pointer leaves them alone. .bss goes on
+// pages of its own after the stubs, the only part of the mapping left
+// writable.
+#define _GNU_SOURCE
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <dlfcn.h>
+#include <sys/mman.h>
+
+// pushq %rbp; movq %rsp, %rbp; andq $-16, %rsp; call *2(%rip); leave; ret,
+// then the target address
+#define JIT_STUB_SIZE 32
+
+static long jit_print_int(long value)
+{
+    char buffer[32];
+    int length = snprintf(buffer, sizeof(buffer), "%ld\n", value);
+    return write(STDOUT_FILENO, buffer, length);
+}
+
+static const struct {
+    const char* name;
+    void* address;
+} jit_runtime[] = {
+    { "print_int", (void*) jit_print_int }
+};
+
+static void* jit_resolve(const char* name)
+{
+    for (size_t i = 0; i < sizeof(jit_runtime) / sizeof(jit_runtime[0]); i++) {
+        if (strcmp(jit_runtime[i].name, name) == 0) {
+            return jit_runtime[i].address;
+        }
+    }
+    return dlsym(RTLD_DEFAULT, name);
+}
+
+static bool jit_fail(char* error, size_t error_size, const char* message, const char* name)
+{
+    snprintf(error, error_size, message, name);
+    return false;
+}
+
+bool jit_run(struct asm_object* object, const char* entry, int* exit_code, char* error, size_t error_size)
+{
+    int entry_symbol = -1;
+    for (int i = 0; i < object->symbol_count; i++) {
+        if (object->symbols[i].defined && strcmp(object->symbols[i].name, entry) == 0) {
+            entry_symbol = i;
+        }
+    }
+    if (entry_symbol < 0) {
+        return jit_fail(error, error_size, "there is no %s function to run\n", entry);
+    }
+
+    // One stub per undefined symbol that is called
+    int* stubs = malloc((object->symbol_count ? object->symbol_count : 1) * sizeof(int));
+    for (int i = 0; i < object->symbol_count; i++) {
+        stubs[i] = -1;
+    }
+    int stub_count = 0;
+    size_t text_size = (object->text_size + JIT_STUB_SIZE - 1) & ~(size_t) (JIT_STUB_SIZE - 1);
+    for (int i = 0; i < object->relocation_count; i++) {
+        int symbol = object->relocations[i].symbol;
+        if (!object->symbols[symbol].defined && stubs[symbol] < 0) {
+            stubs[symbol] = stub_count++;
+        }
+    }
+
+    size_t page_size = sysconf(_SC_PAGESIZE);
+    size_t code_size = text_size + stub_count * JIT_STUB_SIZE;
+    size_t bss_start = (code_size + page_size - 1) & ~(page_size - 1);
+    size_t size = bss_start + object->bss_size;
+    unsigned char* code = mmap(NULL, size ? size : 1, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED) {
+        free(stubs);
+        return jit_fail(error, error_size, "couldn't map memory for the %s program\n", entry);
+    }
+    memcpy(code, object->text, object->text_size);
+    // int3 between the code and the stubs
+    memset(code + object->text_size, 0xCC, text_size - object->text_size);
+
+    for (int i = 0; i < object->symbol_count; i++) {
+        if (stubs[i] < 0) {
+            continue;
+        }
+        void* address = jit_resolve(object->symbols[i].name);
+        if (!address) {
+            munmap(code, size);
+            free(stubs);
+            return jit_fail(error, error_size, "undefined reference to %s\n", object->symbols[i].name);
+        }
+        unsigned char* stub = code + text_size + stubs[i] * JIT_STUB_SIZE;
+        static const unsigned char call[] = {
+            0x55, 0x48, 0x89, 0xE5, 0x48, 0x83, 0xE4, 0xF0, 0xFF, 0x15, 0x02, 0x00, 0x00, 0x00, 0xC9, 0xC3
+        };
+        memcpy(stub, call, sizeof(call));
+        memcpy(stub + sizeof(call), &address, sizeof(address));
+        memset(stub + sizeof(call) + sizeof(address), 0xCC, JIT_STUB_SIZE - sizeof(call) - sizeof(address));
+    }
+
+    for (int i = 0; i < object->relocation_count; i++) {
+        struct asm_relocation* relocation = &object->relocations[i];
+        struct asm_symbol* symbol = &object->symbols[relocation->symbol];
+        // PLT32 and PC32 are S + A - P, with the stub standing in for the
+        // PLT entry
+        long long target = !symbol->defined ? (long long) (text_size + stubs[relocation->symbol] * JIT_STUB_SIZE)
+                           : symbol->bss    ? (long long) (bss_start + symbol->offset)
+                                            : (long long) symbol->offset;
+        int value = (int) (target + relocation->addend - (long long) relocation->offset);
+        memcpy(code + relocation->offset, &value, sizeof(value));
+    }
+    free(stubs);
+
+    if (mprotect(code, code_size ? code_size : 1, PROT_READ | PROT_EXEC) != 0) {
+        munmap(code, size);
+        return jit_fail(error, error_size, "couldn't make the %s program executable\n", entry);
+    }
+    // The program writes to the file descriptors directly
+    fflush(stdout);
+    fflush(stderr);
+    long (*function)(void) = (long (*)(void)) (code + object->symbols[entry_symbol].offset);
+    *exit_code = (int) function();
+    // And anything it printed through libc
+    fflush(stdout);
+    munmap(code, size);
+    return true;
+}
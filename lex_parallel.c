@@ -0,0 +1,220 @@
+// Parallel lexing of large inputs.
+//
+// The source is mapped into memory and a quick pre-scan picks chunk
+// boundaries at line starts that are outside of comments, string and
+// character literals, so every chunk lexes exactly as it would as part of
+// the whole file. Each chunk's lexer starts at the chunk's offset in the
+// file, so its tokens need no fixing up. Chunks are lexed on their own
+// threads through lex() with an in-memory character source, and their
+// tokens are appended in order. A chunk that can't get a thread is lexed
+// on the calling one instead.
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Smaller inputs aren't worth the threads
+#define LEX_PARALLEL_MIN_CHUNK_SIZE (256 * 1024)
+
+static int lex_threads = 1;
+
+void compiler_set_lex_threads(int threads)
+{
+    lex_threads = threads < 1 ? 1 : threads;
+}
+
+struct lex_chunk {
+    const char* data;
+    size_t offset;
+    size_t end;
+    struct compile_process compiler;
+    struct vector* tokens;
+    char* diagnostics;
+    size_t diagnostics_size;
+    bool failed;
+    // Lexed on a thread of its own, which has to be joined
+    bool threaded;
+};
+
+// Same contract as getc/ungetc on the input file
+static char chunk_next_char(struct lex_process* process)
+{
+    struct lex_chunk* chunk = lex_process_private(process);
+    if (chunk->offset >= chunk->end) {
+        return EOF;
+    }
+    return chunk->data[chunk->offset++];
+}
+
+static char chunk_peek_char(struct lex_process* process)
+{
+    struct lex_chunk* chunk = lex_process_private(process);
+    return chunk->offset < chunk->end ? chunk->data[chunk->offset] : EOF;
+}
+
+static void chunk_push_char(struct lex_process* process, char c)
+{
+    struct lex_chunk* chunk = lex_process_private(process);
+    if (c != EOF) {
+        chunk->offset--;
+    }
+}
+
+static struct lex_process_functions chunk_lex_functions = {
+    .next_char = chunk_next_char,
+    .peek_char = chunk_peek_char,
+    .push_char = chunk_push_char
+};
+
+static void lex_chunk(void* data)
+{
+    struct lex_chunk* chunk = data;
+    struct lex_process* process = lex_process_create(&chunk->compiler, &chunk_lex_functions, chunk);
+    process->offset = chunk->offset;
+    lex(process);
+    chunk->tokens = process->token_vec;
+    free(process);
+}
+
+static void* lex_chunk_worker(void* data)
+{
+    struct lex_chunk* chunk = data;
+    FILE* diagnostics = open_memstream(&chunk->diagnostics, &chunk->diagnostics_size);
+    FILE* previous_diagnostics = compiler_diagnostics;
+    compiler_diagnostics = diagnostics;
+    chunk->failed = !compiler_run_protected(lex_chunk, chunk);
+    compiler_diagnostics = previous_diagnostics;
+    fclose(diagnostics);
+    return NULL;
+}
+
+// Picks up to max_chunks boundaries. A boundary is the start of a line that
+// begins outside of any comment or literal, at or after the chunk's share of
+// the input. starts[] gets each chunk's offset
+static int find_chunk_starts(const char* data, size_t size, int max_chunks, size_t* starts)
+{
+    enum { CODE, LINE_COMMENT, BLOCK_COMMENT, STRING, CHARACTER } state = CODE;
+    size_t share = size / max_chunks;
+    int count = 1;
+    starts[0] = 0;
+    for (size_t i = 0; i < size && count < max_chunks; i++) {
+        char c = data[i];
+        switch (state) {
+            case CODE:
+                if (c == '/' && i + 1 < size && data[i + 1] == '/') {
+                    state = LINE_COMMENT;
+                    i++;
+                } else if (c == '/' && i + 1 < size && data[i + 1] == '*') {
+                    state = BLOCK_COMMENT;
+                    i++;
+                } else if (c == '"') {
+                    state = STRING;
+                } else if (c == '\'') {
+                    state = CHARACTER;
+                }
+                break;
+            case LINE_COMMENT:
+                if (c == '\n') {
+                    state = CODE;
+                }
+                break;
+            case BLOCK_COMMENT:
+                if (c == '*' && i + 1 < size && data[i + 1] == '/') {
+                    state = CODE;
+                    i++;
+                }
+                break;
+            case STRING:
+                if (c == '"') {
+                    state = CODE;
+                }
+                break;
+            case CHARACTER:
+                if (c == '\'') {
+                    state = CODE;
+                }
+                break;
+        }
+        if (c == '\n' && state == CODE && i + 1 >= share * count && i + 1 < size) {
+            starts[count] = i + 1;
+            count++;
+        }
+    }
+    return count;
+}
+
+// Lexes the whole input of process into process->token_vec. Returns false
+// when the input is too small to split or can't be mapped, and the caller
+// should lex it sequentially instead
+bool lex_parallel(struct compile_process* process)
+{
+    struct stat st;
+    int fd = fileno(process->cfile.fp);
+    if (lex_threads <= 1 || fstat(fd, &st) != 0 || st.st_size < 2 * LEX_PARALLEL_MIN_CHUNK_SIZE) {
+        return false;
+    }
+    size_t size = st.st_size;
+    const char* data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    int max_chunks = size / LEX_PARALLEL_MIN_CHUNK_SIZE;
+    if (max_chunks > lex_threads) {
+        max_chunks = lex_threads;
+    }
+    size_t* starts = calloc(max_chunks, sizeof(size_t));
+    int count = find_chunk_starts(data, size, max_chunks, starts);
+
+    struct lex_chunk* chunks = calloc(count, sizeof(struct lex_chunk));
+    pthread_t* workers = calloc(count, sizeof(pthread_t));
+    for (int i = 0; i < count; i++) {
+        chunks[i].data = data;
+        chunks[i].offset = starts[i];
+        chunks[i].end = i + 1 < count ? starts[i + 1] : size;
+        chunks[i].compiler = *process;
+        chunks[i].threaded = pthread_create(&workers[i], NULL, lex_chunk_worker, &chunks[i]) == 0;
+        if (!chunks[i].threaded) {
+            lex_chunk_worker(&chunks[i]);
+        }
+    }
+
+    // Report diagnostics in file order, up to the first chunk that failed,
+    // which is what lexing sequentially would have printed
+    FILE* diagnostics = compiler_diagnostics ? compiler_diagnostics : stderr;
+    bool failed = false;
+    process->token_vec = vector_create(sizeof(struct token));
+    for (int i = 0; i < count; i++) {
+        if (chunks[i].threaded) {
+            pthread_join(workers[i], NULL);
+        }
+        if (!failed) {
+            fwrite(chunks[i].diagnostics, 1, chunks[i].diagnostics_size, diagnostics);
+            failed = chunks[i].failed;
+        }
+        free(chunks[i].diagnostics);
+        // Built if the chunk reported a position
+        free(chunks[i].compiler.line_starts);
+        if (chunks[i].failed) {
+            continue;
+        }
+        for (int t = 0; t < vector_total(chunks[i].tokens); t++) {
+            vector_add(process->token_vec, vector_get(chunks[i].tokens, t));
+        }
+        vector_free(chunks[i].tokens);
+    }
+    process->token_vector_count = vector_total(process->token_vec);
+
+    free(workers);
+    free(chunks);
+    free(starts);
+    munmap((void*) data, size);
+    if (failed) {
+        compiler_abort();
+    }
+    compiler_trace(TRACE_LEVEL_PHASE, "Lexed %d chunks in parallel, %d tokens\n", count, process->token_vector_count);
+    return true;
+}
@@ -8,8 +8,6 @@ struct lex_process* lex_process_create(struct compile_process* compiler, struct
     process -> private = private;
     process -> compiler =  compiler;
     process -> token_vec = vector_create(sizeof(struct token));
-    process -> pos.line = 1;
-    process -> pos.col = 1;
     return process;
 };
 
@@ -18,6 +16,23 @@ void lex_process_free(struct lex_process* process)
     vector_free(process -> token_vec);
     free(process);
 }
+// Frees the tokens lex() produced, not the vector holding them
+void lex_tokens_free(struct vector* tokens)
+{
+    for (int i = 0; i < vector_total(tokens); i++) {
+        struct token* token = vector_get(tokens, i);
+        switch (token->type) {
+            case TOKEN_TYPE_COMMENT:
+            case TOKEN_TYPE_IDENTIFIER:
+            case TOKEN_TYPE_KEYWORD:
+            case TOKEN_TYPE_STRING:
+            case TOKEN_TYPE_OPERATOR:
+                free((void*) token->sval);
+                break;
+        }
+        free(token);
+    }
+}
 void* lex_process_private(struct lex_process* process)
 {
     return process -> private;
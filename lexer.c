@@ -8,8 +8,9 @@
 
 
     
-static struct lex_process* lex_process;
-struct token tmptoken;
+// Thread-local so the compile server can lex several files at once
+static __thread struct lex_process* lex_process;
+__thread struct token tmptoken;
 struct token* read_next_token();
 static char peekc(){
     return lex_process -> functions -> peek_char(lex_process);
@@ -21,18 +22,32 @@ static char nextc()
     {
         buffer_write(lex_process -> parentheses_buffer, c);
     }
-    lex_process ->pos.col +=1;
-    if(c == '\n'){
-        lex_process -> pos.line +=1;
-        lex_process -> pos.col = 1;
-    }
+    // Only the offset is tracked, lines and columns are worked out on demand
+    lex_process -> offset++;
     return c;
 }
 
 static void pushc(char c){
     lex_process->functions -> push_char(lex_process, c);
+    // Like ungetc, pushing back EOF does nothing
+    if(c != EOF)
+    {
+        lex_process -> offset--;
+    }
 
 }
+
+// Copies the buffer's text out for a token, at its own size, and frees the
+// buffer. Keeping the buffer's data instead would leave every token holding
+// BUFFER_REALLOC_AMOUNT bytes
+static char* buffer_detach(struct buffer* buffer)
+{
+    size_t size = strlen(buffer_ptr(buffer)) + 1;
+    char* text = malloc(size);
+    memcpy(text, buffer_ptr(buffer), size);
+    buffer_free(buffer);
+    return text;
+}
 // Function to print token details (can be customized based on token structure)
 // void print_token(struct token *tkn) {
 //     printf("Token Type: %d\n", tkn->type);
@@ -62,28 +77,33 @@ static char assert_next_char(char c)
 
 
 
+__thread FILE* compiler_diagnostics = NULL;
+
+static void compiler_report(struct compile_process* compiler, const char* msg, va_list args)
+{
+    FILE* out = compiler_diagnostics ? compiler_diagnostics : stderr;
+    vfprintf(out, msg, args);
+    if (compiler) {
+        struct pos pos = compile_process_pos(compiler, compiler->offset);
+        fprintf(out, "on line %d, col %d, in file %s\n", pos.line, pos.col, pos.filename);
+    }
+}
+
 void compiler_error(struct compile_process* compiler, const char* msg, ...)
 {
     va_list args;
     va_start(args, msg);
-    vfprintf(stderr, msg, args);
+    compiler_report(compiler, msg, args);
     va_end(args);
-
-  
-    fprintf(stderr, "on line %d, col %d, in file %s\n", compiler->pos.line, compiler->pos.col, compiler->cfile.abs_path);
-    exit(COMPILER_FAILED_WITH_ERRORS);
+    compiler_abort();
 }
 
 void compiler_warning(struct compile_process* compiler, const char* msg, ...)
 {
     va_list args;
     va_start(args, msg);
-    vfprintf(stderr, msg, args);
+    compiler_report(compiler, msg, args);
     va_end(args);
-
-    
-    fprintf(stderr, "on line %d, col %d, in file %s\n", compiler->pos.line, compiler->pos.col, compiler->cfile.abs_path);
-    // exit(-1); // Uncomment if you want to terminate on warning
 }
 struct token* token_create_string(char start_delim, char end_delim)
 {
@@ -97,9 +117,8 @@ struct token* token_create_string(char start_delim, char end_delim)
         c = nextc();
     }
     buffer_write(buffer, 0x00);
-    token -> sval = buffer_ptr(buffer);
+    token -> sval = buffer_detach(buffer);
     token -> type = TOKEN_TYPE_STRING;
-    token->pos = lex_process->pos;
     // printf("%s\n", token->sval);
     return token;
 }
@@ -109,14 +128,6 @@ static struct token*  lexer_last_token()
     return vector_get(lex_process -> token_vec, lex_process->token_vec->total -1);
 }
 
-static struct token* handle_whitespace()
-{
-  
-    // char c;
-    nextc();
-    return read_next_token();
-}
-
 const char* read_number_str()
 {
     const char* num = NULL;
@@ -128,20 +139,21 @@ const char* read_number_str()
     }
 
     buffer_write(buffer, 0x00);
-    return buffer_ptr(buffer);
+    return buffer_detach(buffer);
 };
 
 unsigned long long read_number()
 {
     const char* s = read_number_str();
-    return atoll(s);
+    unsigned long long number = atoll(s);
+    free((void*) s);
+    return number;
 }
 struct token* token_create_number( unsigned long long number)
 {
     struct token* token = (struct token*)malloc(sizeof(struct token));
     token -> type =  TOKEN_TYPE_NUMBER;
     token -> llnum =  number;
-    token -> pos = lex_process->pos;
     if(lex_process -> current_expression_count>0)
     {
         if (lex_process->parentheses_buffer == NULL) {
@@ -194,6 +206,8 @@ bool op_valid(char* ptr){
            strcmp(ptr, "<") == 0 ||
            strcmp(ptr, ">") == 0 ||
            strcmp(ptr, "==") == 0 ||
+           strcmp(ptr, "!=") == 0 ||
+           strcmp(ptr, "^") == 0 ||
            strcmp(ptr, "->") == 0 ||
            strcmp(ptr, ",") == 0 ||
            strcmp(ptr, ".") == 0 ||
@@ -253,7 +267,7 @@ static void flush_back(struct buffer* buffer){
     char* ptr = buffer_ptr(buffer);
     int len = buffer -> len;
 
-    for(int i = len-1; i > 1; i--){
+    for(int i = len-1; i >= 1; i--){
         if(ptr[i]==0x00)
         {
             continue;
@@ -280,13 +294,14 @@ char* read_op()
     char* ptr = (char*) buffer_ptr(buffer);
 
     if (single_operator && !op_valid(ptr)) {
+        lex_process->compiler->offset = lex_process->offset;
         compiler_error(lex_process->compiler, "The operator %s isn't valid", ptr);
     } else if (!single_operator && !op_valid(ptr)) {
         flush_back(buffer);
         ptr[1] = 0x00;
     }
 
-    return ptr;
+    return buffer_detach(buffer);
 }
 
 struct token* token_make_newline()
@@ -298,7 +313,6 @@ struct token* token_make_newline()
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
     }
     token -> type =  TOKEN_TYPE_NEWLINE;
-    token -> pos = lex_process -> pos;
     return token;
 }
 struct token* token_create_one_line_comment()
@@ -316,9 +330,8 @@ struct token* token_create_one_line_comment()
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
     }
     struct token* token = (struct token*) malloc(sizeof(struct token));
-    token->sval = (char*) buffer_ptr(buffer); 
+    token->sval = buffer_detach(buffer); 
     token->type = TOKEN_TYPE_COMMENT;
-    token->pos = lex_process->pos;
     // printf("# %s\n", token->sval); 
 
     return token;
@@ -348,6 +361,7 @@ struct token* token_create_multiline_comment()
     
     if(c == EOF) 
     {
+        lex_process->compiler->offset = lex_process->offset;
         compiler_error(lex_process->compiler, "You did not close this multiline comment, fix it now!\n");
     }
     if(lex_process -> current_expression_count>0)
@@ -355,9 +369,8 @@ struct token* token_create_multiline_comment()
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
     }
     struct token* token = (struct token*) malloc(sizeof(struct token));
-    token->sval = (char*) buffer_ptr(buffer);   
+    token->sval = buffer_detach(buffer);   
     token->type = TOKEN_TYPE_COMMENT;
-    token->pos = lex_process->pos;
     // printf("/* %s */\n", token->sval); 
 
     return token;
@@ -379,7 +392,6 @@ struct token* token_create_string_or_operator()
     struct token* token = (struct token*) malloc(sizeof(struct token));
     token -> sval = read_op();
     token -> type = TOKEN_TYPE_OPERATOR;
-    token -> pos = lex_process -> pos;
     if(lex_process -> current_expression_count>0)
     {
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
@@ -412,6 +424,11 @@ struct token* handle_comment()
 static void handle_closing_expression()
 {
     lex_process -> current_expression_count--;
+    if(lex_process -> current_expression_count == 0 && lex_process -> parentheses_buffer)
+    {
+        buffer_free(lex_process -> parentheses_buffer);
+        lex_process -> parentheses_buffer = NULL;
+    }
     // if(lex_process -> current_expression_count < 0){
     //     compiler_error(lex_process -> compiler, "you tried closing an expression that wasn't open in the first place ");
     // }
@@ -434,7 +451,6 @@ struct token* make_symbol_token()
 
     struct token* token = (struct token*) malloc(sizeof(struct token));
     token -> cval = c;
-    token -> pos = lex_process -> pos;
     token -> type = TOKEN_TYPE_SYMBOL;
     // printf("%c\n",c);
 
@@ -458,15 +474,13 @@ struct token* make_token_identifer_or_keyword()
 
 
     buffer_write(buffer, 0x00);
-    char* ptr = (char*) buffer_ptr(buffer);
+    char* ptr = buffer_detach(buffer);
     if(lex_process -> current_expression_count>0)
     {
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
     }
     struct token* token = (struct token*) malloc(sizeof(struct token));
     token -> sval = ptr;
-    token -> pos = lex_process -> pos;
-    printf("%s\n", ptr);
 
     if( is_keyword(ptr))
     { 
@@ -536,6 +550,7 @@ struct token* token_make_quote() {
     }
 
     if (c != quote) {
+        lex_process->compiler->offset = lex_process->offset;
         compiler_error(lex_process->compiler, "Missing closing quote for string literal");
     }
 
@@ -545,9 +560,8 @@ struct token* token_make_quote() {
         tmptoken.between_brackets = buffer_ptr(lex_process -> parentheses_buffer);
     }
 
-    token->sval = buffer_ptr(buffer);
+    token->sval = buffer_detach(buffer);
     token->type = TOKEN_TYPE_STRING;
-    token->pos = lex_process->pos;
 
     // printf("Char token created: %s\n", token->sval); // Debug code
 
@@ -560,13 +574,18 @@ struct token* read_next_token()
 {
     struct  token* token = NULL;
   
-    // printf("Reading next token at line %d, col %d\n", lex_process->pos.line, lex_process->pos.col); // debug statement
+    // Blanks never start a token, skip them before noting where this one starts
+    while(peekc() == ' ' || peekc() == '\t')
+    {
+        nextc();
+    }
+    int start = lex_process -> offset;
     char c = peekc();
-    // printf("Reading next token at line %d, col %d, peeked char: %c\n", lex_process->pos.line, lex_process->pos.col, c);
     // printf("peeking c value %c\n", c);
     token = handle_comment();
     if(token)
     {
+        token -> offset = start;
         return token;
     }
     switch (c)
@@ -605,11 +624,6 @@ struct token* read_next_token()
             
             break;
 
-        case ' ':
-        case '\t':
-            token = handle_whitespace();
-            break;
-
         case '\'':
             token = token_make_quote();
             break;;
@@ -626,13 +640,17 @@ struct token* read_next_token()
                 token = read_special_token();
                 if(!token)
                 {
+                    lex_process->compiler->offset = lex_process->offset;
                     compiler_error(lex_process->compiler, "Unexpected Token");
                 }
             }
             break;
     }
     //  lex_process -> compiler -> token_vector_count ++;
-   
+    if(token)
+    {
+        token -> offset = start;
+    }
     return token;
 }
 int lex(struct lex_process* process)
@@ -640,7 +658,6 @@ int lex(struct lex_process* process)
     process -> current_expression_count = 0;
     process -> parentheses_buffer = NULL;
     lex_process =  process;
-    process -> pos.filename = process ->compiler->cfile.abs_path;
 
 
     struct token* token = read_next_token();
@@ -650,13 +667,21 @@ int lex(struct lex_process* process)
         {
             vector_add(process -> token_vec, token);
         }
+        else
+        {
+            free(token);
+        }
         
         token = read_next_token();
         
     }
+    if(process -> parentheses_buffer)
+    {
+        buffer_free(process -> parentheses_buffer);
+        process -> parentheses_buffer = NULL;
+    }
     lex_process->compiler->token_vector_count = vector_total(lex_process -> token_vec);
-    printf("Total count of tokens: %i\n",lex_process->compiler->token_vector_count);
-    printf("Total count of tokens: %i\n",vector_total(lex_process -> token_vec));
+    compiler_trace(TRACE_LEVEL_PHASE, "Total count of tokens: %i\n",lex_process->compiler->token_vector_count);
     // lexer_finalize();
 
 
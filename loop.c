@@ -0,0 +1,451 @@
+// Loop optimizations on the AST: invariant code motion and strength
+// reduction of induction variables.
+//
+// Every while loop is a natural loop with the condition as its header, so
+// there's no need to find loops in a flow graph. For each loop, outermost
+// first, the variables written anywhere in it are counted, and then:
+//
+// - Expressions that only read variables the loop never writes are computed
+//   once before the loop into a temporary, and read from it inside:
+//
+//     while (i < n * 4) { s += i * (a + b); i++; }
+//     becomes   { int loop.0 = n * 4; int loop.1 = a + b;
+//                 while (i < loop.0) { s += i * loop.1; i++; } }
+//
+// - A variable whose only writes are statements like `i++` or `i += 2` at
+//   the top of the body is an induction variable. `i * k`, with k constant
+//   or invariant, is kept in a temporary that is set before the loop and
+//   increased by the step times k after each update of i, so the loop
+//   adds instead of multiplying:
+//
+//     int loop.2 = i * loop.1;
+//     while (i < loop.0) { s += loop.2; i++; loop.2 += loop.1; }
+//
+// Nothing that may trap is moved: divisions only when the divisor is a
+// constant other than 0 and -1. Locals can only be written by name, so a
+// call in the loop doesn't stop anything else from being invariant. The
+// temporaries are named like the inliner's, with a dot no identifier can
+// contain, and are declared in a block with the loop, right before it. The
+// generator then tests the condition at the bottom of the loop.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct loop_write {
+    const char* name;
+    int count;
+};
+
+struct loop_reduction {
+    // The temporary holding variable * factor
+    const char* variable;
+    struct ast_node* factor;
+    const char* temporary;
+};
+
+struct loop_optimizer {
+    // Temporaries of the function being optimized, which numbers them
+    int temporary_count;
+    // The loop being optimized: what it writes, and the declarations of
+    // its temporaries that go right before it
+    struct loop_write* writes;
+    int write_count;
+    struct ast_node** preheader;
+    int preheader_count;
+    struct ast_node** hoisted;
+    int hoisted_count;
+    struct loop_reduction* reductions;
+    int reduction_count;
+};
+
+static int loop_writes(struct loop_optimizer* optimizer, const char* name)
+{
+    for (int i = 0; i < optimizer->write_count; i++) {
+        if (strcmp(optimizer->writes[i].name, name) == 0) {
+            return optimizer->writes[i].count;
+        }
+    }
+    return 0;
+}
+
+static void loop_add_write(struct loop_optimizer* optimizer, const char* name)
+{
+    for (int i = 0; i < optimizer->write_count; i++) {
+        if (strcmp(optimizer->writes[i].name, name) == 0) {
+            optimizer->writes[i].count++;
+            return;
+        }
+    }
+    if ((optimizer->write_count & (optimizer->write_count - 1)) == 0) {
+        optimizer->writes = realloc(optimizer->writes, (optimizer->write_count ? optimizer->write_count * 2 : 1) * sizeof(struct loop_write));
+    }
+    optimizer->writes[optimizer->write_count++] = (struct loop_write) { name, 1 };
+}
+
+static bool loop_is_assignment(enum operator_kind op)
+{
+    return op == OP_ASSIGN || op == OP_ADD_ASSIGN || op == OP_SUB_ASSIGN || op == OP_MUL_ASSIGN || op == OP_DIV_ASSIGN;
+}
+
+// A write to a variable or to an element of an array counts as a write to
+// the variable or the array
+static void loop_add_target_write(struct loop_optimizer* optimizer, struct ast_node* target)
+{
+    if (target->type == AST_ARRAY_ACCESS) {
+        target = target->array_access.array;
+    }
+    if (target->type == AST_IDENTIFIER) {
+        loop_add_write(optimizer, target->id_literal.value);
+    }
+}
+
+static void loop_collect_writes(struct loop_optimizer* optimizer, struct ast_node* node)
+{
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_BINARY_OP && loop_is_assignment(node->binary_op.op)) {
+        loop_add_target_write(optimizer, node->binary_op.left);
+    } else if (node->type == AST_UNARY_OP && (node->unary_op.op == OP_INCREMENT || node->unary_op.op == OP_DECREMENT)) {
+        loop_add_target_write(optimizer, node->unary_op.operand);
+    } else if (node->type == AST_DECLARATION) {
+        loop_add_write(optimizer, node->declaration.name);
+    }
+
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            loop_collect_writes(optimizer, (*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        loop_collect_writes(optimizer, *slots[i]);
+    }
+}
+
+static bool loop_same(struct ast_node* a, struct ast_node* b)
+{
+    if (a->type != b->type) {
+        return false;
+    }
+    switch (a->type) {
+        case AST_NUMBER:
+            return a->number.value == b->number.value;
+        case AST_IDENTIFIER:
+            return strcmp(a->id_literal.value, b->id_literal.value) == 0;
+        case AST_UNARY_OP:
+            return a->unary_op.op == b->unary_op.op && loop_same(a->unary_op.operand, b->unary_op.operand);
+        case AST_BINARY_OP:
+            return a->binary_op.op == b->binary_op.op && loop_same(a->binary_op.left, b->binary_op.left) &&
+                   loop_same(a->binary_op.right, b->binary_op.right);
+        default:
+            return false;
+    }
+}
+
+static struct ast_node* loop_identifier(int offset, const char* name)
+{
+    return create_id_literal_node(AST_IDENTIFIER, offset, name);
+}
+
+// A new temporary set to value, declared right before the loop
+static const char* loop_temporary(struct loop_optimizer* optimizer, struct ast_node* value)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "loop.%d", optimizer->temporary_count++);
+    struct ast_node* declaration = create_declaration_node(value->offset, "int", name, value);
+    optimizer->preheader = ast_node_list_append(optimizer->preheader, optimizer->preheader_count++, declaration);
+    return declaration->declaration.name;
+}
+
+// Replaces the invariant expression in *slot with a temporary set before the
+// loop, the same one for expressions that are alike
+static void loop_hoist(struct loop_optimizer* optimizer, struct ast_node** slot)
+{
+    struct ast_node* node = *slot;
+    // Loading a negated constant from memory is no cheaper than negating it
+    if (node->type == AST_UNARY_OP && node->unary_op.operand->type == AST_NUMBER) {
+        return;
+    }
+    if (node->type != AST_UNARY_OP && node->type != AST_BINARY_OP) {
+        return;
+    }
+    for (int i = 0; i < optimizer->hoisted_count; i++) {
+        struct ast_node* declaration = optimizer->hoisted[i];
+        if (loop_same(declaration->declaration.initial_value, node)) {
+            *slot = loop_identifier(node->offset, declaration->declaration.name);
+            return;
+        }
+    }
+    const char* temporary = loop_temporary(optimizer, node);
+    optimizer->hoisted = ast_node_list_append(optimizer->hoisted, optimizer->hoisted_count++, optimizer->preheader[optimizer->preheader_count - 1]);
+    *slot = loop_identifier(node->offset, temporary);
+}
+
+// Whether the expression in *slot is invariant in the loop. The largest
+// invariant expressions under a node that isn't are hoisted
+static bool loop_hoist_walk(struct loop_optimizer* optimizer, struct ast_node** slot)
+{
+    struct ast_node* node = *slot;
+    if (!node) {
+        return false;
+    }
+    struct ast_node** children[AST_MAX_SLOTS];
+    int child_count = 0;
+    bool invariant;
+    switch (node->type) {
+        case AST_NUMBER:
+            return true;
+        case AST_IDENTIFIER:
+            return loop_writes(optimizer, node->id_literal.value) == 0;
+        case AST_UNARY_OP:
+            invariant = node->unary_op.op != OP_INCREMENT && node->unary_op.op != OP_DECREMENT;
+            break;
+        case AST_BINARY_OP:
+            invariant = !loop_is_assignment(node->binary_op.op);
+            if (node->binary_op.op == OP_DIV || node->binary_op.op == OP_MOD) {
+                struct ast_node* divisor = node->binary_op.right;
+                invariant = invariant && divisor->type == AST_NUMBER && divisor->number.value != 0 && divisor->number.value != -1;
+            }
+            break;
+        default:
+            invariant = false;
+            break;
+    }
+
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            if (loop_hoist_walk(optimizer, &(*list)[i])) {
+                loop_hoist(optimizer, &(*list)[i]);
+            }
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        if (loop_hoist_walk(optimizer, slots[i])) {
+            children[child_count++] = slots[i];
+        } else {
+            invariant = false;
+        }
+    }
+    if (invariant) {
+        return true;
+    }
+    for (int i = 0; i < child_count; i++) {
+        loop_hoist(optimizer, children[i]);
+    }
+    return false;
+}
+
+// The step of a top level statement of the body that updates an induction
+// variable, in *step, or NULL if it isn't one
+static const char* loop_update(struct ast_node* statement, long long* step)
+{
+    if (statement->type == AST_UNARY_OP && (statement->unary_op.op == OP_INCREMENT || statement->unary_op.op == OP_DECREMENT) &&
+        statement->unary_op.operand->type == AST_IDENTIFIER) {
+        *step = statement->unary_op.op == OP_INCREMENT ? 1 : -1;
+        return statement->unary_op.operand->id_literal.value;
+    }
+    if (statement->type == AST_BINARY_OP && (statement->binary_op.op == OP_ADD_ASSIGN || statement->binary_op.op == OP_SUB_ASSIGN) &&
+        statement->binary_op.left->type == AST_IDENTIFIER && statement->binary_op.right->type == AST_NUMBER) {
+        long long value = statement->binary_op.right->number.value;
+        *step = statement->binary_op.op == OP_ADD_ASSIGN ? value : (long long) (0ULL - (unsigned long long) value);
+        return statement->binary_op.left->id_literal.value;
+    }
+    return NULL;
+}
+
+// Whether name is an induction variable of the loop whose body is body: all
+// its writes are updates at the top of the body. unit is set when every
+// update steps by one
+static bool loop_induction(struct loop_optimizer* optimizer, struct ast_node* body, const char* name, bool* unit)
+{
+    int updates = 0;
+    *unit = true;
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        long long step;
+        const char* variable = loop_update(body->block.statements[i], &step);
+        if (variable && strcmp(variable, name) == 0) {
+            updates++;
+            *unit = *unit && (step == 1 || step == -1);
+        }
+    }
+    return updates > 0 && updates == loop_writes(optimizer, name);
+}
+
+// Replaces induction variable * factor products under *slot with
+// temporaries that the updates keep up to date
+static void loop_reduce_walk(struct loop_optimizer* optimizer, struct ast_node* body, struct ast_node** slot)
+{
+    struct ast_node* node = *slot;
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_BINARY_OP && node->binary_op.op == OP_MUL) {
+        for (int side = 0; side < 2; side++) {
+            struct ast_node* variable = side ? node->binary_op.right : node->binary_op.left;
+            struct ast_node* factor = side ? node->binary_op.left : node->binary_op.right;
+            bool unit;
+            if (variable->type != AST_IDENTIFIER || !loop_induction(optimizer, body, variable->id_literal.value, &unit)) {
+                continue;
+            }
+            // Stepping by a variable factor needs a multiplication again
+            // unless the variable steps by one
+            if (!(factor->type == AST_NUMBER || (factor->type == AST_IDENTIFIER && unit && loop_writes(optimizer, factor->id_literal.value) == 0))) {
+                continue;
+            }
+            const char* temporary = NULL;
+            for (int i = 0; i < optimizer->reduction_count && !temporary; i++) {
+                struct loop_reduction* reduction = &optimizer->reductions[i];
+                if (strcmp(reduction->variable, variable->id_literal.value) == 0 && loop_same(reduction->factor, factor)) {
+                    temporary = reduction->temporary;
+                }
+            }
+            if (!temporary) {
+                temporary = loop_temporary(optimizer, node);
+                if ((optimizer->reduction_count & (optimizer->reduction_count - 1)) == 0) {
+                    optimizer->reductions = realloc(optimizer->reductions, (optimizer->reduction_count ? optimizer->reduction_count * 2 : 1) * sizeof(struct loop_reduction));
+                }
+                optimizer->reductions[optimizer->reduction_count++] = (struct loop_reduction) { variable->id_literal.value, factor, temporary };
+            }
+            *slot = loop_identifier(node->offset, temporary);
+            return;
+        }
+    }
+
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            loop_reduce_walk(optimizer, body, &(*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        loop_reduce_walk(optimizer, body, slots[i]);
+    }
+}
+
+// The statement that keeps reduction in step after an update by step
+static struct ast_node* loop_reduction_update(struct loop_reduction* reduction, long long step, int offset)
+{
+    struct ast_node* increment;
+    enum operator_kind op = OP_ADD_ASSIGN;
+    if (reduction->factor->type == AST_NUMBER) {
+        // Wraps like the multiplication it replaces
+        increment = create_number_node(offset, (long long) ((unsigned long long) step * (unsigned long long) reduction->factor->number.value));
+    } else {
+        increment = loop_identifier(offset, reduction->factor->id_literal.value);
+        op = step == 1 ? OP_ADD_ASSIGN : OP_SUB_ASSIGN;
+    }
+    return create_binary_op_node(offset, loop_identifier(offset, reduction->temporary), increment, op);
+}
+
+static void loop_reduce(struct loop_optimizer* optimizer, struct ast_node* loop)
+{
+    struct ast_node* body = loop->while_loop.body;
+    if (body->type != AST_BLOCK) {
+        return;
+    }
+    loop_reduce_walk(optimizer, body, &loop->while_loop.condition);
+    loop_reduce_walk(optimizer, body, &loop->while_loop.body);
+    if (!optimizer->reduction_count) {
+        return;
+    }
+
+    struct ast_node** statements = NULL;
+    int count = 0;
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        struct ast_node* statement = body->block.statements[i];
+        statements = ast_node_list_append(statements, count++, statement);
+        long long step;
+        const char* variable = loop_update(statement, &step);
+        for (int j = 0; variable && j < optimizer->reduction_count; j++) {
+            if (strcmp(optimizer->reductions[j].variable, variable) == 0) {
+                statements = ast_node_list_append(statements, count++, loop_reduction_update(&optimizer->reductions[j], step, statement->offset));
+            }
+        }
+    }
+    body->block.statements = statements;
+    body->block.stmt_count = count;
+}
+
+static void loop_walk(struct loop_optimizer* optimizer, struct ast_node** slot);
+
+static void loop_optimize(struct loop_optimizer* optimizer, struct ast_node** slot)
+{
+    struct ast_node* loop = *slot;
+    optimizer->write_count = 0;
+    optimizer->preheader_count = 0;
+    optimizer->preheader = NULL;
+    optimizer->hoisted_count = 0;
+    optimizer->hoisted = NULL;
+    optimizer->reduction_count = 0;
+    loop_collect_writes(optimizer, loop);
+
+    if (loop_hoist_walk(optimizer, &loop->while_loop.condition)) {
+        loop_hoist(optimizer, &loop->while_loop.condition);
+    }
+    loop_hoist_walk(optimizer, &loop->while_loop.body);
+    // The temporaries set before the loop aren't written in it
+    loop_reduce(optimizer, loop);
+
+    if (optimizer->preheader_count) {
+        struct ast_node* block = create_block_node(loop->offset);
+        block->block.statements = ast_node_list_append(optimizer->preheader, optimizer->preheader_count, loop);
+        block->block.stmt_count = optimizer->preheader_count + 1;
+        *slot = block;
+    }
+    // Then the loops inside, with what is left
+    loop_walk(optimizer, &loop->while_loop.body);
+}
+
+static void loop_walk(struct loop_optimizer* optimizer, struct ast_node** slot)
+{
+    struct ast_node* node = *slot;
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_WHILE || node->type == AST_WHILE_LOOP) {
+        loop_optimize(optimizer, slot);
+        return;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            loop_walk(optimizer, &(*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        loop_walk(optimizer, slots[i]);
+    }
+}
+
+void optimize_loops(struct ast_node* root)
+{
+    struct loop_optimizer optimizer = { 0 };
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* function = root->root.statements[i];
+        if (function->type != AST_FUNCTION_DEFINITION || !function->function_def.body ||
+            function->function_def.body->type != AST_BLOCK) {
+            continue;
+        }
+        optimizer.temporary_count = 0;
+        struct ast_node* body = function->function_def.body;
+        for (int j = 0; j < body->block.stmt_count; j++) {
+            loop_walk(&optimizer, &body->block.statements[j]);
+        }
+    }
+    free(optimizer.writes);
+    free(optimizer.reductions);
+}
@@ -1,12 +1,190 @@
     #include <stdio.h>
+    #include <stdlib.h>
+    #include <string.h>
     #include "helpers/vector.h"
     #include "compiler.h"
 
+    static void usage(const char* program)
+    {
+        fprintf(stderr, "usage: %s [--cache-dir <dir> [--cache-stats]] [--connect <socket>] [--jobs <n>] [-O0] [-fprofile-generate[=<file>] | -fprofile-use[=<file>]] [-c | --emit-ast] [-o <output>] [input.c | input.ast]\n", program);
+        fprintf(stderr, "       %s --run [--cache-dir <dir>] [--jobs <n>] [-O0] [-fprofile-generate[=<file>] | -fprofile-use[=<file>]] [input.c]\n", program);
+        fprintf(stderr, "       %s --interpret [input.c]\n", program);
+        fprintf(stderr, "       %s --server <socket> [--threads <n>] [--cache-dir <dir>]\n", program);
+    }
+
+    // input.c profiles to input.profile, unless -fprofile-generate= or
+    // -fprofile-use= name the file
+    static char* default_profile_path(const char* input)
+    {
+        const char* slash = strrchr(input, '/');
+        const char* dot = strrchr(input, '.');
+        size_t length = dot && dot > (slash ? slash : input) ? (size_t) (dot - input) : strlen(input);
+        char* path = malloc(length + sizeof(".profile"));
+        memcpy(path, input, length);
+        strcpy(path + length, ".profile");
+        return path;
+    }
 
-    int main()
+    int main(int argc, char** argv)
     {
-        int res = compile_file("./test.c", "./test.s",0);
-        if (res == COMPILER_FILE_COMPILED_OK)
+        const char* input = "./test.c";
+        const char* output = NULL;
+        int flags = 0;
+        bool run = false;
+        bool interpret = false;
+        bool print_cache_stats = false;
+        const char* server_socket = NULL;
+        const char* connect_socket = NULL;
+        int server_threads = 0;
+        const char* profile_path = NULL;
+        for (int i = 1; i < argc; i++)
+        {
+            if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            {
+                output = argv[++i];
+            }
+            else if (strcmp(argv[i], "--cache-dir") == 0 && i + 1 < argc)
+            {
+                compiler_set_cache_dir(argv[++i]);
+            }
+            else if (strcmp(argv[i], "--server") == 0 && i + 1 < argc)
+            {
+                server_socket = argv[++i];
+            }
+            else if (strcmp(argv[i], "--jobs") == 0 && i + 1 < argc)
+            {
+                int jobs = atoi(argv[++i]);
+                compiler_set_lex_threads(jobs);
+                compiler_set_codegen_threads(jobs);
+            }
+            else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            {
+                server_threads = atoi(argv[++i]);
+            }
+            else if (strcmp(argv[i], "--connect") == 0 && i + 1 < argc)
+            {
+                connect_socket = argv[++i];
+            }
+            else if (strcmp(argv[i], "-c") == 0)
+            {
+                // Object file instead of assembly, no `as` needed
+                flags |= COMPILE_PROCESS_EMIT_OBJECT;
+            }
+            else if (strcmp(argv[i], "-O0") == 0)
+            {
+                flags |= COMPILE_PROCESS_NO_OPTIMIZE;
+            }
+            else if (strncmp(argv[i], "-fprofile-generate", 18) == 0 && (argv[i][18] == 0 || argv[i][18] == '='))
+            {
+                // Count branches into a profile file when the program runs
+                flags |= COMPILE_PROCESS_PROFILE_GENERATE;
+                profile_path = argv[i][18] ? argv[i] + 19 : NULL;
+            }
+            else if (strncmp(argv[i], "-fprofile-use", 13) == 0 && (argv[i][13] == 0 || argv[i][13] == '='))
+            {
+                // Lay out and inline by the counts in the profile file
+                flags |= COMPILE_PROCESS_PROFILE_USE;
+                profile_path = argv[i][13] ? argv[i] + 14 : NULL;
+            }
+            else if (strcmp(argv[i], "--emit-ast") == 0)
+            {
+                // The parsed AST, for tools and later compiles to load
+                flags |= COMPILE_PROCESS_EMIT_AST;
+            }
+            else if (strcmp(argv[i], "--run") == 0)
+            {
+                run = true;
+            }
+            else if (strcmp(argv[i], "--interpret") == 0)
+            {
+                interpret = true;
+            }
+            else if (strcmp(argv[i], "--cache-stats") == 0)
+            {
+                print_cache_stats = true;
+            }
+            else if (argv[i][0] == '-')
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            else
+            {
+                input = argv[i];
+            }
+        }
+
+        if (!output)
+        {
+            output = flags & COMPILE_PROCESS_EMIT_AST ? "./test.ast" : flags & COMPILE_PROCESS_EMIT_OBJECT ? "./test.o" : "./test.s";
+        }
+
+        if ((run || interpret) && (server_socket || connect_socket || (run && interpret)))
+        {
+            usage(argv[0]);
+            return 1;
+        }
+        int profile_flags = flags & (COMPILE_PROCESS_PROFILE_GENERATE | COMPILE_PROCESS_PROFILE_USE);
+        if (profile_flags)
+        {
+            // The interpreter doesn't count, and the server and its clients
+            // don't share the file
+            if (profile_flags != COMPILE_PROCESS_PROFILE_GENERATE && profile_flags != COMPILE_PROCESS_PROFILE_USE)
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            if (interpret || server_socket || connect_socket || (flags & COMPILE_PROCESS_EMIT_AST))
+            {
+                usage(argv[0]);
+                return 1;
+            }
+            compiler_set_profile_path(profile_path && profile_path[0] ? profile_path : default_profile_path(input));
+        }
+        if (interpret)
+        {
+            // Bytecode on the interpreter, nothing is written
+            int exit_code = 0;
+            if (compile_and_interpret(input, &exit_code) != COMPILER_FILE_COMPILED_OK)
+            {
+                printf("file compilation failed\n");
+                return 1;
+            }
+            return exit_code;
+        }
+        if (run)
+        {
+            // Compile into memory and run it here; the exit status is the
+            // program's
+            int exit_code = 0;
+            if (compile_and_run(input, flags, &exit_code) != COMPILER_FILE_COMPILED_OK)
+            {
+                printf("file compilation failed\n");
+                return 1;
+            }
+            return exit_code;
+        }
+
+        if (server_socket)
+        {
+            return compile_server_run(server_socket, server_threads);
+        }
+
+        int res;
+        long long elapsed_us = 0;
+        if (connect_socket)
+        {
+            res = compile_client_run(connect_socket, input, output, flags, &elapsed_us);
+        }
+        else
+        {
+            res = compile_file(input, output, flags);
+        }
+        if (res == COMPILER_FILE_COMPILED_OK && connect_socket)
+        {
+            printf("file compiled successfully in %lld us by the compile server\n", elapsed_us);
+        }
+        else if (res == COMPILER_FILE_COMPILED_OK)
         {
             printf("file compiled successfully\n");
         }
@@ -16,5 +194,11 @@
         else{
             printf("Unknown error occurred\n");
         }
-        return 0;
-    }
\ No newline at end of file
+        if (print_cache_stats)
+        {
+            printf("cache: files %d hits %d misses, functions %d hits %d misses\n",
+                   cache_stats.file_hits, cache_stats.file_misses,
+                   cache_stats.function_hits, cache_stats.function_misses);
+        }
+        return res == COMPILER_FILE_COMPILED_OK ? 0 : 1;
+    }
@@ -4,76 +4,363 @@
 #include <stdio.h>
 #include "./helpers/vector.h"
 #include <string.h>
+#include <stddef.h>
 
 
+// Blocks the AST is allocated from. Allocations are 8-byte aligned; anything
+// larger than a block gets a block of its own
+#define AST_ARENA_BLOCK_SIZE (64 * 1024)
+
+struct ast_arena_block {
+    struct ast_arena_block* next;
+    size_t used;
+    size_t size;
+    char data[];
+};
+
+static __thread struct ast_arena* current_arena = NULL;
+
+void ast_arena_use(struct ast_arena* arena) {
+    current_arena = arena;
+}
+
+void* ast_arena_alloc(size_t size) {
+    size = (size + 7) & ~(size_t) 7;
+    struct ast_arena_block* block = current_arena->blocks;
+    if (!block || block->used + size > block->size) {
+        size_t block_size = size > AST_ARENA_BLOCK_SIZE ? size : AST_ARENA_BLOCK_SIZE;
+        block = malloc(sizeof(struct ast_arena_block) + block_size);
+        block->used = 0;
+        block->size = block_size;
+        block->next = current_arena->blocks;
+        current_arena->blocks = block;
+    }
+    void* memory = block->data + block->used;
+    block->used += size;
+    return memory;
+}
+
+void ast_arena_free(struct ast_arena* arena) {
+    struct ast_arena_block* block = arena->blocks;
+    while (block) {
+        struct ast_arena_block* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->blocks = NULL;
+}
+
+char* ast_arena_strdup(const char* string) {
+    size_t length = strlen(string) + 1;
+    char* copy = ast_arena_alloc(length);
+    memcpy(copy, string, length);
+    return copy;
+}
+
+// Appends node to a list of count nodes. Lists are arena memory too, and
+// grow by doubling whenever count reaches a power of two
+struct ast_node** ast_node_list_append(struct ast_node** list, int count, struct ast_node* node) {
+    if ((count & (count - 1)) == 0) {
+        struct ast_node** grown = ast_arena_alloc((count ? count * 2 : 1) * sizeof(struct ast_node*));
+        if (count) {
+            memcpy(grown, list, count * sizeof(struct ast_node*));
+        }
+        list = grown;
+    }
+    list[count] = node;
+    return list;
+}
+
+#define AST_NODE_SIZE(member) (offsetof(struct ast_node, member) + sizeof(((struct ast_node*) 0)->member))
+
+// Bytes a node of type needs: the header and the union member it uses
+static size_t ast_node_size(enum ast_node_type type) {
+    switch (type) {
+        case AST_ROOT:
+            return AST_NODE_SIZE(root);
+        case AST_IDENTIFIER:
+        case AST_STRING:
+        case AST_CHAR:
+        case AST_LITERAL:
+        case AST_VARIABLE:
+        case AST_PREPROCESSOR:
+            return AST_NODE_SIZE(id_literal);
+        case AST_NUMBER:
+            return AST_NODE_SIZE(number);
+        case AST_BINARY_OP:
+            return AST_NODE_SIZE(binary_op);
+        case AST_UNARY_OP:
+            return AST_NODE_SIZE(unary_op);
+        case AST_ARRAY_ACCESS:
+            return AST_NODE_SIZE(array_access);
+        case AST_FUNCTION_CALL:
+            return AST_NODE_SIZE(function_call);
+        case AST_DECLARATION:
+            return AST_NODE_SIZE(declaration);
+        case AST_IF_STMT:
+            return AST_NODE_SIZE(if_stmt);
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+            return AST_NODE_SIZE(while_loop);
+        case AST_FOR:
+            return AST_NODE_SIZE(for_loop);
+        case AST_PROGRAM:
+        case AST_BLOCK:
+            return AST_NODE_SIZE(block);
+        case AST_FUNCTION_DEFINITION:
+            return AST_NODE_SIZE(function_def);
+        case AST_RETURN:
+            return AST_NODE_SIZE(return_stmt);
+        case AST_PRINT:
+            return AST_NODE_SIZE(print);
+        case AST_SWITCH:
+            return AST_NODE_SIZE(switch_stmt);
+        case AST_CASE:
+            return AST_NODE_SIZE(case_label);
+        case AST_BREAK:
+            return offsetof(struct ast_node, root);
+        default:
+            return sizeof(struct ast_node);
+    }
+}
+
+// A number, possibly under unary - + ~, as in case labels and divisors
+bool ast_constant(struct ast_node* node, long long* value) {
+    if (node->type == AST_NUMBER) {
+        *value = node->number.value;
+        return true;
+    }
+    if (node->type != AST_UNARY_OP || !ast_constant(node->unary_op.operand, value)) {
+        return false;
+    }
+    switch (node->unary_op.op) {
+        case OP_SUB:
+            *value = (long long) -(unsigned long long) *value;
+            return true;
+        case OP_ADD:
+            return true;
+        case OP_BIT_NOT:
+            *value = ~*value;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Pointers to the fixed child fields of node, in order. Lists of children
+// (statements, arguments, parameters) are handled by ast_node_list
+int ast_node_slots(struct ast_node* node, struct ast_node** slots[AST_MAX_SLOTS]) {
+    switch (node->type) {
+        case AST_BINARY_OP:
+            slots[0] = &node->binary_op.left;
+            slots[1] = &node->binary_op.right;
+            return 2;
+        case AST_UNARY_OP:
+            slots[0] = &node->unary_op.operand;
+            return 1;
+        case AST_ARRAY_ACCESS:
+            slots[0] = &node->array_access.array;
+            slots[1] = &node->array_access.index;
+            return 2;
+        case AST_DECLARATION:
+            slots[0] = &node->declaration.initial_value;
+            slots[1] = &node->declaration.array_size;
+            return 2;
+        case AST_IF_STMT:
+            slots[0] = &node->if_stmt.condition;
+            slots[1] = &node->if_stmt.true_body;
+            slots[2] = &node->if_stmt.false_body;
+            return 3;
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+            slots[0] = &node->while_loop.condition;
+            slots[1] = &node->while_loop.body;
+            return 2;
+        case AST_FOR:
+            slots[0] = &node->for_loop.init;
+            slots[1] = &node->for_loop.condition;
+            slots[2] = &node->for_loop.update;
+            slots[3] = &node->for_loop.body;
+            return 4;
+        case AST_RETURN:
+            slots[0] = &node->return_stmt.value;
+            return 1;
+        case AST_PRINT:
+            slots[0] = &node->print.expression;
+            return 1;
+        case AST_FUNCTION_DEFINITION:
+            slots[0] = &node->function_def.body;
+            return 1;
+        case AST_SWITCH:
+            slots[0] = &node->switch_stmt.value;
+            slots[1] = &node->switch_stmt.body;
+            return 2;
+        case AST_CASE:
+            slots[0] = &node->case_label.value;
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// The list of children of node, if it has one; they come before the slots
+bool ast_node_list(struct ast_node* node, struct ast_node**** list, int** count) {
+    switch (node->type) {
+        case AST_ROOT:
+            *list = &node->root.statements;
+            *count = &node->root.stmt_count;
+            return true;
+        case AST_PROGRAM:
+        case AST_BLOCK:
+            *list = &node->block.statements;
+            *count = &node->block.stmt_count;
+            return true;
+        case AST_FUNCTION_CALL:
+            *list = &node->function_call.arguments;
+            *count = &node->function_call.arg_count;
+            return true;
+        case AST_FUNCTION_DEFINITION:
+            *list = &node->function_def.parameters;
+            *count = &node->function_def.param_count;
+            return true;
+        default:
+            return false;
+    }
+}
+
+// The names a node carries: its name, and the type that goes with it
+void ast_node_names(struct ast_node* node, char*** name, char*** type_name) {
+    *name = NULL;
+    *type_name = NULL;
+    switch (node->type) {
+        case AST_IDENTIFIER:
+        case AST_STRING:
+        case AST_CHAR:
+        case AST_LITERAL:
+        case AST_VARIABLE:
+        case AST_PREPROCESSOR:
+            *name = &node->id_literal.value;
+            break;
+        case AST_FUNCTION_CALL:
+            *name = &node->function_call.name;
+            break;
+        case AST_DECLARATION:
+            *name = &node->declaration.name;
+            *type_name = &node->declaration.type;
+            break;
+        case AST_FUNCTION_DEFINITION:
+            *name = &node->function_def.name;
+            *type_name = &node->function_def.return_type;
+            break;
+        default:
+            break;
+    }
+}
+
+// A copy of the subtree at node. Names, and fields that aren't children
+// like a function's inlined list, are shared with node
+struct ast_node* ast_copy(struct ast_node* node) {
+    if (!node) {
+        return NULL;
+    }
+    size_t size = ast_node_size(node->type);
+    struct ast_node* copy = ast_arena_alloc(size);
+    memcpy(copy, node, size);
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(copy, &list, &count)) {
+        struct ast_node** children = NULL;
+        for (int i = 0; i < *count; i++) {
+            children = ast_node_list_append(children, i, ast_copy((*list)[i]));
+        }
+        *list = children;
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(copy, slots);
+    for (int i = 0; i < slot_count; i++) {
+        *slots[i] = ast_copy(*slots[i]);
+    }
+    return copy;
+}
+
 // AST node creation functions
-struct ast_node* create_ast_node(enum ast_node_type type, struct pos pos) {
-    struct ast_node* node = calloc(1, sizeof(struct ast_node));
+struct ast_node* create_ast_node(enum ast_node_type type, int offset) {
+    size_t size = ast_node_size(type);
+    struct ast_node* node = ast_arena_alloc(size);
+    memset(node, 0, size);
     node->type = type;
-    node->pos = pos;
+    node->offset = offset;
     return node;
 }
-struct ast_node* create_id_literal_node(enum ast_node_type type, struct pos pos, const char* value) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = type;
-    node->pos = pos;
-    node->id_literal.value = strdup(value);
+struct ast_node* create_id_literal_node(enum ast_node_type type, int offset, const char* value) {
+    struct ast_node* node = create_ast_node(type, offset);
+    node->id_literal.value = ast_arena_strdup(value);
+    return node;
+}
+
+struct ast_node* create_number_node(int offset, long long value) {
+    struct ast_node* node = create_ast_node(AST_NUMBER, offset);
+    node->number.value = value;
     return node;
 }
 
-struct ast_node* create_binary_op_node(struct pos pos, struct ast_node* left, struct ast_node* right, const char* operator) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_BINARY_OP;
-    node->pos = pos;
+struct ast_node* create_binary_op_node(int offset, struct ast_node* left, struct ast_node* right, enum operator_kind op) {
+    struct ast_node* node = create_ast_node(AST_BINARY_OP, offset);
     node->binary_op.left = left;
     node->binary_op.right = right;
-    node->binary_op.operator = strdup(operator);
+    node->binary_op.op = op;
+    node->binary_op.operator = operator_table[op].text;
+    return node;
+}
+
+struct ast_node* create_unary_op_node(int offset, struct ast_node* operand, enum operator_kind op, bool is_postfix) {
+    struct ast_node* node = create_ast_node(AST_UNARY_OP, offset);
+    node->unary_op.operand = operand;
+    node->unary_op.op = op;
+    node->unary_op.operator = operator_table[op].text;
+    node->unary_op.is_postfix = is_postfix;
     return node;
 }
 
-struct ast_node* create_function_definition_node(struct pos pos, const char* return_type, const char* name, struct ast_node** parameters, int param_count, struct ast_node* body) {
-    struct ast_node* node = create_ast_node(AST_FUNCTION_DEFINITION, pos);
-    node->function_def.return_type = strdup(return_type);
-    node->function_def.name = strdup(name);
+struct ast_node* create_array_access_node(int offset, struct ast_node* array, struct ast_node* index) {
+    struct ast_node* node = create_ast_node(AST_ARRAY_ACCESS, offset);
+    node->array_access.array = array;
+    node->array_access.index = index;
+    return node;
+}
+
+struct ast_node* create_function_definition_node(int offset, const char* return_type, const char* name, struct ast_node** parameters, int param_count, struct ast_node* body) {
+    struct ast_node* node = create_ast_node(AST_FUNCTION_DEFINITION, offset);
+    node->function_def.return_type = ast_arena_strdup(return_type);
+    node->function_def.name = ast_arena_strdup(name);
     node->function_def.parameters = parameters;
     node->function_def.param_count = param_count;
     node->function_def.body = body;
     return node;
 }
-struct ast_node* create_function_call_node(struct pos pos, const char* name, struct ast_node** arguments, int arg_count) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_FUNCTION_CALL;
-    node->pos = pos;
-    node->function_call.name = strdup(name);
+struct ast_node* create_function_call_node(int offset, const char* name, struct ast_node** arguments, int arg_count) {
+    struct ast_node* node = create_ast_node(AST_FUNCTION_CALL, offset);
+    node->function_call.name = ast_arena_strdup(name);
     node->function_call.arguments = arguments;
     node->function_call.arg_count = arg_count;
     return node;
 }
 
-struct ast_node* create_declaration_node(struct pos pos, const char* type, const char* name, struct ast_node* initial_value) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_DECLARATION;
-    node->pos = pos;
-    node->declaration.type = strdup(type);
-    node->declaration.name = strdup(name);
+struct ast_node* create_declaration_node(int offset, const char* type, const char* name, struct ast_node* initial_value) {
+    struct ast_node* node = create_ast_node(AST_DECLARATION, offset);
+    node->declaration.type = ast_arena_strdup(type);
+    node->declaration.name = ast_arena_strdup(name);
     node->declaration.initial_value = initial_value;
     return node;
 }
 
-struct ast_node* create_block_node(struct pos pos) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_BLOCK;
-    node->pos = pos;
-    node->block.statements = NULL;
-    node->block.stmt_count = 0;
-    return node;
+struct ast_node* create_block_node(int offset) {
+    return create_ast_node(AST_BLOCK, offset);
 }
 
 // Function to create an if statement node
-struct ast_node* create_if_stmt_node(struct pos pos, struct ast_node* condition, struct ast_node* true_body, struct ast_node* false_body) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_IF_STMT;
-    node->pos = pos;
+struct ast_node* create_if_stmt_node(int offset, struct ast_node* condition, struct ast_node* true_body, struct ast_node* false_body) {
+    struct ast_node* node = create_ast_node(AST_IF_STMT, offset);
     node->if_stmt.condition = condition;
     node->if_stmt.true_body = true_body;
     node->if_stmt.false_body = false_body;
@@ -81,17 +368,15 @@ struct ast_node* create_if_stmt_node(struct pos pos, struct ast_node* condition,
 }
 
 // Update the create_while_loop_node function
-struct ast_node* create_while_loop_node(struct pos pos, struct ast_node* condition, struct ast_node* body) {
-    struct ast_node* node = malloc(sizeof(struct ast_node));
-    node->type = AST_WHILE_LOOP;
-    node->pos = pos;
+struct ast_node* create_while_loop_node(int offset, struct ast_node* condition, struct ast_node* body) {
+    struct ast_node* node = create_ast_node(AST_WHILE_LOOP, offset);
     node->while_loop.condition = condition;
     node->while_loop.body = body;
     return node;
 }
 
-struct ast_node* create_print_node(struct pos pos, struct ast_node* expression) {
-    struct ast_node* node = create_ast_node(AST_PRINT, pos);
+struct ast_node* create_print_node(int offset, struct ast_node* expression) {
+    struct ast_node* node = create_ast_node(AST_PRINT, offset);
     node->print.expression = expression;
     return node;
 }
@@ -102,9 +387,7 @@ void add_child(struct ast_node* parent, struct ast_node* child) {
     switch (parent->type) {
         case AST_PROGRAM:
         case AST_BLOCK:
-            parent->block.statements = realloc(parent->block.statements, 
-                                               (parent->block.stmt_count + 1) * sizeof(struct ast_node*));
-            parent->block.statements[parent->block.stmt_count++] = child;
+            parent->block.statements = ast_node_list_append(parent->block.statements, parent->block.stmt_count++, child);
             break;
         case AST_IF_STMT:
             if (!parent->if_stmt.true_body) {
@@ -125,51 +408,17 @@ void add_child(struct ast_node* parent, struct ast_node* child) {
     }
 }
 
-struct ast_node* create_ast_node_with_value(enum ast_node_type type, const char* value, struct pos pos) {
-    struct ast_node* node = create_ast_node(type, pos);
-    if (node) {
-        switch (type) {
-            case AST_IDENTIFIER:
-            case AST_NUMBER:
-            case AST_STRING:
-            case AST_CHAR:
-                node->id_literal.value = strdup(value);
-                break;
-            default:
-                compiler_error(NULL, "Attempt to create node with value for type that doesn't support it");
-                free(node);
-                return NULL;
-        }
-    }
-    return node;
-}
-void free_ast_node(struct ast_node* node) {
-    if (!node) return;
-
-    switch (node->type) {
+struct ast_node* create_ast_node_with_value(enum ast_node_type type, const char* value, int offset) {
+    switch (type) {
         case AST_IDENTIFIER:
-        case AST_NUMBER:
         case AST_STRING:
         case AST_CHAR:
-            free(node->id_literal.value);
-            break;
-        case AST_BINARY_OP:
-            free_ast_node(node->binary_op.left);
-            free_ast_node(node->binary_op.right);
-            free(node->binary_op.operator);
-            break;
-        
-        case AST_FUNCTION_CALL:
-            free(node->function_call.name);
-            for (int i = 0; i < node->function_call.arg_count; i++) {
-                free_ast_node(node->function_call.arguments[i]);
-            }
-            free(node->function_call.arguments);
-            break;
-        // Add cases for other node types...
+            return create_id_literal_node(type, offset, value);
+        case AST_NUMBER:
+            return create_number_node(offset, (long long) strtoull(value, NULL, 0));
+        default:
+            compiler_error(NULL, "Attempt to create node with value for type that doesn't support it");
     }
-
-    free(node);
 }
 
 void print_indent(int indent) {
@@ -192,15 +441,16 @@ void print_ast_node(struct ast_node* node, int indent) {
                 print_ast_node(node->root.statements[i], indent + 1);
             }
             break;
-        case AST_IDENTIFIER:
         case AST_NUMBER:
+            printf("NUMBER: %lld\n", node->number.value);
+            break;
+        case AST_IDENTIFIER:
         case AST_STRING:
         case AST_CHAR:
         case AST_LITERAL:
         case AST_VARIABLE:
             printf("%s: %s\n", 
                 node->type == AST_IDENTIFIER ? "IDENTIFIER" :
-                node->type == AST_NUMBER ? "NUMBER" :
                 node->type == AST_STRING ? "STRING" :
                 // node -> type == AST_VARIABLE? "VARIABLE":
                 node->type == AST_CHAR ? "CHAR" : "LITERAL",
@@ -222,8 +472,16 @@ void print_ast_node(struct ast_node* node, int indent) {
                 print_ast_node(node->function_call.arguments[i], indent + 1);
             }
             break;
+        case AST_ARRAY_ACCESS:
+            printf("ARRAY_ACCESS\n");
+            print_ast_node(node->array_access.array, indent + 1);
+            print_ast_node(node->array_access.index, indent + 1);
+            break;
         case AST_DECLARATION:
             printf("DECLARATION: %s %s\n", node->declaration.type, node->declaration.name);
+            if (node->declaration.array_size) {
+                print_ast_node(node->declaration.array_size, indent + 1);
+            }
             if (node->declaration.initial_value) {
                 print_ast_node(node->declaration.initial_value, indent + 1);
             }
@@ -298,6 +556,25 @@ void print_ast_node(struct ast_node* node, int indent) {
             // printf("");
             print_ast_node(node->print.expression, indent + 2);
             break;
+        case AST_SWITCH:
+            printf("SWITCH\n");
+            print_indent(indent + 1);
+            printf("Value:\n");
+            print_ast_node(node->switch_stmt.value, indent + 2);
+            print_indent(indent + 1);
+            printf("Body:\n");
+            print_ast_node(node->switch_stmt.body, indent + 2);
+            break;
+        case AST_CASE:
+            if (node->case_label.value) {
+                printf("CASE: %lld\n", node->case_label.value->number.value);
+            } else {
+                printf("DEFAULT\n");
+            }
+            break;
+        case AST_BREAK:
+            printf("BREAK\n");
+            break;
         default:
             printf("UNKNOWN NODE TYPE: %d\n", node->type);
     }
@@ -13,6 +13,7 @@ struct parse_process* create_parse_process(struct compile_process* compiler,stru
     parser -> token_vector = compiler -> token_vec;
     parser -> index = 0;
     parser -> token_vector_count = compiler -> token_vector_count;
+    parser -> in_switch = false;
     return parser;
 }
 
@@ -4,272 +4,303 @@
 #include "./helpers/vector.h"
 #include <string.h>
 
+// Every parse_* function starts with the parser index on the first token of
+// its construct and leaves it on the first token after it.
+
 // Function prototypes
 struct ast_node* parse_expression(struct parse_process* parser);
 struct ast_node* parse_statement(struct parse_process* parser);
 struct ast_node* parse_declaration(struct parse_process* parser);
 struct ast_node* parse_function_definition(struct parse_process* parser);
 struct ast_node* parse_block(struct parse_process* parser);  // Forward declaration
+static struct ast_node* parse_expression_with_precedence(struct parse_process* parser, int min_precedence);
 
 // Helper functions
 static struct token* consume_token(struct parse_process* parser) {
     struct token* token = peek_next_token(parser);
     if (token) {
         parser->index++;
-        printf("Consumed token: %s\n", token->sval);
+        trace_token(TRACE_LEVEL_PARSER, "Consumed token", token);
     }
     return token;
 }
 
 static bool check_and_consume(struct parse_process* parser, int type, const char* value) {
     struct token* token = peek_next_token(parser);
-    if (token && token->type == type && 
+    if (token && token->type == type &&
         ((type == TOKEN_TYPE_SYMBOL && token->cval == value[0]) ||
          (type != TOKEN_TYPE_SYMBOL && strcmp(token->sval, value) == 0))) {
         consume_token(parser);
-        printf("Checked and consumed token: %s\n", token->sval);
+        trace_token(TRACE_LEVEL_PARSER, "Checked and consumed token", token);
         return true;
     }
     return false;
 }
 
+static bool token_is_symbol(struct token* token, char c) {
+    return token && token->type == TOKEN_TYPE_SYMBOL && token->cval == c;
+}
+
+static bool token_is_keyword(struct token* token, const char* keyword) {
+    return token && token->type == TOKEN_TYPE_KEYWORD && strcmp(token->sval, keyword) == 0;
+}
+
+static struct token* expect_symbol(struct parse_process* parser, char c, const char* message) {
+    struct token* token = peek_next_token(parser);
+    if (!token_is_symbol(token, c)) {
+        compiler_error(parser->compiler, "%s\n", message);
+    }
+    return consume_token(parser);
+}
+
+// Looks past the next token without consuming anything, skipping comments
+static struct token* peek_token_ahead(struct parse_process* parser, int ahead) {
+    int index = parser->index;
+    while (index < parser->token_vector_count) {
+        struct token* token = vector_get(parser->token_vector, index);
+        if (token->type != TOKEN_TYPE_COMMENT) {
+            if (ahead == 0) {
+                return token;
+            }
+            ahead--;
+        }
+        index++;
+    }
+    return NULL;
+}
+
 struct ast_node* parse_primary(struct parse_process* parser) {
-    printf("Parsing primary...\n");
-    struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-    // printf("%d\n" ,token->type);
-    // printf("inside primary block %d\n", token->type);
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing primary...\n");
+    struct token* token = peek_next_token(parser);
     if (!token) {
-        printf("Error: Expected primary expression, but token is NULL\n");
+        compiler_error(parser->compiler, "Expected primary expression, but reached the end of the file\n");
         return NULL;
     }
 
     struct ast_node* node = NULL;
     switch (token->type) {
         case TOKEN_TYPE_IDENTIFIER:
-            node = create_id_literal_node(AST_IDENTIFIER, token->pos, token->sval);
-            // printf("Parsed identifier: %s\n", token->sval);
+            consume_token(parser);
+            node = create_id_literal_node(AST_IDENTIFIER, token->offset, token->sval);
             break;
         case TOKEN_TYPE_NUMBER:
-            char* buffer = (char*)malloc(21 * sizeof(char)); 
-            sprintf(buffer, "%llu", token -> llnum); 
-            node = create_id_literal_node(AST_NUMBER, token->pos, buffer);
-            printf("Parsed number: %lld\n", token->llnum);
+            consume_token(parser);
+            node = create_number_node(token->offset, (long long) token->llnum);
+            compiler_trace(TRACE_LEVEL_PARSER, "Parsed number: %lld\n", token->llnum);
             break;
         case TOKEN_TYPE_STRING:
-            node = create_id_literal_node(AST_LITERAL, token->pos, token->sval);
-            printf("Parsed string literal: %s\n", token->sval);
+            consume_token(parser);
+            node = create_id_literal_node(AST_LITERAL, token->offset, token->sval);
+            compiler_trace(TRACE_LEVEL_PARSER, "Parsed string literal: %s\n", token->sval);
             break;
         case TOKEN_TYPE_SYMBOL:
             if (token->cval == '(') {
-                // printf("Parsed opening parenthesis\n");
+                consume_token(parser);
                 node = parse_expression(parser);
-                if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ")")) {
-                    compiler_error(parser->compiler, "Expected closing parenthesis");
-                    printf("Error: Expected closing parenthesis\n");
-                    free_ast_node(node);
-                    return NULL;
-                }
-                printf("Parsed closing parenthesis\n");
+                expect_symbol(parser, ')', "Expected closing parenthesis");
+                compiler_trace(TRACE_LEVEL_PARSER, "Parsed closing parenthesis\n");
+                break;
             }
-            break;
+            // fallthrough
         default:
-            compiler_error(parser->compiler, "Unexpected token in primary expression");
-            printf("Error: Unexpected token in primary expression\n");
+            compiler_error(parser->compiler, "Unexpected token in primary expression\n");
             return NULL;
     }
     return node;
 }
-struct ast_node* parse_print_statement(struct parse_process* parser) {
-    printf("Parsing print statement...\n");
-    struct token* print_token = consume_token(parser);
-    // parser->index++;
-    struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-    // printf("%s\n", token->sval);
-    if (token -> type !=TOKEN_TYPE_SYMBOL || token->cval != '(') {
-        compiler_error(parser->compiler, "Expected opening parenthesis after 'print'");
-        printf("Error: Expected opening parenthesis after 'print'\n");
-        return NULL;
-    }
-    parser->index ++;
-    
-    struct ast_node* expression = parse_expression(parser);
-     token = (struct token*) vector_get(parser->token_vector, parser->index);
-    //  printf("%c\n", token->cval);
-    if ( token -> type != TOKEN_TYPE_SYMBOL && token -> cval == ')') {
-        compiler_error(parser->compiler, "Expected closing parenthesis");
-        printf("Error: Expected closing parenthesis in print statement\n");
-        free_ast_node(expression);
-        return NULL;
+
+static struct ast_node* parse_call(struct parse_process* parser, struct ast_node* callee) {
+    struct token* paren = expect_symbol(parser, '(', "Expected opening parenthesis in call");
+    if (callee->type != AST_IDENTIFIER) {
+        compiler_error(parser->compiler, "Called object is not a function name\n");
     }
-    parser -> index++;
-    token = (struct token*) vector_get(parser->token_vector, parser->index);
-    if (token -> type != TOKEN_TYPE_SYMBOL && token -> cval == ';') {
-        compiler_error(parser->compiler, "Expected semicolon after print statement");
-        printf("Error: Expected semicolon after print statement\n");
-        free_ast_node(expression);
-        return NULL;
+
+    struct ast_node** arguments = NULL;
+    int arg_count = 0;
+    if (!token_is_symbol(peek_next_token(parser), ')')) {
+        do {
+            // Arguments bind tighter than the comma that separates them
+            struct ast_node* argument = parse_expression_with_precedence(parser, PREC_ASSIGN);
+            arguments = ast_node_list_append(arguments, arg_count++, argument);
+        } while (token_operator(peek_next_token(parser)) == OP_COMMA && consume_token(parser));
     }
-    
-    return create_print_node(print_token->pos, expression);
+    expect_symbol(parser, ')', "Expected closing parenthesis after call arguments");
+
+    return create_function_call_node(paren->offset, callee->id_literal.value, arguments, arg_count);
 }
-struct ast_node* parse_expression(struct parse_process* parser) {
-    printf("Parsing expression...\n");
-    struct ast_node* left = parse_primary(parser);
-    if (!left) return NULL;
 
+// Calls, indexing and postfix ++/-- bind tighter than any prefix operator
+static struct ast_node* parse_postfix(struct parse_process* parser, struct ast_node* node) {
     while (true) {
-        struct token* token = vector_get(parser->token_vector, parser->index+1);
-        // printf("token next :%d\n", token -> type);
-        if (!token || token->type != TOKEN_TYPE_OPERATOR) break;
-
-        // consume_token(parser);
-        parser -> index ++;
-        token = vector_get(parser->token_vector, parser->index);
-        parser -> index ++;
-        // printf("Parsed operator: %s\n", token->sval);
-        struct ast_node* right = parse_primary(parser);
-        if (!right) {
-            compiler_error(parser->compiler, "Expected expression after operator");
-            printf("Error: Expected expression after operator\n");
-            free_ast_node(left);
-            return NULL;
+        struct token* token = peek_next_token(parser);
+        if (token_is_symbol(token, '(')) {
+            node = parse_call(parser, node);
+        } else if (token_is_symbol(token, '[')) {
+            consume_token(parser);
+            struct ast_node* index = parse_expression(parser);
+            expect_symbol(parser, ']', "Expected closing bracket");
+            node = create_array_access_node(token->offset, node, index);
+        } else {
+            enum operator_kind op = token_operator(token);
+            if (!operator_table[op].postfix) {
+                break;
+            }
+            consume_token(parser);
+            node = create_unary_op_node(token->offset, node, op, true);
         }
+    }
+    return node;
+}
 
-        left = create_binary_op_node(token->pos, left, right, token->sval);
+static struct ast_node* parse_unary(struct parse_process* parser) {
+    struct token* token = peek_next_token(parser);
+    enum operator_kind op = token_operator(token);
+    if (op != OP_NONE && operator_table[op].prefix) {
+        consume_token(parser);
+        struct ast_node* operand = parse_expression_with_precedence(parser, PREC_UNARY);
+        return create_unary_op_node(token->offset, operand, op, false);
     }
+    return parse_postfix(parser, parse_primary(parser));
+}
+
+// Precedence climbing over operator_table: folds every binary operator that
+// binds at least as tightly as min_precedence, recursing for the right hand
+// side with a higher floor for left associative operators.
+static struct ast_node* parse_expression_with_precedence(struct parse_process* parser, int min_precedence) {
+    struct ast_node* left = parse_unary(parser);
 
-    parser->index++;
+    while (true) {
+        struct token* token = peek_next_token(parser);
+        enum operator_kind op = token_operator(token);
+        const struct operator_info* info = &operator_table[op];
+        if (info->binary_precedence == PREC_NONE || info->binary_precedence < min_precedence) {
+            break;
+        }
+        consume_token(parser);
 
+        int next_precedence = info->right_assoc ? info->binary_precedence : info->binary_precedence + 1;
+        struct ast_node* right = parse_expression_with_precedence(parser, next_precedence);
+        left = create_binary_op_node(token->offset, left, right, op);
+    }
     return left;
 }
 
+struct ast_node* parse_expression(struct parse_process* parser) {
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing expression...\n");
+    return parse_expression_with_precedence(parser, PREC_COMMA);
+}
+
+struct ast_node* parse_print_statement(struct parse_process* parser) {
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing print statement...\n");
+    struct token* print_token = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis after 'print'");
+    struct ast_node* expression = parse_expression(parser);
+    expect_symbol(parser, ')', "Expected closing parenthesis");
+    expect_symbol(parser, ';', "Expected semicolon after print statement");
+    return create_print_node(print_token->offset, expression);
+}
+
 struct ast_node* parse_function_definition(struct parse_process* parser) {
-    printf("Parsing function definition...\n");
-    
-    // Consume return type and function name
-    struct token* return_type = consume_token(parser);
-    struct token* name = consume_token(parser);
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing function definition...\n");
+    peek_next_token(parser);
+    int token_start = parser->index;
 
-    // Expect opening parenthesis
-    
-    struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-    parser->index++;
-    if (token->type != TOKEN_TYPE_SYMBOL || token->cval != '(') {
-        printf("Error: Expected opening parenthesis in function definition\n");
-        return NULL;
+    // Consume return type (possibly several keywords) and function name
+    struct token* return_type = consume_token(parser);
+    bool is_static = token_is_keyword(return_type, "static");
+    while (peek_next_token(parser)->type == TOKEN_TYPE_KEYWORD) {
+        is_static = is_static || token_is_keyword(peek_next_token(parser), "static");
+        consume_token(parser);
     }
+    struct token* name = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis in function definition");
 
     // Parse parameters
     struct ast_node** parameters = NULL;
     int param_count = 0;
-    
-    token = (struct token*) vector_get(parser->token_vector, parser->index);
-    // printf(" token val just before param while loop: %s\n", token ->sval);
-    parser->index++;
-    
-    while (token->type != TOKEN_TYPE_SYMBOL || token->cval != ')') {
-        // Create and allocate a new parameter
-        struct ast_node* param_node = malloc(sizeof(struct ast_node));
-        token = (struct token*) vector_get(parser->token_vector, parser->index);
-        if (token->type == TOKEN_TYPE_IDENTIFIER) {
-            // Assume token->sval contains the parameter name
-            // printf("param name %s\n", token->sval);
-            param_node->type = AST_VARIABLE;
-            param_node->id_literal.value = strdup(token->sval);
-        } else {
-            printf("Error: Expected parameter name\n");
-            return NULL;
-        }
+    if (token_is_keyword(peek_next_token(parser), "void") && token_is_symbol(peek_token_ahead(parser, 1), ')')) {
         consume_token(parser);
-        // Store the parameter in the parameters array
-        parameters = realloc(parameters, (param_count + 1) * sizeof(struct ast_node*));
-        parameters[param_count++] = param_node;
+    }
+    while (!token_is_symbol(peek_next_token(parser), ')')) {
+        // Skip the parameter type
+        while (peek_next_token(parser) && peek_next_token(parser)->type == TOKEN_TYPE_KEYWORD) {
+            consume_token(parser);
+        }
+        struct token* token = consume_token(parser);
+        if (!token || token->type != TOKEN_TYPE_IDENTIFIER) {
+            compiler_error(parser->compiler, "Expected parameter name\n");
+        }
+        struct ast_node* parameter = create_id_literal_node(AST_VARIABLE, token->offset, token->sval);
+        parameters = ast_node_list_append(parameters, param_count++, parameter);
 
-        // Check for a comma or closing parenthesis
-        token = (struct token*) vector_get(parser->token_vector, parser->index);
-        parser->index++;
-        // printf("%s token type: %d\n", token->sval, token -> type);
-        if (token->type == TOKEN_TYPE_SYMBOL && token->cval == ')') {
-            // printf("breaking");
-            break;
-        } 
-        // else (token->type == TOKEN_TYPE_OPERATOR  && token->sval == ",") 
-        else{
-            // Continue to the next parameter
-            token = (struct token*) vector_get(parser->token_vector, parser->index);
-            // printf("%s\n", token->sval);
-            parser->index++;
+        if (token_operator(peek_next_token(parser)) == OP_COMMA) {
+            consume_token(parser);
+        } else if (!token_is_symbol(peek_next_token(parser), ')')) {
+            compiler_error(parser->compiler, "Expected ',' or ')' after parameter\n");
         }
-        // } else {
-        //     printf("Error: Expected ',' or ')' after parameter\n");
-        //     return NULL;
-        // }
     }
+    consume_token(parser);
 
-    // Parse function body (block of statements)
-    struct ast_node* body = parse_block(parser);
+    // A prototype has no body
+    struct ast_node* body = NULL;
+    if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ";")) {
+        body = parse_block(parser);
+    }
 
-    // Return a function call node with the parsed details
-    struct ast_node* func_def_node = create_function_definition_node(return_type->pos, return_type->sval, name->sval, parameters, param_count, body);
-    return func_def_node;
+    struct ast_node* node = create_function_definition_node(return_type->offset, return_type->sval, name->sval, parameters, param_count, body);
+    node->function_def.is_static = is_static;
+    node->function_def.token_start = token_start;
+    node->function_def.token_end = parser->index;
+    return node;
 }
 
 
 struct ast_node* parse_declaration(struct parse_process* parser) {
-    printf("Parsing declaration...\n");
-    // printf("%s inside statement funciton", token->sval);
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing declaration...\n");
     struct token* type = consume_token(parser);
+    while (peek_next_token(parser)->type == TOKEN_TYPE_KEYWORD) {
+        consume_token(parser);
+    }
     struct token* name = consume_token(parser);
-    
-    struct ast_node* initial_value = NULL;
-    struct token* next_token = (struct token*) vector_get(parser->token_vector, parser->index);
-    // printf("next_token in declaration in block %c", next_token->cval);
-    if (check_and_consume(parser, TOKEN_TYPE_OPERATOR, "=")) {
-        initial_value = parse_expression(parser);
-    }
-    next_token = (struct token*) vector_get(parser->token_vector, parser->index);
-    // printf("value of token after parsing expression %c \n", next_token->cval);
-    
-    if (next_token-> type != TOKEN_TYPE_SYMBOL && next_token-> cval ==';' ) {
-        if (initial_value) {
-            free_ast_node(initial_value);
+    if (!name || name->type != TOKEN_TYPE_IDENTIFIER) {
+        compiler_error(parser->compiler, "Expected a name in declaration\n");
+    }
+
+    // Arrays have a constant number of elements and no initializer
+    struct ast_node* array_size = NULL;
+    if (check_and_consume(parser, TOKEN_TYPE_SYMBOL, "[")) {
+        array_size = parse_expression(parser);
+        if (array_size->type != AST_NUMBER || array_size->number.value < 1) {
+            compiler_error(parser->compiler, "Size of array %s must be a positive constant\n", name->sval);
         }
-        // printf("Error: Expected semicolon after declaration\n");
-        return NULL;
+        expect_symbol(parser, ']', "Expected closing bracket");
+    }
+
+    struct ast_node* initial_value = NULL;
+    if (!array_size && token_operator(peek_next_token(parser)) == OP_ASSIGN) {
+        consume_token(parser);
+        initial_value = parse_expression_with_precedence(parser, PREC_ASSIGN);
     }
-    
-    return create_declaration_node(type->pos, type->sval, name->sval, initial_value);
+    expect_symbol(parser, ';', "Expected semicolon after declaration");
+
+    struct ast_node* declaration = create_declaration_node(type->offset, type->sval, name->sval, initial_value);
+    declaration->declaration.array_size = array_size;
+    return declaration;
 }
 
 struct ast_node* parse_block(struct parse_process* parser) {
-    printf("Parsing block...\n");
-    struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-    if (token->type != TOKEN_TYPE_SYMBOL || token->cval != '{') {
-        compiler_error(parser->compiler, "Expected opening brace");
-        printf("Error: Expected opening brace\n");
-        return NULL;
-    }
-    
-    struct ast_node* block = create_ast_node(AST_BLOCK, parser->compiler->pos);
-    block->block.statements = NULL;
-    block->block.stmt_count = 0;
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing block...\n");
+    struct token* brace = expect_symbol(parser, '{', "Expected opening brace");
+
+    struct ast_node* block = create_ast_node(AST_BLOCK, brace->offset);
 
     while (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, "}")) {
-        // printf("inside block\n");
-        parser->index++;
+        if (!peek_next_token(parser)) {
+            compiler_error(parser->compiler, "Expected closing brace before the end of the file\n");
+        }
         struct ast_node* stmt = parse_statement(parser);
         if (stmt) {
-            block->block.statements = realloc(block->block.statements, 
-                                              (block->block.stmt_count + 1) * sizeof(struct ast_node*));
-            block->block.statements[block->block.stmt_count++] = stmt;
-        }
-        struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-        // if(token -> type != TOKEN_TYPE_SYMBOL)printf("Values inside parse_block : %s\n", token -> sval);
-        if(token-> type == TOKEN_TYPE_SYMBOL && token-> cval =='}')
-        {
-            parser->index ++;
-            printf("semi colon detected in parser_block\n");
-            break;
+            block->block.statements = ast_node_list_append(block->block.statements, block->block.stmt_count++, stmt);
         }
     }
 
@@ -277,182 +308,302 @@ struct ast_node* parse_block(struct parse_process* parser) {
 }
 
 struct ast_node* parse_preprocessor_directive(struct parse_process* parser) {
-    printf("Parsing preprocessor directive...\n");
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing preprocessor directive...\n");
     struct token* hash = consume_token(parser);
     struct token* directive = consume_token(parser);
-    
-    if (strcmp(directive->sval, "include") == 0) {
+
+    if (directive && strcmp(directive->sval, "include") == 0) {
         struct token* file = consume_token(parser);
-        return create_ast_node_with_value(AST_PREPROCESSOR, file->sval, hash->pos);
+        if (token_operator(file) == OP_LT) {
+            // <header.h> comes through the lexer as loose tokens
+            while (peek_next_token(parser) && token_operator(consume_token(parser)) != OP_GT) {
+            }
+            return NULL;
+        }
+        return create_ast_node_with_value(AST_PREPROCESSOR, file->sval, hash->offset);
     }
-    
+
     return NULL;
 }
 
 struct ast_node* parse_return_statement(struct parse_process* parser) {
-    printf("Parsing return statement...\n");
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing return statement...\n");
     struct token* return_token = consume_token(parser);
-    
+
     struct ast_node* value = NULL;
     if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ";")) {
         value = parse_expression(parser);
-        parser -> index ++;
-        struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-        // printf("type of token in return statement %d\n", token->type);
-        
-        if (token -> type != TOKEN_TYPE_SYMBOL && token -> cval ==';') {
-            compiler_error(parser->compiler, "Expected semicolon after return statement");
-            printf("Error: Expected semicolon after return statement\n");
-            free_ast_node(value);
-            return NULL;
-        }
+        expect_symbol(parser, ';', "Expected semicolon after return statement");
     }
-    
-    struct ast_node* node = create_ast_node(AST_RETURN, return_token->pos);
+
+    struct ast_node* node = create_ast_node(AST_RETURN, return_token->offset);
     node->return_stmt.value = value;
-    // printf("returning return node\n");
     return node;
 }
 
 struct ast_node* parse_while_statement(struct parse_process* parser) {
-    printf("Parsing while statement...\n");
-    struct token* while_token = vector_get(parser->token_vector, parser->index);
-    parser->index++;
-    struct token* token = vector_get(parser->token_vector, parser->index);
-    if (token -> type != TOKEN_TYPE_SYMBOL || token->cval != '(') {
-        compiler_error(parser->compiler, "Expected opening parenthesis");
-        printf("Error: Expected opening parenthesis in while statement\n");
-        return NULL;
-    }
-    parser->index ++;
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing while statement...\n");
+    struct token* while_token = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis");
     struct ast_node* condition = parse_expression(parser);
-    token = vector_get(parser->token_vector, parser->index);
-    if (token -> type != TOKEN_TYPE_SYMBOL || token->cval != ')') {
-        compiler_error(parser->compiler, "Expected closing parenthesis");
-        printf("Error: Expected closing parenthesis in while statement\n");
-        free_ast_node(condition);
-        return NULL;
-    }
-    
+    expect_symbol(parser, ')', "Expected closing parenthesis");
+
+    bool in_switch = parser->in_switch;
+    parser->in_switch = false;
     struct ast_node* body = parse_statement(parser);
-    
-    struct ast_node* while_node = create_while_loop_node(while_token->pos, condition, body);
+    parser->in_switch = in_switch;
+
+    struct ast_node* while_node = create_while_loop_node(while_token->offset, condition, body);
     return while_node;
 }
 
-struct ast_node* parse_if_statement(struct parse_process* parser) {
-    printf("Parsing if statement...\n");
-    // struct token* token = 
-    struct token* if_token = vector_get(parser->token_vector, parser->index);
-    parser->index++;
-    struct token* token = vector_get(parser->token_vector, parser->index);
-    if (token->type != TOKEN_TYPE_SYMBOL || token->cval != '(' ) {
-        compiler_error(parser->compiler, "Expected opening parenthesis");
-        printf("Error: Expected opening parenthesis in if statement\n");
-        return NULL;
+// Whether a statement of block declares a variable
+static bool block_declares(struct ast_node* block) {
+    for (int i = 0; i < block->block.stmt_count; i++) {
+        if (block->block.statements[i]->type == AST_DECLARATION) {
+            return true;
+        }
     }
-    parser->index++;
-    
-    struct ast_node* condition = parse_expression(parser);
-    token = vector_get(parser->token_vector, parser->index);
-    if (token->type != TOKEN_TYPE_SYMBOL || token->cval != ')' ) {
-        compiler_error(parser->compiler, "Expected closing parenthesis");
-        printf("Error: Expected closing parenthesis in if statement\n");
-        free_ast_node(condition);
-        return NULL;
+    return false;
+}
+
+// for (init; condition; update) body is parsed as the while loop it stands
+// for, { init; while (condition) { body; update; } }, which is the same
+// thing in a language without continue. Every pass and backend that knows
+// while loops then knows for loops too, and the update is the last top
+// level statement of the loop body, where loop.c looks for induction
+// variables. The outer block scopes a variable declared by init to the
+// loop; a body that declares variables of its own stays a block inside the
+// loop body, so they can't hide init's from the update
+struct ast_node* parse_for_statement(struct parse_process* parser) {
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing for statement...\n");
+    struct token* for_token = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis");
+
+    struct ast_node* init = NULL;
+    struct token* token = peek_next_token(parser);
+    if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ";")) {
+        if (token && token->type == TOKEN_TYPE_KEYWORD) {
+            // The declaration takes the semicolon
+            init = parse_declaration(parser);
+        } else {
+            init = parse_expression(parser);
+            expect_symbol(parser, ';', "Expected semicolon after for loop initializer");
+        }
+    }
+    struct ast_node* condition = NULL;
+    token = peek_next_token(parser);
+    if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ";")) {
+        condition = parse_expression(parser);
+        expect_symbol(parser, ';', "Expected semicolon after for loop condition");
+    }
+    if (!condition) {
+        condition = create_number_node(token ? token->offset : for_token->offset, 1);
+    }
+    struct ast_node* update = NULL;
+    if (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, ")")) {
+        update = parse_expression(parser);
+        expect_symbol(parser, ')', "Expected closing parenthesis");
+    }
+
+    bool in_switch = parser->in_switch;
+    parser->in_switch = false;
+    struct ast_node* body = parse_statement(parser);
+    parser->in_switch = in_switch;
+    struct ast_node* loop_body = body;
+    if (!body || body->type != AST_BLOCK || update) {
+        loop_body = create_block_node(for_token->offset);
+        if (body && body->type == AST_BLOCK && !block_declares(body)) {
+            loop_body->block.statements = body->block.statements;
+            loop_body->block.stmt_count = body->block.stmt_count;
+        } else if (body) {
+            loop_body->block.statements = ast_node_list_append(NULL, loop_body->block.stmt_count++, body);
+        }
+        if (update) {
+            loop_body->block.statements = ast_node_list_append(loop_body->block.statements, loop_body->block.stmt_count++, update);
+        }
+    }
+    struct ast_node* loop = create_while_loop_node(for_token->offset, condition, loop_body);
+    if (!init) {
+        return loop;
     }
-    parser -> index ++;
-    
+    struct ast_node* block = create_block_node(for_token->offset);
+    block->block.statements = ast_node_list_append(NULL, block->block.stmt_count++, init);
+    block->block.statements = ast_node_list_append(block->block.statements, block->block.stmt_count++, loop);
+    return block;
+}
+
+struct ast_node* parse_if_statement(struct parse_process* parser) {
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing if statement...\n");
+    struct token* if_token = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis");
+    struct ast_node* condition = parse_expression(parser);
+    expect_symbol(parser, ')', "Expected closing parenthesis");
+
     struct ast_node* then_branch = parse_statement(parser);
-    token = vector_get(parser->token_vector, parser->index);
     struct ast_node* else_branch = NULL;
-    if (token->type == TOKEN_TYPE_IDENTIFIER && token->sval == "else" ) {
+    if (check_and_consume(parser, TOKEN_TYPE_KEYWORD, "else")) {
         else_branch = parse_statement(parser);
     }
-    parser->index++;
-    
-    struct ast_node* if_node = create_if_stmt_node(if_token->pos, condition, then_branch, else_branch);
+
+    struct ast_node* if_node = create_if_stmt_node(if_token->offset, condition, then_branch, else_branch);
 
     return if_node;
 }
 
+static struct ast_node* parse_case_label(struct parse_process* parser) {
+    struct token* token = consume_token(parser);
+    struct ast_node* node = create_ast_node(AST_CASE, token->offset);
+    if (token_is_keyword(token, "case")) {
+        struct ast_node* value = parse_expression_with_precedence(parser, PREC_ASSIGN);
+        long long constant;
+        if (!ast_constant(value, &constant)) {
+            compiler_error(parser->compiler, "Case value must be a constant\n");
+        }
+        node->case_label.value = create_number_node(value->offset, constant);
+    }
+    expect_symbol(parser, ':', "Expected ':' after case label");
+    return node;
+}
+
+// The case labels of a switch are statements of its body, in order, so that
+// falling through to the next case is just carrying on. They can't be nested
+// any deeper, and neither can a declaration be at that level: a jump to a
+// later case would skip its stack slot
+struct ast_node* parse_switch_statement(struct parse_process* parser) {
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing switch statement...\n");
+    struct token* switch_token = consume_token(parser);
+    expect_symbol(parser, '(', "Expected opening parenthesis");
+    struct ast_node* value = parse_expression(parser);
+    expect_symbol(parser, ')', "Expected closing parenthesis");
+    struct token* brace = expect_symbol(parser, '{', "Expected opening brace after switch");
+
+    struct ast_node* body = create_block_node(brace->offset);
+    bool in_switch = parser->in_switch;
+    parser->in_switch = true;
+    bool has_default = false;
+    while (!check_and_consume(parser, TOKEN_TYPE_SYMBOL, "}")) {
+        struct token* token = peek_next_token(parser);
+        if (!token) {
+            compiler_error(parser->compiler, "Expected closing brace before the end of the file\n");
+        }
+        struct ast_node* stmt;
+        if (token_is_keyword(token, "case") || token_is_keyword(token, "default")) {
+            stmt = parse_case_label(parser);
+            if (!stmt->case_label.value) {
+                if (has_default) {
+                    compiler_error(parser->compiler, "Multiple default labels in one switch\n");
+                }
+                has_default = true;
+            }
+        } else {
+            stmt = parse_statement(parser);
+            if (stmt && stmt->type == AST_DECLARATION) {
+                compiler_error(parser->compiler, "Declarations in a switch need a block of their own\n");
+            }
+        }
+        if (stmt) {
+            body->block.statements = ast_node_list_append(body->block.statements, body->block.stmt_count++, stmt);
+        }
+    }
+    parser->in_switch = in_switch;
+
+    struct ast_node* node = create_ast_node(AST_SWITCH, switch_token->offset);
+    node->switch_stmt.value = value;
+    node->switch_stmt.body = body;
+    return node;
+}
+
+struct ast_node* parse_break_statement(struct parse_process* parser) {
+    struct token* break_token = consume_token(parser);
+    if (!parser->in_switch) {
+        compiler_error(parser->compiler, "break is only supported in a switch\n");
+    }
+    expect_symbol(parser, ';', "Expected semicolon after break");
+    return create_ast_node(AST_BREAK, break_token->offset);
+}
+
 struct ast_node* parse_statement(struct parse_process* parser) {
-    printf("Parsing statement...\n");
+    compiler_trace(TRACE_LEVEL_PARSER, "Parsing statement...\n");
     struct token* token = peek_next_token(parser);
-    // printf("peeked successfully\n");
-    if(token -> type ==TOKEN_TYPE_SYMBOL ){
-        printf("%c\n", token->cval);
-    }
-    else {
-        printf("%s\n", token->sval);
+    if (!token) {
+        return NULL;
     }
-    // printf("%s inside statement funciton\n", token->sval);
-    // printf("%d otken type\n", token->type);
+    trace_token(TRACE_LEVEL_PARSER, "Statement starts at", token);
     if (token->type == TOKEN_TYPE_KEYWORD) {
         if (strcmp(token->sval, "return") == 0) {
             return parse_return_statement(parser);
         } else if (strcmp(token->sval, "while") == 0) {
             return parse_while_statement(parser);
+        } else if (strcmp(token->sval, "for") == 0) {
+            return parse_for_statement(parser);
         } else if (strcmp(token->sval, "if") == 0) {
             return parse_if_statement(parser);
+        } else if (strcmp(token->sval, "switch") == 0) {
+            return parse_switch_statement(parser);
+        } else if (strcmp(token->sval, "break") == 0) {
+            return parse_break_statement(parser);
+        } else if (strcmp(token->sval, "case") == 0 || strcmp(token->sval, "default") == 0) {
+            compiler_error(parser->compiler, "Case labels must be directly in the body of a switch\n");
         }else if (strcmp(token->sval, "print") == 0) {
             return parse_print_statement(parser);
         }else {
             // Assume it's a type specifier (for variable declaration or function definition)
-            struct token* next_token = vector_get(parser->token_vector, parser->index + 1);
-            printf("next_token value: %s\n", next_token->sval);
+            int ahead = 1;
+            while (peek_token_ahead(parser, ahead) && peek_token_ahead(parser, ahead)->type == TOKEN_TYPE_KEYWORD) {
+                ahead++;
+            }
+            struct token* next_token = peek_token_ahead(parser, ahead);
+            trace_token(TRACE_LEVEL_PARSER, "next_token value", next_token);
             if (next_token && next_token->type == TOKEN_TYPE_IDENTIFIER) {
-                struct token* after_next = vector_get(parser->token_vector, parser->index + 2);
-                printf("after next_token value: %c\n", after_next->cval);
-                if (after_next && after_next->type == TOKEN_TYPE_SYMBOL && after_next->cval == ')' || after_next->cval == '(') {
+                struct token* after_next = peek_token_ahead(parser, ahead + 1);
+                trace_token(TRACE_LEVEL_PARSER, "after next_token value", after_next);
+                if (token_is_symbol(after_next, '(')) {
                     return parse_function_definition(parser);
                 } else {
                     return parse_declaration(parser);
                 }
             }
         }
-    } else if (token->type == TOKEN_TYPE_SYMBOL && token->cval == '{') {
+    } else if (token_is_symbol(token, '{')) {
         return parse_block(parser);
-    } else if (token->type == TOKEN_TYPE_SYMBOL && token->cval == '#') {
+    } else if (token_is_symbol(token, '#')) {
         return parse_preprocessor_directive(parser);
-    }
-    else if (token->type == TOKEN_TYPE_SYMBOL && token->cval == '}') {
-        // parser->index++;
+    } else if (token_is_symbol(token, ';')) {
+        // Empty statement
+        consume_token(parser);
+        return NULL;
+    } else if (token_is_symbol(token, '}')) {
+        // End of the enclosing block, left for the caller
         return NULL;
+    } else if (token->type == TOKEN_TYPE_IDENTIFIER || token->type == TOKEN_TYPE_NUMBER ||
+               token_is_symbol(token, '(') || token_operator(token) != OP_NONE) {
+        struct ast_node* expression = parse_expression(parser);
+        expect_symbol(parser, ';', "Expected semicolon after expression");
+        return expression;
     }
-    
 
-    
-    printf("Error: Unrecognized statement type\n");
+    compiler_trace(TRACE_LEVEL_PARSER, "Error: Unrecognized statement type\n");
     return NULL;
 }
 struct ast_node* parse(struct parse_process* parser) {
-    printf("Starting parsing process...\n");
-    struct ast_node* root = NULL;
+    compiler_trace(TRACE_LEVEL_PHASE, "Starting parsing process...\n");
+    ast_arena_use(&parser->compiler->ast_arena);
+    struct ast_node* root = create_ast_node(AST_ROOT, 0);
 
-    while (parser->index < parser->token_vector_count) {
-        struct token* token = (struct token*) vector_get(parser->token_vector, parser->index);
-        printf("%s\n inside main block\n", token->sval);
+    while (peek_next_token(parser)) {
+        int start = parser->index;
         struct ast_node* stmt = parse_statement(parser);
         if (stmt) {
-            if (!root) {
-                root = create_ast_node(AST_ROOT, parser->compiler->pos);
-                root->root.statements = NULL;
-                root->root.stmt_count = 1;
-            }
-            root->root.statements = realloc(root->root.statements, 
-                                              (root->root.stmt_count + 1) * sizeof(struct ast_node*));
-            root->root.statements[root->root.stmt_count] = stmt;
-            printf("root->statement count: %d\n", root -> root.stmt_count++);
-        } else {
+            root->root.statements = ast_node_list_append(root->root.statements, root->root.stmt_count++, stmt);
+            compiler_trace(TRACE_LEVEL_PARSER, "root->statement count: %d\n", root -> root.stmt_count);
+        } else if (parser->index == start) {
             // If no statement is parsed, move to the next token
             consume_token(parser);  // This is important to avoid an infinite loop
         }
-        if(parser -> index == parser->token_vector_count -1 )break;
     }
-    // printf("root->type %d\n",root->type);
     parser -> root = root;
-    printf("root->statement count: %d\n", root -> root.stmt_count++);
-    printf("Parsing process completed\n");
+    ast_arena_use(NULL);
+    compiler_trace(TRACE_LEVEL_PHASE, "Parsing process completed\n");
     return PARSER_ANALYSIS_ALL_OK;
 }
@@ -0,0 +1,425 @@
+// Jump peephole over the assembly of a function.
+//
+// Blocks aren't reordered here. The generator places them in the order it
+// walks the tree, and with a profile it already makes the side of an if
+// that ran more often the fall through and moves a side that never ran
+// past the end of the function (see profile.c). Without a profile there's
+// nothing to order them by. What the tree walk leaves behind are jumps
+// that only get from one block to the one after it: an if without an else
+// still jumps over the empty else, a return in the then side is followed
+// by that jump too, and `jcc A; jmp B; A:` takes a branch either way. Once
+// a function is generated its text is rewritten, line by line, until none
+// of these apply any more:
+//
+//     jump to a label whose code is a jmp    goes where that jmp goes
+//     jcc A; jmp B; A:                       jNcc B; A:
+//     jump to the label right after it       dropped
+//     instructions after a jmp or ret, up    dropped, as nothing runs them
+//     to the next label
+//     .L labels nothing refers to            dropped
+//
+// Dropping labels lets the other rules see through them, so the jump over
+// an empty else disappears and a then side that returns falls through into
+// the else. Only the .L labels generate_label hands out, which are private
+// to the function, are rewritten or dropped. Directives stay where they
+// are: .long entries of a jump table follow a jmp, and padding before an
+// aligned loop head is never run.
+//
+// optimize_jumps marks the functions whose code goes through it, so
+// -O0 keeps the code as the tree walk places it.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Jumps followed to where a chain of jmps ends, at most. Longer chains, and
+// loops of jmps, are left as they are
+#define PEEPHOLE_MAX_HOPS 8
+
+// Condition suffixes and their opposites, with the aliases the assembler
+// takes
+static const char* peephole_conditions[][2] = {
+    { "o", "no" }, { "b", "ae" }, { "e", "ne" }, { "be", "a" },
+    { "s", "ns" }, { "p", "np" }, { "l", "ge" }, { "le", "g" },
+    { "z", "nz" }, { "c", "nc" }, { "nae", "nb" }, { "na", "nbe" },
+    { "nge", "nl" }, { "ng", "nle" }, { "pe", "po" }
+};
+
+enum {
+    PEEPHOLE_NO_JUMP,
+    PEEPHOLE_JUMP,
+    PEEPHOLE_CONDITIONAL_JUMP
+};
+
+struct peephole_line {
+    char* text;
+    bool deleted;
+    // text was allocated by peephole_rewrite, rather than pointing into the
+    // function's text
+    bool rewritten;
+    // For .L labels, the lines that refer to them
+    int references;
+};
+
+struct peephole {
+    struct peephole_line* lines;
+    int count;
+    // .L label name -> index of its line + 1, open addressing
+    int* slots;
+    int slot_count;
+};
+
+static bool peephole_is_label(const char* text)
+{
+    size_t length = strlen(text);
+    return length > 1 && text[0] != '\t' && text[length - 1] == ':';
+}
+
+static bool peephole_is_instruction(const char* text)
+{
+    return text[0] == '\t' && text[1] != '.';
+}
+
+// Lines that run no code: labels, alignment padding and blank lines
+static bool peephole_is_transparent(const char* text)
+{
+    return peephole_is_label(text) || strncmp(text, "\t.p2align", 9) == 0 || text[0] == '\0';
+}
+
+static bool peephole_is_identifier(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '.' ||
+           c == '$';
+}
+
+static unsigned long long peephole_hash(const char* name, size_t length)
+{
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Line defining the .L label name, or -1 when it isn't one of this
+// function's
+static int peephole_find(struct peephole* peephole, const char* name, size_t length)
+{
+    if (length < 2 || strncmp(name, ".L", 2) != 0) {
+        return -1;
+    }
+    size_t slot = peephole_hash(name, length) & (peephole->slot_count - 1);
+    while (peephole->slots[slot]) {
+        int line = peephole->slots[slot] - 1;
+        const char* text = peephole->lines[line].text;
+        if (strncmp(text, name, length) == 0 && text[length] == ':') {
+            return peephole->lines[line].deleted ? -1 : line;
+        }
+        slot = (slot + 1) & (peephole->slot_count - 1);
+    }
+    return -1;
+}
+
+static void peephole_index_labels(struct peephole* peephole)
+{
+    peephole->slot_count = 16;
+    while (peephole->slot_count < 2 * peephole->count) {
+        peephole->slot_count *= 2;
+    }
+    peephole->slots = calloc(peephole->slot_count, sizeof(int));
+    for (int i = 0; i < peephole->count; i++) {
+        const char* text = peephole->lines[i].text;
+        size_t length = strlen(text) - 1;
+        if (!peephole_is_label(text) || strncmp(text, ".L", 2) != 0 || peephole_find(peephole, text, length) >= 0) {
+            continue;
+        }
+        size_t slot = peephole_hash(text, length) & (peephole->slot_count - 1);
+        while (peephole->slots[slot]) {
+            slot = (slot + 1) & (peephole->slot_count - 1);
+        }
+        peephole->slots[slot] = i + 1;
+    }
+}
+
+// The kind of jump text is; for a conditional one, the row and column of
+// its condition in peephole_conditions. target is NULL for an indirect jmp
+static int peephole_jump(const char* text, int* condition, int* side, const char** target)
+{
+    if (text[0] != '\t' || text[1] != 'j') {
+        return PEEPHOLE_NO_JUMP;
+    }
+    const char* space = strchr(text, ' ');
+    if (!space) {
+        return PEEPHOLE_NO_JUMP;
+    }
+    *target = space[1] == '*' ? NULL : space + 1;
+    size_t length = space - text - 2;
+    if (length == 2 && strncmp(text + 2, "mp", 2) == 0) {
+        return PEEPHOLE_JUMP;
+    }
+    for (int i = 0; i < (int) (sizeof(peephole_conditions) / sizeof(peephole_conditions[0])); i++) {
+        for (int j = 0; j < 2; j++) {
+            if (strlen(peephole_conditions[i][j]) == length && strncmp(text + 2, peephole_conditions[i][j], length) == 0) {
+                *condition = i;
+                *side = j;
+                return *target ? PEEPHOLE_CONDITIONAL_JUMP : PEEPHOLE_NO_JUMP;
+            }
+        }
+    }
+    return PEEPHOLE_NO_JUMP;
+}
+
+// Where a direct jmp goes, or NULL for any other line
+static const char* peephole_jmp_target(const char* text)
+{
+    return strncmp(text, "\tjmp ", 5) == 0 && text[5] != '*' ? text + 5 : NULL;
+}
+
+// Line of the .L label a jump goes to, or -1
+static int peephole_jump_target(struct peephole* peephole, const char* text)
+{
+    int condition;
+    int side;
+    const char* target;
+    if (peephole_jump(text, &condition, &side, &target) == PEEPHOLE_NO_JUMP || !target) {
+        return -1;
+    }
+    return peephole_find(peephole, target, strlen(target));
+}
+
+static int peephole_next(struct peephole* peephole, int line)
+{
+    line++;
+    while (line < peephole->count && peephole->lines[line].deleted) {
+        line++;
+    }
+    return line;
+}
+
+// Whether nothing runs between the lines from and to
+static bool peephole_falls_through(struct peephole* peephole, int from, int to)
+{
+    if (to <= from) {
+        return false;
+    }
+    for (int line = peephole_next(peephole, from); line < to; line = peephole_next(peephole, line)) {
+        if (!peephole_is_transparent(peephole->lines[line].text)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The first line that runs code from label on
+static int peephole_code_at(struct peephole* peephole, int label)
+{
+    int line = label;
+    while (line < peephole->count && peephole_is_transparent(peephole->lines[line].text)) {
+        line = peephole_next(peephole, line);
+    }
+    return line;
+}
+
+static void peephole_rewrite(struct peephole_line* line, const char* mnemonic, const char* target)
+{
+    char* text = malloc(strlen(mnemonic) + strlen(target) + 3);
+    sprintf(text, "\t%s %s", mnemonic, target);
+    if (line->rewritten) {
+        free(line->text);
+    }
+    line->text = text;
+    line->rewritten = true;
+}
+
+static void peephole_count_references(struct peephole* peephole)
+{
+    for (int i = 0; i < peephole->count; i++) {
+        peephole->lines[i].references = 0;
+    }
+    for (int i = 0; i < peephole->count; i++) {
+        const char* text = peephole->lines[i].text;
+        if (peephole->lines[i].deleted || peephole_is_label(text)) {
+            continue;
+        }
+        for (const char* c = strstr(text, ".L"); c; c = strstr(c, ".L")) {
+            const char* end = c + 2;
+            while (peephole_is_identifier(*end)) {
+                end++;
+            }
+            if (c == text || !peephole_is_identifier(c[-1])) {
+                int label = peephole_find(peephole, c, end - c);
+                if (label >= 0) {
+                    peephole->lines[label].references++;
+                }
+            }
+            c = end;
+        }
+    }
+}
+
+// Points the jump on line at the end of the chain of jmps its label leads to
+static bool peephole_thread_jump(struct peephole* peephole, int line)
+{
+    int label = peephole_jump_target(peephole, peephole->lines[line].text);
+    if (label < 0) {
+        return false;
+    }
+    const char* target = NULL;
+    for (int hop = 0;; hop++) {
+        int code = peephole_code_at(peephole, label);
+        const char* next = code < peephole->count ? peephole_jmp_target(peephole->lines[code].text) : NULL;
+        int next_label = next ? peephole_find(peephole, next, strlen(next)) : -1;
+        if (next_label < 0) {
+            break;
+        }
+        if (hop == PEEPHOLE_MAX_HOPS) {
+            // A chain that doesn't end
+            return false;
+        }
+        target = next;
+        label = next_label;
+    }
+    if (!target) {
+        return false;
+    }
+    const char* text = peephole->lines[line].text;
+    char* mnemonic = strndup(text + 1, strchr(text, ' ') - text - 1);
+    char* destination = strdup(target);
+    peephole_rewrite(&peephole->lines[line], mnemonic, destination);
+    free(mnemonic);
+    free(destination);
+    return true;
+}
+
+static bool peephole_pass(struct peephole* peephole)
+{
+    bool changed = false;
+    for (int i = peephole_next(peephole, -1); i < peephole->count; i = peephole_next(peephole, i)) {
+        struct peephole_line* line = &peephole->lines[i];
+        int condition;
+        int side;
+        const char* target;
+        int kind = peephole_jump(line->text, &condition, &side, &target);
+        if (kind == PEEPHOLE_NO_JUMP) {
+            if (strcmp(line->text, "\tret") != 0) {
+                continue;
+            }
+        } else if (peephole_thread_jump(peephole, i)) {
+            changed = true;
+            kind = peephole_jump(line->text, &condition, &side, &target);
+        }
+
+        int label = kind == PEEPHOLE_NO_JUMP ? -1 : peephole_jump_target(peephole, line->text);
+        if (label >= 0 && peephole_falls_through(peephole, i, label)) {
+            line->deleted = true;
+            changed = true;
+            continue;
+        }
+        if (kind == PEEPHOLE_CONDITIONAL_JUMP && label >= 0) {
+            int next = peephole_next(peephole, i);
+            const char* next_target = next < peephole->count ? peephole_jmp_target(peephole->lines[next].text) : NULL;
+            if (next_target && peephole_falls_through(peephole, next, label)) {
+                char* destination = strdup(next_target);
+                char mnemonic[8];
+                sprintf(mnemonic, "j%s", peephole_conditions[condition][!side]);
+                peephole_rewrite(line, mnemonic, destination);
+                free(destination);
+                peephole->lines[next].deleted = true;
+                changed = true;
+                continue;
+            }
+        }
+        if (kind == PEEPHOLE_CONDITIONAL_JUMP) {
+            continue;
+        }
+        // Nothing gets to the instructions up to the next label
+        for (int dead = peephole_next(peephole, i); dead < peephole->count && !peephole_is_label(peephole->lines[dead].text);
+             dead = peephole_next(peephole, dead)) {
+            if (peephole_is_instruction(peephole->lines[dead].text)) {
+                peephole->lines[dead].deleted = true;
+                changed = true;
+            }
+        }
+    }
+
+    peephole_count_references(peephole);
+    for (int i = 0; i < peephole->count; i++) {
+        struct peephole_line* line = &peephole->lines[i];
+        if (!line->deleted && peephole_is_label(line->text) && strncmp(line->text, ".L", 2) == 0 && !line->references) {
+            line->deleted = true;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// text is split into lines where it is, so it is overwritten
+void peephole_function(FILE* output, char* text, size_t size)
+{
+    struct peephole peephole = { 0 };
+    int capacity = 0;
+    char* end = text + size;
+    for (char* start = text; start < end;) {
+        char* newline = memchr(start, '\n', end - start);
+        char* stop = newline ? newline : end;
+        if (peephole.count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            peephole.lines = realloc(peephole.lines, capacity * sizeof(struct peephole_line));
+        }
+        *stop = '\0';
+        peephole.lines[peephole.count].text = start;
+        peephole.lines[peephole.count].deleted = false;
+        peephole.lines[peephole.count].rewritten = false;
+        peephole.count++;
+        start = stop + 1;
+    }
+
+    peephole_index_labels(&peephole);
+    while (peephole_pass(&peephole)) {
+    }
+
+    // Runs of lines kept as they were still sit together in text, and are
+    // written in one go once their newlines are back
+    char* run = NULL;
+    char* run_end = NULL;
+    for (int i = 0; i <= peephole.count; i++) {
+        struct peephole_line* line = i < peephole.count ? &peephole.lines[i] : NULL;
+        if (line && !line->deleted && !line->rewritten && line->text == run_end) {
+            run_end = line->text + strlen(line->text) + 1;
+            run_end[-1] = '\n';
+            continue;
+        }
+        if (run) {
+            fwrite(run, 1, run_end - run, output);
+            run = NULL;
+        }
+        if (!line) {
+            break;
+        }
+        if (line->rewritten) {
+            if (!line->deleted) {
+                fprintf(output, "%s\n", line->text);
+            }
+            free(line->text);
+            continue;
+        }
+        if (line->deleted) {
+            continue;
+        }
+        run = line->text;
+        run_end = run + strlen(run) + 1;
+        run_end[-1] = '\n';
+    }
+    free(peephole.lines);
+    free(peephole.slots);
+}
+
+void optimize_jumps(struct ast_node* root)
+{
+    for (int i = 0; i < root->root.stmt_count; i++) {
+        struct ast_node* function = root->root.statements[i];
+        if (function->type == AST_FUNCTION_DEFINITION && function->function_def.body) {
+            function->function_def.peephole = true;
+        }
+    }
+}
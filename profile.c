@@ -0,0 +1,304 @@
+// Profile-guided optimization (./main -fprofile-generate, -fprofile-use).
+//
+// Right after parsing, every function definition, if statement, loop,
+// case label and && or || is given counters, numbered in the order the tree
+// is walked: a function counts its calls, an if how often each side ran, a
+// loop how many times its body ran, a case how often the code after it was
+// reached, by the switch or by falling through into it, and && or || how
+// often its right operand was evaluated. The numbering only depends on the source, so the
+// instrumented build and the one that uses its profile agree on it, and a
+// checksum of what was numbered tells a profile of some other version of
+// the program apart.
+//
+// An instrumented program increments the counters in a local .bss block
+// with one incq each; programs here have one thread, so they need no lock.
+// When main returns it writes the block with open/write/close system
+// calls, to the profile file named at compile time:
+//
+//     magic, checksum, counter count, counters...
+//
+// as 64-bit words. Each run replaces the file. With the profile, the
+// generator lays out the side of an if that ran more often as the fall
+// through, and moves a side that never ran past the end of the function.
+// Functions that never ran go after the rest, calls that never ran aren't
+// inlined, and calls that ran often may inline bigger functions; that goes
+// for calls in the right operand of && and || too.
+#define _GNU_SOURCE
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// "profile\0" as a little-endian word
+#define PROFILE_MAGIC 0x656c69666f7270LL
+// Words before the counters: magic, checksum, counter count
+#define PROFILE_HEADER 3
+
+#define PROFILE_FNV_OFFSET 0xcbf29ce484222325ULL
+#define PROFILE_FNV_PRIME 0x100000001b3ULL
+
+static const char* profile_path = NULL;
+
+void compiler_set_profile_path(const char* path)
+{
+    profile_path = path;
+}
+
+const char* compiler_profile_path()
+{
+    return profile_path;
+}
+
+static void profile_hash(struct profile* profile, const void* data, size_t size)
+{
+    const unsigned char* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        profile->checksum ^= bytes[i];
+        profile->checksum *= PROFILE_FNV_PRIME;
+    }
+}
+
+static int profile_counter(struct profile* profile, struct ast_node* node, int count)
+{
+    int counter = PROFILE_HEADER + profile->counter_count;
+    profile->counter_count += count;
+    profile_hash(profile, &node->type, sizeof(node->type));
+    return counter;
+}
+
+static void profile_number(struct profile* profile, struct ast_node* node)
+{
+    if (!node) {
+        return;
+    }
+    switch (node->type) {
+        case AST_FUNCTION_DEFINITION:
+            if (!node->function_def.body) {
+                return;
+            }
+            node->function_def.counter = profile_counter(profile, node, 1);
+            node->function_def.profile = profile;
+            profile_hash(profile, node->function_def.name, strlen(node->function_def.name));
+            break;
+        case AST_IF_STMT:
+            node->if_stmt.counter = profile_counter(profile, node, 2);
+            break;
+        case AST_WHILE:
+        case AST_WHILE_LOOP:
+            node->while_loop.counter = profile_counter(profile, node, 1);
+            break;
+        case AST_CASE:
+            node->case_label.counter = profile_counter(profile, node, 1);
+            break;
+        case AST_BINARY_OP:
+            if (node->binary_op.op == OP_LOGICAL_AND || node->binary_op.op == OP_LOGICAL_OR) {
+                node->binary_op.counter = profile_counter(profile, node, 1);
+            }
+            break;
+        default:
+            break;
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            profile_number(profile, (*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        profile_number(profile, *slots[i]);
+    }
+}
+
+// The counts from the profile file into profile->counts; false, with a
+// warning, when there's no usable profile
+static bool profile_load(struct compile_process* process, struct profile* profile, const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        compiler_warning(NULL, "Warning: no profile %s, compiling without it\n", path);
+        return false;
+    }
+    size_t count = PROFILE_HEADER + profile->counter_count;
+    long long* words = ast_arena_alloc(count * sizeof(long long));
+    size_t read = fread(words, sizeof(long long), count, file);
+    bool longer = fgetc(file) != EOF;
+    fclose(file);
+    if (read != count || longer || words[0] != PROFILE_MAGIC || (unsigned long long) words[1] != profile->checksum ||
+        words[2] != profile->counter_count) {
+        compiler_warning(NULL, "Warning: profile %s is not from this version of %s, compiling without it\n", path,
+                         process->cfile.abs_path);
+        return false;
+    }
+    profile->counts = words;
+    return true;
+}
+
+// Never-run functions after the rest, in the order they were in
+static void profile_order_functions(struct profile* profile, struct ast_node* root)
+{
+    struct ast_node** statements = root->root.statements;
+    int count = root->root.stmt_count;
+    struct ast_node** cold = malloc((count ? count : 1) * sizeof(struct ast_node*));
+    int kept = 0;
+    int cold_count = 0;
+    for (int i = 0; i < count; i++) {
+        struct ast_node* statement = statements[i];
+        if (statement->type == AST_FUNCTION_DEFINITION && statement->function_def.counter &&
+            profile->counts[statement->function_def.counter] == 0) {
+            cold[cold_count++] = statement;
+        } else {
+            statements[kept++] = statement;
+        }
+    }
+    memcpy(statements + kept, cold, cold_count * sizeof(struct ast_node*));
+    free(cold);
+}
+
+void profile_attach(struct compile_process* process, int flags)
+{
+    struct ast_node* root = process->ast;
+    struct profile* profile = ast_arena_alloc(sizeof(struct profile));
+    memset(profile, 0, sizeof(*profile));
+    profile->checksum = PROFILE_FNV_OFFSET;
+    profile_number(profile, root);
+
+    // The program may run anywhere, so the file it writes is named in full
+    const char* path = profile_path;
+    if (path[0] != '/') {
+        char* directory = getcwd(NULL, 0);
+        if (directory) {
+            char* full = ast_arena_alloc(strlen(directory) + strlen(path) + 2);
+            sprintf(full, "%s/%s", directory, path);
+            free(directory);
+            path = full;
+        }
+    }
+    if (flags & COMPILE_PROCESS_PROFILE_GENERATE) {
+        profile->path = path;
+    } else if (profile_load(process, profile, path)) {
+        profile_order_functions(profile, root);
+    }
+}
+
+bool profile_if_counts(struct profile* profile, struct ast_node* node, long long counts[2])
+{
+    if (!profile || !profile->counts || !node->if_stmt.counter) {
+        return false;
+    }
+    counts[0] = profile->counts[node->if_stmt.counter];
+    counts[1] = profile->counts[node->if_stmt.counter + 1];
+    return true;
+}
+
+long long profile_slot_count(struct profile* profile, struct ast_node* node, struct ast_node** slot, long long count)
+{
+    if (!profile || !profile->counts) {
+        return -1;
+    }
+    switch (node->type) {
+        case AST_FUNCTION_DEFINITION:
+            return node->function_def.counter ? profile->counts[node->function_def.counter] : count;
+        case AST_IF_STMT:
+            if (!node->if_stmt.counter || slot == &node->if_stmt.condition) {
+                return count;
+            }
+            return profile->counts[node->if_stmt.counter + (slot == &node->if_stmt.false_body)];
+        case AST_WHILE:
+        case AST_WHILE_LOOP: {
+            if (!node->while_loop.counter) {
+                return count;
+            }
+            long long body = profile->counts[node->while_loop.counter];
+            // The condition runs once more than the body, per entry
+            return slot == &node->while_loop.body || body > count ? body : count;
+        }
+        case AST_BINARY_OP:
+            if (!node->binary_op.counter || slot != &node->binary_op.right) {
+                return count;
+            }
+            return profile->counts[node->binary_op.counter];
+        default:
+            return count;
+    }
+}
+
+// The counter block, declared once per file: as wouldn't take a second
+// .comm for a .local symbol
+void generate_profile_counters(FILE* output, struct ast_node* root)
+{
+    struct profile* profile = NULL;
+    for (int i = 0; i < root->root.stmt_count && !profile; i++) {
+        if (root->root.statements[i]->type == AST_FUNCTION_DEFINITION) {
+            profile = root->root.statements[i]->function_def.profile;
+        }
+    }
+    if (!profile || !profile->path) {
+        return;
+    }
+    fprintf(output, "\t.local __profile_counters\n");
+    fprintf(output, "\t.comm __profile_counters,%d,8\n", 8 * (PROFILE_HEADER + profile->counter_count));
+}
+
+void generate_profile_counter(FILE* output, struct profile* profile, int counter)
+{
+    if (!profile || !profile->path || !counter) {
+        return;
+    }
+    fprintf(output, "\tincq __profile_counters+%d(%%rip)\n", 8 * counter);
+}
+
+// __profile_write, which main calls before it returns. It keeps every
+// register but %rcx and %r11, which syscall overwrites, so %rax still
+// holds the return value. The path goes on the stack 8 bytes at a time
+void generate_profile_writer(FILE* output, struct profile* profile)
+{
+    char* done_label = generate_label();
+    size_t length = strlen(profile->path) + 1;
+    int words = (int) ((length + 7) / 8);
+
+    fprintf(output, "__profile_write:\n");
+    fprintf(output, "\tpushq %%rax\n");
+    fprintf(output, "\tpushq %%rdx\n");
+    fprintf(output, "\tpushq %%rsi\n");
+    fprintf(output, "\tpushq %%rdi\n");
+    long long header[PROFILE_HEADER] = { PROFILE_MAGIC, (long long) profile->checksum, profile->counter_count };
+    for (int i = 0; i < PROFILE_HEADER; i++) {
+        fprintf(output, "\tmovq $%lld, %%rax\n", header[i]);
+        fprintf(output, "\tmovq %%rax, __profile_counters+%d(%%rip)\n", 8 * i);
+    }
+    for (int i = words - 1; i >= 0; i--) {
+        unsigned long long word = 0;
+        for (int b = 0; b < 8 && (size_t) (8 * i + b) < length; b++) {
+            word |= (unsigned long long) (unsigned char) profile->path[8 * i + b] << (8 * b);
+        }
+        fprintf(output, "\tmovq $%lld, %%rax\n", (long long) word);
+        fprintf(output, "\tpushq %%rax\n");
+    }
+    // open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644)
+    fprintf(output, "\tmovq %%rsp, %%rdi\n");
+    fprintf(output, "\tmovq $577, %%rsi\n");
+    fprintf(output, "\tmovq $420, %%rdx\n");
+    fprintf(output, "\tmovq $2, %%rax\n");
+    fprintf(output, "\tsyscall\n");
+    fprintf(output, "\taddq $%d, %%rsp\n", 8 * words);
+    fprintf(output, "\ttestq %%rax, %%rax\n");
+    fprintf(output, "\tjs %s\n", done_label);
+    // write(fd, counters, size), then close(fd)
+    fprintf(output, "\tmovq %%rax, %%rdi\n");
+    fprintf(output, "\tleaq __profile_counters(%%rip), %%rsi\n");
+    fprintf(output, "\tmovq $%d, %%rdx\n", 8 * (PROFILE_HEADER + profile->counter_count));
+    fprintf(output, "\tmovq $1, %%rax\n");
+    fprintf(output, "\tsyscall\n");
+    fprintf(output, "\tmovq $3, %%rax\n");
+    fprintf(output, "\tsyscall\n");
+    fprintf(output, "%s:\n", done_label);
+    fprintf(output, "\tpopq %%rdi\n");
+    fprintf(output, "\tpopq %%rsi\n");
+    fprintf(output, "\tpopq %%rdx\n");
+    fprintf(output, "\tpopq %%rax\n");
+    fprintf(output, "\tret\n");
+    free(done_label);
+}
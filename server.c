@@ -0,0 +1,268 @@
+// Compile server.
+//
+//   ./main --server <socket> [--threads <n>]
+//   ./main --connect <socket> [-o <output.s>] [input.c]
+//
+// The server listens on a Unix socket and runs every request through
+// compile_file on one of <n> long-lived worker threads, so a build that runs
+// thousands of tiny compiles pays process startup and allocator warm-up once.
+// All of the compiler's mutable globals are thread-local, and compiler_error
+// unwinds to compile_file instead of exiting, so one bad input only fails its
+// own request. Its diagnostics go back to the client along with the time the
+// compile took.
+//
+// One request per connection:
+//   client -> server  struct compile_request, input path, output path, input name
+//   server -> client  struct compile_response, diagnostics
+// Paths are made absolute by the client, since the server has its own cwd.
+// The input's name as the client was given it comes along for diagnostics,
+// which then read the same as a direct compile's.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+struct compile_request {
+    int flags;
+    unsigned int input_length;
+    unsigned int output_length;
+    unsigned int name_length;
+};
+
+struct compile_response {
+    int status;
+    unsigned int diagnostics_length;
+    long long elapsed_us;
+};
+
+static bool read_full(int fd, void* data, size_t size)
+{
+    char* bytes = data;
+    while (size > 0) {
+        ssize_t got = read(fd, bytes, size);
+        if (got <= 0) {
+            return false;
+        }
+        bytes += got;
+        size -= got;
+    }
+    return true;
+}
+
+static bool write_full(int fd, const void* data, size_t size)
+{
+    const char* bytes = data;
+    while (size > 0) {
+        ssize_t sent = write(fd, bytes, size);
+        if (sent <= 0) {
+            return false;
+        }
+        bytes += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+static int socket_address(const char* socket_path, struct sockaddr_un* address)
+{
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(address->sun_path)) {
+        fprintf(stderr, "socket path %s is too long\n", socket_path);
+        return -1;
+    }
+    strcpy(address->sun_path, socket_path);
+    return 0;
+}
+
+static long long elapsed_us_since(struct timespec* start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1000000LL + (now.tv_nsec - start->tv_nsec) / 1000;
+}
+
+static void serve_connection(int fd)
+{
+    struct compile_request request;
+    if (!read_full(fd, &request, sizeof(request)) ||
+        request.input_length >= PATH_MAX || request.output_length >= PATH_MAX ||
+        request.name_length >= PATH_MAX) {
+        return;
+    }
+    char input[PATH_MAX], output[PATH_MAX], name[PATH_MAX];
+    if (!read_full(fd, input, request.input_length) || !read_full(fd, output, request.output_length) ||
+        !read_full(fd, name, request.name_length)) {
+        return;
+    }
+    input[request.input_length] = 0;
+    output[request.output_length] = 0;
+    name[request.name_length] = 0;
+
+    char* diagnostics = NULL;
+    size_t diagnostics_length = 0;
+    compiler_diagnostics = open_memstream(&diagnostics, &diagnostics_length);
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    struct compile_response response;
+    compiler_input_name = name;
+    response.status = compile_file(input, output, request.flags);
+    compiler_input_name = NULL;
+    response.elapsed_us = elapsed_us_since(&start);
+    fclose(compiler_diagnostics);
+    compiler_diagnostics = NULL;
+
+    response.diagnostics_length = diagnostics_length;
+    if (write_full(fd, &response, sizeof(response))) {
+        write_full(fd, diagnostics, diagnostics_length);
+    }
+    free(diagnostics);
+}
+
+// Waits after accept() fails with anything but a signal or a client that
+// gave up, in milliseconds: the first time, and at most
+#define SERVER_ACCEPT_BACKOFF_MS 10
+#define SERVER_ACCEPT_MAX_BACKOFF_MS 1000
+
+// Every worker blocks in accept() on the shared socket and the kernel hands
+// each connection to one of them. Running out of descriptors (EMFILE,
+// ENFILE) or memory lasts until a compile finishes, so rather than spin on
+// it the worker logs it and waits, longer each time it happens again
+static void* server_worker(void* data)
+{
+    int listen_fd = *(int*) data;
+    int backoff = 0;
+    while (true) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            perror("accept");
+            backoff = backoff ? backoff * 2 : SERVER_ACCEPT_BACKOFF_MS;
+            if (backoff > SERVER_ACCEPT_MAX_BACKOFF_MS) {
+                backoff = SERVER_ACCEPT_MAX_BACKOFF_MS;
+            }
+            struct timespec wait = { backoff / 1000, (backoff % 1000) * 1000000L };
+            nanosleep(&wait, NULL);
+            continue;
+        }
+        backoff = 0;
+        serve_connection(fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+int compile_server_run(const char* socket_path, int threads)
+{
+    struct sockaddr_un address;
+    if (socket_address(socket_path, &address) != 0) {
+        return 1;
+    }
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        perror("socket");
+        return 1;
+    }
+    // A socket left behind by a previous server would make bind fail
+    unlink(socket_path);
+    if (bind(listen_fd, (struct sockaddr*) &address, sizeof(address)) != 0 || listen(listen_fd, 128) != 0) {
+        perror(socket_path);
+        close(listen_fd);
+        return 1;
+    }
+    // A client that goes away mid-response mustn't take the server down
+    signal(SIGPIPE, SIG_IGN);
+    // Hash the executable now rather than racing on it in the first requests
+    compiler_build_id();
+
+    if (threads < 1) {
+        threads = sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    printf("compile server listening on %s with %d threads\n", socket_path, threads);
+    fflush(stdout);
+    pthread_t* workers = calloc(threads, sizeof(pthread_t));
+    int started = 0;
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&workers[started], NULL, server_worker, &listen_fd) == 0) {
+            started++;
+        }
+    }
+    if (!started) {
+        // No threads to be had, so this one serves
+        server_worker(&listen_fd);
+    }
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    free(workers);
+    close(listen_fd);
+    return 0;
+}
+
+static void absolute_path(const char* path, char* absolute, size_t size)
+{
+    char cwd[PATH_MAX];
+    if (path[0] == '/' || !getcwd(cwd, sizeof(cwd))) {
+        snprintf(absolute, size, "%s", path);
+    } else {
+        snprintf(absolute, size, "%s/%s", cwd, path);
+    }
+}
+
+int compile_client_run(const char* socket_path, const char* filename, const char* out_filename, int flags, long long* elapsed_us)
+{
+    struct sockaddr_un address;
+    if (socket_address(socket_path, &address) != 0) {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*) &address, sizeof(address)) != 0) {
+        perror(socket_path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    char input[PATH_MAX], output[PATH_MAX];
+    absolute_path(filename, input, sizeof(input));
+    absolute_path(out_filename, output, sizeof(output));
+    struct compile_request request = { flags, strlen(input), strlen(output), strlen(filename) };
+    struct compile_response response;
+    if (!write_full(fd, &request, sizeof(request)) ||
+        !write_full(fd, input, request.input_length) ||
+        !write_full(fd, output, request.output_length) ||
+        !write_full(fd, filename, request.name_length) ||
+        !read_full(fd, &response, sizeof(response))) {
+        fprintf(stderr, "lost the connection to the compile server\n");
+        close(fd);
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    // Copy the diagnostics through as the compile would have printed them
+    char buffer[4096];
+    unsigned int remaining = response.diagnostics_length;
+    while (remaining > 0) {
+        unsigned int chunk = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+        if (!read_full(fd, buffer, chunk)) {
+            break;
+        }
+        fwrite(buffer, 1, chunk, stderr);
+        remaining -= chunk;
+    }
+    close(fd);
+    *elapsed_us = response.elapsed_us;
+    return response.status;
+}
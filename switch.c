@@ -0,0 +1,197 @@
+// Switch statements.
+//
+// The cases are sorted by value, and the generator picks the dispatch for
+// each run of them. Dense values, where most of the range between the
+// lowest and highest is cases, take a jump table: one bounds check, and an
+// indirect jump through a table of 32-bit offsets that sits in .text after
+// it, so it needs no relocations and works wherever the code is loaded:
+//
+//     subq $low, %rax; cmpq $(high - low), %rax; ja default
+//     leaq table(%rip), %rcx; movslq (%rcx,%rax,4), %rax
+//     addq %rcx, %rax; jmp *%rax
+//   table:
+//     .long case_low - table, ...
+//
+// Sparse values are split at the middle case into a balanced binary search,
+// whose halves are dispatched the same way, so a sparse switch with dense
+// clusters gets a table per cluster. A handful of cases left over are
+// compared one after another. Either way dispatch takes a logarithmic number
+// of branches instead of one per case. The bytecode backend uses the same
+// rule to choose between its table and search instructions.
+#include "compiler.h"
+#include <stdlib.h>
+
+// Fewer cases than this aren't worth the indirect jump
+#define SWITCH_MIN_TABLE_CASES 4
+// Table entries per case, at most, and in all
+#define SWITCH_MAX_TABLE_SPREAD 3
+#define SWITCH_MAX_TABLE_SIZE 4096
+// Cases compared in a row at the leaves of the binary search
+#define SWITCH_MAX_LINEAR_CASES 3
+
+// Where a break goes in the switch being generated
+static __thread const char* break_label = NULL;
+
+static int switch_case_compare(const void* a, const void* b)
+{
+    const struct switch_case* left = a;
+    const struct switch_case* right = b;
+    return left->value < right->value ? -1 : left->value > right->value;
+}
+
+// Sorted by value; the caller frees cases. default_statement is -1 when
+// there's no default
+int switch_cases(struct ast_node* node, struct switch_case** cases, int* default_statement)
+{
+    struct ast_node* body = node->switch_stmt.body;
+    *cases = malloc((body->block.stmt_count ? body->block.stmt_count : 1) * sizeof(struct switch_case));
+    *default_statement = -1;
+    int count = 0;
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        struct ast_node* statement = body->block.statements[i];
+        if (statement->type != AST_CASE) {
+            continue;
+        }
+        if (!statement->case_label.value) {
+            *default_statement = i;
+            continue;
+        }
+        (*cases)[count].value = statement->case_label.value->number.value;
+        (*cases)[count].statement = i;
+        count++;
+    }
+    qsort(*cases, count, sizeof(struct switch_case), switch_case_compare);
+    for (int i = 1; i < count; i++) {
+        if ((*cases)[i].value == (*cases)[i - 1].value) {
+            long long value = (*cases)[i].value;
+            free(*cases);
+            compiler_error(NULL, "Error: Duplicate case value %lld\n", value);
+        }
+    }
+    return count;
+}
+
+bool switch_is_dense(struct switch_case* cases, int count)
+{
+    if (count < SWITCH_MIN_TABLE_CASES) {
+        return false;
+    }
+    // The spread, less one, can't overflow as unsigned
+    unsigned long long spread = (unsigned long long) cases[count - 1].value - (unsigned long long) cases[0].value;
+    return spread < SWITCH_MAX_TABLE_SIZE && spread < (unsigned long long) count * SWITCH_MAX_TABLE_SPREAD;
+}
+
+// Compares the switch value in %rax with value; only 32-bit immediates fit
+// in cmpq
+static void switch_compare(FILE* output, long long value)
+{
+    if (value >= -2147483648LL && value <= 2147483647LL) {
+        fprintf(output, "\tcmpq $%lld, %%rax\n", value);
+        return;
+    }
+    fprintf(output, "\tmovq $%lld, %%rcx\n", value);
+    fprintf(output, "\tcmpq %%rcx, %%rax\n");
+}
+
+static void switch_table(FILE* output, struct switch_case* cases, int count, char** labels, const char* default_label)
+{
+    long long low = cases[0].value;
+    long long spread = (long long) ((unsigned long long) cases[count - 1].value - (unsigned long long) low);
+    if (low >= -2147483648LL && low <= 2147483647LL) {
+        if (low) {
+            fprintf(output, "\tsubq $%lld, %%rax\n", low);
+        }
+    } else {
+        fprintf(output, "\tmovq $%lld, %%rcx\n", low);
+        fprintf(output, "\tsubq %%rcx, %%rax\n");
+    }
+    // Below low wraps around to above the spread
+    fprintf(output, "\tcmpq $%lld, %%rax\n", spread);
+    fprintf(output, "\tja %s\n", default_label);
+    char* table = generate_label();
+    fprintf(output, "\tleaq %s(%%rip), %%rcx\n", table);
+    fprintf(output, "\tmovslq (%%rcx,%%rax,4), %%rax\n");
+    fprintf(output, "\taddq %%rcx, %%rax\n");
+    fprintf(output, "\tjmp *%%rax\n");
+    fprintf(output, "%s:\n", table);
+    int next = 0;
+    for (long long entry = 0; entry <= spread; entry++) {
+        const char* target = default_label;
+        if ((unsigned long long) cases[next].value - (unsigned long long) low == (unsigned long long) entry) {
+            target = labels[cases[next++].statement];
+        }
+        fprintf(output, "\t.long %s-%s\n", target, table);
+    }
+    free(table);
+}
+
+static void switch_dispatch(FILE* output, struct switch_case* cases, int count, char** labels, const char* default_label)
+{
+    if (switch_is_dense(cases, count)) {
+        switch_table(output, cases, count, labels, default_label);
+        return;
+    }
+    if (count <= SWITCH_MAX_LINEAR_CASES) {
+        for (int i = 0; i < count; i++) {
+            switch_compare(output, cases[i].value);
+            fprintf(output, "\tje %s\n", labels[cases[i].statement]);
+        }
+        fprintf(output, "\tjmp %s\n", default_label);
+        return;
+    }
+    int middle = count / 2;
+    char* upper = generate_label();
+    switch_compare(output, cases[middle].value);
+    fprintf(output, "\tje %s\n", labels[cases[middle].statement]);
+    fprintf(output, "\tjg %s\n", upper);
+    switch_dispatch(output, cases, middle, labels, default_label);
+    fprintf(output, "%s:\n", upper);
+    switch_dispatch(output, cases + middle + 1, count - middle - 1, labels, default_label);
+    free(upper);
+}
+
+void generate_switch(FILE* output, struct ast_node* node)
+{
+    struct ast_node* body = node->switch_stmt.body;
+    struct switch_case* cases;
+    int default_statement;
+    int count = switch_cases(node, &cases, &default_statement);
+
+    char** labels = calloc(body->block.stmt_count ? body->block.stmt_count : 1, sizeof(char*));
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        if (body->block.statements[i]->type == AST_CASE) {
+            labels[i] = generate_label();
+        }
+    }
+    char* end_label = generate_label();
+    const char* default_label = default_statement >= 0 ? labels[default_statement] : end_label;
+
+    generate_expression(output, node->switch_stmt.value);
+    switch_dispatch(output, cases, count, labels, default_label);
+
+    const char* outer_break = break_label;
+    break_label = end_label;
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        if (labels[i]) {
+            fprintf(output, "%s:\n", labels[i]);
+        }
+        generate_code(output, body->block.statements[i]);
+    }
+    break_label = outer_break;
+    fprintf(output, "%s:\n", end_label);
+
+    for (int i = 0; i < body->block.stmt_count; i++) {
+        free(labels[i]);
+    }
+    free(labels);
+    free(end_label);
+    free(cases);
+}
+
+void generate_break(FILE* output)
+{
+    if (!break_label) {
+        compiler_error(NULL, "Error: break outside of a switch\n");
+    }
+    fprintf(output, "\tjmp %s\n", break_label);
+}
@@ -0,0 +1,24 @@
+// Preloaded into the compile server by make test: accept() fails with
+// EMFILE for the first 300ms, as it does while a process is out of file
+// descriptors, and works after that
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/socket.h>
+
+int accept(int fd, struct sockaddr* address, socklen_t* length)
+{
+    static struct timespec start;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (!start.tv_sec && !start.tv_nsec) {
+        start = now;
+    }
+    if ((now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000 < 300) {
+        errno = EMFILE;
+        return -1;
+    }
+    int (*real_accept)(int, struct sockaddr*, socklen_t*) = dlsym(RTLD_NEXT, "accept");
+    return real_accept(fd, address, length);
+}
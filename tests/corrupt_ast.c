@@ -0,0 +1,31 @@
+int total = 3;
+
+int add(int a, int b)
+{
+    return a + b;
+}
+
+int main()
+{
+    int values[4];
+    for (int i = 0; i < 4; i++) {
+        values[i] = add(i, total);
+    }
+    int k = 0;
+    while (k < 4) {
+        if (values[k] > 4) {
+            print(-values[k]);
+        } else {
+            print(values[k]);
+        }
+        k = k + 1;
+    }
+    switch (k) {
+        case 4:
+            print(k);
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
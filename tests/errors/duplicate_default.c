@@ -0,0 +1,13 @@
+int main()
+{
+    int x = 2;
+    switch (x) {
+        default:
+            break;
+        case 1:
+            break;
+        default:
+            break;
+    }
+    return 0;
+}
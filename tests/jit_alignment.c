@@ -0,0 +1,13 @@
+int nested(int a) {
+    return a + stack_offset();
+}
+
+int main() {
+    int x = 1;
+    print(stack_offset());
+    print(x + stack_offset());
+    print(x + (x + stack_offset()));
+    print(nested(2));
+    print(nested(x + 2) + x);
+    return 0;
+}
@@ -0,0 +1,9 @@
+// A pthread_create that always fails, preloaded by run_tests.sh to check
+// that the compiler still works when it can't start threads
+#include <errno.h>
+#include <pthread.h>
+
+int pthread_create(pthread_t* thread, const pthread_attr_t* attr, void* (*start)(void*), void* arg)
+{
+    return EAGAIN;
+}
@@ -0,0 +1,29 @@
+int twice(int x) {
+    return x * 2;
+}
+
+int main() {
+    int total = 0;
+    for (int i = 0; i < 10; i++) {
+        switch (i % 4) {
+            case 0:
+                total = total + 1;
+            case 1:
+                total = total + 2;
+                break;
+            case 3:
+                total = total + 3;
+                break;
+            default:
+                total = total - 1;
+        }
+        if (i > 6 && i < 9) {
+            total = total + 10;
+        }
+        if (i < 100 || twice(i) > 5) {
+            total = total + 1;
+        }
+    }
+    print(total);
+    return 0;
+}
@@ -0,0 +1,11 @@
+int main() {
+    int x = 5;
+    int y = x;
+    int z = 10 + 20;
+    print(z);
+    print(x);
+    if(x  == 5){
+        print(10);
+    }
+    
+}
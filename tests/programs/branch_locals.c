@@ -0,0 +1,27 @@
+// A local declared on one side of an if, which doesn't run, mustn't leave
+// the other side's locals where print's buffer and pushes go
+int one()
+{
+    int r = 0;
+    int i = 0;
+    while (i < 1) {
+        r = r + 1;
+        i++;
+    }
+    return r;
+}
+
+int main()
+{
+    int c = one();
+    if (c == 0) {
+        int t = 1;
+    } else {
+        int k = 0;
+        while (k < 3) {
+            print(k);
+            k = k + 1;
+        }
+    }
+    return 0;
+}
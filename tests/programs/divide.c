@@ -0,0 +1,119 @@
+// Division and remainder by constants of every kind divide.c handles:
+// powers of two, small and large odd and even divisors, negatives and the
+// extremes, over dividends that cover the same ground
+int main() {
+    int x[23];
+    int h = 0;
+    x[0] = 0;
+    x[1] = 1;
+    x[2] = -1;
+    x[3] = 2;
+    x[4] = -2;
+    x[5] = 3;
+    x[6] = -3;
+    x[7] = 6;
+    x[8] = -7;
+    x[9] = 13;
+    x[10] = -13;
+    x[11] = 99;
+    x[12] = -100;
+    x[13] = 12345;
+    x[14] = -12345;
+    x[15] = 1000000006;
+    x[16] = 4294967297;
+    x[17] = -4294967297;
+    x[18] = 9223372036854775807;
+    x[19] = -9223372036854775807;
+    x[20] = -9223372036854775807 - 1;
+    x[21] = 123456789012345678;
+    x[22] = -123456789012345678;
+    for (int i = 0; i < 23; i++) {
+        int v = x[i];
+        print(v / 1);
+        print(v % (1));
+        print(v / 2);
+        print(v % (2));
+        print(v / 3);
+        print(v % (3));
+        print(v / 5);
+        print(v % (5));
+        print(v / 6);
+        print(v % (6));
+        print(v / 7);
+        print(v % (7));
+        print(v / 9);
+        print(v % (9));
+        print(v / 10);
+        print(v % (10));
+        print(v / 12);
+        print(v % (12));
+        print(v / 16);
+        print(v % (16));
+        print(v / 25);
+        print(v % (25));
+        print(v / 60);
+        print(v % (60));
+        print(v / 64);
+        print(v % (64));
+        print(v / 100);
+        print(v % (100));
+        print(v / 641);
+        print(v % (641));
+        print(v / 1000);
+        print(v % (1000));
+        print(v / 4096);
+        print(v % (4096));
+        print(v / 65536);
+        print(v % (65536));
+        print(v / 1000000007);
+        print(v % (1000000007));
+        print(v / 2147483648);
+        print(v % (2147483648));
+        print(v / 2147483649);
+        print(v % (2147483649));
+        print(v / 4294967296);
+        print(v % (4294967296));
+        print(v / 4294967297);
+        print(v % (4294967297));
+        print(v / 1099511627773);
+        print(v % (1099511627773));
+        print(v / 4611686018427387904);
+        print(v % (4611686018427387904));
+        print(v / 4611686018427387905);
+        print(v % (4611686018427387905));
+        print(v / 9223372036854775807);
+        print(v % (9223372036854775807));
+        print(v / -2);
+        print(v % (-2));
+        print(v / -3);
+        print(v % (-3));
+        print(v / -5);
+        print(v % (-5));
+        print(v / -7);
+        print(v % (-7));
+        print(v / -8);
+        print(v % (-8));
+        print(v / -10);
+        print(v % (-10));
+        print(v / -16);
+        print(v % (-16));
+        print(v / -641);
+        print(v % (-641));
+        print(v / -2147483648);
+        print(v % (-2147483648));
+        print(v / -4294967297);
+        print(v % (-4294967297));
+        print(v / -4611686018427387904);
+        print(v % (-4611686018427387904));
+        print(v / -9223372036854775807);
+        print(v % (-9223372036854775807));
+        print(v / (-9223372036854775807 - 1));
+        print(v % (-9223372036854775807 - 1));
+        int w = v;
+        w /= 7;
+        print(w);
+        x[i] /= -16;
+        print(x[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,44 @@
+int sum(int n)
+{
+    int total = 0;
+    for (int k = 0; k < n; k++) {
+        total += k;
+    }
+    for (int k = 0; k < n; k++) {
+        total += k * 10;
+    }
+    return total;
+}
+
+int main()
+{
+    int count = 0;
+    for (int k = 0; k < 3; k++) {
+        count++;
+    }
+    // A second loop declaring k gets a k of its own
+    int seen = 0;
+    for (int k = 0; k < 3; k++) {
+        seen += k;
+    }
+    print(count);
+    print(seen);
+    print(sum(4));
+
+    // The body's i hides the loop's, which the update still counts
+    int steps = 0;
+    for (int i = 0; i < 3; i++) {
+        int i = 10;
+        steps += i;
+    }
+    print(steps);
+
+    // An inner block's variable goes away with the block
+    int x = 1;
+    {
+        int x = 2;
+        print(x);
+    }
+    print(x);
+    return 0;
+}
@@ -0,0 +1,27 @@
+// The tree walk leaves jumps here that the peephole removes (see
+// peephole.c): the then side of the inner if jumps to the end of the inner
+// if, where there is only a jump to the end of the outer one, and the if
+// without an else jumps over the empty else to the code right after it
+int classify(int x, int y) {
+    int r = 0;
+    if (x > 0) {
+        if (y > 0) {
+            r = 1;
+        } else {
+            r = 2;
+        }
+    } else {
+        r = 3;
+    }
+    if (x == y) {
+        r = r + 10;
+    }
+    return r;
+}
+int main() {
+    print(classify(1, 1));
+    print(classify(1, -1));
+    print(classify(-1, 5));
+    print(classify(-2, -2));
+    return 0;
+}
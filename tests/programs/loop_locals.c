@@ -0,0 +1,25 @@
+// Declarations in a loop body take their stack once, however many times
+// the body runs. one recurses so that it isn't inlined, and main keeps its
+// frame
+int one(int x)
+{
+    if (x > 1) {
+        return one(x - 1);
+    }
+    return x;
+}
+
+int main()
+{
+    int sum = 0;
+    for (int i = 0; i < 5000000; i++) {
+        int t = one(1);
+        for (int j = 0; j < 1; j++) {
+            int values[4];
+            values[j] = t;
+            sum += values[j];
+        }
+    }
+    print(sum);
+    return 0;
+}
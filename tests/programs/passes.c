@@ -0,0 +1,26 @@
+// What the optimization passes change shows in the assembly, which
+// run_tests.sh checks: scale is inlined into main (inline.c), and in sum's
+// loop a ^ b is computed once before it and i * (a ^ b) is kept up to date
+// by adding instead of multiplying (loop.c), with the condition tested at
+// the bottom
+int scale(int a, int b) {
+    return a * b + a;
+}
+int sum(int n, int a, int b) {
+    int s = 0;
+    int i = 0;
+    while (i < n) {
+        s += i * (a ^ b);
+        i++;
+    }
+    return s;
+}
+int main() {
+    int x = 3;
+    print(scale(x, 4));
+    print(scale(x++, x));
+    print(sum(10, 6, 3));
+    print(sum(0, 6, 3));
+    print(sum(x, scale(2, x), 1));
+    return 0;
+}
@@ -0,0 +1,147 @@
+int dense(int x) {
+    switch (x) {
+        case 0: return 10;
+        case 1: return 11;
+        case 2: return 12;
+        case 3: return 13;
+        case 5: return 15;
+        case 6: return 16;
+        default: return -1;
+    }
+    return 99;
+}
+
+int sparse(int x) {
+    int r = 0;
+    switch (x) {
+        case -1000: r = 1; break;
+        case 7: r = 2; break;
+        case 300: r = 3; break;
+        case 4000: r = 4; break;
+        case 50000: r = 5; break;
+        case 600000: r = 6; break;
+        case 7000000: r = 7; break;
+        case 80000000000: r = 8; break;
+    }
+    return r;
+}
+
+int clusters(int x) {
+    int r = 0;
+    switch (x) {
+        case 100: case 101: r += 1;
+        case 102: r += 2; break;
+        case 103: r = 30; break;
+        case 104: r = 40; break;
+        case 9000: r = 900; break;
+        case 9001: r = 901; break;
+        case 9002: r = 902; break;
+        case 9003: r = 903; break;
+        case 9004: r = 904; break;
+        case -5: r = -50; break;
+        default: r = 7;
+        case 55: r += 5;
+    }
+    return r;
+}
+
+int negative(int x) {
+    switch (x) {
+        case -3: return 3;
+        case -2: return 2;
+        case -1: return 1;
+        case 0: return 0;
+        case 1: return -1;
+    }
+    return 100;
+}
+
+int nested(int a, int b) {
+    int r = 0;
+    switch (a) {
+        case 1:
+            switch (b) {
+                case 1: r = 11; break;
+                case 2: r = 12; break;
+            }
+            r += 100;
+            break;
+        case 2: {
+            int t = b * 2;
+            r = t;
+            break;
+        }
+    }
+    return r;
+}
+
+// Cases at both ends of the 64-bit range: a table just below the largest
+// value, and a search whose spread doesn't fit in a signed value
+int extremes(int x) {
+    switch (x) {
+        case 9223372036854775804: return 1;
+        case 9223372036854775805: return 2;
+        case 9223372036854775806: return 3;
+        case 9223372036854775807: return 4;
+    }
+    switch (x) {
+        case -9223372036854775807: return -1;
+        case -4294967296: return -2;
+        case 4294967296: return -3;
+        case 9223372036854775800: return -4;
+    }
+    return 0;
+}
+
+int main() {
+    int s = 0;
+    for (int i = -2; i < 9; i++) {
+        s = s * 3 + dense(i);
+    }
+    print(s);
+    int t = 0;
+    int k[10];
+    k[0] = -1000; k[1] = 7; k[2] = 300; k[3] = 4000; k[4] = 50000;
+    k[5] = 600000; k[6] = 7000000; k[7] = 80000000000; k[8] = 8; k[9] = 0;
+    for (int j = 0; j < 10; j++) {
+        t = t * 10 + sparse(k[j]);
+    }
+    print(t);
+    for (int m = 99; m < 106; m++) {
+        print(clusters(m));
+    }
+    print(clusters(9003));
+    print(clusters(-5));
+    print(clusters(55));
+    print(clusters(56));
+    for (int n = -4; n < 3; n++) {
+        print(negative(n));
+    }
+    print(nested(1, 1));
+    print(nested(1, 2));
+    print(nested(1, 3));
+    print(nested(2, 21));
+    print(nested(3, 21));
+    int total = 0;
+    for (int q = 0; q < 1000; q++) {
+        switch (q % 4) {
+            case 0: total += 1; break;
+            case 1: total += 10; break;
+            case 2: total += 100; break;
+            case 3: total += 1000; break;
+        }
+    }
+    print(total);
+    int big = 9223372036854775803;
+    for (int e = 0; e < 5; e++) {
+        print(extremes(big));
+        big = big + 1;
+    }
+    print(extremes(-9223372036854775807));
+    print(extremes(-9223372036854775807 - 1));
+    print(extremes(-4294967296));
+    print(extremes(4294967296));
+    print(extremes(4294967295));
+    print(extremes(9223372036854775800));
+    return 0;
+}
@@ -0,0 +1,27 @@
+// Calls in tail position are jumps (see frame.c), so these recurse 10^7
+// deep in constant stack; with a frame per call they'd need hundreds of MB
+int count_down(int n, int acc) {
+    if (n == 0) {
+        return acc;
+    }
+    return count_down(n - 1, acc + n % 7);
+}
+int is_odd(int n);
+int is_even(int n) {
+    if (n == 0) {
+        return 1;
+    }
+    return is_odd(n - 1);
+}
+int is_odd(int n) {
+    if (n == 0) {
+        return 0;
+    }
+    return is_even(n - 1);
+}
+int main() {
+    print(count_down(10000000, 0));
+    print(is_even(10000001));
+    print(is_odd(10000001));
+    return 0;
+}
@@ -0,0 +1,58 @@
+// Loops vectorize.c runs several elements at a time: trip counts that
+// don't divide by the vector width, loops that start past element 0 and
+// loops too short for a single vector iteration
+int mixed(int start, int n, int k) {
+    int a[11];
+    int b[11];
+    int c[11];
+    int i = 0;
+    while (i < 11) {
+        a[i] = 0;
+        b[i] = i * 3;
+        c[i] = 100 - i;
+        i++;
+    }
+    i = start;
+    while (i < n) {
+        a[i] = b[i] + c[i] ^ k;
+        c[i] -= 5;
+        i++;
+    }
+    int sum = 0;
+    for (i = 0; i < 11; i++) {
+        sum = sum * 7 + a[i] * 3 + c[i];
+    }
+    return sum;
+}
+int constant_bound(int k) {
+    int a[9];
+    int b[9];
+    int i = 0;
+    while (i < 9) {
+        a[i] = i;
+        b[i] = i * i;
+        i++;
+    }
+    for (i = 2; i < 9; i++) {
+        a[i] += b[i] - k | 1;
+        b[i] = a[i] & 12;
+    }
+    int sum = 0;
+    for (i = 0; i < 9; i++) {
+        sum = sum * 5 + a[i] + b[i];
+    }
+    return sum;
+}
+int main() {
+    print(mixed(0, 11, 6));
+    print(mixed(0, 9, 6));
+    print(mixed(3, 10, 6));
+    print(mixed(1, 8, 6));
+    print(mixed(5, 8, 6));
+    print(mixed(2, 3, 6));
+    print(mixed(0, 1, 6));
+    print(mixed(4, 4, 6));
+    print(mixed(7, 5, 6));
+    print(constant_bound(3));
+    return 0;
+}
@@ -0,0 +1,308 @@
+#!/bin/sh
+# Regression tests, run by `make test` from the top of the tree.
+#
+# Every tests/programs/<name>.c is compiled and run through each backend:
+# assembly linked by gcc, an object file from -c, --run and --interpret.
+# All four must print tests/programs/<name>.expected. Every
+# tests/errors/<name>.c must fail to compile with the diagnostics in
+# tests/errors/<name>.expected. The checks after that cover what a
+# program's output doesn't show.
+MAIN=./main
+WORK=./build/tests
+failures=0
+
+mkdir -p $WORK
+
+fail()
+{
+    echo "FAIL: $*"
+    failures=$((failures + 1))
+}
+
+# check_output <what> <expected file> <actual file>
+check_output()
+{
+    if ! cmp -s "$2" "$3"; then
+        fail "$1"
+        diff "$2" "$3" | head -10
+    fi
+}
+
+for program in tests/programs/*.c; do
+    name=$(basename $program .c)
+    expected=tests/programs/$name.expected
+    if $MAIN $program -o $WORK/$name.s >/dev/null && gcc -no-pie $WORK/$name.s -o $WORK/$name; then
+        $WORK/$name > $WORK/$name.out
+        check_output "$name (assembly)" $expected $WORK/$name.out
+    else
+        fail "$name (assembly) didn't build"
+    fi
+    if $MAIN -c $program -o $WORK/$name.o >/dev/null && gcc -no-pie $WORK/$name.o -o $WORK/$name.obj; then
+        $WORK/$name.obj > $WORK/$name.out
+        check_output "$name (-c)" $expected $WORK/$name.out
+    else
+        fail "$name (-c) didn't build"
+    fi
+    $MAIN --run $program > $WORK/$name.out
+    check_output "$name (--run)" $expected $WORK/$name.out
+    $MAIN --interpret $program > $WORK/$name.out
+    check_output "$name (--interpret)" $expected $WORK/$name.out
+done
+
+for program in tests/errors/*.c; do
+    name=$(basename $program .c)
+    for mode in "" --interpret; do
+        if $MAIN $mode $program -o $WORK/$name.s >/dev/null 2>$WORK/$name.err; then
+            fail "$name $mode compiled"
+        fi
+        check_output "$name $mode diagnostics" tests/errors/$name.expected $WORK/$name.err
+    done
+    # A failed compile removes its output, but only when that is a file
+    $MAIN $program -o /dev/null >/dev/null 2>&1
+    [ -c /dev/null ] || fail "$name removed /dev/null"
+done
+
+# Switches dispatch through jump tables where their cases are dense and a
+# binary search where they aren't, in the assembly and in the bytecode. The
+# bytecode's choice only shows in a build with tracing
+$MAIN tests/programs/switch.c -o $WORK/switch.s >/dev/null
+if [ $(grep -c 'jmp \*%rax' $WORK/switch.s) -ne 5 ]; then
+    fail "switch.c jump tables"
+fi
+gcc -g -DCOMPILER_TRACE -I. $(ls *.c | grep -v test.c) helpers/*.c -pthread -ldl -o $WORK/main_trace
+COMPILER_TRACE=2 $WORK/main_trace --interpret tests/programs/switch.c | grep '^Switch' > $WORK/switch_lowering.out
+check_output "switch.c bytecode dispatch" tests/switch_lowering.expected $WORK/switch_lowering.out
+
+# Divisions by constants multiply by a magic number instead; in divide.c
+# only the division and remainder by 1 are left to idivq
+$MAIN tests/programs/divide.c -o $WORK/divide.s >/dev/null
+if [ $(grep -c idivq $WORK/divide.s) -ne 2 ]; then
+    fail "divide.c divisions by constants"
+fi
+
+# Both of vector.c's array loops are vectorized, for AVX2 and for SSE2, and
+# give the same output when SSE2 is forced on a CPU that has AVX2
+$MAIN tests/programs/vector.c -o $WORK/vector.s >/dev/null
+if [ $(grep -c cpuid $WORK/vector.s) -ne 4 ] || ! grep -q ymm $WORK/vector.s || ! grep -q xmm $WORK/vector.s; then
+    fail "vector.c loops not vectorized"
+fi
+gcc -no-pie $WORK/vector.s tests/vector_sse2.c -o $WORK/vector_sse2
+$WORK/vector_sse2 > $WORK/vector_sse2.out
+check_output "vector.c with SSE2" tests/programs/vector.expected $WORK/vector_sse2.out
+
+# tail_calls.c's recursion only fits in the stack because its calls in
+# tail position, to the function itself and to the other one of a pair, are
+# jumps
+$MAIN tests/programs/tail_calls.c -o $WORK/tail_calls.s >/dev/null
+for callee in count_down is_odd is_even; do
+    grep -q "^	jmp $callee$" $WORK/tail_calls.s || fail "tail_calls.c call to $callee not a jump"
+done
+
+# loop_body <assembly> <function>: the instructions of the function's loops,
+# each from the label a backward jump goes to down to that jump
+loop_body()
+{
+    sed -n "/^$2:/,/^	\.text/p" $1 | awk '
+        /^\.L.*:$/ { start[substr($1, 1, length($1) - 1)] = NR }
+        { line[NR] = $0 }
+        /^	j/ && ($2 in start) { for (i = start[$2]; i <= NR; i++) print line[i] }'
+}
+
+# passes.c's calls to scale are inlined, which -O0 leaves alone. The xorq of
+# sum's invariant and the imulq by it are both before its loop, which
+# adds instead and ends by jumping back only while the condition holds
+$MAIN tests/programs/passes.c -o $WORK/passes.s >/dev/null
+$MAIN -O0 tests/programs/passes.c -o $WORK/passes_O0.s >/dev/null
+if grep -q "call scale" $WORK/passes.s || ! grep -q "call scale" $WORK/passes_O0.s; then
+    fail "passes.c calls to scale not inlined"
+fi
+loop_body $WORK/passes.s sum > $WORK/passes_loop.s
+if [ ! -s $WORK/passes_loop.s ] || grep -q xorq $WORK/passes_loop.s || ! grep -q xorq $WORK/passes.s; then
+    fail "passes.c invariant not hoisted out of the loop"
+fi
+if grep -q imulq $WORK/passes_loop.s || [ $(grep -c addq $WORK/passes_loop.s) -lt 2 ]; then
+    fail "passes.c multiplication in the loop not reduced to an addition"
+fi
+if ! tail -1 $WORK/passes_loop.s | grep -q "^	j[a-z]* " || tail -1 $WORK/passes_loop.s | grep -q "^	jmp "; then
+    fail "passes.c loop condition not tested at the bottom"
+fi
+
+# leftover_jumps <assembly>: "next" for every jmp to the code right after
+# it, "chain" for every jump to a label whose code is a jmp
+leftover_jumps()
+{
+    awk '
+        { line[NR] = $0 }
+        /^\.L.*:$/ { at[substr($1, 1, length($1) - 1)] = NR }
+        END {
+            for (i = 1; i <= NR; i++) {
+                if (line[i] !~ /^	j/) continue
+                split(line[i], jump, " ")
+                for (next_line = i + 1; line[next_line] ~ /^\.L.*:$/; next_line++)
+                    if (jump[1] == "jmp" && line[next_line] == jump[2] ":") print "next"
+                if (!(jump[2] in at)) continue
+                for (code = at[jump[2]] + 1; line[code] ~ /^\.L.*:$/; code++);
+                if (line[code] ~ /^	jmp [^*]/) print "chain"
+            }
+        }' $1
+}
+
+# jumps.c has both kinds of jumps at -O0. The peephole removes them there
+# and in every other program
+$MAIN -O0 tests/programs/jumps.c -o $WORK/jumps_O0.s >/dev/null
+if [ "$(leftover_jumps $WORK/jumps_O0.s | sort -u | tr '\n' ' ')" != "chain next " ]; then
+    fail "jumps.c at -O0 doesn't jump to a jump and to the next label"
+fi
+for program in tests/programs/*.c; do
+    name=$(basename $program .c)
+    if [ -n "$(leftover_jumps $WORK/$name.s)" ]; then
+        fail "$name jumps to a jump or to the next label"
+    fi
+done
+
+# Of constprop.c's functions, the static ones nothing calls are dropped,
+# and only scaled, which divides by the constant it's passed, is copied
+$MAIN tests/programs/constprop.c -o $WORK/constprop.s >/dev/null
+if [ "$(grep '^[a-z.]*:$' $WORK/constprop.s | tr '\n' ' ')" != "steps: scaled: scaled.constprop: mixed: down: reset: main: " ]; then
+    fail "constprop.c functions"
+fi
+grep -q "call scaled.constprop" $WORK/constprop.s || fail "constprop.c calls to the copy"
+
+# A profile written by an instrumented build is taken back without a
+# warning, changes the layout and not the output: unused() never runs, so
+# it goes after main. One from an older version of the source, or none at
+# all, is warned about and left out
+$MAIN -fprofile-generate=$WORK/profile.profile tests/profile.c -o $WORK/profile_generate.s >/dev/null
+gcc -no-pie $WORK/profile_generate.s -o $WORK/profile_generate
+$WORK/profile_generate > $WORK/profile.out
+check_output "profile.c instrumented" tests/profile.expected $WORK/profile.out
+$MAIN -fprofile-use=$WORK/profile.profile tests/profile.c -o $WORK/profile_use.s >/dev/null 2>$WORK/profile.err
+check_output "profile.c profile use warnings" /dev/null $WORK/profile.err
+gcc -no-pie $WORK/profile_use.s -o $WORK/profile_use
+$WORK/profile_use > $WORK/profile.out
+check_output "profile.c with its profile" tests/profile.expected $WORK/profile.out
+if [ "$(grep '^[a-z]*:$' $WORK/profile_use.s | tr -d '\n')" != "mix:main:unused:" ]; then
+    fail "profile.c function order"
+fi
+(cat tests/profile.c; echo "int extra() { return 1; }") > $WORK/profile_changed.c
+$MAIN -fprofile-use=$WORK/profile.profile $WORK/profile_changed.c -o $WORK/profile_changed.s 2>&1 >/dev/null |
+    grep -q "is not from this version" || fail "stale profile not warned about"
+$MAIN -fprofile-use=$WORK/missing.profile tests/profile.c -o $WORK/profile_missing.s 2>&1 >/dev/null |
+    grep -q "no profile" || fail "missing profile not warned about"
+
+# Besides functions, ifs and loops, a case counts how often the code after
+# it was reached, also by falling through, and && or || how often its right
+# operand ran. The counters follow the 3-word header of the profile. twice()
+# is inlined without a profile, but not into the || operand that never ran
+$MAIN -fprofile-generate=$WORK/profile_counts.profile tests/profile_counts.c -o $WORK/profile_counts.s >/dev/null
+gcc -no-pie $WORK/profile_counts.s -o $WORK/profile_counts
+$WORK/profile_counts >/dev/null
+od -An -td8 -w8 -v $WORK/profile_counts.profile | tr -s ' ' | sed 's/^ //' | tail -n +4 > $WORK/profile_counts.out
+check_output "profile_counts.c counters" tests/profile_counts.expected $WORK/profile_counts.out
+$MAIN -fprofile-use=$WORK/profile_counts.profile tests/profile_counts.c -o $WORK/profile_counts_use.s >/dev/null
+$MAIN tests/profile_counts.c -o $WORK/profile_counts_plain.s >/dev/null
+if ! grep -q "call twice" $WORK/profile_counts_use.s || grep -q "call twice" $WORK/profile_counts_plain.s; then
+    fail "profile_counts.c call in the || operand that never ran inlined"
+fi
+
+# Lexing in parallel chunks gives the tokens lexing serially does, also
+# when no thread can be started and every chunk is lexed on the main one
+./build/bench/gen_input mixed 1M > $WORK/large.c
+$MAIN $WORK/large.c -o $WORK/large_serial.s >/dev/null
+$MAIN --jobs 4 $WORK/large.c -o $WORK/large_jobs.s >/dev/null
+check_output "--jobs 4 output" $WORK/large_serial.s $WORK/large_jobs.s
+gcc -shared -fPIC tests/no_threads.c -o $WORK/no_threads.so
+LD_PRELOAD=$WORK/no_threads.so $MAIN --jobs 4 $WORK/large.c -o $WORK/large_no_threads.s >/dev/null
+check_output "--jobs 4 output without threads" $WORK/large_serial.s $WORK/large_no_threads.s
+
+# Compiling a file again takes the whole output from the cache as it was.
+# Editing one function only generates that one again, and the output is what
+# an uncached compile of the edited file gives. Functions cached by a .s
+# compile are also taken by a -c compile, which keeps its whole output apart
+# as an object. The build is part of every key, so all of these compiles are
+# by the one with tracing
+rm -rf $WORK/cache
+$WORK/main_trace --cache-dir $WORK/cache tests/programs/constprop.c -o $WORK/cache.s >/dev/null
+COMPILER_TRACE=2 $WORK/main_trace --cache-dir $WORK/cache tests/programs/constprop.c -o $WORK/cache_hit.s |
+    grep -q "cache_hit.s taken from the cache" || fail "second compile not taken from the cache"
+check_output "constprop.c from the cache" $WORK/cache.s $WORK/cache_hit.s
+sed 's/r \* 31/r * 37/' tests/programs/constprop.c > $WORK/cache_edited.c
+COMPILER_TRACE=2 $WORK/main_trace --cache-dir $WORK/cache $WORK/cache_edited.c -o $WORK/cache_edited.s |
+    grep -q "^function cache: 6 hits, 1 misses" || fail "editing mixed() didn't miss only mixed()"
+$WORK/main_trace $WORK/cache_edited.c -o $WORK/uncached_edited.s >/dev/null
+check_output "edited constprop.c from the function cache" $WORK/uncached_edited.s $WORK/cache_edited.s
+COMPILER_TRACE=2 $WORK/main_trace --cache-dir $WORK/cache -c tests/programs/constprop.c -o $WORK/cache.o |
+    grep -q "^function cache: [1-9][0-9]* hits, 0 misses" || fail "-c doesn't take the functions cached by .s"
+[ -n "$(ls $WORK/cache/objects/*.o 2>/dev/null)" ] || fail "-c output not cached as an object"
+gcc -no-pie $WORK/cache.o -o $WORK/cache_obj
+$WORK/cache_obj > $WORK/cache.out
+check_output "constprop.c (-c from the function cache)" tests/programs/constprop.expected $WORK/cache.out
+
+# --run calls the functions dlsym finds with the stack 16-byte aligned,
+# wherever the generated code has left it
+gcc -shared -fPIC tests/stack_offset.s -o $WORK/stack_offset.so
+LD_PRELOAD=$WORK/stack_offset.so $MAIN --run tests/jit_alignment.c > $WORK/jit_alignment.out
+check_output "--run stack alignment" tests/jit_alignment.expected $WORK/jit_alignment.out
+
+# Compiling through a compile server writes what compiling directly does,
+# and fails the same way with the same diagnostics
+rm -f $WORK/server.sock
+$MAIN --server $WORK/server.sock --threads 2 >/dev/null 2>&1 &
+server=$!
+while [ ! -S $WORK/server.sock ]; do sleep 0.05; done
+for program in tests/programs/constprop.c tests/programs/switch.c; do
+    name=$(basename $program .c)
+    $MAIN --connect $WORK/server.sock -o $WORK/server_$name.s $program >/dev/null
+    check_output "$name through the compile server" $WORK/$name.s $WORK/server_$name.s
+done
+for program in tests/errors/*.c; do
+    name=$(basename $program .c)
+    if $MAIN --connect $WORK/server.sock -o $WORK/server_$name.s $program >/dev/null 2>$WORK/server_$name.err; then
+        fail "$name compiled through the compile server"
+    fi
+    check_output "$name diagnostics through the compile server" tests/errors/$name.expected $WORK/server_$name.err
+done
+kill $server
+wait $server 2>/dev/null
+
+# A compile server that can't accept connections for a while, out of file
+# descriptors, says so and waits rather than spinning, and then serves
+gcc -shared -fPIC tests/accept_fails.c -o $WORK/accept_fails.so -ldl
+rm -f $WORK/accept.sock
+LD_PRELOAD=$WORK/accept_fails.so $MAIN --server $WORK/accept.sock --threads 1 >/dev/null 2>$WORK/accept.err &
+server=$!
+while [ ! -S $WORK/accept.sock ]; do sleep 0.05; done
+$MAIN --connect $WORK/accept.sock -o $WORK/accept.s tests/programs/basic.c >/dev/null 2>&1
+$MAIN tests/programs/basic.c -o $WORK/basic.s >/dev/null
+check_output "compile server after accept failures" $WORK/basic.s $WORK/accept.s
+kill $server
+wait $server 2>/dev/null
+errors=$(grep -c "^accept: Too many open files" $WORK/accept.err)
+if [ $errors -lt 1 ] || [ $errors -gt 10 ]; then
+    fail "compile server logged $errors accept failures in 300ms"
+fi
+
+# An AST file with any one node's type changed is either still a tree the
+# compiler can take or turned away as corrupt, never crashed on or hung on
+$MAIN --emit-ast tests/corrupt_ast.c -o $WORK/good.ast >/dev/null
+nodes=$(od -An -tu4 -j12 -N4 $WORK/good.ast)
+node=0
+while [ $node -lt $nodes ]; do
+    type=0
+    while [ $type -le 35 ]; do
+        cp $WORK/good.ast $WORK/corrupt.ast
+        printf "\\$(printf %o $type)" | dd of=$WORK/corrupt.ast bs=1 seek=$((32 + node * 32)) conv=notrunc 2>/dev/null
+        timeout 10 $MAIN $WORK/corrupt.ast -o $WORK/corrupt.s >/dev/null 2>&1
+        if [ $? -ge 124 ]; then
+            fail "AST file with node $node made type $type"
+        fi
+        type=$((type + 1))
+    done
+    node=$((node + 1))
+done
+
+if [ $failures -ne 0 ]; then
+    echo "$failures test(s) failed"
+    exit 1
+fi
+echo "all tests passed"
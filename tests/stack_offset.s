@@ -0,0 +1,9 @@
+# stack_offset() returns the stack pointer at the call modulo 16, which the
+# ABI wants to be 0. run_tests.sh preloads it into ./main for --run
+	.text
+	.globl stack_offset
+stack_offset:
+	leaq 8(%rsp), %rax
+	andq $15, %rax
+	ret
+	.section .note.GNU-stack,"",@progbits
@@ -0,0 +1,4 @@
+// Linked into a program to make its vector loops use SSE2 whatever the CPU
+// has: a definition of __vector_isa takes the place of the generated common
+// one, and a nonzero value is taken as already found out (see vectorize.c)
+long __vector_isa = 1;
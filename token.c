@@ -3,5 +3,73 @@
 
 bool is_token_keyword(struct token* token, char* keyword)
 {
-    return token->type == TOKEN_TYPE_OPERATOR && token->sval == keyword;
-}
\ No newline at end of file
+    return token && token->type == TOKEN_TYPE_OPERATOR && token->sval == keyword;
+}
+
+// Indexed by enum operator_kind. The parser drives precedence climbing
+// entirely off this table.
+const struct operator_info operator_table[OP_KIND_COUNT] = {
+    [OP_NONE]        = { "",   PREC_NONE,           false, false, false },
+    [OP_COMMA]       = { ",",  PREC_COMMA,          false, false, false },
+    [OP_ASSIGN]      = { "=",  PREC_ASSIGN,         true,  false, false },
+    [OP_ADD_ASSIGN]  = { "+=", PREC_ASSIGN,         true,  false, false },
+    [OP_SUB_ASSIGN]  = { "-=", PREC_ASSIGN,         true,  false, false },
+    [OP_MUL_ASSIGN]  = { "*=", PREC_ASSIGN,         true,  false, false },
+    [OP_DIV_ASSIGN]  = { "/=", PREC_ASSIGN,         true,  false, false },
+    [OP_LOGICAL_OR]  = { "||", PREC_LOGICAL_OR,     false, false, false },
+    [OP_LOGICAL_AND] = { "&&", PREC_LOGICAL_AND,    false, false, false },
+    [OP_BIT_OR]      = { "|",  PREC_BIT_OR,         false, false, false },
+    [OP_BIT_XOR]     = { "^",  PREC_BIT_XOR,        false, false, false },
+    [OP_BIT_AND]     = { "&",  PREC_BIT_AND,        false, true,  false },
+    [OP_EQ]          = { "==", PREC_EQUALITY,       false, false, false },
+    [OP_NE]          = { "!=", PREC_EQUALITY,       false, false, false },
+    [OP_LT]          = { "<",  PREC_RELATIONAL,     false, false, false },
+    [OP_GT]          = { ">",  PREC_RELATIONAL,     false, false, false },
+    [OP_LE]          = { "<=", PREC_RELATIONAL,     false, false, false },
+    [OP_GE]          = { ">=", PREC_RELATIONAL,     false, false, false },
+    [OP_SHL]         = { "<<", PREC_SHIFT,          false, false, false },
+    [OP_SHR]         = { ">>", PREC_SHIFT,          false, false, false },
+    [OP_ADD]         = { "+",  PREC_ADDITIVE,       false, true,  false },
+    [OP_SUB]         = { "-",  PREC_ADDITIVE,       false, true,  false },
+    [OP_MUL]         = { "*",  PREC_MULTIPLICATIVE, false, true,  false },
+    [OP_DIV]         = { "/",  PREC_MULTIPLICATIVE, false, false, false },
+    [OP_MOD]         = { "%",  PREC_MULTIPLICATIVE, false, false, false },
+    [OP_NOT]         = { "!",  PREC_NONE,           false, true,  false },
+    [OP_BIT_NOT]     = { "~",  PREC_NONE,           false, true,  false },
+    [OP_INCREMENT]   = { "++", PREC_NONE,           false, true,  true  },
+    [OP_DECREMENT]   = { "--", PREC_NONE,           false, true,  true  },
+    [OP_DOT]         = { ".",  PREC_NONE,           false, false, false },
+    [OP_ARROW]       = { "->", PREC_NONE,           false, false, false },
+    [OP_QUESTION]    = { "?",  PREC_NONE,           false, false, false },
+};
+
+// Classifies an operator token by its (at most three) characters without
+// going through strcmp
+enum operator_kind token_operator(struct token* token)
+{
+    if (!token || token->type != TOKEN_TYPE_OPERATOR) {
+        return OP_NONE;
+    }
+    const char* s = token->sval;
+    char second = s[0] ? s[1] : 0;
+    switch (s[0]) {
+        case ',': return OP_COMMA;
+        case '=': return second == '=' ? OP_EQ : OP_ASSIGN;
+        case '+': return second == '=' ? OP_ADD_ASSIGN : second == '+' ? OP_INCREMENT : OP_ADD;
+        case '-': return second == '=' ? OP_SUB_ASSIGN : second == '-' ? OP_DECREMENT :
+                         second == '>' ? OP_ARROW : OP_SUB;
+        case '*': return second == '=' ? OP_MUL_ASSIGN : OP_MUL;
+        case '/': return second == '=' ? OP_DIV_ASSIGN : OP_DIV;
+        case '%': return OP_MOD;
+        case '|': return second == '|' ? OP_LOGICAL_OR : OP_BIT_OR;
+        case '&': return second == '&' ? OP_LOGICAL_AND : OP_BIT_AND;
+        case '^': return OP_BIT_XOR;
+        case '!': return second == '=' ? OP_NE : OP_NOT;
+        case '~': return OP_BIT_NOT;
+        case '<': return second == '=' ? OP_LE : second == '<' ? OP_SHL : OP_LT;
+        case '>': return second == '=' ? OP_GE : second == '>' ? OP_SHR : OP_GT;
+        case '.': return OP_DOT;
+        case '?': return OP_QUESTION;
+    }
+    return OP_NONE;
+}
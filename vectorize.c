@@ -0,0 +1,403 @@
+// Vectorization of simple counted loops over arrays.
+//
+// vectorize_loops marks the while loops (for loops are while loops once
+// parsed) of the shape
+//
+//   while (i < n) { a[i] = b[i] + c[i] ^ k; c[i] -= 5; ...; i++; }
+//
+// where n is a constant or a variable, every statement but the last stores
+// to element i of an array, and the values stored combine elements i of
+// arrays, constants and variables with + - & | ^. Those are the operations
+// with a packed 64-bit form in both SSE2 and AVX2; there is no packed
+// 64-bit multiply before AVX-512. Only element i of any array is touched in
+// an iteration and no variable but i is written, so iterations can run side
+// by side, and statement by statement over several elements is the same as
+// element by element over the statements.
+//
+// For a marked loop the generator first calls generate_vector_loop, which
+// runs the loop four elements at a time on ymm registers when the CPU has
+// AVX2 and two at a time on xmm registers otherwise (SSE2 is part of
+// x86-64), while at least that many iterations are left. The scalar loop
+// after it does the rest. Variables and constants are broadcast to the top
+// registers once, before the loop; expressions are evaluated from the
+// bottom ones.
+//
+// cpuid takes microseconds in a virtual machine, where it traps to the
+// hypervisor, so which instructions to use is decided once: the answer is
+// kept in __vector_isa, a common .bss word, which is 0 until the first
+// vector loop runs.
+#include "compiler.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define VECTOR_REGISTERS 16
+// Values of __vector_isa
+#define VECTOR_ISA_SSE2 1
+#define VECTOR_ISA_AVX2 2
+
+// The parts of a marked loop
+struct vector_loop {
+    const char* counter;
+    struct ast_node* bound;
+    struct ast_node** statements;
+    int statement_count;
+    // Variables and constants, broadcast to registers 15, 14, ...
+    struct ast_node* invariants[VECTOR_REGISTERS];
+    int invariant_count;
+};
+
+static bool vector_is_counter(struct ast_node* node, const char* counter)
+{
+    return node->type == AST_IDENTIFIER && strcmp(node->id_literal.value, counter) == 0;
+}
+
+// array[counter]
+static bool vector_is_element(struct ast_node* node, const char* counter)
+{
+    return node->type == AST_ARRAY_ACCESS && node->array_access.array->type == AST_IDENTIFIER &&
+           !vector_is_counter(node->array_access.array, counter) && vector_is_counter(node->array_access.index, counter);
+}
+
+static bool vector_operator(enum operator_kind op)
+{
+    return op == OP_ADD || op == OP_SUB || op == OP_BIT_AND || op == OP_BIT_OR || op == OP_BIT_XOR;
+}
+
+// The register of invariant, added if it's new; -1 if there are too many
+static int vector_invariant(struct vector_loop* loop, struct ast_node* invariant)
+{
+    for (int i = 0; i < loop->invariant_count; i++) {
+        struct ast_node* existing = loop->invariants[i];
+        if (existing->type == invariant->type &&
+            (invariant->type == AST_NUMBER ? existing->number.value == invariant->number.value
+                                           : strcmp(existing->id_literal.value, invariant->id_literal.value) == 0)) {
+            return VECTOR_REGISTERS - 1 - i;
+        }
+    }
+    if (loop->invariant_count == VECTOR_REGISTERS) {
+        return -1;
+    }
+    loop->invariants[loop->invariant_count++] = invariant;
+    return VECTOR_REGISTERS - loop->invariant_count;
+}
+
+// Registers from the bottom that evaluating node takes, or -1 if it can't
+// be vectorized
+static int vector_registers(struct vector_loop* loop, struct ast_node* node)
+{
+    switch (node->type) {
+        case AST_NUMBER:
+            return vector_invariant(loop, node) < 0 ? -1 : 0;
+        case AST_IDENTIFIER:
+            if (vector_is_counter(node, loop->counter)) {
+                return -1;
+            }
+            return vector_invariant(loop, node) < 0 ? -1 : 0;
+        case AST_ARRAY_ACCESS:
+            return vector_is_element(node, loop->counter) ? 1 : -1;
+        case AST_BINARY_OP: {
+            if (!vector_operator(node->binary_op.op)) {
+                return -1;
+            }
+            // The left operand is evaluated into the result register, the
+            // right one above it
+            int left = vector_registers(loop, node->binary_op.left);
+            int right = vector_registers(loop, node->binary_op.right);
+            if (left < 0 || right < 0) {
+                return -1;
+            }
+            int registers = left > right + 1 ? left : right + 1;
+            return registers > 1 ? registers : 1;
+        }
+        default:
+            return -1;
+    }
+}
+
+// Fills in loop from a while loop of the right shape
+static bool vector_loop_parts(struct ast_node* node, struct vector_loop* loop)
+{
+    memset(loop, 0, sizeof(*loop));
+    struct ast_node* condition = node->while_loop.condition;
+    struct ast_node* body = node->while_loop.body;
+    if (condition->type != AST_BINARY_OP || condition->binary_op.op != OP_LT ||
+        condition->binary_op.left->type != AST_IDENTIFIER || body->type != AST_BLOCK || body->block.stmt_count < 2) {
+        return false;
+    }
+    loop->counter = condition->binary_op.left->id_literal.value;
+    loop->bound = condition->binary_op.right;
+    if (loop->bound->type != AST_NUMBER && (loop->bound->type != AST_IDENTIFIER || vector_is_counter(loop->bound, loop->counter))) {
+        return false;
+    }
+
+    // i++, ++i or i += 1 last
+    struct ast_node* update = body->block.statements[body->block.stmt_count - 1];
+    bool increments = (update->type == AST_UNARY_OP && update->unary_op.op == OP_INCREMENT &&
+                       vector_is_counter(update->unary_op.operand, loop->counter)) ||
+                      (update->type == AST_BINARY_OP && update->binary_op.op == OP_ADD_ASSIGN &&
+                       vector_is_counter(update->binary_op.left, loop->counter) &&
+                       update->binary_op.right->type == AST_NUMBER && update->binary_op.right->number.value == 1);
+    if (!increments) {
+        return false;
+    }
+    loop->statements = body->block.statements;
+    loop->statement_count = body->block.stmt_count - 1;
+
+    int registers = 0;
+    for (int i = 0; i < loop->statement_count; i++) {
+        struct ast_node* statement = loop->statements[i];
+        if (statement->type != AST_BINARY_OP || !vector_is_element(statement->binary_op.left, loop->counter)) {
+            return false;
+        }
+        int needed;
+        switch (statement->binary_op.op) {
+            case OP_ASSIGN:
+                needed = vector_registers(loop, statement->binary_op.right);
+                break;
+            case OP_ADD_ASSIGN:
+            case OP_SUB_ASSIGN:
+                // The element, then the value above it
+                needed = vector_registers(loop, statement->binary_op.right);
+                needed = needed < 0 ? -1 : needed + 1;
+                break;
+            default:
+                return false;
+        }
+        if (needed < 0) {
+            return false;
+        }
+        registers = needed > registers ? needed : registers;
+    }
+    return registers + loop->invariant_count <= VECTOR_REGISTERS;
+}
+
+static void vector_walk(struct ast_node* node)
+{
+    if (!node) {
+        return;
+    }
+    if (node->type == AST_WHILE || node->type == AST_WHILE_LOOP) {
+        struct vector_loop loop;
+        node->while_loop.vectorize = vector_loop_parts(node, &loop);
+    }
+    struct ast_node*** list;
+    int* count;
+    if (ast_node_list(node, &list, &count)) {
+        for (int i = 0; i < *count; i++) {
+            vector_walk((*list)[i]);
+        }
+    }
+    struct ast_node** slots[AST_MAX_SLOTS];
+    int slot_count = ast_node_slots(node, slots);
+    for (int i = 0; i < slot_count; i++) {
+        vector_walk(*slots[i]);
+    }
+}
+
+void vectorize_loops(struct ast_node* root)
+{
+    vector_walk(root);
+}
+
+// Code generation. %rcx holds the counter and %rdx the bound while the
+// vector loop runs
+
+struct vector_isa {
+    int width;
+    // Register prefix, "%xmm" or "%ymm"
+    const char* registers;
+    bool avx;
+};
+
+static const struct vector_isa vector_sse2 = { 2, "%xmm", false };
+static const struct vector_isa vector_avx2 = { 4, "%ymm", true };
+
+static const char* vector_instruction(enum operator_kind op, bool avx)
+{
+    switch (op) {
+        case OP_ADD: return avx ? "vpaddq" : "paddq";
+        case OP_SUB: return avx ? "vpsubq" : "psubq";
+        case OP_BIT_AND: return avx ? "vpand" : "pand";
+        case OP_BIT_OR: return avx ? "vpor" : "por";
+        default: return avx ? "vpxor" : "pxor";
+    }
+}
+
+// result = left op right, where result is where left was evaluated to
+static void vector_operation(FILE* output, const struct vector_isa* isa, enum operator_kind op, int left, int right, int result)
+{
+    const char* r = isa->registers;
+    if (isa->avx) {
+        fprintf(output, "\t%s %s%d, %s%d, %s%d\n", vector_instruction(op, true), r, right, r, left, r, result);
+        return;
+    }
+    if (left != result) {
+        fprintf(output, "\tmovdqa %s%d, %s%d\n", r, left, r, result);
+    }
+    fprintf(output, "\t%s %s%d, %s%d\n", vector_instruction(op, false), r, right, r, result);
+}
+
+static void vector_element(FILE* output, const struct vector_isa* isa, struct ast_node* element, int reg, bool store)
+{
+    int offset = get_array_offset(element->array_access.array->id_literal.value);
+    if (store) {
+        fprintf(output, "\t%s %s%d, %s\n", isa->avx ? "vmovdqu" : "movdqu", isa->registers, reg, local_address(offset, "%rcx"));
+    } else {
+        fprintf(output, "\t%s %s, %s%d\n", isa->avx ? "vmovdqu" : "movdqu", local_address(offset, "%rcx"), isa->registers, reg);
+    }
+}
+
+// Evaluates node into register free or above, and returns the register
+// that holds it
+static int vector_expression(FILE* output, const struct vector_isa* isa, struct vector_loop* loop, struct ast_node* node, int free)
+{
+    switch (node->type) {
+        case AST_NUMBER:
+        case AST_IDENTIFIER:
+            return vector_invariant(loop, node);
+        case AST_ARRAY_ACCESS:
+            vector_element(output, isa, node, free, false);
+            return free;
+        default: {
+            int left = vector_expression(output, isa, loop, node->binary_op.left, free);
+            int right = vector_expression(output, isa, loop, node->binary_op.right, free + 1);
+            vector_operation(output, isa, node->binary_op.op, left, right, free);
+            return free;
+        }
+    }
+}
+
+static void vector_body(FILE* output, const struct vector_isa* isa, struct vector_loop* loop)
+{
+    for (int i = 0; i < loop->statement_count; i++) {
+        struct ast_node* statement = loop->statements[i];
+        struct ast_node* element = statement->binary_op.left;
+        int result;
+        if (statement->binary_op.op == OP_ASSIGN) {
+            result = vector_expression(output, isa, loop, statement->binary_op.right, 0);
+        } else {
+            vector_element(output, isa, element, 0, false);
+            int value = vector_expression(output, isa, loop, statement->binary_op.right, 1);
+            vector_operation(output, isa, statement->binary_op.op == OP_ADD_ASSIGN ? OP_ADD : OP_SUB, 0, value, 0);
+            result = 0;
+        }
+        vector_element(output, isa, element, result, true);
+    }
+}
+
+// Loops over isa->width elements at a time while i < n and n - i >= width;
+// n - i is only trusted once i < n, where it can't come out negative
+// unless it overflowed
+static void vector_pass(FILE* output, const struct vector_isa* isa, struct vector_loop* loop, const char* done_label)
+{
+    for (int i = 0; i < loop->invariant_count; i++) {
+        struct ast_node* invariant = loop->invariants[i];
+        int reg = VECTOR_REGISTERS - 1 - i;
+        if (invariant->type == AST_NUMBER) {
+            fprintf(output, "\tmovq $%lld, %%rax\n", invariant->number.value);
+        } else {
+            fprintf(output, "\tmovq %s, %%rax\n", local_address(get_variable_offset(invariant->id_literal.value), NULL));
+        }
+        if (isa->avx) {
+            fprintf(output, "\tvmovq %%rax, %%xmm%d\n", reg);
+            fprintf(output, "\tvpbroadcastq %%xmm%d, %%ymm%d\n", reg, reg);
+        } else {
+            fprintf(output, "\tmovq %%rax, %%xmm%d\n", reg);
+            fprintf(output, "\tpunpcklqdq %%xmm%d, %%xmm%d\n", reg, reg);
+        }
+    }
+    char* body_label = generate_label();
+    char* test_label = generate_label();
+    char* exit_label = generate_label();
+    fprintf(output, "\tjmp %s\n", test_label);
+    generate_loop_alignment(output);
+    fprintf(output, "%s:\n", body_label);
+    vector_body(output, isa, loop);
+    fprintf(output, "\taddq $%d, %%rcx\n", isa->width);
+    fprintf(output, "%s:\n", test_label);
+    fprintf(output, "\tcmpq %%rdx, %%rcx\n");
+    fprintf(output, "\tjge %s\n", exit_label);
+    fprintf(output, "\tmovq %%rdx, %%rax\n");
+    fprintf(output, "\tsubq %%rcx, %%rax\n");
+    fprintf(output, "\tcmpq $%d, %%rax\n", isa->width);
+    fprintf(output, "\tjge %s\n", body_label);
+    fprintf(output, "%s:\n", exit_label);
+    if (isa->avx) {
+        // Leaving the upper halves dirty slows down any SSE code after
+        fprintf(output, "\tvzeroupper\n");
+    }
+    fprintf(output, "\tjmp %s\n", done_label);
+    free(body_label);
+    free(test_label);
+    free(exit_label);
+}
+
+// Leaves __vector_isa in %rax, finding it out on the first run: AVX2 needs
+// the CPU to have it (cpuid 7, %ebx bit 5) and the OS to save the ymm
+// registers (cpuid 1: OSXSAVE and AVX, then xgetbv: the SSE and AVX state)
+static void vector_dispatch(FILE* output)
+{
+    char* known_label = generate_label();
+    char* detected_label = generate_label();
+    // Every vector loop declares it. as takes a .comm again, but not for
+    // a .local symbol; copies in other objects merge, and all hold the
+    // same answer
+    fprintf(output, "\t.comm __vector_isa,8,8\n");
+    fprintf(output, "\tmovq __vector_isa(%%rip), %%rax\n");
+    fprintf(output, "\ttestq %%rax, %%rax\n");
+    fprintf(output, "\tjne %s\n", known_label);
+    // cpuid writes %rbx, which the caller expects to keep
+    fprintf(output, "\tpushq %%rbx\n");
+    fprintf(output, "\tmovq $%d, %%rsi\n", VECTOR_ISA_SSE2);
+    fprintf(output, "\tmovq $1, %%rax\n");
+    fprintf(output, "\tcpuid\n");
+    fprintf(output, "\tandq $402653184, %%rcx\n");
+    fprintf(output, "\tcmpq $402653184, %%rcx\n");
+    fprintf(output, "\tjne %s\n", detected_label);
+    fprintf(output, "\txorq %%rcx, %%rcx\n");
+    fprintf(output, "\txgetbv\n");
+    fprintf(output, "\tandq $6, %%rax\n");
+    fprintf(output, "\tcmpq $6, %%rax\n");
+    fprintf(output, "\tjne %s\n", detected_label);
+    fprintf(output, "\tmovq $7, %%rax\n");
+    fprintf(output, "\txorq %%rcx, %%rcx\n");
+    fprintf(output, "\tcpuid\n");
+    fprintf(output, "\ttestq $32, %%rbx\n");
+    fprintf(output, "\tje %s\n", detected_label);
+    fprintf(output, "\tmovq $%d, %%rsi\n", VECTOR_ISA_AVX2);
+    fprintf(output, "%s:\n", detected_label);
+    fprintf(output, "\tpopq %%rbx\n");
+    fprintf(output, "\tmovq %%rsi, __vector_isa(%%rip)\n");
+    fprintf(output, "\tmovq %%rsi, %%rax\n");
+    fprintf(output, "%s:\n", known_label);
+    free(known_label);
+    free(detected_label);
+}
+
+void generate_vector_loop(FILE* output, struct ast_node* node)
+{
+    struct vector_loop loop;
+    if (!vector_loop_parts(node, &loop)) {
+        compiler_error(NULL, "Error: Loop can't be vectorized\n");
+    }
+    char* sse2_label = generate_label();
+    char* done_label = generate_label();
+    int counter = get_variable_offset(loop.counter);
+
+    vector_dispatch(output);
+    if (loop.bound->type == AST_NUMBER) {
+        fprintf(output, "\tmovq $%lld, %%rdx\n", loop.bound->number.value);
+    } else {
+        fprintf(output, "\tmovq %s, %%rdx\n", local_address(get_variable_offset(loop.bound->id_literal.value), NULL));
+    }
+    fprintf(output, "\tmovq %s, %%rcx\n", local_address(counter, NULL));
+    fprintf(output, "\tcmpq $%d, %%rax\n", VECTOR_ISA_AVX2);
+    fprintf(output, "\tjne %s\n", sse2_label);
+    vector_pass(output, &vector_avx2, &loop, done_label);
+    fprintf(output, "%s:\n", sse2_label);
+    vector_pass(output, &vector_sse2, &loop, done_label);
+    fprintf(output, "%s:\n", done_label);
+    fprintf(output, "\tmovq %%rcx, %s\n", local_address(counter, NULL));
+    free(sse2_label);
+    free(done_label);
+}